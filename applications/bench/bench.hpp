@@ -0,0 +1,215 @@
+/**
+ * @file bench.hpp
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+#include <llri/llri.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <istream>
+#include <iterator>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace bench
+{
+    using clock = std::chrono::steady_clock;
+
+    inline double elapsed(clock::time_point start, clock::time_point end)
+    {
+        return std::chrono::duration<double, std::nano>(end - start).count();
+    }
+
+    /**
+     * @brief The summarized timings of a single benchmark, in nanoseconds per iteration.
+    */
+    struct result
+    {
+        std::string name;
+        size_t iterations = 0;
+        double mean = 0.0;
+        double median = 0.0;
+        double min = 0.0;
+        double p99 = 0.0;
+        double max = 0.0;
+        /**
+         * @brief Optional divisor to report a per-item time for benchmarks that process multiple items per iteration (e.g. barriers per resourceBarrier() call).
+        */
+        size_t itemsPerIteration = 1;
+        /**
+         * @brief The median of the benchmark with the same name in the --compare file, or 0.0 if there is none.
+        */
+        double baselineMedian = 0.0;
+        bool failed = false;
+    };
+
+    /**
+     * @brief Collects the duration of every iteration of a benchmark.
+    */
+    class samples
+    {
+    public:
+        explicit samples(std::string name, size_t reserve = 0) : m_name(std::move(name))
+        {
+            m_samples.reserve(reserve);
+        }
+
+        void add(double nanoseconds) { m_samples.push_back(nanoseconds); }
+        void add(clock::time_point start, clock::time_point end) { add(elapsed(start, end)); }
+        void fail() { m_failed = true; }
+
+        [[nodiscard]] result summarize(size_t itemsPerIteration = 1)
+        {
+            result output;
+            output.name = m_name;
+            output.itemsPerIteration = itemsPerIteration;
+            output.failed = m_failed || m_samples.empty();
+            if (output.failed)
+                return output;
+
+            std::sort(m_samples.begin(), m_samples.end());
+
+            double total = 0.0;
+            for (const double s : m_samples)
+                total += s;
+
+            const size_t count = m_samples.size();
+            output.iterations = count;
+            output.mean = total / static_cast<double>(count);
+            output.median = m_samples[count / 2];
+            output.min = m_samples.front();
+            output.p99 = m_samples[std::min(count - 1, (count * 99) / 100)];
+            output.max = m_samples.back();
+            return output;
+        }
+
+    private:
+        std::string m_name;
+        std::vector<double> m_samples;
+        bool m_failed = false;
+    };
+
+    /**
+     * @brief Returns the result with the lowest median of a and b. A failed result always wins, so a failure in any repetition is reported. A default constructed result never wins.
+    */
+    inline result fastest(const result& a, const result& b)
+    {
+        if (a.iterations == 0 && !a.failed)
+            return b;
+        if (b.iterations == 0 && !b.failed)
+            return a;
+        if (a.failed || b.failed)
+            return a.failed ? a : b;
+        return b.median < a.median ? b : a;
+    }
+
+    inline void writeString(std::ostream& stream, const std::string& str)
+    {
+        stream << '"';
+        for (const char c : str)
+        {
+            if (c == '"' || c == '\\')
+                stream << '\\' << c;
+            else if (static_cast<unsigned char>(c) < 0x20)
+                stream << ' ';
+            else
+                stream << c;
+        }
+        stream << '"';
+    }
+
+    inline void writeResult(std::ostream& stream, const result& r)
+    {
+        stream << R"({"name":)";
+        writeString(stream, r.name);
+
+        if (r.failed)
+        {
+            stream << R"(,"failed":true})";
+            return;
+        }
+
+        stream << R"(,"iterations":)" << r.iterations
+            << R"(,"meanNs":)" << r.mean
+            << R"(,"medianNs":)" << r.median
+            << R"(,"minNs":)" << r.min
+            << R"(,"p99Ns":)" << r.p99
+            << R"(,"maxNs":)" << r.max;
+
+        if (r.itemsPerIteration > 1)
+        {
+            stream << R"(,"itemsPerIteration":)" << r.itemsPerIteration
+                << R"(,"medianNsPerItem":)" << r.median / static_cast<double>(r.itemsPerIteration);
+        }
+
+        if (r.baselineMedian > 0.0)
+        {
+            stream << R"(,"baselineMedianNs":)" << r.baselineMedian
+                << R"(,"medianRatio":)" << r.median / r.baselineMedian;
+        }
+
+        stream << "}";
+    }
+
+    /**
+     * @brief The medians of the first run in a file written by llri_bench, keyed by benchmark name.
+    */
+    struct baseline
+    {
+        std::string validationLevel;
+        std::unordered_map<std::string, double> medians;
+    };
+
+    /**
+     * @brief Reads the output of llri_bench, only understanding the fields that writeResult() writes. Returns false if the stream doesn't contain any benchmarks.
+    */
+    inline bool readBaseline(std::istream& stream, baseline& output)
+    {
+        const std::string json { std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>() };
+
+        // reads the string value of key, starting at offset, and stops at limit
+        const auto readString = [&json](const std::string& key, size_t offset, size_t limit, std::string& value)
+        {
+            const size_t start = json.find("\"" + key + "\":\"", offset);
+            if (start == std::string::npos || start >= limit)
+                return false;
+
+            value.clear();
+            for (size_t i = start + key.size() + 4; i < json.size() && json[i] != '"'; i++)
+            {
+                if (json[i] == '\\' && i + 1 < json.size())
+                    i++;
+                value += json[i];
+            }
+            return true;
+        };
+
+        const size_t run = json.find(R"("benchmarks":[)");
+        if (run == std::string::npos)
+            return false;
+        // benchmark objects are flat, so the first "]" after the array start ends the run
+        const size_t runEnd = json.find(']', run);
+
+        readString("validationLevel", json.rfind('{', run), run, output.validationLevel);
+
+        for (size_t object = json.find('{', run); object < runEnd; object = json.find('{', object + 1))
+        {
+            const size_t objectEnd = json.find('}', object);
+            std::string name;
+            if (objectEnd == std::string::npos || !readString("name", object, objectEnd, name))
+                break;
+
+            const size_t median = json.find(R"("medianNs":)", object);
+            if (median < objectEnd)
+                output.medians[name] = std::strtod(json.c_str() + median + 11, nullptr);
+        }
+
+        return !output.medians.empty();
+    }
+}
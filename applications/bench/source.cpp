@@ -0,0 +1,598 @@
+/**
+ * @file source.cpp
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <llri/llri.hpp>
+#include <bench.hpp>
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+// Measures the CPU cost of LLRI calls for every validation_level and writes the results as JSON, to stdout or to the file passed with --output.
+// To compare against a build without any validation code, write the results of a build with LLRI_DISABLE_VALIDATION=ON to a file
+// and pass that file to a validated build with --compare. Every benchmark then also reports its median relative to the baseline,
+// and the ratios are printed to stderr. --compare may be passed multiple times, e.g. with the results of several runs of the baseline,
+// in which case every benchmark is compared against its fastest baseline run. On machines whose speed varies between runs (e.g. virtual machines),
+// the fastest of several runs of both builds gives a more reliable ratio than a single run of each.
+//
+// The benchmark doesn't create any windows or surfaces, so it can run headless on a software Vulkan implementation,
+// e.g. by pointing VK_ICD_FILENAMES to lavapipe's or SwiftShader's ICD json and passing --adapter llvmpipe or --adapter SwiftShader.
+// To measure LLRI's own overhead without any driver, e.g. on CI machines without a Vulkan loader, configure with LLRI_SELECTED_APP_IMPLEMENTATION=llri-null.
+//
+// usage: llri_bench [--output <file>] [--compare <file>]... [--adapter <name>] [--validation <Disabled|Basic|Full>]
+
+namespace
+{
+    constexpr size_t warmupIterations = 100;
+    constexpr size_t iterations = 10000;
+    constexpr size_t submitIterations = 1000;
+    constexpr size_t coldIterations = 20;
+    constexpr size_t resourceBatchSize = 64;
+    constexpr size_t resourceBatches = 250;
+    constexpr size_t resourceRepetitions = 20;
+    constexpr size_t resourceWarmupBatches = 10;
+    constexpr size_t frameResourceCount = 64;
+    constexpr std::array<uint32_t, 5> barrierCounts { 1, 10, 100, 1000, 10000 };
+
+    struct options
+    {
+        std::string output;
+        std::string adapter;
+        std::vector<llri::validation_level> levels;
+        bench::baseline baseline;
+    };
+
+    void callback(llri::message_severity severity, llri::message_source source, const char* message, [[maybe_unused]] void* userData)
+    {
+        if (severity <= llri::message_severity::Info)
+            return;
+
+        // stdout may contain the JSON output, so messages go to stderr
+        std::cerr << "LLRI " << to_string(source) << " " << to_string(severity) << ": " << message << "\n";
+    }
+
+    /**
+     * @brief Returns the first adapter whose name contains name, or the first adapter if name is empty. Returns nullptr if no adapter matches.
+    */
+    llri::Adapter* selectAdapter(llri::Instance* instance, const std::string& name)
+    {
+        std::vector<llri::Adapter*> adapters;
+        if (instance->enumerateAdapters(&adapters) != llri::result::Success)
+            return nullptr;
+
+        for (llri::Adapter* adapter : adapters)
+        {
+            if (name.empty() || adapter->queryInfo().adapterName.find(name) != std::string::npos)
+                return adapter;
+        }
+
+        return nullptr;
+    }
+
+    llri::Instance* createInstance(llri::validation_level level)
+    {
+        llri::instance_desc instanceDesc { 0, nullptr, "llri_bench" };
+        instanceDesc.validationLevel = level;
+
+        llri::Instance* instance = nullptr;
+        if (llri::createInstance(instanceDesc, &instance) != llri::result::Success)
+            return nullptr;
+        return instance;
+    }
+
+    /**
+     * @brief A createResource() / destroyResource() benchmark, with the fastest repetition that has been measured so far.
+    */
+    struct resource_benchmark
+    {
+        std::string name;
+        llri::resource_desc desc;
+        bench::result fastestCreate;
+        bench::result fastestDestroy;
+    };
+
+    /**
+     * @brief Times a single repetition of createResource() and destroyResource() for the benchmark's desc, and keeps it if it is the fastest repetition so far.
+     * A single call takes a few hundred nanoseconds on llri-null, which is close to the cost of reading the clock, so every sample times a batch of
+     * resourceBatchSize calls and stores the time per call.
+    */
+    void benchmarkResourceRepetition(llri::Device* device, resource_benchmark& benchmark)
+    {
+        std::array<llri::Resource*, resourceBatchSize> resources {};
+
+        bench::samples create("resource/" + benchmark.name + "/create", resourceBatches);
+        bench::samples destroy("resource/" + benchmark.name + "/destroy", resourceBatches);
+
+        for (size_t i = 0; i < resourceWarmupBatches + resourceBatches; i++)
+        {
+            llri::result r = llri::result::Success;
+
+            const auto start = bench::clock::now();
+            for (size_t j = 0; j < resourceBatchSize && r == llri::result::Success; j++)
+                r = device->createResource(benchmark.desc, &resources[j]);
+            const auto created = bench::clock::now();
+
+            for (llri::Resource* resource : resources)
+                device->destroyResource(resource);
+            const auto destroyed = bench::clock::now();
+            resources.fill(nullptr);
+
+            if (r != llri::result::Success)
+            {
+                create.fail();
+                destroy.fail();
+                break;
+            }
+
+            if (i >= resourceWarmupBatches)
+            {
+                create.add(bench::elapsed(start, created) / static_cast<double>(resourceBatchSize));
+                destroy.add(bench::elapsed(created, destroyed) / static_cast<double>(resourceBatchSize));
+            }
+        }
+
+        benchmark.fastestCreate = bench::fastest(benchmark.fastestCreate, create.summarize());
+        benchmark.fastestDestroy = bench::fastest(benchmark.fastestDestroy, destroy.summarize());
+    }
+
+    /**
+     * @brief Times createResource() and destroyResource() separately for a buffer, an upload buffer and a texture.
+     * The benchmarks are repeated resourceRepetitions times, taking turns so that every benchmark is measured throughout the run, and each reports its repetition with the lowest median.
+     * This filters out repetitions that were slowed down by the scheduler, by another process, or by a lower clock speed, which would otherwise make the difference between validation levels
+     * smaller than the difference between two runs.
+    */
+    void benchmarkResources(llri::Device* device, std::vector<bench::result>& results)
+    {
+        llri::resource_desc texture {};
+        texture.type = llri::resource_type::Texture2D;
+        texture.usage = llri::resource_usage_flag_bits::Sampled | llri::resource_usage_flag_bits::TransferDst;
+        texture.memoryType = llri::memory_type::Local;
+        texture.initialState = llri::resource_state::TransferDst;
+        texture.width = 256;
+        texture.height = 256;
+        texture.depthOrArrayLayers = 1;
+        texture.mipLevels = 1;
+        texture.sampleCount = llri::sample_count::Count1;
+        texture.textureFormat = llri::format::RGBA8UNorm;
+
+        std::array<resource_benchmark, 3> benchmarks {{
+            { "buffer", llri::resource_desc::buffer(llri::resource_usage_flag_bits::TransferDst, llri::memory_type::Local, llri::resource_state::TransferDst, 1024), {}, {} },
+            { "uploadBuffer", llri::resource_desc::buffer(llri::resource_usage_flag_bits::TransferSrc, llri::memory_type::Upload, llri::resource_state::Upload, 1024), {}, {} },
+            { "texture2D", texture, {}, {} }
+        }};
+
+        for (size_t repetition = 0; repetition < resourceRepetitions; repetition++)
+        {
+            for (auto& benchmark : benchmarks)
+                benchmarkResourceRepetition(device, benchmark);
+        }
+
+        for (const auto& benchmark : benchmarks)
+        {
+            results.push_back(benchmark.fastestCreate);
+            results.push_back(benchmark.fastestDestroy);
+        }
+    }
+
+    /**
+     * @brief Times a single resourceBarrier() call with n barriers, for every n in barrierCounts.
+    */
+    void benchmarkBarriers(llri::Device* device, llri::CommandGroup* group, llri::CommandList* list, std::vector<bench::result>& results)
+    {
+        const auto desc = llri::resource_desc::buffer(llri::resource_usage_flag_bits::ShaderWrite, llri::memory_type::Local, llri::resource_state::ShaderReadWrite, 1024);
+
+        llri::Resource* buffer = nullptr;
+        const bool created = device->createResource(desc, &buffer) == llri::result::Success;
+
+        for (const uint32_t count : barrierCounts)
+        {
+            bench::samples samples("resourceBarrier/" + std::to_string(count));
+            if (!created)
+            {
+                samples.fail();
+                results.push_back(samples.summarize(count));
+                continue;
+            }
+
+            const std::vector<llri::resource_barrier> barriers(count, llri::resource_barrier::read_write(buffer));
+            const size_t n = std::clamp<size_t>(iterations / count, 10, 1000);
+
+            for (size_t i = 0; i < warmupIterations + n; i++)
+            {
+                if (group->reset() != llri::result::Success || list->begin(llri::command_list_begin_desc {}) != llri::result::Success)
+                {
+                    samples.fail();
+                    break;
+                }
+
+                const auto start = bench::clock::now();
+                const llri::result r = list->resourceBarrier(count, barriers.data());
+                const auto end = bench::clock::now();
+
+                if (list->end() != llri::result::Success || r != llri::result::Success)
+                {
+                    samples.fail();
+                    break;
+                }
+
+                if (i >= warmupIterations)
+                    samples.add(start, end);
+            }
+
+            results.push_back(samples.summarize(count));
+        }
+
+        device->destroyResource(buffer);
+    }
+
+    /**
+     * @brief Times the round trip of submitting an empty CommandList with a Fence and waiting for that Fence.
+    */
+    void benchmarkSubmit(llri::Device* device, llri::Queue* queue, llri::CommandGroup* group, llri::CommandList* list, std::vector<bench::result>& results)
+    {
+        bench::samples samples("submit/fenceRoundTrip", submitIterations);
+
+        llri::Fence* fence = nullptr;
+        if (group->reset() != llri::result::Success ||
+            list->begin(llri::command_list_begin_desc {}) != llri::result::Success ||
+            list->end() != llri::result::Success ||
+            device->createFence(llri::fence_flag_bits::None, &fence) != llri::result::Success)
+        {
+            samples.fail();
+            results.push_back(samples.summarize());
+            return;
+        }
+
+        const llri::submit_desc desc { 0, 1, &list, 0, nullptr, 0, nullptr, fence };
+        for (size_t i = 0; i < warmupIterations + submitIterations; i++)
+        {
+            const auto start = bench::clock::now();
+            if (queue->submit(desc) != llri::result::Success || device->waitFence(fence, LLRI_TIMEOUT_MAX) != llri::result::Success)
+            {
+                samples.fail();
+                break;
+            }
+            const auto end = bench::clock::now();
+
+            if (i >= warmupIterations)
+                samples.add(start, end);
+        }
+
+        device->destroyFence(fence);
+        results.push_back(samples.summarize());
+    }
+
+    /**
+     * @brief Times a complete frame on the CPU: resetting the CommandGroup, recording a CommandList with a barrier for every resource, submitting it with a Fence and waiting for that Fence.
+     * On llri-null this measures LLRI's own per-frame overhead, because no work is done by a driver or GPU.
+    */
+    void benchmarkFrameLoop(llri::Device* device, llri::Queue* queue, llri::CommandGroup* group, llri::CommandList* list, std::vector<bench::result>& results)
+    {
+        bench::samples samples("frame/loop", submitIterations);
+
+        const auto desc = llri::resource_desc::buffer(llri::resource_usage_flag_bits::ShaderWrite, llri::memory_type::Local, llri::resource_state::ShaderReadWrite, 1024);
+
+        std::vector<llri::resource_barrier> barriers;
+        for (size_t i = 0; i < frameResourceCount; i++)
+        {
+            llri::Resource* buffer = nullptr;
+            if (device->createResource(desc, &buffer) != llri::result::Success)
+                break;
+            barriers.push_back(llri::resource_barrier::read_write(buffer));
+        }
+
+        llri::Fence* fence = nullptr;
+        if (barriers.size() != frameResourceCount || device->createFence(llri::fence_flag_bits::None, &fence) != llri::result::Success)
+            samples.fail();
+
+        const llri::submit_desc submitDesc { 0, 1, &list, 0, nullptr, 0, nullptr, fence };
+        for (size_t i = 0; fence && i < warmupIterations + submitIterations; i++)
+        {
+            const auto start = bench::clock::now();
+            if (group->reset() != llri::result::Success ||
+                list->begin(llri::command_list_begin_desc {}) != llri::result::Success ||
+                list->resourceBarrier(static_cast<uint32_t>(barriers.size()), barriers.data()) != llri::result::Success ||
+                list->end() != llri::result::Success ||
+                queue->submit(submitDesc) != llri::result::Success ||
+                device->waitFence(fence, LLRI_TIMEOUT_MAX) != llri::result::Success)
+            {
+                samples.fail();
+                break;
+            }
+            const auto end = bench::clock::now();
+
+            if (i >= warmupIterations)
+                samples.add(start, end);
+        }
+
+        device->destroyFence(fence);
+        for (const auto& barrier : barriers)
+            device->destroyResource(barrier.rw.resource);
+
+        results.push_back(samples.summarize());
+    }
+
+    /**
+     * @brief Times CommandGroup::allocate(), CommandGroup::reset() and CommandGroup::free() separately.
+    */
+    void benchmarkCommandLists(llri::CommandGroup* group, std::vector<bench::result>& results)
+    {
+        bench::samples allocate("commandList/allocate", iterations);
+        bench::samples reset("commandList/reset", iterations);
+        bench::samples free("commandList/free", iterations);
+
+        const llri::command_list_alloc_desc desc { 0, llri::command_list_usage::Direct };
+        for (size_t i = 0; i < warmupIterations + iterations; i++)
+        {
+            llri::CommandList* list = nullptr;
+
+            const auto start = bench::clock::now();
+            const llri::result allocated = group->allocate(desc, &list);
+            const auto afterAllocate = bench::clock::now();
+            const llri::result wasReset = allocated == llri::result::Success ? group->reset() : allocated;
+            const auto afterReset = bench::clock::now();
+            const llri::result freed = wasReset == llri::result::Success ? group->free(list) : wasReset;
+            const auto afterFree = bench::clock::now();
+
+            if (freed != llri::result::Success)
+            {
+                allocate.fail();
+                reset.fail();
+                free.fail();
+                break;
+            }
+
+            if (i >= warmupIterations)
+            {
+                allocate.add(start, afterAllocate);
+                reset.add(afterAllocate, afterReset);
+                free.add(afterReset, afterFree);
+            }
+        }
+
+        results.push_back(allocate.summarize());
+        results.push_back(reset.summarize());
+        results.push_back(free.summarize());
+    }
+
+    /**
+     * @brief Times queryFormatProperties() on a freshly enumerated Adapter (cold) and on an Adapter that already cached its format properties (warm).
+    */
+    void benchmarkFormatProperties(llri::validation_level level, const options& opts, llri::Adapter* adapter, std::vector<bench::result>& results)
+    {
+        bench::samples cold("queryFormatProperties/cold", coldIterations);
+        for (size_t i = 0; i < coldIterations; i++)
+        {
+            llri::Instance* instance = createInstance(level);
+            llri::Adapter* fresh = instance ? selectAdapter(instance, opts.adapter) : nullptr;
+            if (!fresh)
+            {
+                cold.fail();
+                llri::destroyInstance(instance);
+                break;
+            }
+
+            const auto start = bench::clock::now();
+            [[maybe_unused]] const auto& properties = fresh->queryFormatProperties();
+            const auto end = bench::clock::now();
+            cold.add(start, end);
+
+            llri::destroyInstance(instance);
+        }
+        results.push_back(cold.summarize());
+
+        bench::samples warm("queryFormatProperties/warm", iterations);
+        [[maybe_unused]] const auto& cached = adapter->queryFormatProperties();
+        for (size_t i = 0; i < iterations; i++)
+        {
+            const auto start = bench::clock::now();
+            [[maybe_unused]] const auto& properties = adapter->queryFormatProperties(llri::format::RGBA8UNorm);
+            const auto end = bench::clock::now();
+            warm.add(start, end);
+        }
+        results.push_back(warm.summarize());
+    }
+
+    llri::queue_type selectQueueType(llri::Adapter* adapter)
+    {
+        if (adapter->queryQueueCount(llri::queue_type::Graphics) > 0)
+            return llri::queue_type::Graphics;
+        return llri::queue_type::Compute;
+    }
+
+    /**
+     * @brief Runs all benchmarks on the selected adapter with an Instance created with the given validation level, and writes them as a JSON object.
+    */
+    bool run(llri::validation_level level, const options& opts, std::ostream& stream)
+    {
+        llri::Instance* instance = createInstance(level);
+        if (!instance)
+        {
+            std::cerr << "llri_bench: failed to create an Instance\n";
+            return false;
+        }
+
+        llri::Adapter* adapter = selectAdapter(instance, opts.adapter);
+        if (!adapter || adapter->queryQueueCount(selectQueueType(adapter)) == 0)
+        {
+            std::cerr << "llri_bench: no suitable adapter found\n";
+            llri::destroyInstance(instance);
+            return false;
+        }
+
+        const llri::queue_type queueType = selectQueueType(adapter);
+        std::array<llri::queue_desc, 1> queues { llri::queue_desc { queueType, llri::queue_priority::Normal } };
+        const llri::device_desc deviceDesc { adapter, llri::adapter_features{}, 0, nullptr, static_cast<uint32_t>(queues.size()), queues.data() };
+
+        llri::Device* device = nullptr;
+        llri::CommandGroup* group = nullptr;
+        llri::CommandList* list = nullptr;
+        if (instance->createDevice(deviceDesc, &device) != llri::result::Success ||
+            device->createCommandGroup(queueType, &group) != llri::result::Success ||
+            group->allocate(llri::command_list_alloc_desc { 0, llri::command_list_usage::Direct }, &list) != llri::result::Success)
+        {
+            std::cerr << "llri_bench: failed to create a Device\n";
+            if (device)
+            {
+                device->destroyCommandGroup(group);
+                instance->destroyDevice(device);
+            }
+            llri::destroyInstance(instance);
+            return false;
+        }
+
+        std::vector<bench::result> results;
+        benchmarkResources(device, results);
+        benchmarkBarriers(device, group, list, results);
+        benchmarkSubmit(device, device->getQueue(queueType, 0), group, list, results);
+        benchmarkFrameLoop(device, device->getQueue(queueType, 0), group, list, results);
+
+        // allocate/reset/free with an otherwise empty group
+        group->free(list);
+        benchmarkCommandLists(group, results);
+
+        benchmarkFormatProperties(level, opts, adapter, results);
+
+        for (auto& r : results)
+        {
+            const auto it = opts.baseline.medians.find(r.name);
+            if (r.failed || it == opts.baseline.medians.end() || it->second <= 0.0)
+                continue;
+
+            r.baselineMedian = it->second;
+            std::cerr << to_string(level) << " " << r.name << ": " << r.median / r.baselineMedian << "x ("
+                << r.median << " ns vs " << r.baselineMedian << " ns)\n";
+        }
+
+        const llri::adapter_info info = adapter->queryInfo();
+        stream << R"({"adapter":)";
+        bench::writeString(stream, info.adapterName);
+        stream << R"(,"adapterType":)";
+        bench::writeString(stream, to_string(info.adapterType));
+#ifdef LLRI_DETAIL_ENABLE_VALIDATION
+        stream << R"(,"validationLevel":)";
+        bench::writeString(stream, to_string(level));
+#else
+        stream << R"(,"validationLevel":"CompiledOut")";
+#endif
+        stream << R"(,"queueType":)";
+        bench::writeString(stream, to_string(queueType));
+        stream << R"(,"benchmarks":[)";
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            stream << (i == 0 ? "\n" : ",\n");
+            bench::writeResult(stream, results[i]);
+        }
+        stream << "\n]}";
+
+        device->destroyCommandGroup(group);
+        instance->destroyDevice(device);
+        llri::destroyInstance(instance);
+        return true;
+    }
+
+    bool parseValidationLevel(const char* str, llri::validation_level& level)
+    {
+        for (uint8_t i = 0; i <= static_cast<uint8_t>(llri::validation_level::MaxEnum); i++)
+        {
+            if (to_string(static_cast<llri::validation_level>(i)) == str)
+            {
+                level = static_cast<llri::validation_level>(i);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool parseOptions(int argc, char** argv, options& opts)
+    {
+        for (int i = 1; i < argc; i++)
+        {
+            const bool hasValue = i + 1 < argc;
+            if (std::strcmp(argv[i], "--output") == 0 && hasValue)
+                opts.output = argv[++i];
+            else if (std::strcmp(argv[i], "--compare") == 0 && hasValue)
+            {
+                std::ifstream file(argv[++i]);
+                bench::baseline baseline;
+                if (!file || !bench::readBaseline(file, baseline))
+                {
+                    std::cerr << "llri_bench: failed to read benchmarks from " << argv[i] << "\n";
+                    return false;
+                }
+
+                if (baseline.validationLevel != "CompiledOut")
+                    std::cerr << "llri_bench: " << argv[i] << " wasn't written by a build with LLRI_DISABLE_VALIDATION=ON\n";
+
+                // with multiple baseline files, each benchmark compares against its fastest baseline run
+                for (const auto& [name, median] : baseline.medians)
+                {
+                    const auto it = opts.baseline.medians.find(name);
+                    if (it == opts.baseline.medians.end() || median < it->second)
+                        opts.baseline.medians[name] = median;
+                }
+            }
+            else if (std::strcmp(argv[i], "--adapter") == 0 && hasValue)
+                opts.adapter = argv[++i];
+            else if (std::strcmp(argv[i], "--validation") == 0 && hasValue)
+            {
+                llri::validation_level level;
+                if (!parseValidationLevel(argv[++i], level))
+                    return false;
+                opts.levels.push_back(level);
+            }
+            else
+                return false;
+        }
+
+#ifdef LLRI_DETAIL_ENABLE_VALIDATION
+        if (opts.levels.empty())
+            opts.levels = { llri::validation_level::Disabled, llri::validation_level::Basic, llri::validation_level::Full };
+#else
+        // validation_level has no effect without validation code, so a single run is enough
+        opts.levels = { llri::validation_level::Disabled };
+#endif
+        return true;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    options opts;
+    if (!parseOptions(argc, argv, opts))
+    {
+        std::cerr << "usage: llri_bench [--output <file>] [--compare <file>]... [--adapter <name>] [--validation <Disabled|Basic|Full>]\n";
+        return -1;
+    }
+
+    llri::setMessageCallback(&callback);
+
+    std::ofstream file;
+    if (!opts.output.empty())
+    {
+        file.open(opts.output);
+        if (!file)
+        {
+            std::cerr << "llri_bench: failed to open " << opts.output << "\n";
+            return -1;
+        }
+    }
+    std::ostream& stream = opts.output.empty() ? std::cout : file;
+
+    stream << R"({"implementation":)";
+    bench::writeString(stream, to_string(llri::getImplementation()));
+    stream << R"(,"runs":[)";
+
+    for (size_t i = 0; i < opts.levels.size(); i++)
+    {
+        stream << (i == 0 ? "\n" : ",\n");
+        if (!run(opts.levels[i], opts, stream))
+            return -1;
+    }
+
+    stream << "\n]}\n";
+    return 0;
+}
@@ -343,6 +343,7 @@ void createResources()
     textureDesc.mipLevels = 1;
     textureDesc.sampleCount = llri::sample_count::Count1;
     textureDesc.textureFormat = llri::format::RGBA8sRGB;
+    textureDesc.sharingMode = llri::resource_sharing_mode::Exclusive;
 
     THROW_IF_FAILED(m_device->createResource(textureDesc, &m_texture));
 }
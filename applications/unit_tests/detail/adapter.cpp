@@ -49,15 +49,46 @@ TEST_CASE("Adapter")
             }
         }
 
+        SUBCASE("Adapter::queryQueueFamilies()")
+        {
+            const auto families = adapter->queryQueueFamilies();
+
+            // every queue_type with queues has exactly one selected family, which reports the same count as queryQueueCount()
+            for (uint8_t type = 0; type <= static_cast<uint8_t>(llri::queue_type::MaxEnum); type++)
+            {
+                const auto queueType = static_cast<llri::queue_type>(type);
+                const auto selected = std::count_if(families.begin(), families.end(), [queueType](const llri::queue_family_info& family) { return family.type == queueType && family.selected; });
+                CHECK_EQ(selected, adapter->queryQueueCount(queueType) > 0 ? 1 : 0);
+
+                for (const auto& family : families)
+                {
+                    if (family.type == queueType && family.selected)
+                        CHECK_EQ(family.queueCount, adapter->queryQueueCount(queueType));
+                }
+            }
+
+            for (const auto& family : families)
+            {
+                CHECK_LE(family.type, llri::queue_type::MaxEnum);
+                CHECK_GT(family.queueCount, 0);
+            }
+        }
+
         SUBCASE("Adapter::queryFormatProperties()")
         {
-            auto props = adapter->queryFormatProperties();
-            CHECK_FALSE(props.empty());
+            const auto& props = adapter->queryFormatProperties();
             CHECK_EQ(props.size(), static_cast<size_t>(llri::format::MaxEnum) + 1);
 
             for (uint8_t f = 0; f <= static_cast<uint8_t>(llri::format::MaxEnum); f++)
             {
-                CHECK_NE(props.find(static_cast<llri::format>(f)), props.end());
+                const auto& formatProps = adapter->queryFormatProperties(static_cast<llri::format>(f));
+
+                // single format queries return a reference into the cached table
+                CHECK_EQ(&formatProps, &props[f]);
+                CHECK_FALSE(formatProps.supportsType(llri::resource_type::Buffer));
+                CHECK_FALSE(formatProps.supportsType(static_cast<llri::resource_type>(std::numeric_limits<uint8_t>::max())));
+                CHECK_FALSE(formatProps.supportsSampleCount(static_cast<llri::sample_count>(3)));
+                CHECK_FALSE(formatProps.supportsSampleCount(static_cast<llri::sample_count>(0)));
             }
         }
     });
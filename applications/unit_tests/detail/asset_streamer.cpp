@@ -0,0 +1,170 @@
+/**
+ * @file asset_streamer.cpp
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <llri/asset.hpp>
+#include <helpers.hpp>
+#include <doctest/doctest.h>
+
+#include <atomic>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace
+{
+    // run-length encoding as (count, value) pairs, which stands in for LZ4 or zstd
+    std::vector<uint8_t> compress(const uint8_t* data, size_t size)
+    {
+        std::vector<uint8_t> output;
+        for (size_t i = 0; i < size;)
+        {
+            uint8_t count = 1;
+            while (i + count < size && count < UINT8_MAX && data[i + count] == data[i])
+                count++;
+
+            output.push_back(count);
+            output.push_back(data[i]);
+            i += count;
+        }
+        return output;
+    }
+
+    bool decompress(const void* source, size_t sourceSize, void* destination, size_t destinationSize, void* userData)
+    {
+        static_cast<std::atomic<uint32_t>*>(userData)->fetch_add(1);
+
+        const auto* src = static_cast<const uint8_t*>(source);
+        auto* dst = static_cast<uint8_t*>(destination);
+
+        size_t written = 0;
+        for (size_t i = 0; i + 1 < sourceSize; i += 2)
+        {
+            if (written + src[i] > destinationSize)
+                return false;
+
+            std::memset(dst + written, src[i + 1], src[i]);
+            written += src[i];
+        }
+        return written == destinationSize;
+    }
+}
+
+TEST_CASE("asset_streamer")
+{
+    auto* instance = detail::defaultInstance();
+
+    // the source file holds a small header followed by two compressed chunks of half the buffer each
+    constexpr uint32_t size = 4 * 1024;
+    std::vector<uint8_t> expected(size);
+    for (size_t i = 0; i < expected.size(); i++)
+        expected[i] = static_cast<uint8_t>(i / 100 * 3);
+
+    const std::vector<uint8_t> first = compress(expected.data(), size / 2);
+    const std::vector<uint8_t> second = compress(expected.data() + size / 2, size / 2);
+    const std::string path = (std::filesystem::temp_directory_path() / "llri_asset_streamer.bin").string();
+    {
+        std::ofstream stream(path, std::ios::binary);
+        stream.write("LLRI asset", 10);
+        stream.write(reinterpret_cast<const char*>(first.data()), static_cast<std::streamsize>(first.size()));
+        stream.write(reinterpret_cast<const char*>(second.data()), static_cast<std::streamsize>(second.size()));
+    }
+
+    const std::array<llri::compressed_chunk, 2> chunks {
+        llri::compressed_chunk { 10, first.size(), 0, size / 2 },
+        llri::compressed_chunk { 10 + first.size(), second.size(), size / 2, size / 2 }
+    };
+
+    detail::iterateAdapters(instance, [instance, &expected, &path, &chunks](llri::Adapter* adapter) {
+        if (adapter->queryQueueCount(llri::queue_type::Graphics) == 0)
+            return;
+
+        auto* device = detail::defaultDevice(instance, adapter);
+
+        llri::Resource* buffer;
+        REQUIRE_EQ(device->createResource(llri::resource_desc::buffer(llri::resource_usage_flag_bits::TransferSrc | llri::resource_usage_flag_bits::TransferDst, llri::memory_type::Local, llri::resource_state::ShaderReadOnly, size), &buffer), llri::result::Success);
+
+        // both chunks don't fit in the staging buffer together, so they're flushed separately
+        llri::streaming_uploader uploader;
+        REQUIRE_EQ(uploader.create(device, llri::streaming_uploader_desc { 3 * 1024, 0, llri::queue_type::Graphics, 0 }), llri::result::Success);
+
+        std::atomic<uint32_t> calls { 0 };
+        const llri::asset_streamer_desc desc { &uploader, 2, &decompress, &calls };
+        const llri::asset_stream_desc streamDesc { path.c_str(), buffer, llri::resource_state::ShaderReadOnly, static_cast<uint32_t>(chunks.size()), chunks.data() };
+
+        SUBCASE("[Incorrect usage] invalid create() and stream() parameters")
+        {
+            llri::asset_streamer streamer;
+            llri::asset_request request;
+            CHECK_EQ(streamer.stream(streamDesc, &request), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(streamer.update(), llri::result::ErrorInvalidUsage);
+
+            CHECK_EQ(streamer.create(llri::asset_streamer_desc { nullptr, 1, &decompress, &calls }), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(streamer.create(llri::asset_streamer_desc { &uploader, 1, nullptr, &calls }), llri::result::ErrorInvalidUsage);
+            REQUIRE_EQ(streamer.create(desc), llri::result::Success);
+
+            CHECK_EQ(streamer.stream(streamDesc, nullptr), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(streamer.stream(llri::asset_stream_desc { nullptr, buffer, llri::resource_state::ShaderReadOnly, 2, chunks.data() }, &request), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(streamer.stream(llri::asset_stream_desc { "", buffer, llri::resource_state::ShaderReadOnly, 2, chunks.data() }, &request), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(streamer.stream(llri::asset_stream_desc { path.c_str(), nullptr, llri::resource_state::ShaderReadOnly, 2, chunks.data() }, &request), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(streamer.stream(llri::asset_stream_desc { path.c_str(), buffer, llri::resource_state::ShaderReadOnly, 0, chunks.data() }, &request), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(streamer.stream(llri::asset_stream_desc { path.c_str(), buffer, llri::resource_state::ShaderReadOnly, 2, nullptr }, &request), llri::result::ErrorInvalidUsage);
+
+            // out of the buffer's range
+            const llri::compressed_chunk outOfRange { 10, chunks[0].sourceSize, size / 2 + 1, size / 2 };
+            CHECK_EQ(streamer.stream(llri::asset_stream_desc { path.c_str(), buffer, llri::resource_state::ShaderReadOnly, 1, &outOfRange }, &request), llri::result::ErrorInvalidUsage);
+
+            CHECK_EQ(streamer.queryStatus(llri::asset_request {}), llri::asset_status::Failed);
+        }
+
+        SUBCASE("[Incorrect usage] assets that can't be streamed")
+        {
+            llri::asset_streamer streamer;
+            REQUIRE_EQ(streamer.create(desc), llri::result::Success);
+
+            // a missing file, and a chunk that ends past the end of the file
+            llri::asset_request missing, outOfFile;
+            const std::string missingPath = (std::filesystem::temp_directory_path() / "llri_asset_streamer_missing.bin").string();
+            REQUIRE_EQ(streamer.stream(llri::asset_stream_desc { missingPath.c_str(), buffer, llri::resource_state::ShaderReadOnly, 2, chunks.data() }, &missing), llri::result::Success);
+            CHECK_EQ(streamer.queryStatus(missing), llri::asset_status::Failed);
+
+            const llri::compressed_chunk pastEnd { chunks[1].sourceOffset, chunks[1].sourceSize + 1, 0, size / 2 };
+            REQUIRE_EQ(streamer.stream(llri::asset_stream_desc { path.c_str(), buffer, llri::resource_state::ShaderReadOnly, 1, &pastEnd }, &outOfFile), llri::result::Success);
+            CHECK_EQ(streamer.queryStatus(outOfFile), llri::asset_status::Failed);
+
+            // a chunk that decompresses into a different size, and a chunk that's larger than the staging buffer
+            llri::asset_request corrupt, tooLarge;
+            const llri::compressed_chunk wrongSize { chunks[0].sourceOffset, chunks[0].sourceSize, 0, size / 2 - 1 };
+            REQUIRE_EQ(streamer.stream(llri::asset_stream_desc { path.c_str(), buffer, llri::resource_state::ShaderReadOnly, 1, &wrongSize }, &corrupt), llri::result::Success);
+
+            const llri::compressed_chunk whole { 10, chunks[0].sourceSize + chunks[1].sourceSize, 0, size };
+            REQUIRE_EQ(streamer.stream(llri::asset_stream_desc { path.c_str(), buffer, llri::resource_state::ShaderReadOnly, 1, &whole }, &tooLarge), llri::result::Success);
+
+            CHECK_EQ(detail::waitWhileLoading(streamer, uploader, corrupt), llri::asset_status::Failed);
+            CHECK_EQ(detail::waitWhileLoading(streamer, uploader, tooLarge), llri::asset_status::Failed);
+        }
+
+        SUBCASE("[Correct usage] chunks are decompressed into the buffer")
+        {
+            llri::asset_streamer streamer;
+            REQUIRE_EQ(streamer.create(desc), llri::result::Success);
+
+            llri::asset_request request;
+            REQUIRE_EQ(streamer.stream(streamDesc, &request), llri::result::Success);
+            CHECK_EQ(detail::waitWhileLoading(streamer, uploader, request), llri::asset_status::Complete);
+            CHECK_EQ(calls.load(), 2u);
+
+            streamer.destroy();
+            detail::checkBufferContents(device, buffer, llri::resource_state::ShaderReadOnly, expected);
+        }
+
+        uploader.destroy();
+        device->destroyResource(buffer);
+        instance->destroyDevice(device);
+    });
+
+    llri::destroyInstance(instance);
+    std::filesystem::remove(path);
+}
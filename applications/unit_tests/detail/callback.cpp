@@ -0,0 +1,184 @@
+/**
+ * @file callback.cpp
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <llri/llri.hpp>
+#include <doctest/doctest.h>
+#include <helpers.hpp>
+
+namespace
+{
+    struct received_messages
+    {
+        size_t count = 0;
+        std::string last;
+    };
+
+    void countingCallback(llri::message_severity, llri::message_source, const char* message, void* userData)
+    {
+        auto* received = static_cast<received_messages*>(userData);
+        received->count++;
+        received->last = message;
+    }
+}
+
+TEST_SUITE("Callback")
+{
+    TEST_CASE("setMessageDelivery()")
+    {
+        received_messages received;
+        llri::setMessageCallback(&countingCallback, &received);
+
+        const llri::instance_desc desc { 1, nullptr, "" };
+        llri::Instance* instance = nullptr;
+
+        SUBCASE("[Correct usage] message_delivery::Immediate")
+        {
+            llri::setMessageDelivery(llri::message_delivery::Immediate);
+
+            CHECK_EQ(llri::createInstance(desc, &instance), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(received.count, 1);
+            CHECK_EQ(llri::pollMessages(), 0);
+        }
+
+        SUBCASE("[Correct usage] message_delivery::Deferred")
+        {
+            llri::setMessageDelivery(llri::message_delivery::Deferred);
+
+            CHECK_EQ(llri::createInstance(desc, &instance), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(received.count, 0);
+
+            CHECK_EQ(llri::pollMessages(), 1);
+            CHECK_EQ(received.count, 1);
+            CHECK_EQ(llri::pollMessages(), 0);
+        }
+
+        SUBCASE("[Correct usage] repeated deferred messages are de-duplicated")
+        {
+            llri::setMessageDelivery(llri::message_delivery::Deferred);
+
+            for (size_t i = 0; i < 100; i++)
+                CHECK_EQ(llri::createInstance(desc, &instance), llri::result::ErrorInvalidUsage);
+
+            CHECK_EQ(llri::pollMessages(), 1);
+            CHECK_EQ(received.count, 1);
+            CHECK_NE(received.last.find("(repeated 99 more times)"), std::string::npos);
+
+            // the slot's repeat count was taken along with the message, so the next message starts without repeats
+            CHECK_EQ(llri::createInstance(desc, &instance), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(llri::pollMessages(), 1);
+            CHECK_EQ(received.last.find("repeated"), std::string::npos);
+        }
+
+        SUBCASE("[Correct usage] a full queue reports dropped messages")
+        {
+            llri::setMessageDelivery(llri::message_delivery::Deferred);
+
+            // make every message unique so that they aren't de-duplicated
+            const llri::detail::message_target target { &countingCallback, &received };
+            for (uint32_t i = 0; i < llri::detail::messageQueueCapacity + 10; i++)
+                llri::detail::apiWarning(target, "setMessageDelivery() test", std::to_string(i));
+
+            CHECK_EQ(llri::pollMessages(), llri::detail::messageQueueCapacity + 1);
+            CHECK_NE(received.last.find("10 messages were dropped"), std::string::npos);
+        }
+
+        SUBCASE("[Correct usage] dropped messages are reported to the target that they were raised for")
+        {
+            llri::setMessageDelivery(llri::message_delivery::Deferred);
+            llri::setMessageCallback(nullptr);
+
+            received_messages other;
+            const llri::detail::message_target target { &countingCallback, &received };
+            const llri::detail::message_target otherTarget { &countingCallback, &other };
+            for (uint32_t i = 0; i < llri::detail::messageQueueCapacity + 10; i++)
+                llri::detail::apiWarning(target, "setMessageDelivery() test", std::to_string(i));
+            for (uint32_t i = 0; i < 5; i++)
+                llri::detail::apiWarning(otherTarget, "setMessageDelivery() test", std::to_string(i));
+
+            CHECK_EQ(llri::pollMessages(), llri::detail::messageQueueCapacity + 2);
+            CHECK_NE(received.last.find("10 messages were dropped"), std::string::npos);
+            CHECK_EQ(other.count, 1);
+            CHECK_NE(other.last.find("5 messages were dropped"), std::string::npos);
+        }
+
+        SUBCASE("[Correct usage] immediate messages aren't truncated")
+        {
+            llri::setMessageDelivery(llri::message_delivery::Immediate);
+
+            const llri::detail::message_target target { &countingCallback, &received };
+            const std::string message(llri::detail::maxMessageLength * 2, 'x');
+            llri::detail::callUserCallback(target, llri::message_severity::Info, llri::message_source::Implementation, message.c_str());
+            CHECK_EQ(received.last, message);
+
+            llri::detail::apiWarning(target, "setMessageDelivery() test", message);
+            CHECK_EQ(received.last, "in setMessageDelivery() test: " + message);
+        }
+
+        llri::setMessageDelivery(llri::message_delivery::Immediate);
+        llri::setMessageCallback(nullptr);
+    }
+
+    TEST_CASE("detail::message_entry::append()")
+    {
+        llri::detail::message_entry entry;
+        entry.text[0] = '\0';
+
+        entry.append(std::numeric_limits<int64_t>::min());
+        entry.append(" ");
+        entry.append(std::numeric_limits<int8_t>::min());
+        entry.append(" ");
+        entry.append(std::numeric_limits<uint64_t>::max());
+        CHECK_EQ(std::string(entry.text), "-9223372036854775808 -128 18446744073709551615");
+    }
+
+    TEST_CASE("instance_desc::messageCallback")
+    {
+        received_messages global;
+        received_messages local;
+        llri::setMessageCallback(&countingCallback, &global);
+
+        llri::instance_desc desc { 0, nullptr, "" };
+        desc.messageCallback = &countingCallback;
+        desc.messageUserData = &local;
+
+        SUBCASE("[Correct usage] createInstance() validation uses the instance's callback")
+        {
+            desc.numExtensions = 1;
+            llri::Instance* instance = nullptr;
+            CHECK_EQ(llri::createInstance(desc, &instance), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(local.count, 1);
+            CHECK_EQ(global.count, 0);
+        }
+
+        SUBCASE("[Correct usage] objects created by the instance use the instance's callback")
+        {
+            llri::Instance* instance = nullptr;
+            REQUIRE_EQ(llri::createInstance(desc, &instance), llri::result::Success);
+
+            // changing the global callback doesn't affect existing instances
+            llri::setMessageCallback(nullptr);
+
+            const size_t before = local.count;
+            CHECK_EQ(instance->enumerateAdapters(nullptr), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(local.count, before + 1);
+            CHECK_EQ(global.count, 0);
+
+            llri::destroyInstance(instance);
+        }
+
+        SUBCASE("[Correct usage] messageCallback == nullptr uses the global callback")
+        {
+            desc.messageCallback = nullptr;
+            desc.numExtensions = 1;
+            llri::Instance* instance = nullptr;
+            CHECK_EQ(llri::createInstance(desc, &instance), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(local.count, 0);
+            CHECK_EQ(global.count, 1);
+        }
+
+        llri::setMessageCallback(nullptr);
+    }
+}
@@ -50,6 +50,28 @@ TEST_CASE("CommandGroup")
                     }
                 }
 
+                SUBCASE("CommandGroup::resolve()")
+                {
+                    SUBCASE("[Incorrect usage] default handle")
+                    {
+                        CHECK_EQ(group->resolve(llri::handle<llri::CommandList> {}), nullptr);
+                    }
+
+                    SUBCASE("[Correct usage] handles resolve until the CommandList is freed")
+                    {
+                        std::vector<llri::CommandList*> cmdLists;
+                        REQUIRE_EQ(group->allocate(llri::command_list_alloc_desc{ nodeMask, llri::command_list_usage::Direct }, 3, &cmdLists), llri::result::Success);
+
+                        const llri::handle<llri::CommandList> handle = cmdLists[1]->getHandle();
+                        CHECK_EQ(group->resolve(handle), cmdLists[1]);
+
+                        REQUIRE_EQ(group->free(cmdLists[1]), llri::result::Success);
+                        CHECK_EQ(group->resolve(handle), nullptr);
+                        CHECK_EQ(group->resolve(cmdLists[0]->getHandle()), cmdLists[0]);
+                        CHECK_EQ(group->resolve(cmdLists[2]->getHandle()), cmdLists[2]);
+                    }
+                }
+
                 SUBCASE("CommandGroup::allocate() (single)")
                 {
                     SUBCASE("[Correct usage] Valid parameters")
@@ -9,6 +9,8 @@
 #include <doctest/doctest.h>
 
 #include <detail/commands/resource_barrier.hpp>
+#include <detail/commands/queries.hpp>
+#include <detail/commands/copies.hpp>
 
 TEST_CASE("CommandList:: commands")
 {
@@ -21,6 +23,18 @@ TEST_CASE("CommandList:: commands")
 
         SUBCASE("resourceBarrier()")
             testCommandListResourceBarrier(device, group, list);
+
+        SUBCASE("resetQueries() and writeTimestamp()")
+            testCommandListQueries(device, group, list);
+
+        SUBCASE("beginQuery(), endQuery() and copyQueryResults()")
+            testCommandListQueryResults(device, group, list);
+
+        SUBCASE("copyBuffer()")
+            testCommandListCopyBuffer(device, group, list);
+
+        SUBCASE("copyBufferToTexture() and copyTextureToBuffer()")
+            testCommandListCopyTexture(device, group, list);
         
         device->destroyCommandGroup(group);
         instance->destroyDevice(device);
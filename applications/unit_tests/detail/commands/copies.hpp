@@ -0,0 +1,237 @@
+/**
+ * @file copies.hpp
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <llri/llri.hpp>
+#include <helpers.hpp>
+#include <doctest/doctest.h>
+
+#include <cstring>
+
+inline void testCommandListCopyBuffer(llri::Device* device, llri::CommandGroup* group, llri::CommandList* list)
+{
+    REQUIRE_EQ(group->reset(), llri::result::Success);
+
+    constexpr uint32_t size = 8 * 1024;
+
+    llri::Resource* upload;
+    REQUIRE_EQ(device->createResource(llri::resource_desc::buffer(llri::resource_usage_flag_bits::TransferSrc, llri::memory_type::Upload, llri::resource_state::Upload, size), &upload), llri::result::Success);
+    llri::Resource* local;
+    REQUIRE_EQ(device->createResource(llri::resource_desc::buffer(llri::resource_usage_flag_bits::TransferSrc | llri::resource_usage_flag_bits::TransferDst, llri::memory_type::Local, llri::resource_state::TransferDst, size), &local), llri::result::Success);
+    llri::Resource* readback;
+    REQUIRE_EQ(device->createResource(llri::resource_desc::buffer(llri::resource_usage_flag_bits::TransferDst, llri::memory_type::Read, llri::resource_state::TransferDst, size), &readback), llri::result::Success);
+
+    SUBCASE("Function parameter requirements")
+    {
+        // command list isn't recording
+        CHECK_EQ(list->copyBuffer(upload, 0, local, 0, size), llri::result::ErrorInvalidState);
+
+        const llri::command_list_begin_desc beginDesc {};
+        REQUIRE_EQ(list->record(beginDesc, [=](llri::CommandList* cmd)
+        {
+            // src or dst == nullptr, src == dst, size == 0
+            CHECK_EQ(cmd->copyBuffer(nullptr, 0, local, 0, size), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(cmd->copyBuffer(upload, 0, nullptr, 0, size), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(cmd->copyBuffer(local, 0, local, 0, size), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(cmd->copyBuffer(upload, 0, local, 0, 0), llri::result::ErrorInvalidUsage);
+
+            // out of range
+            CHECK_EQ(cmd->copyBuffer(upload, 1, local, 0, size), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(cmd->copyBuffer(upload, 0, local, 1, size), llri::result::ErrorInvalidUsage);
+
+            // src isn't a TransferSrc buffer in Local or Upload memory, dst isn't a TransferDst buffer in Local or Read memory
+            CHECK_EQ(cmd->copyBuffer(readback, 0, local, 0, size), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(cmd->copyBuffer(local, 0, upload, 0, size), llri::result::ErrorInvalidUsage);
+        }, list), llri::result::Success);
+    }
+
+    SUBCASE("[Correct usage] Upload -> Local -> Read")
+    {
+        void* data;
+        REQUIRE_EQ(device->mapResource(upload, &data), llri::result::Success);
+
+        std::vector<uint8_t> expected(size);
+        for (size_t i = 0; i < expected.size(); i++)
+            expected[i] = static_cast<uint8_t>(i * 7 + i / 256);
+        std::memcpy(data, expected.data(), size);
+        device->unmapResource(upload);
+
+        const llri::command_list_begin_desc beginDesc {};
+        REQUIRE_EQ(list->record(beginDesc, [=](llri::CommandList* cmd)
+        {
+            CHECK_EQ(cmd->copyBuffer(upload, 0, local, 0, size), llri::result::Success);
+            CHECK_EQ(cmd->resourceBarrier(llri::resource_barrier::transition(local, llri::resource_state::TransferDst, llri::resource_state::TransferSrc)), llri::result::Success);
+
+            // copy the halves in swapped order
+            CHECK_EQ(cmd->copyBuffer(local, 0, readback, size / 2, size / 2), llri::result::Success);
+            CHECK_EQ(cmd->copyBuffer(local, size / 2, readback, 0, size / 2), llri::result::Success);
+        }, list), llri::result::Success);
+
+        auto* fence = detail::defaultFence(device, false);
+        REQUIRE_EQ(device->getQueue(group->getType(), 0)->submit(llri::submit_desc { 0, 1, &list, 0, nullptr, 0, nullptr, fence }), llri::result::Success);
+        REQUIRE_EQ(device->waitFence(fence, LLRI_TIMEOUT_MAX), llri::result::Success);
+        device->destroyFence(fence);
+
+        // the null implementation has no device memory to copy through
+        if (llri::getImplementation() != llri::implementation::Null)
+        {
+            REQUIRE_EQ(device->mapResource(readback, &data), llri::result::Success);
+            const auto* bytes = static_cast<const uint8_t*>(data);
+            CHECK_EQ(std::memcmp(bytes, expected.data() + size / 2, size / 2), 0);
+            CHECK_EQ(std::memcmp(bytes + size / 2, expected.data(), size / 2), 0);
+            device->unmapResource(readback);
+        }
+    }
+
+    device->destroyResource(readback);
+    device->destroyResource(local);
+    device->destroyResource(upload);
+}
+
+inline void testCommandListCopyTexture(llri::Device* device, llri::CommandGroup* group, llri::CommandList* list)
+{
+    REQUIRE_EQ(group->reset(), llri::result::Success);
+
+    constexpr uint32_t width = 48;
+    constexpr uint32_t height = 32;
+    constexpr uint32_t texelSize = 4;
+    constexpr uint32_t rowPitch = 256; // width * texelSize rounded up to a multiple of 256
+    constexpr uint32_t size = rowPitch * height;
+
+    llri::Resource* upload;
+    REQUIRE_EQ(device->createResource(llri::resource_desc::buffer(llri::resource_usage_flag_bits::TransferSrc, llri::memory_type::Upload, llri::resource_state::Upload, size), &upload), llri::result::Success);
+    llri::Resource* readback;
+    REQUIRE_EQ(device->createResource(llri::resource_desc::buffer(llri::resource_usage_flag_bits::TransferDst, llri::memory_type::Read, llri::resource_state::TransferDst, size), &readback), llri::result::Success);
+
+    llri::resource_desc textureDesc {};
+    textureDesc.type = llri::resource_type::Texture2D;
+    textureDesc.usage = llri::resource_usage_flag_bits::TransferSrc | llri::resource_usage_flag_bits::TransferDst;
+    textureDesc.memoryType = llri::memory_type::Local;
+    textureDesc.initialState = llri::resource_state::TransferDst;
+    textureDesc.width = width;
+    textureDesc.height = height;
+    textureDesc.depthOrArrayLayers = 2;
+    textureDesc.mipLevels = 2;
+    textureDesc.sampleCount = llri::sample_count::Count1;
+    textureDesc.textureFormat = llri::format::RGBA8UNorm;
+
+    llri::Resource* texture;
+    REQUIRE_EQ(device->createResource(textureDesc, &texture), llri::result::Success);
+
+    // the second array layer of the first mip level
+    const llri::texture_copy_desc copyDesc { upload, 0, rowPitch, texture, 0, 1, llri::offset_3d { 0, 0, 0 }, llri::extent_3d { width, height, 1 } };
+
+    SUBCASE("Function parameter requirements")
+    {
+        // command list isn't recording
+        CHECK_EQ(list->copyBufferToTexture(copyDesc), llri::result::ErrorInvalidState);
+
+        const llri::command_list_begin_desc beginDesc {};
+        REQUIRE_EQ(list->record(beginDesc, [=](llri::CommandList* cmd)
+        {
+            auto desc = copyDesc;
+            desc.buffer = nullptr;
+            CHECK_EQ(cmd->copyBufferToTexture(desc), llri::result::ErrorInvalidUsage);
+
+            desc = copyDesc;
+            desc.texture = nullptr;
+            CHECK_EQ(cmd->copyBufferToTexture(desc), llri::result::ErrorInvalidUsage);
+
+            // misaligned buffer offset or row pitch
+            desc = copyDesc;
+            desc.bufferOffset = 256;
+            CHECK_EQ(cmd->copyBufferToTexture(desc), llri::result::ErrorInvalidUsage);
+
+            desc = copyDesc;
+            desc.bufferRowPitch = 128;
+            CHECK_EQ(cmd->copyBufferToTexture(desc), llri::result::ErrorInvalidUsage);
+
+            // empty extent
+            desc = copyDesc;
+            desc.extent.height = 0;
+            CHECK_EQ(cmd->copyBufferToTexture(desc), llri::result::ErrorInvalidUsage);
+
+            // subresource out of range
+            desc = copyDesc;
+            desc.mipLevel = 2;
+            CHECK_EQ(cmd->copyBufferToTexture(desc), llri::result::ErrorInvalidUsage);
+
+            desc = copyDesc;
+            desc.arrayLayer = 2;
+            CHECK_EQ(cmd->copyBufferToTexture(desc), llri::result::ErrorInvalidUsage);
+
+            // region doesn't fit in the subresource
+            desc = copyDesc;
+            desc.textureOffset.x = 1;
+            CHECK_EQ(cmd->copyBufferToTexture(desc), llri::result::ErrorInvalidUsage);
+
+            desc = copyDesc;
+            desc.mipLevel = 1;
+            CHECK_EQ(cmd->copyBufferToTexture(desc), llri::result::ErrorInvalidUsage);
+
+            desc = copyDesc;
+            desc.textureOffset.z = 1;
+            CHECK_EQ(cmd->copyBufferToTexture(desc), llri::result::ErrorInvalidUsage);
+
+            // region doesn't fit in the buffer
+            desc = copyDesc;
+            desc.bufferOffset = 512;
+            CHECK_EQ(cmd->copyBufferToTexture(desc), llri::result::ErrorInvalidUsage);
+
+            // the buffer isn't a TransferSrc buffer in Local or Upload memory
+            desc = copyDesc;
+            desc.buffer = readback;
+            CHECK_EQ(cmd->copyBufferToTexture(desc), llri::result::ErrorInvalidUsage);
+
+            // the buffer isn't a TransferDst buffer in Local or Read memory
+            CHECK_EQ(cmd->copyTextureToBuffer(copyDesc), llri::result::ErrorInvalidUsage);
+        }, list), llri::result::Success);
+    }
+
+    SUBCASE("[Correct usage] Upload -> Texture -> Read")
+    {
+        void* data;
+        REQUIRE_EQ(device->mapResource(upload, &data), llri::result::Success);
+
+        std::vector<uint8_t> expected(size);
+        for (size_t i = 0; i < expected.size(); i++)
+            expected[i] = static_cast<uint8_t>(i * 13 + i / rowPitch);
+        std::memcpy(data, expected.data(), size);
+        device->unmapResource(upload);
+
+        // read back a 16x8 region from the middle of the texture
+        const llri::texture_copy_desc readDesc { readback, 0, rowPitch, texture, 0, 1, llri::offset_3d { 8, 4, 0 }, llri::extent_3d { 16, 8, 1 } };
+
+        const llri::command_list_begin_desc beginDesc {};
+        REQUIRE_EQ(list->record(beginDesc, [=](llri::CommandList* cmd)
+        {
+            CHECK_EQ(cmd->copyBufferToTexture(copyDesc), llri::result::Success);
+            CHECK_EQ(cmd->resourceBarrier(llri::resource_barrier::transition(texture, llri::resource_state::TransferDst, llri::resource_state::TransferSrc)), llri::result::Success);
+            CHECK_EQ(cmd->copyTextureToBuffer(readDesc), llri::result::Success);
+        }, list), llri::result::Success);
+
+        auto* fence = detail::defaultFence(device, false);
+        REQUIRE_EQ(device->getQueue(group->getType(), 0)->submit(llri::submit_desc { 0, 1, &list, 0, nullptr, 0, nullptr, fence }), llri::result::Success);
+        REQUIRE_EQ(device->waitFence(fence, LLRI_TIMEOUT_MAX), llri::result::Success);
+        device->destroyFence(fence);
+
+        // the null implementation has no device memory to copy through
+        if (llri::getImplementation() != llri::implementation::Null)
+        {
+            REQUIRE_EQ(device->mapResource(readback, &data), llri::result::Success);
+            const auto* bytes = static_cast<const uint8_t*>(data);
+            for (uint32_t row = 0; row < 8; row++)
+            {
+                const size_t src = (4 + row) * rowPitch + 8 * texelSize;
+                CHECK_EQ(std::memcmp(bytes + row * rowPitch, expected.data() + src, 16 * texelSize), 0);
+            }
+            device->unmapResource(readback);
+        }
+    }
+
+    device->destroyResource(texture);
+    device->destroyResource(readback);
+    device->destroyResource(upload);
+}
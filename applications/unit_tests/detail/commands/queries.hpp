@@ -0,0 +1,143 @@
+/**
+ * @file queries.hpp
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <llri/llri.hpp>
+#include <helpers.hpp>
+#include <doctest/doctest.h>
+
+inline void testCommandListQueries(llri::Device* device, llri::CommandGroup* group, llri::CommandList* list)
+{
+    REQUIRE_EQ(group->reset(), llri::result::Success);
+
+    llri::QueryPool* pool;
+    REQUIRE_EQ(device->createQueryPool(llri::query_pool_desc { llri::query_type::Timestamp, 4 }, &pool), llri::result::Success);
+
+    SUBCASE("Function parameter requirements")
+    {
+        // command list isn't recording
+        CHECK_EQ(list->resetQueries(pool, 0, 4), llri::result::ErrorInvalidState);
+        CHECK_EQ(list->writeTimestamp(pool, 0), llri::result::ErrorInvalidState);
+
+        REQUIRE_EQ(group->reset(), llri::result::Success);
+        const llri::command_list_begin_desc beginDesc {};
+        REQUIRE_EQ(list->record(beginDesc, [=](llri::CommandList* cmd)
+        {
+            // pool == nullptr
+            CHECK_EQ(cmd->resetQueries(nullptr, 0, 4), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(cmd->writeTimestamp(nullptr, 0), llri::result::ErrorInvalidUsage);
+
+            // count == 0
+            CHECK_EQ(cmd->resetQueries(pool, 0, 0), llri::result::ErrorInvalidUsage);
+
+            // out of range
+            CHECK_EQ(cmd->resetQueries(pool, 2, 4), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(cmd->writeTimestamp(pool, 4), llri::result::ErrorInvalidUsage);
+        }, list), llri::result::Success);
+    }
+
+    SUBCASE("[Correct usage] valid parameters")
+    {
+        REQUIRE_EQ(group->reset(), llri::result::Success);
+        const llri::command_list_begin_desc beginDesc {};
+        REQUIRE_EQ(list->record(beginDesc, [=](llri::CommandList* cmd)
+        {
+            CHECK_EQ(cmd->resetQueries(pool, 0, 4), llri::result::Success);
+
+            if (group->getType() != llri::queue_type::Transfer)
+            {
+                CHECK_EQ(cmd->writeTimestamp(pool, 0), llri::result::Success);
+                CHECK_EQ(cmd->writeTimestamp(pool, 3), llri::result::Success);
+            }
+            else
+            {
+                CHECK_EQ(cmd->writeTimestamp(pool, 0), llri::result::ErrorInvalidUsage);
+            }
+        }, list), llri::result::Success);
+    }
+
+    device->destroyQueryPool(pool);
+}
+
+inline void testCommandListQueryResults(llri::Device* device, llri::CommandGroup* group, llri::CommandList* list)
+{
+    REQUIRE_EQ(group->reset(), llri::result::Success);
+
+    llri::QueryPool* timestamps;
+    REQUIRE_EQ(device->createQueryPool(llri::query_pool_desc { llri::query_type::Timestamp, 4 }, &timestamps), llri::result::Success);
+    llri::QueryPool* occlusion;
+    REQUIRE_EQ(device->createQueryPool(llri::query_pool_desc { llri::query_type::Occlusion, 4 }, &occlusion), llri::result::Success);
+
+    llri::Resource* readback;
+    const auto readbackDesc = llri::resource_desc::buffer(llri::resource_usage_flag_bits::TransferDst, llri::memory_type::Read, llri::resource_state::TransferDst, 4 * sizeof(uint64_t));
+    REQUIRE_EQ(device->createResource(readbackDesc, &readback), llri::result::Success);
+
+    llri::Resource* upload;
+    const auto uploadDesc = llri::resource_desc::buffer(llri::resource_usage_flag_bits::TransferSrc, llri::memory_type::Upload, llri::resource_state::Upload, 4 * sizeof(uint64_t));
+    REQUIRE_EQ(device->createResource(uploadDesc, &upload), llri::result::Success);
+
+    SUBCASE("Function parameter requirements")
+    {
+        // command list isn't recording
+        CHECK_EQ(list->beginQuery(occlusion, 0), llri::result::ErrorInvalidState);
+        CHECK_EQ(list->endQuery(occlusion, 0), llri::result::ErrorInvalidState);
+        CHECK_EQ(list->copyQueryResults(timestamps, 0, 4, readback, 0), llri::result::ErrorInvalidState);
+
+        REQUIRE_EQ(group->reset(), llri::result::Success);
+        const llri::command_list_begin_desc beginDesc {};
+        REQUIRE_EQ(list->record(beginDesc, [=](llri::CommandList* cmd)
+        {
+            // pool == nullptr
+            CHECK_EQ(cmd->beginQuery(nullptr, 0), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(cmd->endQuery(nullptr, 0), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(cmd->copyQueryResults(nullptr, 0, 4, readback, 0), llri::result::ErrorInvalidUsage);
+
+            // timestamps can't be begun or ended
+            CHECK_EQ(cmd->beginQuery(timestamps, 0), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(cmd->endQuery(timestamps, 0), llri::result::ErrorInvalidUsage);
+
+            // index out of range
+            CHECK_EQ(cmd->beginQuery(occlusion, 4), llri::result::ErrorInvalidUsage);
+
+            // dst == nullptr, count == 0, first + count out of range
+            CHECK_EQ(cmd->copyQueryResults(timestamps, 0, 4, nullptr, 0), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(cmd->copyQueryResults(timestamps, 0, 0, readback, 0), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(cmd->copyQueryResults(timestamps, 1, 4, readback, 0), llri::result::ErrorInvalidUsage);
+
+            // dstOffset misaligned or results don't fit
+            CHECK_EQ(cmd->copyQueryResults(timestamps, 0, 1, readback, 4), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(cmd->copyQueryResults(timestamps, 0, 4, readback, sizeof(uint64_t)), llri::result::ErrorInvalidUsage);
+
+            // dst isn't a TransferDst buffer in Local or Read memory
+            CHECK_EQ(cmd->copyQueryResults(timestamps, 0, 4, upload, 0), llri::result::ErrorInvalidUsage);
+        }, list), llri::result::Success);
+    }
+
+    SUBCASE("[Correct usage] valid parameters")
+    {
+        REQUIRE_EQ(group->reset(), llri::result::Success);
+        const llri::command_list_begin_desc beginDesc {};
+        REQUIRE_EQ(list->record(beginDesc, [=](llri::CommandList* cmd)
+        {
+            CHECK_EQ(cmd->resetQueries(occlusion, 0, 4), llri::result::Success);
+
+            if (group->getType() == llri::queue_type::Graphics)
+            {
+                CHECK_EQ(cmd->beginQuery(occlusion, 0), llri::result::Success);
+                CHECK_EQ(cmd->endQuery(occlusion, 0), llri::result::Success);
+                CHECK_EQ(cmd->copyQueryResults(occlusion, 0, 1, readback, 0), llri::result::Success);
+            }
+            else
+            {
+                CHECK_EQ(cmd->beginQuery(occlusion, 0), llri::result::ErrorInvalidUsage);
+            }
+        }, list), llri::result::Success);
+    }
+
+    device->destroyResource(upload);
+    device->destroyResource(readback);
+    device->destroyQueryPool(occlusion);
+    device->destroyQueryPool(timestamps);
+}
@@ -60,6 +60,7 @@ inline void testCommandListResourceBarrier(llri::Device* device, llri::CommandGr
     textureDesc.mipLevels = 1;
     textureDesc.sampleCount = llri::sample_count::Count1;
     textureDesc.textureFormat = llri::format::RGBA8UNorm;
+    textureDesc.sharingMode = llri::resource_sharing_mode::Exclusive;
     
     llri::resource_desc bufferDesc = llri::resource_desc::buffer(llri::resource_usage_flag_bits::TransferDst, llri::memory_type::Local, llri::resource_state::General, 1024);
     
@@ -656,6 +657,59 @@ inline void testCommandListResourceBarrier(llri::Device* device, llri::CommandGr
 		}
     }
     
+    SUBCASE("resource_barrier_type::Release and resource_barrier_type::Acquire")
+    {
+        // ownership is transferred between the list's queue type and any other queue type
+        const llri::queue_type listType = list->getGroup()->getType();
+        const auto otherType = static_cast<llri::queue_type>((static_cast<uint8_t>(listType) + 1) % (static_cast<uint8_t>(llri::queue_type::MaxEnum) + 1));
+        
+        current = &resources.emplace_back(nullptr);
+        REQUIRE_EQ(device->createResource(bufferDesc, current), llri::result::Success);
+        llri::Resource* buffer = *current;
+        
+        SUBCASE("[Incorrect usage] barrier.own.resource is nullptr")
+        {
+            CHECK_EQ(list->resourceBarrier(llri::resource_barrier::release(nullptr, llri::resource_state::General, listType, otherType)), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(list->resourceBarrier(llri::resource_barrier::acquire(nullptr, llri::resource_state::General, otherType, listType)), llri::result::ErrorInvalidUsage);
+        }
+        
+        SUBCASE("[Incorrect usage] invalid barrier.own.state, srcQueue or dstQueue")
+        {
+            const auto invalidState = static_cast<llri::resource_state>(std::numeric_limits<uint8_t>::max());
+            const auto invalidQueue = static_cast<llri::queue_type>(std::numeric_limits<uint8_t>::max());
+            CHECK_EQ(list->resourceBarrier(llri::resource_barrier::release(buffer, invalidState, listType, otherType)), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(list->resourceBarrier(llri::resource_barrier::release(buffer, llri::resource_state::General, listType, invalidQueue)), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(list->resourceBarrier(llri::resource_barrier::acquire(buffer, llri::resource_state::General, invalidQueue, listType)), llri::result::ErrorInvalidUsage);
+        }
+        
+        SUBCASE("[Incorrect usage] barrier.own.srcQueue is the same as barrier.own.dstQueue")
+        {
+            CHECK_EQ(list->resourceBarrier(llri::resource_barrier::release(buffer, llri::resource_state::General, listType, listType)), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(list->resourceBarrier(llri::resource_barrier::acquire(buffer, llri::resource_state::General, listType, listType)), llri::result::ErrorInvalidUsage);
+        }
+        
+        SUBCASE("[Incorrect usage] the barrier is recorded on the wrong side of the transfer")
+        {
+            CHECK_EQ(list->resourceBarrier(llri::resource_barrier::release(buffer, llri::resource_state::General, otherType, listType)), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(list->resourceBarrier(llri::resource_barrier::acquire(buffer, llri::resource_state::General, listType, otherType)), llri::result::ErrorInvalidUsage);
+        }
+        
+        SUBCASE("[Correct usage] release and acquire exclusive and concurrent resources")
+        {
+            CHECK_EQ(list->resourceBarrier(llri::resource_barrier::release(buffer, llri::resource_state::General, listType, otherType)), llri::result::Success);
+            CHECK_EQ(list->resourceBarrier(llri::resource_barrier::acquire(buffer, llri::resource_state::General, otherType, listType)), llri::result::Success);
+            
+            current = &resources.emplace_back(nullptr);
+            REQUIRE_EQ(device->createResource(textureDesc, current), llri::result::Success);
+            CHECK_EQ(list->resourceBarrier(llri::resource_barrier::release(*current, llri::resource_state::TransferDst, listType, otherType)), llri::result::Success);
+            
+            bufferDesc.sharingMode = llri::resource_sharing_mode::Concurrent;
+            current = &resources.emplace_back(nullptr);
+            REQUIRE_EQ(device->createResource(bufferDesc, current), llri::result::Success);
+            CHECK_EQ(list->resourceBarrier(llri::resource_barrier::acquire(*current, llri::resource_state::General, otherType, listType)), llri::result::Success);
+        }
+    }
+    
     CHECK_EQ(list->end(), llri::result::Success);
 	
 	auto* queue = device->getQueue(detail::availableQueueType(device->getAdapter()), 0);
@@ -218,6 +218,209 @@ TEST_CASE("Device")
                     CHECK_NOTHROW(device->destroySemaphore(semaphore));
             }
 
+            SUBCASE("Device::createQueryPool()")
+            {
+                SUBCASE("[Incorrect usage] pool == nullptr")
+                {
+                    CHECK_EQ(device->createQueryPool(llri::query_pool_desc { llri::query_type::Timestamp, 1 }, nullptr), llri::result::ErrorInvalidUsage);
+                }
+
+                SUBCASE("[Incorrect usage] desc.type is an invalid enum value")
+                {
+                    llri::QueryPool* pool;
+                    const llri::query_pool_desc desc { static_cast<llri::query_type>(static_cast<uint8_t>(llri::query_type::MaxEnum) + 1), 1 };
+                    CHECK_EQ(device->createQueryPool(desc, &pool), llri::result::ErrorInvalidUsage);
+                }
+
+                SUBCASE("[Incorrect usage] desc.count == 0")
+                {
+                    llri::QueryPool* pool;
+                    CHECK_EQ(device->createQueryPool(llri::query_pool_desc { llri::query_type::Timestamp, 0 }, &pool), llri::result::ErrorInvalidUsage);
+                }
+
+                SUBCASE("[Incorrect usage] desc.type is PipelineStatistics but the feature wasn't enabled")
+                {
+                    llri::QueryPool* pool;
+                    CHECK_EQ(device->createQueryPool(llri::query_pool_desc { llri::query_type::PipelineStatistics, 1 }, &pool), llri::result::ErrorFeatureNotSupported);
+                }
+
+                SUBCASE("[Correct usage] desc.type is Occlusion")
+                {
+                    llri::QueryPool* pool;
+                    auto r = device->createQueryPool(llri::query_pool_desc { llri::query_type::Occlusion, 16 }, &pool);
+                    CHECK_UNARY(r == llri::result::Success || r == llri::result::ErrorOutOfDeviceMemory || r == llri::result::ErrorOutOfHostMemory);
+
+                    device->destroyQueryPool(pool);
+                }
+
+                SUBCASE("[Correct usage] valid parameters")
+                {
+                    llri::QueryPool* pool;
+                    auto r = device->createQueryPool(llri::query_pool_desc { llri::query_type::Timestamp, 16 }, &pool);
+                    CHECK_UNARY(r == llri::result::Success || r == llri::result::ErrorOutOfDeviceMemory || r == llri::result::ErrorOutOfHostMemory);
+
+                    device->destroyQueryPool(pool);
+                }
+            }
+
+            SUBCASE("Device::destroyQueryPool()")
+            {
+                // nullptr is allowed
+                CHECK_NOTHROW(device->destroyQueryPool(nullptr));
+
+                // valid pointer is allowed
+                llri::QueryPool* pool;
+                auto r = device->createQueryPool(llri::query_pool_desc { llri::query_type::Timestamp, 16 }, &pool);
+                REQUIRE_UNARY(r == llri::result::Success || r == llri::result::ErrorOutOfDeviceMemory || r == llri::result::ErrorOutOfHostMemory);
+                if (r == llri::result::Success)
+                    CHECK_NOTHROW(device->destroyQueryPool(pool));
+            }
+
+            SUBCASE("Device::mapResource()")
+            {
+                llri::Resource* upload;
+                REQUIRE_EQ(device->createResource(llri::resource_desc::buffer(llri::resource_usage_flag_bits::TransferSrc, llri::memory_type::Upload, llri::resource_state::Upload, 1024), &upload), llri::result::Success);
+                llri::Resource* local;
+                REQUIRE_EQ(device->createResource(llri::resource_desc::buffer(llri::resource_usage_flag_bits::TransferDst, llri::memory_type::Local, llri::resource_state::TransferDst, 1024), &local), llri::result::Success);
+
+                void* data;
+                SUBCASE("[Incorrect usage] resource == nullptr")
+                {
+                    CHECK_EQ(device->mapResource(nullptr, &data), llri::result::ErrorInvalidUsage);
+                }
+
+                SUBCASE("[Incorrect usage] data == nullptr")
+                {
+                    CHECK_EQ(device->mapResource(upload, nullptr), llri::result::ErrorInvalidUsage);
+                }
+
+                SUBCASE("[Incorrect usage] resource is in Local memory")
+                {
+                    CHECK_EQ(device->mapResource(local, &data), llri::result::ErrorInvalidUsage);
+                }
+
+                SUBCASE("[Incorrect usage] resource is already mapped")
+                {
+                    REQUIRE_EQ(device->mapResource(upload, &data), llri::result::Success);
+                    CHECK_EQ(device->mapResource(upload, &data), llri::result::ErrorInvalidState);
+                    device->unmapResource(upload);
+                }
+
+                SUBCASE("[Correct usage] valid parameters")
+                {
+                    REQUIRE_EQ(device->mapResource(upload, &data), llri::result::Success);
+                    CHECK_NE(data, nullptr);
+
+                    // the pointer is writable for the entire size of the buffer
+                    std::fill_n(static_cast<uint8_t*>(data), 1024, uint8_t(0xAB));
+                    device->unmapResource(upload);
+
+                    // resources can be mapped again after they're unmapped, and unmapping twice or nullptr is allowed
+                    REQUIRE_EQ(device->mapResource(upload, &data), llri::result::Success);
+                    device->unmapResource(upload);
+                    CHECK_NOTHROW(device->unmapResource(upload));
+                    CHECK_NOTHROW(device->unmapResource(nullptr));
+                }
+
+                device->destroyResource(local);
+                device->destroyResource(upload);
+            }
+
+            SUBCASE("Device::resolve()")
+            {
+                SUBCASE("[Incorrect usage] default handles never resolve")
+                {
+                    CHECK_EQ(device->resolve(llri::handle<llri::Resource> {}), nullptr);
+                    CHECK_EQ(device->resolve(llri::handle<llri::Fence> {}), nullptr);
+                    CHECK_EQ(device->resolve(llri::handle<llri::Semaphore> {}), nullptr);
+                }
+
+                SUBCASE("[Correct usage] handles resolve until the object is destroyed")
+                {
+                    const auto desc = llri::resource_desc::buffer(llri::resource_usage_flag_bits::TransferSrc, llri::memory_type::Upload, llri::resource_state::Upload, 1024);
+
+                    llri::Resource* resource;
+                    REQUIRE_EQ(device->createResource(desc, &resource), llri::result::Success);
+                    const llri::handle<llri::Resource> handle = resource->getHandle();
+                    CHECK_EQ(device->resolve(handle), resource);
+
+                    device->destroyResource(resource);
+                    CHECK_EQ(device->resolve(handle), nullptr);
+
+                    // a new Resource may reuse the slot, but the old handle keeps referring to the destroyed Resource
+                    REQUIRE_EQ(device->createResource(desc, &resource), llri::result::Success);
+                    CHECK_NE(resource->getHandle(), handle);
+                    CHECK_EQ(device->resolve(handle), nullptr);
+                    CHECK_EQ(device->resolve(resource->getHandle()), resource);
+                    device->destroyResource(resource);
+
+                    auto* fence = detail::defaultFence(device, false);
+                    const llri::handle<llri::Fence> fenceHandle = fence->getHandle();
+                    CHECK_EQ(device->resolve(fenceHandle), fence);
+                    device->destroyFence(fence);
+                    CHECK_EQ(device->resolve(fenceHandle), nullptr);
+
+                    llri::Semaphore* semaphore;
+                    REQUIRE_EQ(device->createSemaphore(&semaphore), llri::result::Success);
+                    const llri::handle<llri::Semaphore> semaphoreHandle = semaphore->getHandle();
+                    CHECK_EQ(device->resolve(semaphoreHandle), semaphore);
+                    device->destroySemaphore(semaphore);
+                    CHECK_EQ(device->resolve(semaphoreHandle), nullptr);
+                }
+
+                SUBCASE("[Correct usage] many objects stay valid while the pool grows")
+                {
+                    std::vector<llri::Fence*> fences(200);
+                    for (auto*& fence : fences)
+                        fence = detail::defaultFence(device, false);
+
+                    for (auto* fence : fences)
+                        CHECK_EQ(device->resolve(fence->getHandle()), fence);
+
+                    for (auto* fence : fences)
+                        device->destroyFence(fence);
+                }
+
+                SUBCASE("[Correct usage] objects are created, resolved and destroyed on several threads")
+                {
+                    const auto desc = llri::resource_desc::buffer(llri::resource_usage_flag_bits::TransferSrc, llri::memory_type::Upload, llri::resource_state::Upload, 256);
+
+                    std::atomic<uint32_t> failures { 0 };
+                    std::vector<std::thread> threads;
+                    for (size_t t = 0; t < 4; t++)
+                    {
+                        threads.emplace_back([device, &desc, &failures]
+                        {
+                            std::vector<llri::Resource*> resources(100, nullptr);
+                            for (auto*& resource : resources)
+                            {
+                                if (device->createResource(desc, &resource) != llri::result::Success)
+                                    failures++;
+                            }
+
+                            for (auto* resource : resources)
+                            {
+                                if (resource == nullptr)
+                                    continue;
+
+                                const llri::handle<llri::Resource> handle = resource->getHandle();
+                                if (device->resolve(handle) != resource)
+                                    failures++;
+
+                                device->destroyResource(resource);
+                                if (device->resolve(handle) != nullptr)
+                                    failures++;
+                            }
+                        });
+                    }
+
+                    for (auto& thread : threads)
+                        thread.join();
+
+                    CHECK_EQ(failures.load(), 0);
+                }
+            }
+
             instance->destroyDevice(device);
         });
 
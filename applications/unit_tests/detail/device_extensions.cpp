@@ -5,6 +5,633 @@
  */
 
 #include <llri/llri.hpp>
+#include <helpers.hpp>
 #include <doctest/doctest.h>
 
-// reserved for future use
+#ifndef _WIN32
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+namespace
+{
+    llri::CommandList* recordBarriers(llri::CommandGroup* group, uint32_t count, llri::Resource* resource)
+    {
+        auto* list = detail::defaultCommandList(group, 0, llri::command_list_usage::Direct);
+
+        const std::vector<llri::resource_barrier> barriers(count, llri::resource_barrier::read_write(resource));
+        REQUIRE_EQ(list->begin(llri::command_list_begin_desc {}), llri::result::Success);
+        REQUIRE_EQ(list->resourceBarrier(count, barriers.data()), llri::result::Success);
+        REQUIRE_EQ(list->end(), llri::result::Success);
+        return list;
+    }
+
+    llri::resource_desc exportableBufferDesc(uint32_t size)
+    {
+        return llri::resource_desc::buffer(llri::resource_usage_flag_bits::TransferSrc, llri::memory_type::Upload, llri::resource_state::Upload, size);
+    }
+
+#ifndef _WIN32
+    /**
+     * @brief Creates a Device with extension and a Queue of every available type on the adapter named adapterName, or returns nullptr if that fails.
+     * This runs in a child process, so it reports failures through its return value instead of doctest.
+    */
+    llri::Device* createChildDevice(llri::Instance* instance, const std::string& adapterName, llri::adapter_extension extension)
+    {
+        std::vector<llri::Adapter*> adapters;
+        if (instance->enumerateAdapters(&adapters) != llri::result::Success)
+            return nullptr;
+
+        for (auto* adapter : adapters)
+        {
+            if (adapter->queryInfo().adapterName != adapterName)
+                continue;
+
+            std::vector<llri::queue_desc> queues;
+            for (size_t type = 0; type <= static_cast<uint8_t>(llri::queue_type::MaxEnum); type++)
+            {
+                if (adapter->queryQueueCount(static_cast<llri::queue_type>(type)) > 0)
+                    queues.push_back(llri::queue_desc { static_cast<llri::queue_type>(type), llri::queue_priority::Normal });
+            }
+
+            llri::Device* device;
+            if (instance->createDevice(llri::device_desc { adapter, llri::adapter_features {}, 1, &extension, static_cast<uint32_t>(queues.size()), queues.data() }, &device) != llri::result::Success)
+                return nullptr;
+
+            return device;
+        }
+
+        return nullptr;
+    }
+
+    /**
+     * @brief Imports fd into a new Device on the adapter named adapterName, and fills the memory with i * 3.
+    */
+    bool writeFromOtherProcess(const std::string& adapterName, const llri::resource_desc& desc, int fd)
+    {
+        llri::Instance* instance;
+        if (llri::createInstance(llri::instance_desc { 0, nullptr, "unit test child process" }, &instance) != llri::result::Success)
+            return false;
+
+        bool written = false;
+        auto* device = createChildDevice(instance, adapterName, llri::adapter_extension::ExternalMemoryFd);
+        if (device)
+        {
+            llri::Resource* resource;
+            if (device->importResourceMemoryFdEXT(desc, llri::external_memory_handle_type_ext::OpaqueFd, fd, &resource) == llri::result::Success)
+            {
+                void* data;
+                if (device->mapResource(resource, &data) == llri::result::Success)
+                {
+                    for (uint32_t i = 0; i < desc.width; i++)
+                        static_cast<uint8_t*>(data)[i] = static_cast<uint8_t>(i * 3);
+
+                    device->unmapResource(resource);
+                    written = true;
+                }
+
+                device->destroyResource(resource);
+            }
+
+            instance->destroyDevice(device);
+        }
+
+        llri::destroyInstance(instance);
+        return written;
+    }
+
+    /**
+     * @brief Imports the sync fd into a Semaphore of a new Device on the adapter named adapterName, and waits for a submission that waits on the Semaphore to complete.
+    */
+    bool waitInOtherProcess(const std::string& adapterName, int fd)
+    {
+        llri::Instance* instance;
+        if (llri::createInstance(llri::instance_desc { 0, nullptr, "unit test child process" }, &instance) != llri::result::Success)
+            return false;
+
+        bool waited = false;
+        auto* device = createChildDevice(instance, adapterName, llri::adapter_extension::ExternalSemaphoreFd);
+        if (device)
+        {
+            llri::queue_type type = llri::queue_type::Graphics;
+            while (device->queryQueueCount(type) == 0 && type < llri::queue_type::MaxEnum)
+                type = static_cast<llri::queue_type>(static_cast<uint8_t>(type) + 1);
+
+            llri::Semaphore* semaphore = nullptr;
+            llri::Fence* fence = nullptr;
+            llri::CommandGroup* group = nullptr;
+            llri::CommandList* list = nullptr;
+            if (device->createSemaphore(&semaphore) == llri::result::Success &&
+                device->createFence(llri::fence_flag_bits::None, &fence) == llri::result::Success &&
+                device->createCommandGroup(type, &group) == llri::result::Success &&
+                group->allocate(llri::command_list_alloc_desc { 0, llri::command_list_usage::Direct }, &list) == llri::result::Success &&
+                list->begin(llri::command_list_begin_desc {}) == llri::result::Success &&
+                list->end() == llri::result::Success &&
+                device->importSemaphoreSyncFdEXT(semaphore, fd) == llri::result::Success)
+            {
+                waited = device->getQueue(type, 0)->submit(llri::submit_desc { 0, 1, &list, 1, &semaphore, 0, nullptr, fence }) == llri::result::Success &&
+                    device->waitFence(fence, LLRI_TIMEOUT_MAX) == llri::result::Success;
+            }
+
+            device->destroyCommandGroup(group);
+            device->destroyFence(fence);
+            device->destroySemaphore(semaphore);
+            instance->destroyDevice(device);
+        }
+
+        llri::destroyInstance(instance);
+        return waited;
+    }
+
+    /**
+     * @brief Child process entry with the arguments adapterName, fd and the buffer size.
+    */
+    int writeFromOtherProcessEntry(int argc, char** argv)
+    {
+        if (argc != 3)
+            return EXIT_FAILURE;
+
+        const auto size = static_cast<uint32_t>(std::stoul(argv[2]));
+        return writeFromOtherProcess(argv[0], exportableBufferDesc(size), std::stoi(argv[1])) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    const bool writeFromOtherProcessRegistered = detail::registerChildProcess("external memory writer", writeFromOtherProcessEntry);
+
+    /**
+     * @brief Child process entry with the arguments adapterName and the sync fd.
+    */
+    int waitInOtherProcessEntry(int argc, char** argv)
+    {
+        if (argc != 2)
+            return EXIT_FAILURE;
+
+        return waitInOtherProcess(argv[0], std::stoi(argv[1])) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    const bool waitInOtherProcessRegistered = detail::registerChildProcess("external semaphore waiter", waitInOtherProcessEntry);
+#endif
+}
+
+TEST_CASE("adapter_extension::SimulatedTiming")
+{
+    auto* instance = detail::defaultInstance();
+
+    detail::iterateAdapters(instance, [instance](llri::Adapter* adapter) {
+        SUBCASE("[Incorrect usage] the extension wasn't enabled")
+        {
+            auto* device = detail::defaultDevice(instance, adapter);
+
+            uint64_t time;
+            CHECK_EQ(device->setSimulatedTimingEXT(llri::queue_type::Graphics, llri::simulated_timing_desc_ext {}), llri::result::ErrorExtensionNotEnabled);
+            CHECK_EQ(device->querySimulatedTimeEXT(&time), llri::result::ErrorExtensionNotEnabled);
+            CHECK_EQ(device->advanceSimulatedTimeEXT(1), llri::result::ErrorExtensionNotEnabled);
+
+            instance->destroyDevice(device);
+        }
+
+        auto* device = detail::createDeviceWithExtension(instance, adapter, llri::adapter_extension::SimulatedTiming);
+        if (!device)
+            return;
+
+        const llri::queue_type type = detail::availableQueueType(adapter);
+        auto* queue = device->getQueue(type, 0);
+        auto* group = detail::defaultCommandGroup(device, type);
+        auto* fence = detail::defaultFence(device, false);
+
+        llri::Resource* buffer;
+        const auto bufferDesc = llri::resource_desc::buffer(llri::resource_usage_flag_bits::ShaderWrite, llri::memory_type::Local, llri::resource_state::ShaderReadWrite, 1024);
+        REQUIRE_EQ(device->createResource(bufferDesc, &buffer), llri::result::Success);
+
+        SUBCASE("[Incorrect usage] invalid parameters")
+        {
+            CHECK_EQ(device->setSimulatedTimingEXT(static_cast<llri::queue_type>(static_cast<uint8_t>(llri::queue_type::MaxEnum) + 1), llri::simulated_timing_desc_ext {}), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(device->querySimulatedTimeEXT(nullptr), llri::result::ErrorInvalidUsage);
+        }
+
+        SUBCASE("[Correct usage] the simulated time starts at 0 and only advances when requested")
+        {
+            uint64_t time;
+            REQUIRE_EQ(device->querySimulatedTimeEXT(&time), llri::result::Success);
+            CHECK_EQ(time, 0);
+
+            REQUIRE_EQ(device->advanceSimulatedTimeEXT(100), llri::result::Success);
+            REQUIRE_EQ(device->querySimulatedTimeEXT(&time), llri::result::Success);
+            CHECK_EQ(time, 100);
+        }
+
+        SUBCASE("[Correct usage] waiting for a Fence advances the simulated time by the cost of the submission")
+        {
+            REQUIRE_EQ(device->setSimulatedTimingEXT(type, llri::simulated_timing_desc_ext { 10, 0, 100, 50 }), llri::result::Success);
+
+            auto* list = recordBarriers(group, 5, buffer);
+            const llri::submit_desc submitDesc { 0, 1, &list, 0, nullptr, 0, nullptr, fence };
+            REQUIRE_EQ(queue->submit(submitDesc), llri::result::Success);
+
+            // the fence signals at 100 (submit) + 5 * 10 (barriers) + 50 (fence)
+            CHECK_EQ(device->waitFence(fence, 0), llri::result::Timeout);
+            CHECK_EQ(device->waitFence(fence, LLRI_TIMEOUT_MAX), llri::result::Success);
+
+            uint64_t time;
+            REQUIRE_EQ(device->querySimulatedTimeEXT(&time), llri::result::Success);
+            CHECK_EQ(time, 200);
+
+            // submissions on the same queue execute in order
+            REQUIRE_EQ(queue->submit(submitDesc), llri::result::Success);
+            REQUIRE_EQ(queue->submit(llri::submit_desc { 0, 1, &list, 0, nullptr, 0, nullptr, nullptr }), llri::result::Success);
+            REQUIRE_EQ(queue->waitIdle(), llri::result::Success);
+            REQUIRE_EQ(device->querySimulatedTimeEXT(&time), llri::result::Success);
+            CHECK_EQ(time, 200 + 100 + 5 * 10 + 5 * 10);
+        }
+
+        SUBCASE("[Correct usage] timestamps are written in simulated time")
+        {
+            REQUIRE_EQ(device->setSimulatedTimingEXT(type, llri::simulated_timing_desc_ext { 10, 0, 0, 0 }), llri::result::Success);
+
+            llri::QueryPool* pool;
+            REQUIRE_EQ(device->createQueryPool(llri::query_pool_desc { llri::query_type::Timestamp, 2 }, &pool), llri::result::Success);
+
+            auto* list = detail::defaultCommandList(group, 0, llri::command_list_usage::Direct);
+            const std::vector<llri::resource_barrier> barriers(4, llri::resource_barrier::read_write(buffer));
+            REQUIRE_EQ(list->begin(llri::command_list_begin_desc {}), llri::result::Success);
+            REQUIRE_EQ(list->writeTimestamp(pool, 0), llri::result::Success);
+            REQUIRE_EQ(list->resourceBarrier(4, barriers.data()), llri::result::Success);
+            REQUIRE_EQ(list->writeTimestamp(pool, 1), llri::result::Success);
+            REQUIRE_EQ(list->end(), llri::result::Success);
+
+            REQUIRE_EQ(queue->submit(llri::submit_desc { 0, 1, &list, 0, nullptr, 0, nullptr, fence }), llri::result::Success);
+            REQUIRE_EQ(device->waitFence(fence, LLRI_TIMEOUT_MAX), llri::result::Success);
+
+            std::array<uint64_t, 2> timestamps {};
+            REQUIRE_EQ(pool->getResults(0, 2, timestamps.data()), llri::result::Success);
+            CHECK_EQ(timestamps[1] - timestamps[0], 5 * 10);
+
+            device->destroyQueryPool(pool);
+        }
+
+        SUBCASE("[Correct usage] a submission starts after the semaphores that it waits on are signaled")
+        {
+            if (adapter->queryQueueCount(llri::queue_type::Compute) > 0 && type != llri::queue_type::Compute)
+            {
+                REQUIRE_EQ(device->setSimulatedTimingEXT(type, llri::simulated_timing_desc_ext { 100, 0, 0, 0 }), llri::result::Success);
+                REQUIRE_EQ(device->setSimulatedTimingEXT(llri::queue_type::Compute, llri::simulated_timing_desc_ext { 10, 0, 0, 0 }), llri::result::Success);
+
+                llri::Semaphore* semaphore;
+                REQUIRE_EQ(device->createSemaphore(&semaphore), llri::result::Success);
+
+                auto* computeGroup = detail::defaultCommandGroup(device, llri::queue_type::Compute);
+                auto* list = recordBarriers(group, 3, buffer);
+                auto* computeList = recordBarriers(computeGroup, 1, buffer);
+
+                REQUIRE_EQ(queue->submit(llri::submit_desc { 0, 1, &list, 0, nullptr, 1, &semaphore, nullptr }), llri::result::Success);
+                REQUIRE_EQ(device->getQueue(llri::queue_type::Compute, 0)->submit(llri::submit_desc { 0, 1, &computeList, 1, &semaphore, 0, nullptr, fence }), llri::result::Success);
+                REQUIRE_EQ(device->waitFence(fence, LLRI_TIMEOUT_MAX), llri::result::Success);
+
+                uint64_t time;
+                REQUIRE_EQ(device->querySimulatedTimeEXT(&time), llri::result::Success);
+                CHECK_EQ(time, 3 * 100 + 1 * 10);
+
+                device->destroyCommandGroup(computeGroup);
+                device->destroySemaphore(semaphore);
+            }
+        }
+
+        device->destroyResource(buffer);
+        device->destroyFence(fence);
+        device->destroyCommandGroup(group);
+        instance->destroyDevice(device);
+    });
+
+    llri::destroyInstance(instance);
+}
+
+TEST_CASE("adapter_extension::HostMemoryImport")
+{
+    auto* instance = detail::defaultInstance();
+
+    detail::iterateAdapters(instance, [instance](llri::Adapter* adapter) {
+        const uint64_t alignment = adapter->queryLimits().hostMemoryImportAlignment;
+        CHECK_EQ(alignment > 0, adapter->queryExtensionSupport(llri::adapter_extension::HostMemoryImport));
+
+        // over-allocate so that two aligned pages fit in the memory
+        const auto size = static_cast<uint32_t>(alignment * 2);
+        std::vector<uint8_t> memory(static_cast<size_t>(alignment * 3));
+        void* data = memory.data();
+        size_t space = memory.size();
+        std::align(static_cast<size_t>(alignment), size, data, space);
+
+        SUBCASE("[Incorrect usage] the extension wasn't enabled")
+        {
+            auto* device = detail::defaultDevice(instance, adapter);
+
+            llri::Resource* resource;
+            CHECK_EQ(device->importHostMemoryEXT(memory.data(), 4096, &resource), llri::result::ErrorExtensionNotEnabled);
+
+            instance->destroyDevice(device);
+        }
+
+        auto* device = detail::createDeviceWithExtension(instance, adapter, llri::adapter_extension::HostMemoryImport);
+        if (!device)
+            return;
+
+        SUBCASE("[Incorrect usage] invalid parameters")
+        {
+            llri::Resource* resource;
+            CHECK_EQ(device->importHostMemoryEXT(nullptr, size, &resource), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(device->importHostMemoryEXT(data, 0, &resource), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(device->importHostMemoryEXT(data, size, nullptr), llri::result::ErrorInvalidUsage);
+
+            // data and size aren't aligned
+            CHECK_EQ(device->importHostMemoryEXT(static_cast<uint8_t*>(data) + 1, size, &resource), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(device->importHostMemoryEXT(data, size - 1, &resource), llri::result::ErrorInvalidUsage);
+        }
+
+        SUBCASE("[Correct usage] the device copies from the host memory")
+        {
+            for (uint32_t i = 0; i < size; i++)
+                static_cast<uint8_t*>(data)[i] = static_cast<uint8_t>(i * 7);
+
+            llri::Resource* imported;
+            REQUIRE_EQ(device->importHostMemoryEXT(data, size, &imported), llri::result::Success);
+            CHECK_EQ(imported->getDesc().memoryType, llri::memory_type::Upload);
+            CHECK_EQ(imported->getDesc().width, size);
+            CHECK_EQ(imported->getHeap(), nullptr);
+
+            void* mapped;
+            REQUIRE_EQ(device->mapResource(imported, &mapped), llri::result::Success);
+            CHECK_EQ(std::memcmp(mapped, data, size), 0);
+            device->unmapResource(imported);
+
+            // the null implementation has no device memory to copy through
+            if (llri::getImplementation() != llri::implementation::Null && adapter->queryQueueCount(llri::queue_type::Graphics) > 0)
+            {
+                llri::Resource* readback;
+                REQUIRE_EQ(device->createResource(llri::resource_desc::buffer(llri::resource_usage_flag_bits::TransferDst, llri::memory_type::Read, llri::resource_state::TransferDst, size), &readback), llri::result::Success);
+
+                auto* group = detail::defaultCommandGroup(device, llri::queue_type::Graphics);
+                auto* cmd = detail::defaultCommandList(group, 0, llri::command_list_usage::Direct);
+                REQUIRE_EQ(cmd->record(llri::command_list_begin_desc {}, [=](llri::CommandList* c)
+                {
+                    CHECK_EQ(c->copyBuffer(imported, 0, readback, 0, size), llri::result::Success);
+                }, cmd), llri::result::Success);
+
+                auto* fence = detail::defaultFence(device, false);
+                REQUIRE_EQ(device->getQueue(llri::queue_type::Graphics, 0)->submit(llri::submit_desc { 0, 1, &cmd, 0, nullptr, 0, nullptr, fence }), llri::result::Success);
+                REQUIRE_EQ(device->waitFence(fence, LLRI_TIMEOUT_MAX), llri::result::Success);
+
+                REQUIRE_EQ(device->mapResource(readback, &mapped), llri::result::Success);
+                CHECK_EQ(std::memcmp(mapped, data, size), 0);
+                device->unmapResource(readback);
+
+                device->destroyFence(fence);
+                device->destroyCommandGroup(group);
+                device->destroyResource(readback);
+            }
+
+            // the host memory is still owned by the application after the buffer is destroyed
+            device->destroyResource(imported);
+            CHECK_EQ(static_cast<uint8_t*>(data)[size - 1], static_cast<uint8_t>((size - 1) * 7));
+        }
+
+        instance->destroyDevice(device);
+    });
+
+    llri::destroyInstance(instance);
+}
+
+TEST_CASE("adapter_extension::ExternalMemoryFd")
+{
+    auto* instance = detail::defaultInstance();
+
+    detail::iterateAdapters(instance, [instance](llri::Adapter* adapter) {
+        constexpr uint32_t size = 4096;
+        const auto desc = exportableBufferDesc(size);
+
+        SUBCASE("[Incorrect usage] the extension wasn't enabled")
+        {
+            auto* device = detail::defaultDevice(instance, adapter);
+
+            llri::Resource* buffer;
+            REQUIRE_EQ(device->createResource(desc, &buffer), llri::result::Success);
+
+            llri::Resource* resource;
+            int fd;
+            CHECK_EQ(device->createExportableResourceEXT(desc, llri::external_memory_handle_type_ext::OpaqueFd, &resource), llri::result::ErrorExtensionNotEnabled);
+            CHECK_EQ(device->exportResourceMemoryFdEXT(buffer, &fd), llri::result::ErrorExtensionNotEnabled);
+            CHECK_EQ(device->importResourceMemoryFdEXT(desc, llri::external_memory_handle_type_ext::OpaqueFd, 0, &resource), llri::result::ErrorExtensionNotEnabled);
+
+            device->destroyResource(buffer);
+            instance->destroyDevice(device);
+        }
+
+        auto* device = detail::createDeviceWithExtension(instance, adapter, llri::adapter_extension::ExternalMemoryFd);
+        if (!device)
+            return;
+
+        SUBCASE("[Incorrect usage] invalid parameters")
+        {
+            const auto invalidType = static_cast<llri::external_memory_handle_type_ext>(static_cast<uint8_t>(llri::external_memory_handle_type_ext::MaxEnum) + 1);
+            llri::resource_desc texture {};
+            texture.type = llri::resource_type::Texture2D;
+            texture.usage = llri::resource_usage_flag_bits::Sampled;
+            texture.memoryType = llri::memory_type::Local;
+            texture.initialState = llri::resource_state::ShaderReadOnly;
+            texture.width = 16;
+            texture.height = 16;
+            texture.depthOrArrayLayers = 1;
+            texture.mipLevels = 1;
+            texture.sampleCount = llri::sample_count::Count1;
+            texture.textureFormat = llri::format::RGBA8UNorm;
+
+            llri::Resource* resource;
+            CHECK_EQ(device->createExportableResourceEXT(desc, invalidType, &resource), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(device->createExportableResourceEXT(desc, llri::external_memory_handle_type_ext::OpaqueFd, nullptr), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(device->createExportableResourceEXT(texture, llri::external_memory_handle_type_ext::DmaBuf, &resource), llri::result::ErrorInvalidUsage);
+
+            CHECK_EQ(device->importResourceMemoryFdEXT(desc, invalidType, 0, &resource), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(device->importResourceMemoryFdEXT(desc, llri::external_memory_handle_type_ext::OpaqueFd, -1, &resource), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(device->importResourceMemoryFdEXT(desc, llri::external_memory_handle_type_ext::OpaqueFd, 0, nullptr), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(device->importResourceMemoryFdEXT(texture, llri::external_memory_handle_type_ext::DmaBuf, 0, &resource), llri::result::ErrorInvalidUsage);
+
+            // only resources created through createExportableResourceEXT() can be exported
+            llri::Resource* buffer;
+            REQUIRE_EQ(device->createResource(desc, &buffer), llri::result::Success);
+
+            int fd;
+            CHECK_EQ(device->exportResourceMemoryFdEXT(nullptr, &fd), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(device->exportResourceMemoryFdEXT(buffer, nullptr), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(device->exportResourceMemoryFdEXT(buffer, &fd), llri::result::ErrorInvalidUsage);
+
+            device->destroyResource(buffer);
+        }
+
+#ifndef _WIN32
+        SUBCASE("[Correct usage] another process writes to the exported memory")
+        {
+            llri::Resource* resource;
+            REQUIRE_EQ(device->createExportableResourceEXT(desc, llri::external_memory_handle_type_ext::OpaqueFd, &resource), llri::result::Success);
+
+            int fd;
+            REQUIRE_EQ(device->exportResourceMemoryFdEXT(resource, &fd), llri::result::Success);
+            CHECK_GE(fd, 0);
+
+            // exported descriptors are close-on-exec, so clear that for the child to inherit it like a process that receives it over a UNIX domain socket would
+            REQUIRE_UNARY(writeFromOtherProcessRegistered);
+            REQUIRE_NE(fcntl(fd, F_SETFD, 0), -1);
+            CHECK_EQ(detail::runChildProcess("external memory writer", { adapter->queryInfo().adapterName, std::to_string(fd), std::to_string(size) }), EXIT_SUCCESS);
+            close(fd);
+
+            std::vector<uint8_t> expected(size);
+            for (uint32_t i = 0; i < size; i++)
+                expected[i] = static_cast<uint8_t>(i * 3);
+
+            void* data;
+            REQUIRE_EQ(device->mapResource(resource, &data), llri::result::Success);
+            CHECK_EQ(std::memcmp(data, expected.data(), size), 0);
+            device->unmapResource(resource);
+
+            device->destroyResource(resource);
+        }
+#endif
+
+        instance->destroyDevice(device);
+    });
+
+    llri::destroyInstance(instance);
+}
+
+TEST_CASE("adapter_extension::ExternalSemaphoreFd")
+{
+    auto* instance = detail::defaultInstance();
+
+    detail::iterateAdapters(instance, [instance](llri::Adapter* adapter) {
+        SUBCASE("[Incorrect usage] the extension wasn't enabled")
+        {
+            auto* device = detail::defaultDevice(instance, adapter);
+
+            llri::Semaphore* semaphore;
+            REQUIRE_EQ(device->createSemaphore(&semaphore), llri::result::Success);
+
+            llri::Semaphore* exportable;
+            int fd;
+            CHECK_EQ(device->createExportableSemaphoreEXT(&exportable), llri::result::ErrorExtensionNotEnabled);
+            CHECK_EQ(device->exportSemaphoreSyncFdEXT(semaphore, &fd), llri::result::ErrorExtensionNotEnabled);
+            CHECK_EQ(device->importSemaphoreSyncFdEXT(semaphore, -1), llri::result::ErrorExtensionNotEnabled);
+
+            device->destroySemaphore(semaphore);
+            instance->destroyDevice(device);
+        }
+
+        auto* device = detail::createDeviceWithExtension(instance, adapter, llri::adapter_extension::ExternalSemaphoreFd);
+        if (!device)
+            return;
+
+        llri::Semaphore* exportable;
+        llri::Semaphore* semaphore;
+        REQUIRE_EQ(device->createExportableSemaphoreEXT(&exportable), llri::result::Success);
+        REQUIRE_EQ(device->createSemaphore(&semaphore), llri::result::Success);
+
+        SUBCASE("[Incorrect usage] invalid parameters")
+        {
+            int fd;
+            CHECK_EQ(device->createExportableSemaphoreEXT(nullptr), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(device->exportSemaphoreSyncFdEXT(nullptr, &fd), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(device->exportSemaphoreSyncFdEXT(exportable, nullptr), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(device->importSemaphoreSyncFdEXT(nullptr, -1), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(device->importSemaphoreSyncFdEXT(semaphore, -2), llri::result::ErrorInvalidUsage);
+
+            // only Semaphores created through createExportableSemaphoreEXT() can be exported
+            CHECK_EQ(device->exportSemaphoreSyncFdEXT(semaphore, &fd), llri::result::ErrorInvalidUsage);
+        }
+
+        SUBCASE("[Correct usage] a submission waits on an exported signal")
+        {
+            const llri::queue_type type = detail::availableQueueType(adapter);
+            auto* queue = device->getQueue(type, 0);
+            auto* group = detail::defaultCommandGroup(device, type);
+            auto* fence = detail::defaultFence(device, false);
+
+            llri::Resource* buffer;
+            REQUIRE_EQ(device->createResource(llri::resource_desc::buffer(llri::resource_usage_flag_bits::ShaderWrite, llri::memory_type::Local, llri::resource_state::ShaderReadWrite, 256), &buffer), llri::result::Success);
+
+            auto* signalList = recordBarriers(group, 1, buffer);
+            auto* waitList = recordBarriers(group, 1, buffer);
+
+            // the signal crosses over to the other Semaphore through a sync file descriptor, as it would to another process
+            REQUIRE_EQ(queue->submit(llri::submit_desc { 0, 1, &signalList, 0, nullptr, 1, &exportable, nullptr }), llri::result::Success);
+
+            int fd;
+            REQUIRE_EQ(device->exportSemaphoreSyncFdEXT(exportable, &fd), llri::result::Success);
+            CHECK_GE(fd, -1);
+            REQUIRE_EQ(device->importSemaphoreSyncFdEXT(semaphore, fd), llri::result::Success);
+
+            REQUIRE_EQ(queue->submit(llri::submit_desc { 0, 1, &waitList, 1, &semaphore, 0, nullptr, fence }), llri::result::Success);
+            REQUIRE_EQ(device->waitFence(fence, LLRI_TIMEOUT_MAX), llri::result::Success);
+
+            // -1 imports a signal that has already completed
+            REQUIRE_EQ(device->importSemaphoreSyncFdEXT(semaphore, -1), llri::result::Success);
+            REQUIRE_EQ(queue->submit(llri::submit_desc { 0, 1, &waitList, 1, &semaphore, 0, nullptr, fence }), llri::result::Success);
+            REQUIRE_EQ(device->waitFence(fence, LLRI_TIMEOUT_MAX), llri::result::Success);
+
+            device->destroyResource(buffer);
+            device->destroyFence(fence);
+            device->destroyCommandGroup(group);
+        }
+
+#ifndef _WIN32
+        SUBCASE("[Correct usage] another process waits on an exported signal")
+        {
+            const llri::queue_type type = detail::availableQueueType(adapter);
+            auto* queue = device->getQueue(type, 0);
+            auto* group = detail::defaultCommandGroup(device, type);
+            auto* fence = detail::defaultFence(device, false);
+
+            llri::Resource* buffer;
+            REQUIRE_EQ(device->createResource(llri::resource_desc::buffer(llri::resource_usage_flag_bits::ShaderWrite, llri::memory_type::Local, llri::resource_state::ShaderReadWrite, 256), &buffer), llri::result::Success);
+
+            auto* signalList = recordBarriers(group, 1, buffer);
+            REQUIRE_EQ(queue->submit(llri::submit_desc { 0, 1, &signalList, 0, nullptr, 1, &exportable, fence }), llri::result::Success);
+
+            int fd;
+            REQUIRE_EQ(device->exportSemaphoreSyncFdEXT(exportable, &fd), llri::result::Success);
+            CHECK_GE(fd, -1);
+
+            // the submission may complete before the export, in which case the child receives -1 and treats the signal as completed
+            // other descriptors are close-on-exec, so they're made inheritable like the memory fd above
+            REQUIRE_UNARY(waitInOtherProcessRegistered);
+            if (fd >= 0)
+                REQUIRE_NE(fcntl(fd, F_SETFD, 0), -1);
+            CHECK_EQ(detail::runChildProcess("external semaphore waiter", { adapter->queryInfo().adapterName, std::to_string(fd) }), EXIT_SUCCESS);
+            if (fd >= 0)
+                close(fd);
+
+            REQUIRE_EQ(device->waitFence(fence, LLRI_TIMEOUT_MAX), llri::result::Success);
+
+            device->destroyResource(buffer);
+            device->destroyFence(fence);
+            device->destroyCommandGroup(group);
+        }
+#endif
+
+        device->destroySemaphore(exportable);
+        device->destroySemaphore(semaphore);
+        instance->destroyDevice(device);
+    });
+
+    llri::destroyInstance(instance);
+}
+
+TEST_CASE("to_string(adapter_extension)")
+{
+    CHECK_EQ(llri::to_string(llri::adapter_extension::SimulatedTiming), "SimulatedTiming");
+    CHECK_EQ(llri::to_string(llri::adapter_extension::HostMemoryImport), "HostMemoryImport");
+    CHECK_EQ(llri::to_string(llri::adapter_extension::ExternalMemoryFd), "ExternalMemoryFd");
+    CHECK_EQ(llri::to_string(llri::adapter_extension::ExternalSemaphoreFd), "ExternalSemaphoreFd");
+    CHECK_EQ(llri::to_string(static_cast<llri::adapter_extension>(static_cast<uint8_t>(llri::adapter_extension::MaxEnum) + 1)), "Invalid adapter_extension value");
+}
+
+TEST_CASE("to_string(external_memory_handle_type_ext)")
+{
+    CHECK_EQ(llri::to_string(llri::external_memory_handle_type_ext::OpaqueFd), "OpaqueFd");
+    CHECK_EQ(llri::to_string(llri::external_memory_handle_type_ext::DmaBuf), "DmaBuf");
+    CHECK_EQ(llri::to_string(static_cast<llri::external_memory_handle_type_ext>(static_cast<uint8_t>(llri::external_memory_handle_type_ext::MaxEnum) + 1)), "Invalid external_memory_handle_type_ext value");
+}
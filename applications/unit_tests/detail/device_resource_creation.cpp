@@ -127,3 +127,71 @@ TEST_CASE("Device::createResource()")
     
     llri::destroyInstance(instance);
 }
+
+TEST_CASE("Device::createResource() state requirements")
+{
+    auto* instance = detail::defaultInstance();
+
+    detail::iterateAdapters(instance, [instance](llri::Adapter* adapter) {
+        auto* device = detail::defaultDevice(instance, adapter);
+
+        SUBCASE("[Correct usage] Upload buffer in the Upload state")
+        {
+            const auto desc = llri::resource_desc::buffer(llri::resource_usage_flag_bits::TransferSrc, llri::memory_type::Upload, llri::resource_state::Upload, 1024);
+
+            llri::Resource* resource = nullptr;
+            const llri::result result = device->createResource(desc, &resource);
+            CHECK_UNARY(result == llri::result::Success || result == llri::result::ErrorOutOfDeviceMemory);
+            device->destroyResource(resource);
+        }
+
+        SUBCASE("[Incorrect usage] Upload buffer with ShaderWrite usage")
+        {
+            const auto desc = llri::resource_desc::buffer(llri::resource_usage_flag_bits::ShaderWrite, llri::memory_type::Upload, llri::resource_state::Upload, 1024);
+
+            llri::Resource* resource = nullptr;
+            CHECK_EQ(device->createResource(desc, &resource), llri::result::ErrorInvalidUsage);
+        }
+
+        SUBCASE("[Incorrect usage] Local buffer in the Upload state")
+        {
+            const auto desc = llri::resource_desc::buffer(llri::resource_usage_flag_bits::TransferSrc, llri::memory_type::Local, llri::resource_state::Upload, 1024);
+
+            llri::Resource* resource = nullptr;
+            CHECK_EQ(device->createResource(desc, &resource), llri::result::ErrorInvalidUsage);
+        }
+
+        SUBCASE("[Incorrect usage] buffer in a texture-only state")
+        {
+            const auto desc = llri::resource_desc::buffer(llri::resource_usage_flag_bits::None, llri::memory_type::Local, llri::resource_state::ColorAttachment, 1024);
+
+            llri::Resource* resource = nullptr;
+            CHECK_EQ(device->createResource(desc, &resource), llri::result::ErrorInvalidUsage);
+        }
+
+        SUBCASE("[Correct usage] Concurrent buffer")
+        {
+            const auto desc = llri::resource_desc::buffer(llri::resource_usage_flag_bits::TransferDst, llri::memory_type::Local, llri::resource_state::General, 1024, 0, 0, llri::resource_sharing_mode::Concurrent);
+
+            llri::Resource* resource = nullptr;
+            const llri::result result = device->createResource(desc, &resource);
+            CHECK_UNARY(result == llri::result::Success || result == llri::result::ErrorOutOfDeviceMemory);
+            if (resource != nullptr)
+                CHECK_EQ(resource->getDesc().sharingMode, llri::resource_sharing_mode::Concurrent);
+            device->destroyResource(resource);
+        }
+
+        SUBCASE("[Incorrect usage] sharingMode is more than resource_sharing_mode::MaxEnum")
+        {
+            auto desc = llri::resource_desc::buffer(llri::resource_usage_flag_bits::TransferDst, llri::memory_type::Local, llri::resource_state::General, 1024);
+            desc.sharingMode = static_cast<llri::resource_sharing_mode>(std::numeric_limits<uint8_t>::max());
+
+            llri::Resource* resource = nullptr;
+            CHECK_EQ(device->createResource(desc, &resource), llri::result::ErrorInvalidUsage);
+        }
+
+        instance->destroyDevice(device);
+    });
+
+    llri::destroyInstance(instance);
+}
@@ -0,0 +1,131 @@
+/**
+ * @file image_loader.cpp
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#define STB_IMAGE_IMPLEMENTATION
+#include <llri/image.hpp>
+#include <helpers.hpp>
+#include <doctest/doctest.h>
+
+#include <filesystem>
+
+namespace
+{
+    // a binary PPM file, which every stb_image build decodes
+    std::string writeImage(const std::string& name, uint32_t width, uint32_t height)
+    {
+        const std::string path = (std::filesystem::temp_directory_path() / name).string();
+        std::ofstream stream(path, std::ios::binary);
+        stream << "P6\n" << width << " " << height << "\n255\n";
+        for (uint32_t i = 0; i < width * height * 3; i++)
+            stream.put(static_cast<char>(i * 7));
+        return path;
+    }
+}
+
+TEST_CASE("image_loader")
+{
+    auto* instance = detail::defaultInstance();
+
+    const std::string path = writeImage("llri_image_loader.ppm", 20, 12);
+    const std::string invalidPath = (std::filesystem::temp_directory_path() / "llri_image_loader_invalid.ppm").string();
+    std::ofstream(invalidPath, std::ios::binary) << "not an image";
+
+    detail::iterateAdapters(instance, [instance, &path, &invalidPath](llri::Adapter* adapter) {
+        if (adapter->queryQueueCount(llri::queue_type::Graphics) == 0)
+            return;
+
+        auto* device = detail::defaultDevice(instance, adapter);
+
+        llri::streaming_uploader uploader;
+        REQUIRE_EQ(uploader.create(device, llri::streaming_uploader_desc { 4 * 1024, 0, llri::queue_type::Graphics, 0 }), llri::result::Success);
+
+        SUBCASE("[Incorrect usage] invalid create() and load() parameters")
+        {
+            llri::image_loader loader;
+            llri::image_request request;
+            CHECK_EQ(loader.load(path, &request), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(loader.update(), llri::result::ErrorInvalidUsage);
+
+            CHECK_EQ(loader.create(nullptr, llri::image_loader_desc { &uploader, 1, false, false, llri::resource_state::ShaderReadOnly, 0 }), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(loader.create(device, llri::image_loader_desc { nullptr, 1, false, false, llri::resource_state::ShaderReadOnly, 0 }), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(loader.create(device, llri::image_loader_desc { &uploader, 1, false, false, static_cast<llri::resource_state>(UINT8_MAX), 0 }), llri::result::ErrorInvalidUsage);
+
+            REQUIRE_EQ(loader.create(device, llri::image_loader_desc { &uploader, 1, false, false, llri::resource_state::ShaderReadOnly, 0 }), llri::result::Success);
+            CHECK_EQ(loader.load("", &request), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(loader.load(path, nullptr), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(loader.queryStatus(llri::image_request {}), llri::image_status::Failed);
+            CHECK_EQ(loader.getTexture(llri::image_request {}), nullptr);
+        }
+
+        SUBCASE("[Incorrect usage] files that can't be loaded")
+        {
+            llri::image_loader loader;
+            REQUIRE_EQ(loader.create(device, llri::image_loader_desc { &uploader, 2, false, false, llri::resource_state::ShaderReadOnly, 0 }), llri::result::Success);
+
+            llri::image_request missing, invalid;
+            REQUIRE_EQ(loader.load((std::filesystem::temp_directory_path() / "llri_image_loader_missing.ppm").string(), &missing), llri::result::Success);
+            REQUIRE_EQ(loader.load(invalidPath, &invalid), llri::result::Success);
+
+            CHECK_EQ(detail::waitWhileLoading(loader, uploader, missing), llri::image_status::Failed);
+            CHECK_EQ(detail::waitWhileLoading(loader, uploader, invalid), llri::image_status::Failed);
+            CHECK_EQ(loader.getTexture(invalid), nullptr);
+        }
+
+        SUBCASE("[Incorrect usage] mip levels that don't fit in the staging buffer")
+        {
+            llri::streaming_uploader small;
+            REQUIRE_EQ(small.create(device, llri::streaming_uploader_desc { 1024, 0, llri::queue_type::Graphics, 0 }), llri::result::Success);
+
+            llri::image_loader loader;
+            REQUIRE_EQ(loader.create(device, llri::image_loader_desc { &small, 1, false, false, llri::resource_state::ShaderReadOnly, 0 }), llri::result::Success);
+
+            llri::image_request request;
+            REQUIRE_EQ(loader.load(path, &request), llri::result::Success);
+            CHECK_EQ(detail::waitWhileLoading(loader, small, request), llri::image_status::Failed);
+
+            loader.destroy();
+            small.destroy();
+        }
+
+        SUBCASE("[Correct usage] images with and without mip levels")
+        {
+            for (bool generateMips : { false, true })
+            {
+                llri::image_loader loader;
+                REQUIRE_EQ(loader.create(device, llri::image_loader_desc { &uploader, 0, generateMips, true, llri::resource_state::ShaderReadOnly, 0 }), llri::result::Success);
+
+                // mip 0 and mip 1 don't fit in the staging buffer together, so they're flushed separately
+                std::array<llri::image_request, 3> requests;
+                for (auto& request : requests)
+                    REQUIRE_EQ(loader.load(path, &request), llri::result::Success);
+
+                for (const auto& request : requests)
+                {
+                    REQUIRE_EQ(detail::waitWhileLoading(loader, uploader, request), llri::image_status::Complete);
+
+                    auto* texture = loader.getTexture(request);
+                    REQUIRE_NE(texture, nullptr);
+
+                    const llri::resource_desc desc = texture->getDesc();
+                    CHECK_EQ(desc.type, llri::resource_type::Texture2D);
+                    CHECK_EQ(desc.width, 20u);
+                    CHECK_EQ(desc.height, 12u);
+                    CHECK_EQ(desc.mipLevels, generateMips ? 4 : 1);
+                    CHECK_EQ(desc.textureFormat, llri::format::RGBA8sRGB);
+                }
+
+                loader.destroy();
+            }
+        }
+
+        uploader.destroy();
+        instance->destroyDevice(device);
+    });
+
+    llri::destroyInstance(instance);
+    std::filesystem::remove(path);
+    std::filesystem::remove(invalidPath);
+}
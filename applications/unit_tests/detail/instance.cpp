@@ -69,6 +69,45 @@ TEST_SUITE("Instance")
             CHECK_EQ(llri::createInstance(desc, &instance), llri::result::Success);
         }
 
+        SUBCASE("[Incorrect usage] validationLevel > validation_level::MaxEnum")
+        {
+            desc.validationLevel = static_cast<llri::validation_level>(std::numeric_limits<uint8_t>::max());
+            CHECK_EQ(llri::createInstance(desc, &instance), llri::result::ErrorInvalidUsage);
+        }
+
+        SUBCASE("[Correct usage] validationLevel == validation_level::Disabled")
+        {
+            desc.validationLevel = llri::validation_level::Disabled;
+            CHECK_EQ(llri::createInstance(desc, &instance), llri::result::Success);
+        }
+
+        llri::destroyInstance(instance);
+    }
+
+    TEST_CASE("createInstance() validation levels")
+    {
+        llri::Instance* instance = nullptr;
+        auto extension = static_cast<llri::instance_extension>(std::numeric_limits<uint8_t>::max());
+        llri::instance_desc desc { 1, &extension, "" };
+
+        SUBCASE("[Incorrect usage] validation_level::Basic still checks pointers")
+        {
+            desc.validationLevel = llri::validation_level::Basic;
+            CHECK_EQ(llri::createInstance(desc, nullptr), llri::result::ErrorInvalidUsage);
+        }
+
+        SUBCASE("[Incorrect usage] validation_level::Basic still checks enum values")
+        {
+            desc.validationLevel = llri::validation_level::Basic;
+            CHECK_EQ(llri::createInstance(desc, &instance), llri::result::ErrorExtensionNotSupported);
+        }
+
+        SUBCASE("[Incorrect usage] validation_level::Full checks enum values")
+        {
+            desc.validationLevel = llri::validation_level::Full;
+            CHECK_EQ(llri::createInstance(desc, &instance), llri::result::ErrorExtensionNotSupported);
+        }
+
         llri::destroyInstance(instance);
     }
 
@@ -191,6 +230,19 @@ TEST_SUITE("Instance")
                 // Reserved for future use (no current extensions supported to test this)
             }
 
+            SUBCASE("features.pipelineStatisticsQuery")
+            {
+                ddesc.numQueues = 1;
+                ddesc.queues = &queue;
+                ddesc.features.pipelineStatisticsQuery = true;
+
+                auto r = instance->createDevice(ddesc, &device);
+                if (adapter->queryFeatures().pipelineStatisticsQuery)
+                    CHECK_UNARY(r == llri::result::Success || r == llri::result::ErrorDeviceLost);
+                else
+                    CHECK_EQ(r, llri::result::ErrorFeatureNotSupported);
+            }
+
             SUBCASE("[Incorrect usage] invalid extension type")
             {
                 auto extension = static_cast<llri::adapter_extension>(std::numeric_limits<uint8_t>::max());
@@ -0,0 +1,196 @@
+/**
+ * @file job_scheduler.cpp
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <llri/llri.hpp>
+#include <helpers.hpp>
+#include <doctest/doctest.h>
+
+TEST_CASE("job_scheduler")
+{
+    auto* instance = detail::defaultInstance();
+
+    detail::iterateAdapters(instance, [instance](llri::Adapter* adapter) {
+        if (adapter->queryQueueCount(llri::queue_type::Graphics) == 0)
+            return;
+
+        auto* device = detail::defaultDeviceWithQueues(instance, adapter, detail::allQueues(adapter));
+        auto* graphicsGroup = detail::defaultCommandGroup(device, llri::queue_type::Graphics);
+
+        SUBCASE("[Incorrect usage] invalid create() and schedule() parameters")
+        {
+            llri::job_scheduler scheduler;
+            llri::job output;
+            llri::CommandList* cmd = detail::emptyRecordedList(graphicsGroup);
+
+            CHECK_EQ(scheduler.create(nullptr), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(scheduler.schedule(llri::job_desc { 1, &cmd, 0, nullptr }, &output), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(scheduler.flush(), llri::result::ErrorInvalidUsage);
+
+            REQUIRE_EQ(scheduler.create(device), llri::result::Success);
+            CHECK_EQ(scheduler.schedule(llri::job_desc { 1, &cmd, 0, nullptr }, nullptr), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(scheduler.schedule(llri::job_desc { 0, &cmd, 0, nullptr }, &output), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(scheduler.schedule(llri::job_desc { 1, nullptr, 0, nullptr }, &output), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(scheduler.schedule(llri::job_desc { 1, &cmd, 1, nullptr }, &output), llri::result::ErrorInvalidUsage);
+
+            llri::CommandList* nullList = nullptr;
+            CHECK_EQ(scheduler.schedule(llri::job_desc { 1, &nullList, 0, nullptr }, &output), llri::result::ErrorInvalidUsage);
+
+            // jobs can only depend on jobs that were scheduled since the last flush()
+            const llri::job unscheduled { 0 };
+            CHECK_EQ(scheduler.schedule(llri::job_desc { 1, &cmd, 1, &unscheduled }, &output), llri::result::ErrorInvalidUsage);
+
+            if (adapter->queryQueueCount(llri::queue_type::Compute) > 0)
+            {
+                auto* computeGroup = detail::defaultCommandGroup(device, llri::queue_type::Compute);
+                llri::CommandList* mixed[] = { cmd, detail::emptyRecordedList(computeGroup) };
+                CHECK_EQ(scheduler.schedule(llri::job_desc { 2, mixed, 0, nullptr }, &output), llri::result::ErrorInvalidUsage);
+                device->destroyCommandGroup(computeGroup);
+            }
+        }
+
+        SUBCASE("[Correct usage] a dependency on the same Queue requires no Semaphore")
+        {
+            llri::job_scheduler scheduler;
+            REQUIRE_EQ(scheduler.create(device), llri::result::Success);
+
+            llri::CommandList* first = detail::emptyRecordedList(graphicsGroup);
+            llri::CommandList* second = detail::emptyRecordedList(graphicsGroup);
+
+            llri::job a, b;
+            REQUIRE_EQ(scheduler.schedule(llri::job_desc { 1, &first, 0, nullptr }, &a), llri::result::Success);
+            REQUIRE_EQ(scheduler.schedule(llri::job_desc { 1, &second, 1, &a }, &b), llri::result::Success);
+            CHECK_EQ(a.index, 0);
+            CHECK_EQ(b.index, 1);
+
+            std::vector<llri::job_submission> submissions;
+            REQUIRE_EQ(scheduler.flush(&submissions), llri::result::Success);
+            REQUIRE_EQ(submissions.size(), 2);
+            CHECK_EQ(submissions[0].queueIndex, submissions[1].queueIndex);
+            CHECK_EQ(submissions[1].numWaitSemaphores, 0);
+            CHECK_EQ(submissions[0].numSignalSemaphores, 0);
+            CHECK_EQ(scheduler.wait(), llri::result::Success);
+
+            // flush() invalidates previously scheduled jobs
+            CHECK_EQ(scheduler.schedule(llri::job_desc { 1, &second, 1, &a }, &b), llri::result::ErrorInvalidUsage);
+        }
+
+        const uint8_t computeQueueCount = adapter->queryQueueCount(llri::queue_type::Compute);
+        if (computeQueueCount > 0)
+        {
+            auto* computeGroup = detail::defaultCommandGroup(device, llri::queue_type::Compute);
+
+            SUBCASE("[Correct usage] cross-queue dependencies wait on a single Semaphore")
+            {
+                llri::job_scheduler scheduler;
+                REQUIRE_EQ(scheduler.create(device), llri::result::Success);
+
+                llri::CommandList* graphics = detail::emptyRecordedList(graphicsGroup);
+                llri::CommandList* compute = detail::emptyRecordedList(computeGroup);
+                llri::CommandList* present = detail::emptyRecordedList(graphicsGroup);
+
+                // present depends on both graphics and compute, but graphics already completes before present on the graphics Queue
+                llri::job a, b, c;
+                REQUIRE_EQ(scheduler.schedule(llri::job_desc { 1, &graphics, 0, nullptr }, &a), llri::result::Success);
+                REQUIRE_EQ(scheduler.schedule(llri::job_desc { 1, &compute, 1, &a }, &b), llri::result::Success);
+                const llri::job dependencies[] = { a, b, b };
+                REQUIRE_EQ(scheduler.schedule(llri::job_desc { 1, &present, 3, dependencies }, &c), llri::result::Success);
+
+                std::vector<llri::job_submission> submissions;
+                REQUIRE_EQ(scheduler.flush(&submissions), llri::result::Success);
+                REQUIRE_EQ(submissions.size(), 3);
+                CHECK_EQ(submissions[0].queueType, llri::queue_type::Graphics);
+                CHECK_EQ(submissions[1].queueType, llri::queue_type::Compute);
+                CHECK_EQ(submissions[2].queueType, llri::queue_type::Graphics);
+
+                CHECK_EQ(submissions[0].numSignalSemaphores, 1);
+                CHECK_EQ(submissions[1].numWaitSemaphores, 1);
+                CHECK_EQ(submissions[1].numSignalSemaphores, 1);
+                CHECK_EQ(submissions[2].numWaitSemaphores, 1);
+                CHECK_EQ(scheduler.wait(), llri::result::Success);
+            }
+
+            SUBCASE("[Correct usage] dependencies that are implied through other Queues aren't waited on")
+            {
+                llri::job_scheduler scheduler;
+                REQUIRE_EQ(scheduler.create(device), llri::result::Success);
+
+                llri::CommandList* graphics = detail::emptyRecordedList(graphicsGroup);
+                llri::CommandList* compute = detail::emptyRecordedList(computeGroup);
+                llri::CommandList* final = detail::emptyRecordedList(computeGroup);
+
+                // final depends on graphics and on compute, which already waits on graphics
+                llri::job a, b, c;
+                REQUIRE_EQ(scheduler.schedule(llri::job_desc { 1, &graphics, 0, nullptr }, &a), llri::result::Success);
+                REQUIRE_EQ(scheduler.schedule(llri::job_desc { 1, &compute, 1, &a }, &b), llri::result::Success);
+                const llri::job dependencies[] = { a, b };
+                REQUIRE_EQ(scheduler.schedule(llri::job_desc { 1, &final, 2, dependencies }, &c), llri::result::Success);
+
+                std::vector<llri::job_submission> submissions;
+                REQUIRE_EQ(scheduler.flush(&submissions), llri::result::Success);
+                REQUIRE_EQ(submissions.size(), 3);
+                CHECK_EQ(submissions[2].queueType, llri::queue_type::Compute);
+                CHECK_EQ(submissions[2].queueIndex, submissions[1].queueIndex);
+                CHECK_EQ(submissions[2].numWaitSemaphores, 0);
+                CHECK_EQ(submissions[0].numSignalSemaphores, 1);
+                CHECK_EQ(scheduler.wait(), llri::result::Success);
+            }
+
+            if (computeQueueCount > 1)
+            {
+                SUBCASE("[Correct usage] independent jobs are spread over Queues of the same type")
+                {
+                    llri::job_scheduler scheduler;
+                    REQUIRE_EQ(scheduler.create(device), llri::result::Success);
+
+                    llri::CommandList* first = detail::emptyRecordedList(computeGroup);
+                    llri::CommandList* second = detail::emptyRecordedList(computeGroup);
+                    llri::CommandList* third = detail::emptyRecordedList(computeGroup);
+
+                    llri::job a, b, c;
+                    REQUIRE_EQ(scheduler.schedule(llri::job_desc { 1, &first, 0, nullptr }, &a), llri::result::Success);
+                    REQUIRE_EQ(scheduler.schedule(llri::job_desc { 1, &second, 0, nullptr }, &b), llri::result::Success);
+                    REQUIRE_EQ(scheduler.schedule(llri::job_desc { 1, &third, 1, &b }, &c), llri::result::Success);
+
+                    std::vector<llri::job_submission> submissions;
+                    REQUIRE_EQ(scheduler.flush(&submissions), llri::result::Success);
+                    REQUIRE_EQ(submissions.size(), 3);
+                    CHECK_NE(submissions[0].queueIndex, submissions[1].queueIndex);
+                    CHECK_EQ(submissions[2].queueIndex, submissions[1].queueIndex);
+                    CHECK_EQ(submissions[2].numWaitSemaphores, 0);
+                    CHECK_EQ(scheduler.wait(), llri::result::Success);
+                }
+            }
+
+            SUBCASE("[Correct usage] jobs can be flushed every frame")
+            {
+                llri::job_scheduler scheduler;
+                REQUIRE_EQ(scheduler.create(device), llri::result::Success);
+
+                for (size_t frame = 0; frame < 3; frame++)
+                {
+                    llri::CommandList* graphics = detail::emptyRecordedList(graphicsGroup);
+                    llri::CommandList* compute = detail::emptyRecordedList(computeGroup);
+
+                    llri::job a, b;
+                    REQUIRE_EQ(scheduler.schedule(llri::job_desc { 1, &graphics, 0, nullptr }, &a), llri::result::Success);
+                    REQUIRE_EQ(scheduler.schedule(llri::job_desc { 1, &compute, 1, &a }, &b), llri::result::Success);
+                    REQUIRE_EQ(scheduler.flush(), llri::result::Success);
+                    REQUIRE_EQ(scheduler.wait(), llri::result::Success);
+
+                    REQUIRE_EQ(graphicsGroup->reset(), llri::result::Success);
+                    REQUIRE_EQ(computeGroup->reset(), llri::result::Success);
+                }
+            }
+
+            device->destroyCommandGroup(computeGroup);
+        }
+
+        device->destroyCommandGroup(graphicsGroup);
+        instance->destroyDevice(device);
+    });
+
+    llri::destroyInstance(instance);
+}
@@ -0,0 +1,187 @@
+/**
+ * @file lifetime.cpp
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <llri/llri.hpp>
+#include <helpers.hpp>
+#include <doctest/doctest.h>
+
+namespace
+{
+    void collectWarnings(llri::message_severity severity, [[maybe_unused]] llri::message_source source, const char* message, void* userData)
+    {
+        if (severity == llri::message_severity::Warning)
+            static_cast<std::vector<std::string>*>(userData)->emplace_back(message);
+    }
+
+    llri::Instance* trackingInstance(std::vector<std::string>* warnings)
+    {
+        llri::instance_desc desc {};
+        desc.applicationName = "unit test instance";
+        desc.messageCallback = &collectWarnings;
+        desc.messageUserData = warnings;
+        desc.trackObjectLifetimes = true;
+
+        llri::Instance* instance;
+        REQUIRE_EQ(llri::createInstance(desc, &instance), llri::result::Success);
+        return instance;
+    }
+
+    bool containsWarning(const std::vector<std::string>& warnings, const std::string& text)
+    {
+        return std::any_of(warnings.begin(), warnings.end(), [&text](const std::string& warning) { return warning.find(text) != std::string::npos; });
+    }
+}
+
+TEST_CASE("Object lifetime tracking")
+{
+    std::vector<std::string> warnings;
+    auto* instance = trackingInstance(&warnings);
+
+    detail::iterateAdapters(instance, [instance, &warnings](llri::Adapter* adapter) {
+        auto* device = detail::defaultDevice(instance, adapter);
+        REQUIRE_EQ(instance->queryLiveObjects().devices, 1);
+
+        SUBCASE("[Correct usage] a new Device has no live objects")
+        {
+            CHECK_UNARY(device->queryLiveObjects().empty());
+        }
+
+        SUBCASE("[Correct usage] objects are live until they're destroyed")
+        {
+            const llri::queue_type type = detail::availableQueueType(adapter);
+            auto* group = detail::defaultCommandGroup(device, type);
+
+            std::vector<llri::CommandList*> lists;
+            REQUIRE_EQ(group->allocate(llri::command_list_alloc_desc { 0, llri::command_list_usage::Direct }, 3, &lists), llri::result::Success);
+
+            auto* fence = detail::defaultFence(device, false);
+
+            llri::Semaphore* semaphore;
+            REQUIRE_EQ(device->createSemaphore(&semaphore), llri::result::Success);
+
+            llri::Resource* resource;
+            REQUIRE_EQ(device->createResource(llri::resource_desc::buffer(llri::resource_usage_flag_bits::TransferSrc, llri::memory_type::Upload, llri::resource_state::Upload, 1024), &resource), llri::result::Success);
+
+            llri::live_objects objects = device->queryLiveObjects();
+            CHECK_EQ(objects.devices, 0);
+            CHECK_EQ(objects.commandGroups, 1);
+            CHECK_EQ(objects.commandLists, 3);
+            CHECK_EQ(objects.fences, 1);
+            CHECK_EQ(objects.semaphores, 1);
+            CHECK_EQ(objects.resources, 1);
+            CHECK_GE(objects.resourceBytes[static_cast<size_t>(llri::memory_type::Upload)], 1024);
+            CHECK_EQ(objects.resourceBytes[static_cast<size_t>(llri::memory_type::Local)], 0);
+
+            // the Instance includes the objects of its Devices
+            CHECK_EQ(instance->queryLiveObjects().resources, 1);
+
+            REQUIRE_EQ(group->free(lists[0]), llri::result::Success);
+            CHECK_EQ(device->queryLiveObjects().commandLists, 2);
+
+            // destroying the CommandGroup frees its remaining CommandLists
+            device->destroyCommandGroup(group);
+            device->destroyFence(fence);
+            device->destroySemaphore(semaphore);
+            device->destroyResource(resource);
+
+            objects = device->queryLiveObjects();
+            CHECK_UNARY(objects.empty());
+            CHECK_EQ(objects.commandLists, 0);
+            CHECK_EQ(objects.resourceBytes[static_cast<size_t>(llri::memory_type::Upload)], 0);
+        }
+
+        SUBCASE("[Correct usage] placed resources are counted without bytes of their own")
+        {
+            llri::MemoryHeap* heap;
+            REQUIRE_EQ(device->createMemoryHeap(llri::memory_heap_desc { 0, 0, 4096, llri::memory_type::Upload }, &heap), llri::result::Success);
+
+            llri::Resource* resource;
+            REQUIRE_EQ(device->createPlacedResource(heap, 0, llri::resource_desc::buffer(llri::resource_usage_flag_bits::TransferSrc, llri::memory_type::Upload, llri::resource_state::Upload, 1024), &resource), llri::result::Success);
+
+            const llri::live_objects objects = device->queryLiveObjects();
+            CHECK_EQ(objects.memoryHeaps, 1);
+            CHECK_EQ(objects.resources, 1);
+            CHECK_EQ(objects.resourceBytes[static_cast<size_t>(llri::memory_type::Upload)], 4096);
+
+            device->destroyResource(resource);
+            device->destroyMemoryHeap(heap);
+            CHECK_UNARY(device->queryLiveObjects().empty());
+        }
+
+        SUBCASE("[Correct usage] objects that fail to be created are not counted")
+        {
+            CHECK_EQ(device->createResource(llri::resource_desc {}, nullptr), llri::result::ErrorInvalidUsage);
+            CHECK_UNARY(device->queryLiveObjects().empty());
+        }
+
+        SUBCASE("[Correct usage] destroying a Device reports its live objects")
+        {
+            auto* fence = detail::defaultFence(device, false);
+
+            warnings.clear();
+            instance->destroyDevice(device);
+            device = nullptr;
+
+            REQUIRE_EQ(warnings.size(), 1);
+            CHECK_UNARY(containsWarning(warnings, "Device was destroyed while it still had live objects: 1 Fence."));
+            CHECK_EQ(instance->queryLiveObjects().devices, 0);
+            CHECK_EQ(instance->queryLiveObjects().fences, 1);
+
+            // the Fence's Device is gone, so it can't be destroyed anymore
+            static_cast<void>(fence);
+        }
+
+        warnings.clear();
+        instance->destroyDevice(device);
+        CHECK_UNARY(warnings.empty());
+    });
+
+    llri::destroyInstance(instance);
+}
+
+TEST_CASE("Object lifetime tracking reports on destroyInstance()")
+{
+    std::vector<std::string> warnings;
+    auto* instance = trackingInstance(&warnings);
+
+    std::vector<llri::Adapter*> adapters;
+    REQUIRE_EQ(instance->enumerateAdapters(&adapters), llri::result::Success);
+    REQUIRE_UNARY(!adapters.empty());
+
+    detail::defaultDevice(instance, adapters[0]);
+
+    llri::destroyInstance(instance);
+    CHECK_UNARY(containsWarning(warnings, "Instance was destroyed while it still had live objects: 1 Device."));
+}
+
+TEST_CASE("Object lifetime tracking is disabled by default")
+{
+    auto* instance = detail::defaultInstance();
+
+    detail::iterateAdapters(instance, [instance](llri::Adapter* adapter) {
+        auto* device = detail::defaultDevice(instance, adapter);
+        auto* fence = detail::defaultFence(device, false);
+
+        CHECK_UNARY(device->queryLiveObjects().empty());
+        CHECK_UNARY(instance->queryLiveObjects().empty());
+
+        device->destroyFence(fence);
+        instance->destroyDevice(device);
+    });
+
+    llri::destroyInstance(instance);
+}
+
+TEST_CASE("to_string(live_objects)")
+{
+    llri::live_objects objects {};
+    CHECK_EQ(llri::to_string(objects), "no live objects");
+
+    objects.devices = 1;
+    objects.resources = 2;
+    objects.resourceBytes[static_cast<size_t>(llri::memory_type::Local)] = 4096;
+    CHECK_EQ(llri::to_string(objects), "1 Device, 2 Resources (Local: 4096 bytes)");
+}
@@ -0,0 +1,254 @@
+/**
+ * @file memory_heap.cpp
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <llri/llri.hpp>
+#include <helpers.hpp>
+#include <doctest/doctest.h>
+
+namespace
+{
+    llri::resource_desc renderTargetDesc()
+    {
+        llri::resource_desc desc {};
+        desc.type = llri::resource_type::Texture2D;
+        desc.usage = llri::resource_usage_flag_bits::ColorAttachment | llri::resource_usage_flag_bits::Sampled;
+        desc.memoryType = llri::memory_type::Local;
+        desc.initialState = llri::resource_state::ColorAttachment;
+        desc.width = 256;
+        desc.height = 256;
+        desc.depthOrArrayLayers = 1;
+        desc.mipLevels = 1;
+        desc.sampleCount = llri::sample_count::Count1;
+        desc.textureFormat = llri::format::RGBA8UNorm;
+        return desc;
+    }
+}
+
+TEST_CASE("MemoryHeap")
+{
+    auto* instance = detail::defaultInstance();
+
+    detail::iterateAdapters(instance, [instance](llri::Adapter* adapter) {
+        auto* device = detail::defaultDevice(instance, adapter);
+
+        const llri::resource_desc textureDesc = renderTargetDesc();
+        const llri::resource_desc uploadDesc = llri::resource_desc::buffer(llri::resource_usage_flag_bits::TransferSrc, llri::memory_type::Upload, llri::resource_state::Upload, 1024);
+
+        SUBCASE("Device::createMemoryHeap()")
+        {
+            llri::MemoryHeap* heap = nullptr;
+
+            SUBCASE("[Incorrect usage] heap == nullptr")
+            {
+                CHECK_EQ(device->createMemoryHeap(llri::memory_heap_desc { 0, 0, 1024, llri::memory_type::Local }, nullptr), llri::result::ErrorInvalidUsage);
+            }
+
+            SUBCASE("[Incorrect usage] desc.size == 0")
+            {
+                CHECK_EQ(device->createMemoryHeap(llri::memory_heap_desc { 0, 0, 0, llri::memory_type::Local }, &heap), llri::result::ErrorInvalidUsage);
+            }
+
+            SUBCASE("[Incorrect usage] desc.memoryType > memory_type::MaxEnum")
+            {
+                CHECK_EQ(device->createMemoryHeap(llri::memory_heap_desc { 0, 0, 1024, static_cast<llri::memory_type>(std::numeric_limits<uint8_t>::max()) }, &heap), llri::result::ErrorInvalidUsage);
+            }
+
+            SUBCASE("[Incorrect usage] desc.createNodeMask has multiple bits set")
+            {
+                CHECK_EQ(device->createMemoryHeap(llri::memory_heap_desc { 0b11, 0b11, 1024, llri::memory_type::Local }, &heap), llri::result::ErrorInvalidNodeMask);
+            }
+
+            SUBCASE("[Correct usage] a heap of each memory_type")
+            {
+                for (uint8_t type = 0; type <= static_cast<uint8_t>(llri::memory_type::MaxEnum); type++)
+                {
+                    const llri::memory_heap_desc desc { 0, 0, 64 * 1024, static_cast<llri::memory_type>(type) };
+                    REQUIRE_EQ(device->createMemoryHeap(desc, &heap), llri::result::Success);
+                    CHECK_EQ(heap->getDesc().size, desc.size);
+                    CHECK_EQ(heap->getDesc().memoryType, desc.memoryType);
+                    device->destroyMemoryHeap(heap);
+                }
+
+                heap = nullptr;
+            }
+
+            CHECK_UNARY(heap == nullptr);
+        }
+
+        SUBCASE("Device::queryResourceAllocationInfo()")
+        {
+            llri::resource_allocation_info info {};
+
+            SUBCASE("[Incorrect usage] info == nullptr")
+            {
+                CHECK_EQ(device->queryResourceAllocationInfo(textureDesc, nullptr), llri::result::ErrorInvalidUsage);
+            }
+
+            SUBCASE("[Incorrect usage] desc is invalid")
+            {
+                CHECK_EQ(device->queryResourceAllocationInfo(llri::resource_desc {}, &info), llri::result::ErrorInvalidUsage);
+            }
+
+            SUBCASE("[Correct usage] the size and alignment are reported")
+            {
+                REQUIRE_EQ(device->queryResourceAllocationInfo(textureDesc, &info), llri::result::Success);
+                CHECK_GE(info.size, 256u * 256u * 4u);
+                CHECK_GT(info.alignment, 0);
+                CHECK_EQ(info.alignment & (info.alignment - 1), 0);
+            }
+        }
+
+        SUBCASE("Device::createPlacedResource()")
+        {
+            llri::resource_allocation_info info {};
+            REQUIRE_EQ(device->queryResourceAllocationInfo(textureDesc, &info), llri::result::Success);
+
+            llri::MemoryHeap* heap;
+            REQUIRE_EQ(device->createMemoryHeap(llri::memory_heap_desc { 0, 0, info.size + info.alignment, llri::memory_type::Local }, &heap), llri::result::Success);
+
+            llri::Resource* resource = nullptr;
+
+            SUBCASE("[Incorrect usage] heap == nullptr")
+            {
+                CHECK_EQ(device->createPlacedResource(nullptr, 0, textureDesc, &resource), llri::result::ErrorInvalidUsage);
+            }
+
+            SUBCASE("[Incorrect usage] resource == nullptr")
+            {
+                CHECK_EQ(device->createPlacedResource(heap, 0, textureDesc, nullptr), llri::result::ErrorInvalidUsage);
+            }
+
+            SUBCASE("[Incorrect usage] desc.memoryType doesn't match the heap")
+            {
+                CHECK_EQ(device->createPlacedResource(heap, 0, uploadDesc, &resource), llri::result::ErrorInvalidUsage);
+            }
+
+            SUBCASE("[Incorrect usage] offset isn't aligned")
+            {
+                CHECK_EQ(device->createPlacedResource(heap, 1, textureDesc, &resource), llri::result::ErrorInvalidUsage);
+            }
+
+            SUBCASE("[Incorrect usage] the resource doesn't fit in the heap")
+            {
+                CHECK_EQ(device->createPlacedResource(heap, info.alignment * 2, textureDesc, &resource), llri::result::ErrorInvalidUsage);
+            }
+
+            SUBCASE("[Correct usage] resources at the same offset alias each other")
+            {
+                llri::Resource* other;
+                REQUIRE_EQ(device->createPlacedResource(heap, 0, textureDesc, &resource), llri::result::Success);
+                REQUIRE_EQ(device->createPlacedResource(heap, 0, textureDesc, &other), llri::result::Success);
+
+                CHECK_EQ(resource->getHeap(), heap);
+                CHECK_EQ(resource->getHeapOffset(), 0);
+                CHECK_EQ(other->getHeap(), heap);
+
+                device->destroyResource(other);
+                device->destroyResource(resource);
+                resource = nullptr;
+            }
+
+            SUBCASE("[Correct usage] resources created through createResource() aren't placed")
+            {
+                REQUIRE_EQ(device->createResource(textureDesc, &resource), llri::result::Success);
+                CHECK_UNARY(resource->getHeap() == nullptr);
+                CHECK_EQ(resource->getHeapOffset(), 0);
+
+                device->destroyResource(resource);
+                resource = nullptr;
+            }
+
+            CHECK_UNARY(resource == nullptr);
+            device->destroyMemoryHeap(heap);
+        }
+
+        SUBCASE("[Correct usage] mapped placed buffers share the heap's memory")
+        {
+            llri::resource_allocation_info info {};
+            REQUIRE_EQ(device->queryResourceAllocationInfo(uploadDesc, &info), llri::result::Success);
+
+            llri::MemoryHeap* heap;
+            REQUIRE_EQ(device->createMemoryHeap(llri::memory_heap_desc { 0, 0, info.size, llri::memory_type::Upload }, &heap), llri::result::Success);
+
+            llri::Resource* first;
+            llri::Resource* second;
+            REQUIRE_EQ(device->createPlacedResource(heap, 0, uploadDesc, &first), llri::result::Success);
+            REQUIRE_EQ(device->createPlacedResource(heap, 0, uploadDesc, &second), llri::result::Success);
+
+            void* data = nullptr;
+            REQUIRE_EQ(device->mapResource(first, &data), llri::result::Success);
+            std::memset(data, 0x5A, 1024);
+            device->unmapResource(first);
+
+            REQUIRE_EQ(device->mapResource(second, &data), llri::result::Success);
+            CHECK_EQ(static_cast<uint8_t*>(data)[0], 0x5A);
+            CHECK_EQ(static_cast<uint8_t*>(data)[1023], 0x5A);
+            device->unmapResource(second);
+
+            device->destroyResource(second);
+            device->destroyResource(first);
+            device->destroyMemoryHeap(heap);
+        }
+
+        SUBCASE("resource_barrier_type::Aliasing")
+        {
+            llri::resource_allocation_info info {};
+            REQUIRE_EQ(device->queryResourceAllocationInfo(textureDesc, &info), llri::result::Success);
+
+            llri::MemoryHeap* heap;
+            REQUIRE_EQ(device->createMemoryHeap(llri::memory_heap_desc { 0, 0, info.size, llri::memory_type::Local }, &heap), llri::result::Success);
+
+            llri::Resource* before;
+            llri::Resource* after;
+            llri::Resource* committed;
+            REQUIRE_EQ(device->createPlacedResource(heap, 0, textureDesc, &before), llri::result::Success);
+            REQUIRE_EQ(device->createPlacedResource(heap, 0, textureDesc, &after), llri::result::Success);
+            REQUIRE_EQ(device->createResource(textureDesc, &committed), llri::result::Success);
+
+            auto* group = detail::defaultCommandGroup(device, detail::availableQueueType(adapter));
+            auto* list = detail::defaultCommandList(group, 0, llri::command_list_usage::Direct);
+            REQUIRE_EQ(list->begin({}), llri::result::Success);
+
+            SUBCASE("[Incorrect usage] after == nullptr")
+            {
+                CHECK_EQ(list->resourceBarrier(llri::resource_barrier::aliasing(before, nullptr, llri::resource_state::ColorAttachment)), llri::result::ErrorInvalidUsage);
+            }
+
+            SUBCASE("[Incorrect usage] after isn't placed")
+            {
+                CHECK_EQ(list->resourceBarrier(llri::resource_barrier::aliasing(before, committed, llri::resource_state::ColorAttachment)), llri::result::ErrorInvalidUsage);
+            }
+
+            SUBCASE("[Incorrect usage] before isn't placed in the same heap as after")
+            {
+                CHECK_EQ(list->resourceBarrier(llri::resource_barrier::aliasing(committed, after, llri::resource_state::ColorAttachment)), llri::result::ErrorInvalidUsage);
+            }
+
+            SUBCASE("[Incorrect usage] afterState > resource_state::MaxEnum")
+            {
+                CHECK_EQ(list->resourceBarrier(llri::resource_barrier::aliasing(before, after, static_cast<llri::resource_state>(std::numeric_limits<uint8_t>::max()))), llri::result::ErrorInvalidUsage);
+            }
+
+            SUBCASE("[Correct usage] switching between aliased resources")
+            {
+                CHECK_EQ(list->resourceBarrier(llri::resource_barrier::aliasing(before, after, llri::resource_state::ColorAttachment)), llri::result::Success);
+                CHECK_EQ(list->resourceBarrier(llri::resource_barrier::aliasing(nullptr, before, llri::resource_state::ColorAttachment)), llri::result::Success);
+            }
+
+            REQUIRE_EQ(list->end(), llri::result::Success);
+
+            device->destroyCommandGroup(group);
+            device->destroyResource(committed);
+            device->destroyResource(after);
+            device->destroyResource(before);
+            device->destroyMemoryHeap(heap);
+        }
+
+        instance->destroyDevice(device);
+    });
+
+    llri::destroyInstance(instance);
+}
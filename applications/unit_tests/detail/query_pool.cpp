@@ -0,0 +1,131 @@
+/**
+ * @file query_pool.cpp
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <llri/llri.hpp>
+#include <helpers.hpp>
+#include <doctest/doctest.h>
+
+TEST_CASE("QueryPool")
+{
+    auto* instance = detail::defaultInstance();
+
+    detail::iterateAdapters(instance, [instance](llri::Adapter* adapter) {
+        auto* device = detail::defaultDevice(instance, adapter);
+
+        llri::QueryPool* pool;
+        REQUIRE_EQ(device->createQueryPool(llri::query_pool_desc { llri::query_type::Timestamp, 4 }, &pool), llri::result::Success);
+
+        SUBCASE("QueryPool::getResults()")
+        {
+            std::array<uint64_t, 4> results {};
+
+            SUBCASE("[Incorrect usage] results == nullptr")
+            {
+                CHECK_EQ(pool->getResults(0, 4, nullptr), llri::result::ErrorInvalidUsage);
+            }
+
+            SUBCASE("[Incorrect usage] count == 0")
+            {
+                CHECK_EQ(pool->getResults(0, 0, results.data()), llri::result::ErrorInvalidUsage);
+            }
+
+            SUBCASE("[Incorrect usage] first + count > desc.count")
+            {
+                CHECK_EQ(pool->getResults(1, 4, results.data()), llri::result::ErrorInvalidUsage);
+                CHECK_EQ(pool->getResults(std::numeric_limits<uint32_t>::max(), 2, results.data()), llri::result::ErrorInvalidUsage);
+            }
+        }
+
+        SUBCASE("[Correct usage] timestamps are readable after their CommandList completed")
+        {
+            if (adapter->queryQueueCount(llri::queue_type::Graphics) > 0 && adapter->queryLimits().timestampPeriod > 0.0f)
+            {
+                auto* group = detail::defaultCommandGroup(device, llri::queue_type::Graphics);
+                auto* list = detail::defaultCommandList(group, 0, llri::command_list_usage::Direct);
+                auto* fence = detail::defaultFence(device, false);
+
+                REQUIRE_EQ(list->record(llri::command_list_begin_desc {}, [=](llri::CommandList* cmd)
+                {
+                    CHECK_EQ(cmd->resetQueries(pool, 0, 2), llri::result::Success);
+                    CHECK_EQ(cmd->writeTimestamp(pool, 0), llri::result::Success);
+                    CHECK_EQ(cmd->writeTimestamp(pool, 1), llri::result::Success);
+                }, list), llri::result::Success);
+
+                const llri::submit_desc submitDesc { 0, 1, &list, 0, nullptr, 0, nullptr, fence };
+                REQUIRE_EQ(device->getQueue(llri::queue_type::Graphics, 0)->submit(submitDesc), llri::result::Success);
+                REQUIRE_EQ(device->waitFence(fence, LLRI_TIMEOUT_MAX), llri::result::Success);
+
+                std::array<uint64_t, 2> results {};
+                CHECK_EQ(pool->getResults(0, 2, results.data()), llri::result::Success);
+                CHECK_LE(results[0], results[1]);
+
+                device->destroyFence(fence);
+                device->destroyCommandGroup(group);
+            }
+        }
+
+        device->destroyQueryPool(pool);
+        instance->destroyDevice(device);
+    });
+
+    llri::destroyInstance(instance);
+}
+
+TEST_CASE("query_pool_ring")
+{
+    auto* instance = detail::defaultInstance();
+
+    detail::iterateAdapters(instance, [instance](llri::Adapter* adapter) {
+        auto* device = detail::defaultDevice(instance, adapter);
+        const llri::query_pool_desc desc { llri::query_type::Timestamp, 4 };
+
+        SUBCASE("[Incorrect usage] device == nullptr or numFrames == 0")
+        {
+            llri::query_pool_ring ring;
+            CHECK_EQ(ring.create(nullptr, desc, 3), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(ring.create(device, desc, 0), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(ring.current(), nullptr);
+            CHECK_EQ(ring.oldest(), nullptr);
+        }
+
+        SUBCASE("[Correct usage] pools cycle once per frame")
+        {
+            llri::query_pool_ring ring;
+            REQUIRE_EQ(ring.create(device, desc, 3), llri::result::Success);
+
+            llri::QueryPool* first = ring.current();
+            REQUIRE_NE(first, nullptr);
+            CHECK_EQ(ring.oldest(), nullptr);
+
+            ring.advance();
+            CHECK_NE(ring.current(), first);
+            CHECK_EQ(ring.oldest(), nullptr);
+
+            // first becomes current() again after the next advance(), so its results are read through oldest()
+            ring.advance();
+            CHECK_EQ(ring.oldest(), first);
+
+            ring.advance();
+            CHECK_EQ(ring.current(), first);
+            CHECK_EQ(ring.frame(), 3);
+
+            ring.destroy();
+            CHECK_EQ(ring.current(), nullptr);
+        }
+
+        instance->destroyDevice(device);
+    });
+
+    llri::destroyInstance(instance);
+}
+
+TEST_CASE("queryResultCount()")
+{
+    CHECK_EQ(llri::queryResultCount(llri::query_type::Timestamp), 1);
+    CHECK_EQ(llri::queryResultCount(llri::query_type::Occlusion), 1);
+    CHECK_EQ(llri::queryResultCount(llri::query_type::PipelineStatistics), sizeof(llri::pipeline_statistics) / sizeof(uint64_t));
+    CHECK_EQ(llri::queryResultCount(static_cast<llri::query_type>(static_cast<uint8_t>(llri::query_type::MaxEnum) + 1)), 0);
+}
@@ -197,3 +197,91 @@ TEST_CASE("Queue")
     
     llri::destroyInstance(instance);
 }
+
+TEST_CASE("queue_pool")
+{
+    auto* instance = detail::defaultInstance();
+
+    detail::iterateAdapters(instance, [instance](llri::Adapter* adapter) {
+        // request every queue of the type with the most queues, so that there's something to spread submissions over
+        llri::queue_type type = llri::queue_type::Graphics;
+        for (uint8_t t = 0; t <= static_cast<uint8_t>(llri::queue_type::MaxEnum); t++)
+        {
+            if (adapter->queryQueueCount(static_cast<llri::queue_type>(t)) > adapter->queryQueueCount(type))
+                type = static_cast<llri::queue_type>(t);
+        }
+
+        const uint8_t count = adapter->queryQueueCount(type);
+        if (count == 0)
+            return;
+
+        auto* device = detail::defaultDeviceWithQueues(instance, adapter, std::vector<llri::queue_desc>(count, llri::queue_desc { type, llri::queue_priority::Normal }));
+        auto* group = detail::defaultCommandGroup(device, type);
+
+        SUBCASE("[Incorrect usage] invalid create() and submit() parameters")
+        {
+            llri::queue_pool pool;
+            CHECK_EQ(pool.create(nullptr, type, llri::queue_pool_policy::RoundRobin), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(pool.create(device, static_cast<llri::queue_type>(std::numeric_limits<uint8_t>::max()), llri::queue_pool_policy::RoundRobin), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(pool.create(device, type, static_cast<llri::queue_pool_policy>(std::numeric_limits<uint8_t>::max())), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(pool.queryQueueCount(), 0);
+
+            llri::CommandList* cmd = detail::emptyRecordedList(group);
+            CHECK_EQ(pool.submit(llri::submit_desc { 0, 1, &cmd, 0, nullptr, 0, nullptr, nullptr }), llri::result::ErrorInvalidUsage);
+
+            // the pool signals its own fence
+            REQUIRE_EQ(pool.create(device, type, llri::queue_pool_policy::RoundRobin), llri::result::Success);
+            auto* fence = detail::defaultFence(device, false);
+            CHECK_EQ(pool.submit(llri::submit_desc { 0, 1, &cmd, 0, nullptr, 0, nullptr, fence }), llri::result::ErrorInvalidUsage);
+            device->destroyFence(fence);
+        }
+
+        SUBCASE("[Correct usage] RoundRobin cycles through all queues")
+        {
+            llri::queue_pool pool;
+            REQUIRE_EQ(pool.create(device, type, llri::queue_pool_policy::RoundRobin), llri::result::Success);
+            CHECK_EQ(pool.queryQueueCount(), count);
+
+            std::vector<llri::queue_pool_ticket> tickets;
+            for (size_t i = 0; i < static_cast<size_t>(count) * 2; i++)
+            {
+                llri::CommandList* cmd = detail::emptyRecordedList(group);
+                REQUIRE_EQ(pool.submit(llri::submit_desc { 0, 1, &cmd, 0, nullptr, 0, nullptr, nullptr }, &tickets.emplace_back()), llri::result::Success);
+                CHECK_EQ(tickets.back().queueIndex, i % count);
+                CHECK_EQ(tickets.back().value, i / count + 1);
+            }
+
+            CHECK_EQ(pool.wait(tickets.front()), llri::result::Success);
+            CHECK_UNARY(pool.isComplete(tickets.front()));
+
+            CHECK_EQ(pool.waitIdle(), llri::result::Success);
+            for (const auto& ticket : tickets)
+                CHECK_UNARY(pool.isComplete(ticket));
+
+            for (uint8_t i = 0; i < count; i++)
+                CHECK_EQ(pool.queryLoad(i), 0);
+        }
+
+        SUBCASE("[Correct usage] LeastLoaded prefers idle queues")
+        {
+            llri::queue_pool pool;
+            REQUIRE_EQ(pool.create(device, type, llri::queue_pool_policy::LeastLoaded), llri::result::Success);
+
+            for (size_t frame = 0; frame < 3; frame++)
+            {
+                // all queues are idle after waitIdle(), so the first submission goes to the first queue
+                llri::CommandList* cmd = detail::emptyRecordedList(group);
+                llri::queue_pool_ticket ticket;
+                REQUIRE_EQ(pool.submit(llri::submit_desc { 0, 1, &cmd, 0, nullptr, 0, nullptr, nullptr }, &ticket), llri::result::Success);
+                CHECK_EQ(ticket.queueIndex, 0);
+                CHECK_EQ(pool.waitIdle(), llri::result::Success);
+                CHECK_EQ(pool.queryLoad(0), 0);
+            }
+        }
+
+        device->destroyCommandGroup(group);
+        instance->destroyDevice(device);
+    });
+
+    llri::destroyInstance(instance);
+}
@@ -0,0 +1,319 @@
+/**
+ * @file render_graph.cpp
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <llri/graph.hpp>
+#include <helpers.hpp>
+#include <doctest/doctest.h>
+
+namespace
+{
+    llri::resource_desc transientBuffer(uint32_t size)
+    {
+        return llri::resource_desc::buffer(llri::resource_usage_flag_bits::TransferSrc | llri::resource_usage_flag_bits::TransferDst | llri::resource_usage_flag_bits::ShaderWrite, llri::memory_type::Local, llri::resource_state::General, size);
+    }
+
+    void noCommands([[maybe_unused]] llri::CommandList* cmd) { }
+}
+
+TEST_CASE("render_graph")
+{
+    auto* instance = detail::defaultInstance();
+
+    detail::iterateAdapters(instance, [instance](llri::Adapter* adapter) {
+        if (adapter->queryQueueCount(llri::queue_type::Graphics) == 0)
+            return;
+
+        auto* device = detail::defaultDevice(instance, adapter);
+        const bool hasCompute = adapter->queryQueueCount(llri::queue_type::Compute) > 0;
+        const bool hasTransfer = adapter->queryQueueCount(llri::queue_type::Transfer) > 0;
+
+        SUBCASE("render_graph::create()")
+        {
+            llri::render_graph graph;
+            CHECK_EQ(graph.create(nullptr, llri::render_graph_desc {}), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(graph.create(device, llri::render_graph_desc {}), llri::result::Success);
+            CHECK_EQ(graph.compile(), llri::result::Success);
+            CHECK_EQ(graph.execute(), llri::result::Success);
+            CHECK_UNARY(graph.queryBatches().empty());
+        }
+
+        SUBCASE("render_graph::compile()")
+        {
+            llri::render_graph graph;
+            REQUIRE_EQ(graph.create(device, llri::render_graph_desc {}), llri::result::Success);
+
+            SUBCASE("[Incorrect usage] invalid resource handle")
+            {
+                graph.addPass("pass", llri::queue_type::Graphics, &noCommands).write(llri::render_graph_resource {}, llri::resource_state::TransferDst);
+                CHECK_EQ(graph.compile(), llri::result::ErrorInvalidUsage);
+            }
+
+            SUBCASE("[Incorrect usage] importResource(nullptr) returns an invalid handle")
+            {
+                const auto resource = graph.importResource(nullptr, llri::resource_state::General);
+                CHECK_UNARY(!resource.valid());
+                graph.addPass("pass", llri::queue_type::Graphics, &noCommands).read(resource, llri::resource_state::General);
+                CHECK_EQ(graph.compile(), llri::result::ErrorInvalidUsage);
+            }
+
+            SUBCASE("[Incorrect usage] transient resource isn't memory_type::Local")
+            {
+                const auto resource = graph.createTransient(llri::resource_desc::buffer(llri::resource_usage_flag_bits::TransferSrc, llri::memory_type::Upload, llri::resource_state::Upload, 256));
+                graph.addPass("pass", llri::queue_type::Graphics, &noCommands).read(resource, llri::resource_state::Upload);
+                CHECK_EQ(graph.compile(), llri::result::ErrorInvalidUsage);
+            }
+
+            SUBCASE("[Incorrect usage] pass uses a resource in two states")
+            {
+                const auto resource = graph.createTransient(transientBuffer(256));
+                graph.addPass("pass", llri::queue_type::Graphics, &noCommands).read(resource, llri::resource_state::TransferSrc).write(resource, llri::resource_state::TransferDst);
+                CHECK_EQ(graph.compile(), llri::result::ErrorInvalidUsage);
+            }
+
+            SUBCASE("[Incorrect usage] resource doesn't meet the requirements of the state")
+            {
+                const auto resource = graph.createTransient(transientBuffer(256));
+                graph.addPass("pass", llri::queue_type::Graphics, &noCommands).read(resource, llri::resource_state::ColorAttachment);
+                CHECK_EQ(graph.compile(), llri::result::ErrorInvalidState);
+            }
+
+            SUBCASE("[Incorrect usage] queue_type > queue_type::MaxEnum")
+            {
+                graph.addPass("pass", static_cast<llri::queue_type>(std::numeric_limits<uint8_t>::max()), &noCommands);
+                CHECK_EQ(graph.compile(), llri::result::ErrorInvalidUsage);
+            }
+
+            SUBCASE("[Correct usage] the same state in a read and a write is a single access")
+            {
+                const auto resource = graph.createTransient(transientBuffer(256));
+                graph.addPass("pass", llri::queue_type::Graphics, &noCommands).read(resource, llri::resource_state::ShaderReadWrite).write(resource, llri::resource_state::ShaderReadWrite);
+                CHECK_EQ(graph.compile(), llri::result::Success);
+                CHECK_UNARY(graph.getResource(resource) != nullptr);
+            }
+        }
+
+        SUBCASE("[Correct usage] barriers are derived from the declared states")
+        {
+            llri::render_graph graph;
+            REQUIRE_EQ(graph.create(device, llri::render_graph_desc {}), llri::result::Success);
+
+            const auto buffer = graph.createTransient(transientBuffer(256));
+            graph.addPass("write", llri::queue_type::Graphics, &noCommands).write(buffer, llri::resource_state::ShaderReadWrite);
+            graph.addPass("write again", llri::queue_type::Graphics, &noCommands).write(buffer, llri::resource_state::ShaderReadWrite);
+            graph.addPass("copy", llri::queue_type::Graphics, &noCommands).read(buffer, llri::resource_state::TransferSrc);
+            graph.addPass("copy again", llri::queue_type::Graphics, &noCommands).read(buffer, llri::resource_state::TransferSrc);
+            REQUIRE_EQ(graph.compile(), llri::result::Success);
+
+            const auto batches = graph.queryBatches();
+            REQUIRE_EQ(batches.size(), 1);
+            CHECK_EQ(batches[0].passes, (std::vector<uint32_t> { 0, 1, 2, 3 }));
+            // TransferSrc -> ShaderReadWrite, a read_write barrier between the writes, and ShaderReadWrite -> TransferSrc
+            CHECK_EQ(batches[0].numBarriers, 3);
+            CHECK_EQ(batches[0].numWaitSemaphores, 0);
+
+            CHECK_EQ(graph.execute(), llri::result::Success);
+            CHECK_EQ(graph.execute(), llri::result::Success);
+            CHECK_EQ(graph.wait(), llri::result::Success);
+        }
+
+        SUBCASE("[Correct usage] independent passes are grouped per queue")
+        {
+            if (hasCompute)
+            {
+                llri::render_graph graph;
+                REQUIRE_EQ(graph.create(device, llri::render_graph_desc { 0, true, false }), llri::result::Success);
+
+                const auto a = graph.createTransient(transientBuffer(256));
+                const auto b = graph.createTransient(transientBuffer(256));
+                const auto c = graph.createTransient(transientBuffer(256));
+
+                graph.addPass("A", llri::queue_type::Graphics, &noCommands).write(a, llri::resource_state::ShaderReadWrite);
+                graph.addPass("B", llri::queue_type::Compute, &noCommands).read(a, llri::resource_state::ShaderReadOnly).write(b, llri::resource_state::ShaderReadWrite);
+                graph.addPass("C", llri::queue_type::Graphics, &noCommands).write(c, llri::resource_state::ShaderReadWrite);
+                graph.addPass("D", llri::queue_type::Graphics, &noCommands).read(b, llri::resource_state::ShaderReadOnly).read(c, llri::resource_state::ShaderReadOnly);
+                REQUIRE_EQ(graph.compile(), llri::result::Success);
+
+                const auto batches = graph.queryBatches();
+                REQUIRE_EQ(batches.size(), 3);
+                CHECK_EQ(batches[0].queue, llri::queue_type::Graphics);
+                CHECK_EQ(batches[0].passes, (std::vector<uint32_t> { 0, 2 }));
+                // a and c are transitioned, then a is transitioned and released to Compute
+                CHECK_EQ(batches[0].numBarriers, 4);
+                CHECK_EQ(batches[0].numSignalSemaphores, 1);
+                CHECK_EQ(batches[1].queue, llri::queue_type::Compute);
+                CHECK_EQ(batches[1].passes, (std::vector<uint32_t> { 1 }));
+                // a is acquired, b is transitioned and then released to Graphics
+                CHECK_EQ(batches[1].numBarriers, 3);
+                CHECK_EQ(batches[1].numWaitSemaphores, 1);
+                CHECK_EQ(batches[1].numSignalSemaphores, 1);
+                CHECK_EQ(batches[2].queue, llri::queue_type::Graphics);
+                CHECK_EQ(batches[2].passes, (std::vector<uint32_t> { 3 }));
+                // b is acquired and transitioned, c is transitioned
+                CHECK_EQ(batches[2].numBarriers, 3);
+                CHECK_EQ(batches[2].numWaitSemaphores, 1);
+
+                CHECK_EQ(graph.execute(), llri::result::Success);
+                CHECK_EQ(graph.wait(), llri::result::Success);
+            }
+        }
+
+        SUBCASE("[Correct usage] async compute is optional")
+        {
+            llri::render_graph graph;
+            REQUIRE_EQ(graph.create(device, llri::render_graph_desc {}), llri::result::Success);
+
+            const auto a = graph.createTransient(transientBuffer(256));
+            graph.addPass("A", llri::queue_type::Graphics, &noCommands).write(a, llri::resource_state::ShaderReadWrite);
+            graph.addPass("B", llri::queue_type::Compute, &noCommands).read(a, llri::resource_state::ShaderReadOnly);
+            REQUIRE_EQ(graph.compile(), llri::result::Success);
+
+            const auto batches = graph.queryBatches();
+            REQUIRE_EQ(batches.size(), 1);
+            CHECK_EQ(batches[0].queue, llri::queue_type::Graphics);
+        }
+
+        SUBCASE("[Correct usage] transient resources with disjoint lifetimes share memory")
+        {
+            llri::render_graph graph;
+            REQUIRE_EQ(graph.create(device, llri::render_graph_desc {}), llri::result::Success);
+
+            llri::resource_allocation_info info {};
+            REQUIRE_EQ(device->queryResourceAllocationInfo(transientBuffer(4096), &info), llri::result::Success);
+
+            const auto first = graph.createTransient(transientBuffer(4096));
+            const auto second = graph.createTransient(transientBuffer(4096));
+            const auto output = graph.createTransient(transientBuffer(256));
+
+            graph.addPass("produce first", llri::queue_type::Graphics, &noCommands).write(first, llri::resource_state::ShaderReadWrite);
+            graph.addPass("consume first", llri::queue_type::Graphics, &noCommands).read(first, llri::resource_state::ShaderReadOnly).write(output, llri::resource_state::ShaderReadWrite);
+
+            SUBCASE("disjoint")
+            {
+                graph.addPass("produce second", llri::queue_type::Graphics, &noCommands).read(output, llri::resource_state::ShaderReadOnly).write(second, llri::resource_state::ShaderReadWrite);
+                graph.addPass("consume second", llri::queue_type::Graphics, &noCommands).read(second, llri::resource_state::ShaderReadOnly);
+                REQUIRE_EQ(graph.compile(), llri::result::Success);
+
+                CHECK_LT(graph.queryTransientMemorySize(), info.size * 2);
+                CHECK_EQ(graph.getResource(first)->getHeapOffset(), graph.getResource(second)->getHeapOffset());
+            }
+
+            SUBCASE("overlapping")
+            {
+                graph.addPass("produce second", llri::queue_type::Graphics, &noCommands).write(second, llri::resource_state::ShaderReadWrite);
+                graph.addPass("consume both", llri::queue_type::Graphics, &noCommands).read(first, llri::resource_state::ShaderReadOnly).read(second, llri::resource_state::ShaderReadOnly);
+                REQUIRE_EQ(graph.compile(), llri::result::Success);
+
+                CHECK_GE(graph.queryTransientMemorySize(), info.size * 2);
+                CHECK_NE(graph.getResource(first)->getHeapOffset(), graph.getResource(second)->getHeapOffset());
+            }
+
+            CHECK_EQ(graph.execute(), llri::result::Success);
+            CHECK_EQ(graph.wait(), llri::result::Success);
+        }
+
+        SUBCASE("[Correct usage] the graph is only recompiled when its shape changes")
+        {
+            llri::Resource* a;
+            llri::Resource* b;
+            const auto desc = llri::resource_desc::buffer(llri::resource_usage_flag_bits::TransferDst, llri::memory_type::Local, llri::resource_state::General, 256);
+            REQUIRE_EQ(device->createResource(desc, &a), llri::result::Success);
+            REQUIRE_EQ(device->createResource(desc, &b), llri::result::Success);
+
+            llri::render_graph graph;
+            REQUIRE_EQ(graph.create(device, llri::render_graph_desc {}), llri::result::Success);
+
+            auto declare = [&](llri::Resource* imported, llri::resource_state state)
+            {
+                graph.reset();
+                const auto target = graph.importResource(imported, state);
+                const auto temp = graph.createTransient(transientBuffer(256));
+                graph.addPass("fill", llri::queue_type::Graphics, &noCommands).write(temp, llri::resource_state::TransferSrc);
+                graph.addPass("copy", llri::queue_type::Graphics, &noCommands).read(temp, llri::resource_state::TransferSrc).write(target, llri::resource_state::TransferDst);
+                return graph.execute();
+            };
+
+            REQUIRE_EQ(declare(a, llri::resource_state::General), llri::result::Success);
+            CHECK_EQ(graph.queryCompileCount(), 1);
+
+            // the same shape with a different imported resource
+            REQUIRE_EQ(declare(b, llri::resource_state::General), llri::result::Success);
+            CHECK_EQ(graph.queryCompileCount(), 1);
+
+            // a different state for the imported resource changes the shape
+            REQUIRE_EQ(declare(b, llri::resource_state::TransferDst), llri::result::Success);
+            CHECK_EQ(graph.queryCompileCount(), 2);
+
+            graph.destroy();
+            device->destroyResource(b);
+            device->destroyResource(a);
+        }
+
+        SUBCASE("[Correct usage] transfer passes run on the transfer queue")
+        {
+            if (hasTransfer)
+            {
+                const uint32_t size = 1024;
+
+                llri::Resource* upload;
+                llri::Resource* readback;
+                REQUIRE_EQ(device->createResource(llri::resource_desc::buffer(llri::resource_usage_flag_bits::TransferSrc, llri::memory_type::Upload, llri::resource_state::Upload, size), &upload), llri::result::Success);
+                REQUIRE_EQ(device->createResource(llri::resource_desc::buffer(llri::resource_usage_flag_bits::TransferDst, llri::memory_type::Read, llri::resource_state::TransferDst, size), &readback), llri::result::Success);
+
+                void* data = nullptr;
+                REQUIRE_EQ(device->mapResource(upload, &data), llri::result::Success);
+                std::memset(data, 0x3C, size);
+                device->unmapResource(upload);
+
+                llri::render_graph graph;
+                REQUIRE_EQ(graph.create(device, llri::render_graph_desc { 0, false, true }), llri::result::Success);
+
+                const auto src = graph.importResource(upload, llri::resource_state::Upload);
+                const auto dst = graph.importResource(readback, llri::resource_state::TransferDst);
+                const auto temp = graph.createTransient(transientBuffer(size));
+
+                graph.addPass("upload", llri::queue_type::Transfer, [&](llri::CommandList* cmd)
+                {
+                    CHECK_EQ(cmd->copyBuffer(graph.getResource(src), 0, graph.getResource(temp), 0, size), llri::result::Success);
+                }).read(src, llri::resource_state::TransferSrc).write(temp, llri::resource_state::TransferDst);
+
+                graph.addPass("readback", llri::queue_type::Graphics, [&](llri::CommandList* cmd)
+                {
+                    CHECK_EQ(cmd->copyBuffer(graph.getResource(temp), 0, graph.getResource(dst), 0, size), llri::result::Success);
+                }).read(temp, llri::resource_state::TransferSrc).write(dst, llri::resource_state::TransferDst);
+
+                REQUIRE_EQ(graph.execute(), llri::result::Success);
+                REQUIRE_EQ(graph.wait(), llri::result::Success);
+
+                // upload is Exclusive and owned by Graphics, so the execution starts with a Graphics batch that transitions and releases it
+                const auto batches = graph.queryBatches();
+                REQUIRE_EQ(batches.size(), 3);
+                CHECK_EQ(batches[0].queue, llri::queue_type::Graphics);
+                CHECK_UNARY(batches[0].passes.empty());
+                CHECK_EQ(batches[0].numBarriers, 2);
+                CHECK_EQ(batches[1].queue, llri::queue_type::Transfer);
+                CHECK_EQ(batches[1].numWaitSemaphores, 1);
+                CHECK_EQ(batches[2].queue, llri::queue_type::Graphics);
+                CHECK_EQ(batches[2].numWaitSemaphores, 1);
+
+                if (llri::getImplementation() != llri::implementation::Null)
+                {
+                    REQUIRE_EQ(device->mapResource(readback, &data), llri::result::Success);
+                    CHECK_EQ(static_cast<uint8_t*>(data)[0], 0x3C);
+                    CHECK_EQ(static_cast<uint8_t*>(data)[size - 1], 0x3C);
+                    device->unmapResource(readback);
+                }
+
+                graph.destroy();
+                device->destroyResource(readback);
+                device->destroyResource(upload);
+            }
+        }
+
+        instance->destroyDevice(device);
+    });
+
+    llri::destroyInstance(instance);
+}
@@ -0,0 +1,159 @@
+/**
+ * @file statistics.cpp
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <llri/llri.hpp>
+#include <helpers.hpp>
+#include <doctest/doctest.h>
+
+#include <thread>
+
+TEST_CASE("Device statistics")
+{
+    auto* instance = detail::defaultInstance();
+
+    detail::iterateAdapters(instance, [instance](llri::Adapter* adapter) {
+        auto* device = detail::defaultDevice(instance, adapter);
+
+        SUBCASE("[Correct usage] a new Device has no statistics")
+        {
+            const llri::device_statistics statistics = device->queryStatistics();
+            for (const auto& call : statistics.calls)
+            {
+                CHECK_EQ(call.count, 0);
+                CHECK_EQ(call.totalNanoseconds, 0);
+            }
+            CHECK_EQ(statistics.barriers, 0);
+            for (const uint64_t bytes : statistics.allocatedBytes)
+                CHECK_EQ(bytes, 0);
+        }
+
+        SUBCASE("[Correct usage] createResource() is counted and its allocation is tracked per memory_type")
+        {
+            const auto desc = llri::resource_desc::buffer(llri::resource_usage_flag_bits::TransferSrc, llri::memory_type::Upload, llri::resource_state::Upload, 1024);
+
+            llri::Resource* resource;
+            REQUIRE_EQ(device->createResource(desc, &resource), llri::result::Success);
+
+            const llri::device_statistics statistics = device->queryStatistics();
+            const llri::call_statistics& call = statistics.get(llri::device_call::CreateResource);
+            CHECK_EQ(call.count, 1);
+
+            uint64_t histogramCount = 0;
+            for (const uint64_t bucket : call.histogram)
+                histogramCount += bucket;
+            CHECK_EQ(histogramCount, 1);
+
+            CHECK_GE(statistics.allocatedBytes[static_cast<size_t>(llri::memory_type::Upload)], 1024);
+            CHECK_EQ(statistics.allocatedBytes[static_cast<size_t>(llri::memory_type::Local)], 0);
+
+            device->destroyResource(resource);
+        }
+
+        SUBCASE("[Correct usage] calls that fail validation are not counted")
+        {
+            CHECK_EQ(device->createResource(llri::resource_desc {}, nullptr), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(device->queryStatistics().get(llri::device_call::CreateResource).count, 0);
+        }
+
+        SUBCASE("[Correct usage] statistics are summed across threads")
+        {
+            auto createFence = [device]()
+            {
+                llri::Fence* fence;
+                REQUIRE_EQ(device->createFence(llri::fence_flag_bits::None, &fence), llri::result::Success);
+                device->destroyFence(fence);
+            };
+
+            createFence();
+            std::thread thread(createFence);
+            thread.join();
+
+            CHECK_EQ(device->queryStatistics().get(llri::device_call::CreateFence).count, 2);
+        }
+
+        SUBCASE("[Correct usage] a thread that alternates between Devices records into each of them")
+        {
+            auto* other = detail::defaultDevice(instance, adapter);
+
+            for (size_t i = 0; i < 3; i++)
+            {
+                for (auto* d : { device, other })
+                {
+                    llri::Fence* fence;
+                    REQUIRE_EQ(d->createFence(llri::fence_flag_bits::None, &fence), llri::result::Success);
+                    d->destroyFence(fence);
+                }
+            }
+
+            CHECK_EQ(device->queryStatistics().get(llri::device_call::CreateFence).count, 3);
+            CHECK_EQ(other->queryStatistics().get(llri::device_call::CreateFence).count, 3);
+
+            instance->destroyDevice(other);
+        }
+
+        SUBCASE("[Correct usage] resetStatistics() resets all statistics")
+        {
+            llri::Fence* fence;
+            REQUIRE_EQ(device->createFence(llri::fence_flag_bits::None, &fence), llri::result::Success);
+            REQUIRE_EQ(device->queryStatistics().get(llri::device_call::CreateFence).count, 1);
+
+            device->resetStatistics();
+            CHECK_EQ(device->queryStatistics().get(llri::device_call::CreateFence).count, 0);
+            CHECK_EQ(device->queryStatistics().get(llri::device_call::CreateFence).totalNanoseconds, 0);
+
+            device->destroyFence(fence);
+            REQUIRE_EQ(device->createFence(llri::fence_flag_bits::None, &fence), llri::result::Success);
+            CHECK_EQ(device->queryStatistics().get(llri::device_call::CreateFence).count, 1);
+
+            device->destroyFence(fence);
+        }
+
+        instance->destroyDevice(device);
+    });
+
+    llri::destroyInstance(instance);
+}
+
+TEST_CASE("Queue and CommandList statistics")
+{
+    auto* instance = detail::defaultInstance();
+
+    detail::iterateAdapters(instance, [instance](llri::Adapter* adapter) {
+        auto* device = detail::defaultDevice(instance, adapter);
+        const llri::queue_type type = detail::availableQueueType(adapter);
+
+        auto* group = detail::defaultCommandGroup(device, type);
+        auto* list = detail::defaultCommandList(group, 0, llri::command_list_usage::Direct);
+        auto* fence = detail::defaultFence(device, false);
+
+        REQUIRE_EQ(list->begin(llri::command_list_begin_desc {}), llri::result::Success);
+        REQUIRE_EQ(list->end(), llri::result::Success);
+
+        const llri::submit_desc submitDesc { 0, 1, &list, 0, nullptr, 0, nullptr, fence };
+        REQUIRE_EQ(device->getQueue(type, 0)->submit(submitDesc), llri::result::Success);
+        REQUIRE_EQ(device->waitFence(fence, LLRI_TIMEOUT_MAX), llri::result::Success);
+
+        const llri::device_statistics statistics = device->queryStatistics();
+        CHECK_EQ(statistics.get(llri::device_call::Allocate).count, 1);
+        CHECK_EQ(statistics.get(llri::device_call::Begin).count, 1);
+        CHECK_EQ(statistics.get(llri::device_call::End).count, 1);
+        CHECK_EQ(statistics.get(llri::device_call::Submit).count, 1);
+        CHECK_EQ(statistics.get(llri::device_call::WaitFences).count, 1);
+
+        device->destroyFence(fence);
+        device->destroyCommandGroup(group);
+        instance->destroyDevice(device);
+    });
+
+    llri::destroyInstance(instance);
+}
+
+TEST_CASE("to_string(device_call)")
+{
+    CHECK_EQ(llri::to_string(llri::device_call::CreateResource), "CreateResource");
+    CHECK_EQ(llri::to_string(llri::device_call::WaitIdle), "WaitIdle");
+    CHECK_EQ(llri::to_string(static_cast<llri::device_call>(static_cast<uint8_t>(llri::device_call::MaxEnum) + 1)), "Invalid device_call value");
+}
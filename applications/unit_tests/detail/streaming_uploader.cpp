@@ -0,0 +1,192 @@
+/**
+ * @file streaming_uploader.cpp
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <llri/llri.hpp>
+#include <helpers.hpp>
+#include <doctest/doctest.h>
+
+#include <thread>
+
+TEST_CASE("streaming_uploader")
+{
+    auto* instance = detail::defaultInstance();
+
+    detail::iterateAdapters(instance, [instance](llri::Adapter* adapter) {
+        if (adapter->queryQueueCount(llri::queue_type::Graphics) == 0)
+            return;
+
+        std::vector<llri::queue_desc> queues { llri::queue_desc { llri::queue_type::Graphics, llri::queue_priority::Normal } };
+        if (adapter->queryQueueCount(llri::queue_type::Transfer) > 0)
+            queues.push_back(llri::queue_desc { llri::queue_type::Transfer, llri::queue_priority::Normal });
+
+        auto* device = detail::defaultDeviceWithQueues(instance, adapter, queues);
+
+        constexpr uint32_t size = 4 * 1024;
+        llri::Resource* buffer;
+        REQUIRE_EQ(device->createResource(llri::resource_desc::buffer(llri::resource_usage_flag_bits::TransferSrc | llri::resource_usage_flag_bits::TransferDst, llri::memory_type::Local, llri::resource_state::ShaderReadOnly, size), &buffer), llri::result::Success);
+
+        std::vector<uint8_t> expected(size);
+        for (size_t i = 0; i < expected.size(); i++)
+            expected[i] = static_cast<uint8_t>(i * 7 + i / 256);
+
+        SUBCASE("[Incorrect usage] invalid create() and enqueue() parameters")
+        {
+            llri::streaming_uploader uploader;
+            const llri::streaming_buffer_upload upload { buffer, 0, size, expected.data(), llri::resource_state::ShaderReadOnly };
+
+            CHECK_EQ(uploader.enqueue(upload), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(uploader.flush(), llri::result::ErrorInvalidUsage);
+
+            CHECK_EQ(uploader.create(nullptr, llri::streaming_uploader_desc { size, 0, llri::queue_type::Graphics, 0 }), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(uploader.create(device, llri::streaming_uploader_desc { 0, 0, llri::queue_type::Graphics, 0 }), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(uploader.create(device, llri::streaming_uploader_desc { size, 0, llri::queue_type::Transfer, 0 }), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(uploader.create(device, llri::streaming_uploader_desc { size, 0, llri::queue_type::Compute, 0 }), llri::result::ErrorFeatureNotSupported);
+
+            REQUIRE_EQ(uploader.create(device, llri::streaming_uploader_desc { size, 0, llri::queue_type::Graphics, 0 }), llri::result::Success);
+            CHECK_EQ(uploader.enqueue(llri::streaming_buffer_upload { nullptr, 0, size, expected.data(), llri::resource_state::ShaderReadOnly }), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(uploader.enqueue(llri::streaming_buffer_upload { buffer, 0, 0, expected.data(), llri::resource_state::ShaderReadOnly }), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(uploader.enqueue(llri::streaming_buffer_upload { buffer, 1, size, expected.data(), llri::resource_state::ShaderReadOnly }), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(uploader.enqueue(llri::streaming_buffer_upload { buffer, 0, size, nullptr, llri::resource_state::ShaderReadOnly }), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(uploader.enqueue(llri::streaming_buffer_upload { buffer, 0, size, expected.data(), static_cast<llri::resource_state>(std::numeric_limits<uint8_t>::max()) }), llri::result::ErrorInvalidUsage);
+
+            // the data doesn't fit in the ring
+            std::vector<uint8_t> large(size + 1);
+            llri::Resource* largeBuffer;
+            REQUIRE_EQ(device->createResource(llri::resource_desc::buffer(llri::resource_usage_flag_bits::TransferDst, llri::memory_type::Local, llri::resource_state::TransferDst, size + 1), &largeBuffer), llri::result::Success);
+            CHECK_EQ(uploader.enqueue(llri::streaming_buffer_upload { largeBuffer, 0, size + 1, large.data(), llri::resource_state::TransferDst }), llri::result::ErrorInvalidUsage);
+
+            // requests that weren't flushed can't be waited on
+            llri::streaming_request request;
+            REQUIRE_EQ(uploader.enqueue(upload, &request), llri::result::Success);
+            CHECK_FALSE(uploader.isComplete(request));
+            CHECK_EQ(uploader.wait(request), llri::result::NotReady);
+
+            // the ring is full until the upload completes
+            CHECK_EQ(uploader.enqueue(upload), llri::result::NotReady);
+            CHECK_EQ(uploader.queryQueuedBytes(), size);
+
+            uploader.destroy();
+            device->destroyResource(largeBuffer);
+        }
+
+        SUBCASE("[Correct usage] buffer uploads complete in order")
+        {
+            llri::streaming_uploader uploader;
+            REQUIRE_EQ(uploader.create(device, llri::streaming_uploader_desc { size, 0, llri::queue_type::Graphics, 0 }), llri::result::Success);
+
+            // upload the halves separately, they're submitted together
+            llri::streaming_request first, second;
+            REQUIRE_EQ(uploader.enqueue(llri::streaming_buffer_upload { buffer, 0, size / 2, expected.data(), llri::resource_state::ShaderReadOnly }, &first), llri::result::Success);
+            REQUIRE_EQ(uploader.enqueue(llri::streaming_buffer_upload { buffer, size / 2, size / 2, expected.data() + size / 2, llri::resource_state::ShaderReadOnly }, &second), llri::result::Success);
+            CHECK_LT(first.value, second.value);
+
+            REQUIRE_EQ(uploader.flush(), llri::result::Success);
+            CHECK_EQ(uploader.queryQueuedBytes(), 0u);
+            REQUIRE_EQ(uploader.wait(second), llri::result::Success);
+            CHECK_UNARY(uploader.isComplete(first));
+            CHECK_UNARY(uploader.isComplete(second));
+
+            detail::checkBufferContents(device, buffer, llri::resource_state::ShaderReadOnly, expected);
+
+            // the ring space is reused once the uploads complete
+            REQUIRE_EQ(uploader.enqueue(llri::streaming_buffer_upload { buffer, 0, size, expected.data(), llri::resource_state::ShaderReadOnly }), llri::result::Success);
+            REQUIRE_EQ(uploader.flush(), llri::result::Success);
+            CHECK_EQ(uploader.waitIdle(), llri::result::Success);
+        }
+
+        SUBCASE("[Correct usage] flush() respects the frame budget")
+        {
+            llri::streaming_uploader uploader;
+            REQUIRE_EQ(uploader.create(device, llri::streaming_uploader_desc { size, size / 4, llri::queue_type::Graphics, 0 }), llri::result::Success);
+
+            std::vector<llri::streaming_request> requests(4);
+            for (uint32_t i = 0; i < 4; i++)
+                REQUIRE_EQ(uploader.enqueue(llri::streaming_buffer_upload { buffer, i * size / 4, size / 4, expected.data() + i * size / 4, llri::resource_state::ShaderReadOnly }, &requests[i]), llri::result::Success);
+
+            for (uint32_t frame = 0; frame < 4; frame++)
+            {
+                CHECK_EQ(uploader.queryQueuedBytes(), (4 - frame) * size / 4);
+                REQUIRE_EQ(uploader.flush(), llri::result::Success);
+                REQUIRE_EQ(uploader.wait(requests[frame]), llri::result::Success);
+
+                if (frame < 3)
+                    CHECK_EQ(uploader.wait(requests[frame + 1]), llri::result::NotReady);
+            }
+
+            detail::checkBufferContents(device, buffer, llri::resource_state::ShaderReadOnly, expected);
+        }
+
+        SUBCASE("[Correct usage] uploads are enqueued from multiple threads")
+        {
+            llri::streaming_uploader uploader;
+            REQUIRE_EQ(uploader.create(device, llri::streaming_uploader_desc { size, 0, llri::queue_type::Graphics, 0 }), llri::result::Success);
+
+            std::vector<std::thread> threads;
+            std::vector<llri::result> results(4);
+            for (uint32_t i = 0; i < 4; i++)
+            {
+                threads.emplace_back([&, i]()
+                {
+                    results[i] = uploader.enqueue(llri::streaming_buffer_upload { buffer, i * size / 4, size / 4, expected.data() + i * size / 4, llri::resource_state::ShaderReadOnly });
+                });
+            }
+
+            for (auto& thread : threads)
+                thread.join();
+            for (auto r : results)
+                CHECK_EQ(r, llri::result::Success);
+
+            REQUIRE_EQ(uploader.flush(), llri::result::Success);
+            REQUIRE_EQ(uploader.waitIdle(), llri::result::Success);
+            detail::checkBufferContents(device, buffer, llri::resource_state::ShaderReadOnly, expected);
+        }
+
+        SUBCASE("[Correct usage] texture uploads")
+        {
+            llri::resource_desc textureDesc {};
+            textureDesc.type = llri::resource_type::Texture2D;
+            textureDesc.usage = llri::resource_usage_flag_bits::TransferDst | llri::resource_usage_flag_bits::Sampled;
+            textureDesc.memoryType = llri::memory_type::Local;
+            textureDesc.initialState = llri::resource_state::ShaderReadOnly;
+            textureDesc.width = 48;
+            textureDesc.height = 32;
+            textureDesc.depthOrArrayLayers = 1;
+            textureDesc.mipLevels = 2;
+            textureDesc.sampleCount = llri::sample_count::Count1;
+            textureDesc.textureFormat = llri::format::RGBA8UNorm;
+            textureDesc.sharingMode = llri::resource_sharing_mode::Exclusive;
+
+            llri::Resource* texture;
+            REQUIRE_EQ(device->createResource(textureDesc, &texture), llri::result::Success);
+
+            llri::streaming_uploader uploader;
+            REQUIRE_EQ(uploader.create(device, llri::streaming_uploader_desc { 8 * 1024, 0, llri::queue_type::Graphics, 0 }), llri::result::Success);
+
+            // mip 1 is out of range at this offset
+            CHECK_EQ(uploader.enqueue(llri::streaming_texture_upload { texture, 1, 0, llri::offset_3d { 16, 0, 0 }, llri::extent_3d { 16, 16, 1 }, expected.data(), 0, llri::resource_state::ShaderReadOnly }), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(uploader.enqueue(llri::streaming_texture_upload { texture, 2, 0, llri::offset_3d { 0, 0, 0 }, llri::extent_3d { 1, 1, 1 }, expected.data(), 0, llri::resource_state::ShaderReadOnly }), llri::result::ErrorInvalidUsage);
+            CHECK_EQ(uploader.enqueue(llri::streaming_texture_upload { texture, 0, 0, llri::offset_3d { 0, 0, 0 }, llri::extent_3d { 48, 32, 1 }, expected.data(), 4, llri::resource_state::ShaderReadOnly }), llri::result::ErrorInvalidUsage);
+
+            // both mip levels, the rows of mip 0 aren't a multiple of 256 bytes
+            llri::streaming_request mip0, mip1;
+            REQUIRE_EQ(uploader.enqueue(llri::streaming_texture_upload { texture, 0, 0, llri::offset_3d { 0, 0, 0 }, llri::extent_3d { 48, 16, 1 }, expected.data(), 0, llri::resource_state::ShaderReadOnly }, &mip0), llri::result::Success);
+            REQUIRE_EQ(uploader.enqueue(llri::streaming_texture_upload { texture, 1, 0, llri::offset_3d { 0, 0, 0 }, llri::extent_3d { 24, 16, 1 }, expected.data(), 0, llri::resource_state::ShaderReadOnly }, &mip1), llri::result::Success);
+            CHECK_EQ(uploader.queryQueuedBytes(), 256u * 16 * 2);
+
+            REQUIRE_EQ(uploader.flush(), llri::result::Success);
+            REQUIRE_EQ(uploader.wait(mip1), llri::result::Success);
+            CHECK_UNARY(uploader.isComplete(mip0));
+
+            uploader.destroy();
+            device->destroyResource(texture);
+        }
+
+        device->destroyResource(buffer);
+        instance->destroyDevice(device);
+    });
+
+    llri::destroyInstance(instance);
+}
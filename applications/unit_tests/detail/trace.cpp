@@ -0,0 +1,111 @@
+/**
+ * @file trace.cpp
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <llri/llri.hpp>
+#include <doctest/doctest.h>
+#include <helpers.hpp>
+#include <sstream>
+
+TEST_SUITE("Trace")
+{
+    TEST_CASE("writeTrace()")
+    {
+        llri::clearTrace();
+
+        SUBCASE("[Correct usage] an empty trace is valid trace event JSON")
+        {
+            std::stringstream stream;
+            llri::writeTrace(stream);
+
+            const std::string json = stream.str();
+            CHECK_EQ(json.rfind(R"({"displayTimeUnit":"ns","traceEvents":[)", 0), 0);
+            CHECK_NE(json.find(R"("args":{"name":"LLRI CPU"})"), std::string::npos);
+            CHECK_NE(json.find("]}"), std::string::npos);
+        }
+
+        SUBCASE("[Correct usage] GPU spans are written on the GPU track")
+        {
+            llri::traceGPUSpan(llri::queue_type::Graphics, 0, "shadow \"pass\"", 1000, 3000, 2.0f);
+
+            std::stringstream stream;
+            llri::writeTrace(stream);
+
+            const std::string json = stream.str();
+            CHECK_NE(json.find(R"("name":"shadow \"pass\"")"), std::string::npos);
+            CHECK_NE(json.find(R"("pid":2,"tid":1)"), std::string::npos);
+            // 2000 ticks * 2ns = 4 microseconds
+            CHECK_NE(json.find(R"("dur":4.000000)"), std::string::npos);
+        }
+
+        SUBCASE("[Correct usage] GPU spans of different queues are written on separate named tracks")
+        {
+            llri::traceGPUSpan(llri::queue_type::Graphics, 0, "draw", 0, 100, 1.0f);
+            llri::traceGPUSpan(llri::queue_type::Compute, 1, "simulate", 50, 150, 1.0f);
+            llri::traceGPUSpan(llri::queue_type::Graphics, 0, "post", 100, 200, 1.0f);
+
+            std::stringstream stream;
+            llri::writeTrace(stream);
+
+            const std::string json = stream.str();
+            const std::string graphicsTrack = R"("pid":2,"tid":)" + std::to_string(llri::detail::traceGPUTrack(llri::queue_type::Graphics, 0));
+            const std::string computeTrack = R"("pid":2,"tid":)" + std::to_string(llri::detail::traceGPUTrack(llri::queue_type::Compute, 1));
+            CHECK_NE(graphicsTrack, computeTrack);
+
+            CHECK_NE(json.find(graphicsTrack + R"(,"args":{"name":"Graphics queue 0"})"), std::string::npos);
+            CHECK_NE(json.find(computeTrack + R"(,"args":{"name":"Compute queue 1"})"), std::string::npos);
+            CHECK_NE(json.find(R"("name":"simulate","cat":"llri","ph":"X",)" + computeTrack + ","), std::string::npos);
+
+            // every track is only named once
+            const auto name = json.find(R"("name":"Graphics queue 0")");
+            CHECK_EQ(json.find(R"("name":"Graphics queue 0")", name + 1), std::string::npos);
+        }
+
+        SUBCASE("[Correct usage] clearTrace() removes all spans")
+        {
+            llri::traceGPUSpan(llri::queue_type::Graphics, 0, "pass", 0, 10, 1.0f);
+            llri::clearTrace();
+
+            std::stringstream stream;
+            llri::writeTrace(stream);
+            CHECK_EQ(stream.str().find(R"("name":"pass")"), std::string::npos);
+        }
+
+        llri::clearTrace();
+    }
+
+#ifdef LLRI_ENABLE_TRACING
+    TEST_CASE("setTraceEnabled()")
+    {
+        llri::clearTrace();
+        auto* instance = detail::defaultInstance();
+        std::vector<llri::Adapter*> adapters;
+
+        SUBCASE("[Correct usage] calls are recorded while tracing is enabled")
+        {
+            llri::setTraceEnabled(true);
+            CHECK_EQ(instance->enumerateAdapters(&adapters), llri::result::Success);
+            llri::setTraceEnabled(false);
+
+            std::stringstream stream;
+            llri::writeTrace(stream);
+            CHECK_NE(stream.str().find(R"("name":"enumerateAdapters")"), std::string::npos);
+        }
+
+        SUBCASE("[Correct usage] calls aren't recorded while tracing is disabled")
+        {
+            CHECK_FALSE(llri::isTraceEnabled());
+            CHECK_EQ(instance->enumerateAdapters(&adapters), llri::result::Success);
+
+            std::stringstream stream;
+            llri::writeTrace(stream);
+            CHECK_EQ(stream.str().find(R"("name":"enumerateAdapters")"), std::string::npos);
+        }
+
+        llri::destroyInstance(instance);
+        llri::clearTrace();
+    }
+#endif
+}
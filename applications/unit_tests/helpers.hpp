@@ -9,6 +9,13 @@
 #include <llri/llri.hpp>
 #include <sstream>
 
+#ifndef _WIN32
+    #include <spawn.h>
+    #include <sys/wait.h>
+
+    extern char** environ;
+#endif
+
 namespace detail
 {
     /**
@@ -157,6 +164,47 @@ namespace detail
         return device;
     }
 
+    /**
+     * @brief Every queue of every type that the adapter has, for tests that spread work over multiple queues.
+    */
+    inline std::vector<llri::queue_desc> allQueues(llri::Adapter* adapter)
+    {
+        std::vector<llri::queue_desc> queues;
+        for (uint8_t type = 0; type <= static_cast<uint8_t>(llri::queue_type::MaxEnum); type++)
+        {
+            for (uint8_t i = 0; i < adapter->queryQueueCount(static_cast<llri::queue_type>(type)); i++)
+                queues.push_back(llri::queue_desc{ static_cast<llri::queue_type>(type), llri::queue_priority::Normal });
+        }
+        return queues;
+    }
+
+    inline llri::Device* defaultDeviceWithQueues(llri::Instance* instance, llri::Adapter* adapter, std::vector<llri::queue_desc> queues)
+    {
+        llri::Device* device = nullptr;
+        const llri::device_desc ddesc{ adapter, llri::adapter_features{}, 0, nullptr, static_cast<uint32_t>(queues.size()), queues.data() };
+        REQUIRE_EQ(instance->createDevice(ddesc, &device), llri::result::Success);
+        return device;
+    }
+
+    inline llri::Device* createDeviceWithExtension(llri::Instance* instance, llri::Adapter* adapter, llri::adapter_extension ext)
+    {
+        if (adapter->queryExtensionSupport(ext) == false)
+            return nullptr;
+
+        llri::Device* device = nullptr;
+
+        std::vector<llri::queue_desc> queues;
+        for (size_t type = 0; type <= static_cast<uint8_t>(llri::queue_type::MaxEnum); type++)
+        {
+            if (adapter->queryQueueCount(static_cast<llri::queue_type>(type)) > 0)
+                queues.push_back(llri::queue_desc{ static_cast<llri::queue_type>(type), llri::queue_priority::Normal });
+        }
+
+        const llri::device_desc ddesc{ adapter, llri::adapter_features{}, 1, &ext, static_cast<uint32_t>(queues.size()), queues.data() };
+        REQUIRE_EQ(instance->createDevice(ddesc, &device), llri::result::Success);
+        return device;
+    }
+
     inline llri::queue_type availableQueueType(llri::Adapter* adapter)
     {
         for (size_t type = 0; type <= static_cast<uint8_t>(llri::queue_type::MaxEnum); type++)
@@ -189,6 +237,17 @@ namespace detail
         return cmd;
     }
 
+    /**
+     * @brief A CommandList without commands that is ready to be submitted.
+    */
+    inline llri::CommandList* emptyRecordedList(llri::CommandGroup* group)
+    {
+        auto* cmd = defaultCommandList(group, 0, llri::command_list_usage::Direct);
+        REQUIRE_EQ(cmd->begin(llri::command_list_begin_desc{}), llri::result::Success);
+        REQUIRE_EQ(cmd->end(), llri::result::Success);
+        return cmd;
+    }
+
     inline llri::Fence* defaultFence(llri::Device* device, bool signaled)
     {
         llri::fence_flags flags = signaled ? llri::fence_flag_bits::Signaled : llri::fence_flag_bits::None;
@@ -196,4 +255,119 @@ namespace detail
         REQUIRE_EQ(device->createFence(flags, &result), llri::result::Success);
         return result;
     }
+
+    /**
+     * @brief Updates loader and flushes uploader like an application would once per frame, until request is no longer loading or 30 seconds have passed.
+     * Used for the utilities that load through a streaming_uploader, such as image_loader and asset_streamer.
+     * @return The status of request.
+    */
+    template<typename Loader, typename Uploader, typename Request>
+    inline auto waitWhileLoading(Loader& loader, Uploader& uploader, const Request& request)
+    {
+        using status = decltype(loader.queryStatus(request));
+
+        const auto start = std::chrono::steady_clock::now();
+        while (loader.queryStatus(request) == status::Loading && std::chrono::steady_clock::now() - start < std::chrono::seconds(30))
+        {
+            CHECK_EQ(loader.update(), llri::result::Success);
+            CHECK_EQ(uploader.flush(), llri::result::Success);
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return loader.queryStatus(request);
+    }
+
+    /**
+     * @brief Copies a buffer that's in state into a Read buffer on the Graphics queue, and compares its contents with expected.
+    */
+    inline void checkBufferContents(llri::Device* device, llri::Resource* buffer, llri::resource_state state, const std::vector<uint8_t>& expected)
+    {
+        // the null implementation has no device memory to copy through
+        if (llri::getImplementation() == llri::implementation::Null)
+            return;
+
+        const auto size = static_cast<uint32_t>(expected.size());
+        llri::Resource* readback;
+        REQUIRE_EQ(device->createResource(llri::resource_desc::buffer(llri::resource_usage_flag_bits::TransferDst, llri::memory_type::Read, llri::resource_state::TransferDst, size), &readback), llri::result::Success);
+
+        auto* group = defaultCommandGroup(device, llri::queue_type::Graphics);
+        auto* cmd = defaultCommandList(group, 0, llri::command_list_usage::Direct);
+        REQUIRE_EQ(cmd->record(llri::command_list_begin_desc{}, [=](llri::CommandList* c)
+        {
+            CHECK_EQ(c->resourceBarrier(llri::resource_barrier::transition(buffer, state, llri::resource_state::TransferSrc)), llri::result::Success);
+            CHECK_EQ(c->copyBuffer(buffer, 0, readback, 0, size), llri::result::Success);
+            CHECK_EQ(c->resourceBarrier(llri::resource_barrier::transition(buffer, llri::resource_state::TransferSrc, state)), llri::result::Success);
+        }, cmd), llri::result::Success);
+
+        auto* fence = defaultFence(device, false);
+        REQUIRE_EQ(device->getQueue(llri::queue_type::Graphics, 0)->submit(llri::submit_desc{ 0, 1, &cmd, 0, nullptr, 0, nullptr, fence }), llri::result::Success);
+        REQUIRE_EQ(device->waitFence(fence, LLRI_TIMEOUT_MAX), llri::result::Success);
+        device->destroyFence(fence);
+        device->destroyCommandGroup(group);
+
+        void* data;
+        REQUIRE_EQ(device->mapResource(readback, &data), llri::result::Success);
+        CHECK_EQ(std::memcmp(data, expected.data(), expected.size()), 0);
+        device->unmapResource(readback);
+        device->destroyResource(readback);
+    }
+
+    /**
+     * @brief The first argument that makes the unit test executable run a child process entry instead of the tests.
+    */
+    constexpr const char* childProcessArgument = "--llri-child-process";
+
+    /**
+     * @brief A function that runs in a fresh instance of the unit test executable. It receives the arguments that follow its name, and its return value becomes the exit code of the process.
+    */
+    using child_process_entry = int(*)(int argc, char** argv);
+
+    inline std::unordered_map<std::string, child_process_entry>& childProcessEntries()
+    {
+        static std::unordered_map<std::string, child_process_entry> entries;
+        return entries;
+    }
+
+    /**
+     * @brief The path of the unit test executable, set by main().
+    */
+    inline std::string& executablePath()
+    {
+        static std::string path;
+        return path;
+    }
+
+    /**
+     * @brief Registers entry under name so that runChildProcess() can run it. Intended for initializing a static variable.
+    */
+    inline bool registerChildProcess(const std::string& name, child_process_entry entry)
+    {
+        return childProcessEntries().emplace(name, entry).second;
+    }
+
+#ifndef _WIN32
+    /**
+     * @brief Runs the child process entry called name with arguments in a newly spawned instance of the unit test executable, and waits for it to exit.
+     * A new process is started rather than forking the test process, because the test process may have started threads (e.g. through an llri::Instance) that a forked child would not have.
+     * @return The exit code of the child process, or -1 if it couldn't be started or didn't exit normally.
+    */
+    inline int runChildProcess(const std::string& name, const std::vector<std::string>& arguments)
+    {
+        std::vector<std::string> strings { executablePath(), childProcessArgument, name };
+        strings.insert(strings.end(), arguments.begin(), arguments.end());
+
+        std::vector<char*> argv;
+        for (auto& str : strings)
+            argv.push_back(str.data());
+        argv.push_back(nullptr);
+
+        pid_t child;
+        if (posix_spawn(&child, argv[0], nullptr, nullptr, argv.data(), environ) != 0)
+            return -1;
+
+        int status = 0;
+        if (waitpid(child, &status, 0) != child || !WIFEXITED(status))
+            return -1;
+        return WEXITSTATUS(status);
+    }
+#endif
 }
@@ -6,11 +6,25 @@
 
 #include <llri/llri.hpp>
 
-#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#define DOCTEST_CONFIG_IMPLEMENT
 #include <doctest/doctest.h>
 
 #include <helpers.hpp>
 
+int main(int argc, char** argv)
+{
+    detail::executablePath() = argv[0];
+
+    // tests that need a second process relaunch this executable to run one of their entries, see detail::runChildProcess()
+    if (argc > 2 && strcmp(argv[1], detail::childProcessArgument) == 0)
+    {
+        const auto it = detail::childProcessEntries().find(argv[2]);
+        return it != detail::childProcessEntries().end() ? it->second(argc - 3, argv + 3) : EXIT_FAILURE;
+    }
+
+    return doctest::Context(argc, argv).run();
+}
+
 TEST_CASE("print info")
 {
     printf("LLRI unit tests\n");
@@ -0,0 +1,71 @@
+/**
+ * @file adapter_extensions.hpp
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+#include <llri/llri.hpp> // unnecessary but helps intellisense
+
+namespace llri
+{
+    /**
+     * @brief Adapter extensions are additional features that are injected into a Device. They **may** activate custom behaviour in the Device, or they **may** enable the user to use functions or structures related to the extension.
+     *
+     * The support of individual adapter extensions is fully **optional** and often depends on hardware limitations, so this enum **should** be used with Adapter::queryExtensionSupport() to find out if an extension is available prior to adding the extension to the device_desc extension array.
+    */
+    enum struct adapter_extension : uint8_t
+    {
+        /**
+         * @brief The Device's Queues are modelled as timelines in simulated time, with costs that are configured through Device::setSimulatedTimingEXT().
+         * Fences signal, timestamps are written and the Device's simulated clock advances in simulated time, which makes the timing of a workload deterministic and independent of the host machine.
+         *
+         * Intended for benchmarking scheduling policies (e.g. async compute overlap, transfer queue usage or the number of frames in flight) on machines without a GPU. Only implementations that don't execute work on a GPU (e.g. llri-null) **may** support this extension.
+        */
+        SimulatedTiming,
+        /**
+         * @brief Host memory that the application already owns, such as a memory-mapped file or a network receive buffer, **may** be wrapped in a memory_type::Upload buffer through Device::importHostMemoryEXT().
+         * The device then copies from the host memory directly, without it first being copied into memory that LLRI allocated.
+         *
+         * The alignment that the host memory requires is described by adapter_limits::hostMemoryImportAlignment.
+        */
+        HostMemoryImport,
+        /**
+         * @brief Resource memory **may** be exported as a file descriptor through Device::createExportableResourceEXT() and Device::exportResourceMemoryFdEXT(), and imported in another Device or process through Device::importResourceMemoryFdEXT().
+         * This allows e.g. rendered frames to be passed to a separate encoder process, without them being copied through host memory.
+         *
+         * See external_memory_handle_type_ext for the types of file descriptors. Only implementations that run on POSIX systems **may** support this extension.
+        */
+        ExternalMemoryFd,
+        /**
+         * @brief Semaphores **may** be exported as Linux sync file descriptors through Device::createExportableSemaphoreEXT() and Device::exportSemaphoreSyncFdEXT(), and imported in another Device or process through Device::importSemaphoreSyncFdEXT().
+         * Used together with adapter_extension::ExternalMemoryFd, the work that reads exported memory can wait on the work that wrote it, without the host waiting in between.
+        */
+        ExternalSemaphoreFd,
+        /**
+         * @brief The highest value in this enum.
+        */
+        MaxEnum = ExternalSemaphoreFd
+    };
+
+    /**
+     * @brief Converts a adapter_extension to a string.
+     * @return The enum value as a string, or "Invalid adapter_extension value" if the value was not recognized as an enum member.
+    */
+    inline std::string to_string(adapter_extension ext)
+    {
+        switch(ext)
+        {
+            case adapter_extension::SimulatedTiming:
+                return "SimulatedTiming";
+            case adapter_extension::HostMemoryImport:
+                return "HostMemoryImport";
+            case adapter_extension::ExternalMemoryFd:
+                return "ExternalMemoryFd";
+            case adapter_extension::ExternalSemaphoreFd:
+                return "ExternalSemaphoreFd";
+        }
+
+        return "Invalid adapter_extension value";
+    }
+}
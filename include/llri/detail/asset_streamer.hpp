@@ -0,0 +1,267 @@
+/**
+ * @file asset_streamer.hpp
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+#include <llri/asset.hpp> // unnecessary but helps intellisense
+
+namespace llri
+{
+    class Resource;
+    class streaming_uploader;
+
+    /**
+     * @brief The decompression function of an asset_streamer, for example a wrapper around LZ4_decompress_safe() or ZSTD_decompress().
+     * The function is called from the streamer's worker threads, so it **must** be thread-safe.
+     *
+     * @param source The compressed chunk, in the memory-mapped source file.
+     * @param sourceSize The size of the compressed chunk in bytes.
+     * @param destination The mapped staging memory that the chunk is decompressed into.
+     * @param destinationSize The size of the decompressed chunk in bytes.
+     * @param userData The userData pointer that was passed in asset_streamer_desc.
+     *
+     * @return true if the chunk was decompressed into exactly destinationSize bytes, false otherwise.
+    */
+    using decompress_callback = bool(
+        const void* source,
+        size_t sourceSize,
+        void* destination,
+        size_t destinationSize,
+        void* userData
+        );
+
+    /**
+     * @brief Describes how an asset_streamer decompresses and uploads assets.
+    */
+    struct asset_streamer_desc
+    {
+        /**
+         * @brief The uploader that chunks are decompressed into and uploaded through.
+         *
+         * @note Valid usage (ErrorInvalidUsage): uploader **must** be a valid non-null pointer to a streaming_uploader, and it **must** outlive the asset_streamer.
+        */
+        streaming_uploader* uploader;
+
+        /**
+         * @brief The number of worker threads that decompress chunks, or 0 to create one worker per hardware thread.
+        */
+        uint32_t numWorkers;
+
+        /**
+         * @brief The function that decompresses chunks.
+         *
+         * @note Valid usage (ErrorInvalidUsage): decompress **must** be a valid non-null function pointer.
+        */
+        decompress_callback* decompress;
+
+        /**
+         * @brief A user pointer that is passed to every call to decompress.
+        */
+        void* userData;
+    };
+
+    /**
+     * @brief Describes a compressed chunk in a source file, and where its decompressed data is written to in the destination buffer.
+    */
+    struct compressed_chunk
+    {
+        /**
+         * @brief The offset in bytes of the compressed chunk in the source file.
+         *
+         * @note If sourceOffset + sourceSize is larger than the size of the source file, the asset fails with asset_status::Failed.
+        */
+        uint64_t sourceOffset;
+        /**
+         * @brief The size in bytes of the compressed chunk.
+         *
+         * @note Valid usage (ErrorInvalidUsage): sourceSize **must** be more than 0.
+        */
+        uint64_t sourceSize;
+        /**
+         * @brief The offset in bytes into the destination buffer at which the decompressed chunk is written.
+        */
+        uint64_t bufferOffset;
+        /**
+         * @brief The size in bytes of the decompressed chunk.
+         *
+         * @note Valid usage (ErrorInvalidUsage): size **must** be more than 0, and bufferOffset + size **must** be less than or equal to the size of the buffer.
+         * @note If size is larger than streaming_uploader_desc::ringSize, the asset fails with asset_status::Failed.
+        */
+        uint64_t size;
+    };
+
+    /**
+     * @brief Describes an asset that is streamed from a compressed file into a buffer.
+    */
+    struct asset_stream_desc
+    {
+        /**
+         * @brief The path of the source file, which is memory-mapped while its chunks are decompressed.
+         *
+         * @note Valid usage (ErrorInvalidUsage): path **must** be a valid non-null, non-empty string.
+        */
+        const char* path;
+        /**
+         * @brief The buffer that the chunks are decompressed into.
+         *
+         * @note Valid usage (ErrorInvalidUsage): buffer **must** be a valid non-null pointer to a Resource with resource_type::Buffer, created with resource_usage_flag_bits::TransferDst in memory_type::Local.
+        */
+        Resource* buffer;
+        /**
+         * @brief The state that the buffer is in when its chunks are uploaded, as in streaming_buffer_upload::state.
+         *
+         * @note Valid usage (ErrorInvalidUsage): state **must** be a valid enum value.
+        */
+        resource_state state;
+        /**
+         * @brief The number of chunks in the asset_stream_desc::chunks array.
+         *
+         * @note Valid usage (ErrorInvalidUsage): numChunks **must** be more than 0.
+        */
+        uint32_t numChunks;
+        /**
+         * @brief An array of chunks (of size numChunks), which are uploaded in order. The array is copied by asset_streamer::stream().
+         *
+         * @note Valid usage (ErrorInvalidUsage): chunks **must** be a valid non-null pointer to an array of size numChunks (or more), and each chunk **must** meet the valid usage of compressed_chunk.
+        */
+        const compressed_chunk* chunks;
+    };
+
+    /**
+     * @brief Identifies an asset that was requested through asset_streamer::stream().
+    */
+    struct asset_request
+    {
+        uint32_t index = std::numeric_limits<uint32_t>::max();
+    };
+
+    /**
+     * @brief The progress of an asset that was requested through asset_streamer::stream().
+    */
+    enum struct asset_status : uint8_t
+    {
+        /**
+         * @brief The asset's chunks are being decompressed or uploaded.
+        */
+        Loading,
+        /**
+         * @brief All of the asset's chunks have been uploaded, and its buffer **may** be used on the uploader's destination Queue.
+        */
+        Complete,
+        /**
+         * @brief The source file couldn't be mapped, a chunk was out of its range, a chunk couldn't be decompressed, or a chunk is larger than the uploader's staging buffer.
+         * The contents of the buffer are undefined.
+        */
+        Failed,
+        /**
+         * @brief The highest value in this enum.
+        */
+        MaxEnum = Failed
+    };
+
+    /**
+     * @brief Converts an asset_status to a string.
+     * @return The enum value as a string, or "Invalid asset_status value" if the value was not recognized as an enum member.
+    */
+    inline std::string to_string(asset_status status);
+
+    /**
+     * @brief Utility that streams compressed files into buffers, for example geometry that is compressed with LZ4 or zstd.
+     *
+     * The source file of an asset is memory-mapped, so its pages are only read when a worker decompresses a chunk from them. Every update() reserves staging memory for the next chunks
+     * in the streaming_uploader, after which the workers decompress the chunks into the mapped staging memory directly, and the next streaming_uploader::flush() copies them into the buffer.
+     * The decompressed asset thus never exists in CPU memory as a whole, only its chunks that are in the uploader's staging buffer at the same time.
+     *
+     * @note stream() is thread-safe. The other functions **must** be called from the thread that calls streaming_uploader::flush().
+     * @note The buffer of an asset **must not** be destroyed or used on other Queues until queryStatus() no longer returns asset_status::Loading.
+    */
+    class asset_streamer
+    {
+    public:
+        asset_streamer() = default;
+        asset_streamer(const asset_streamer&) = delete;
+        asset_streamer& operator=(const asset_streamer&) = delete;
+        ~asset_streamer() { destroy(); }
+
+        /**
+         * @brief Start the streamer's worker threads.
+         *
+         * @return Success upon correct execution of the operation.
+         * @return asset_streamer_desc defined result values: ErrorInvalidUsage.
+        */
+        result create(const asset_streamer_desc& desc);
+
+        /**
+         * @brief Stop the streamer's threads after they've finished the chunks that were reserved, and unmap the source files. Chunks that weren't reserved yet are discarded.
+         * Calling destroy() on a streamer that wasn't created has no effect.
+        */
+        void destroy();
+
+        /**
+         * @brief Request an asset to be streamed. The source file is mapped immediately, and the chunks are decompressed and uploaded in the background.
+         *
+         * @param desc Describes the source file, the chunks and the destination buffer.
+         * @param request The request that can be used to query the asset's status.
+         *
+         * @return Success upon correct execution of the operation.
+         * @return ErrorInvalidUsage if the streamer wasn't created or if request is nullptr.
+         * @return asset_stream_desc defined result values: ErrorInvalidUsage.
+        */
+        result stream(const asset_stream_desc& desc, asset_request* request);
+
+        /**
+         * @brief Reserve staging memory for the next chunks, in the order in which the assets were requested.
+         * If the uploader's staging buffer is full, the remaining chunks are reserved in a later update().
+         *
+         * update() is intended to be called once per frame, before streaming_uploader::flush().
+         *
+         * @return Success upon correct execution of the operation.
+         * @return ErrorInvalidUsage if the streamer wasn't created.
+        */
+        result update();
+
+        /**
+         * @brief Query the progress of an asset.
+         * @return The asset's status, or asset_status::Failed if request wasn't returned by stream().
+        */
+        [[nodiscard]] asset_status queryStatus(const asset_request& request);
+
+    private:
+        struct asset
+        {
+            Resource* buffer;
+            resource_state state;
+            std::vector<compressed_chunk> chunks;
+            const uint8_t* file;
+            uint64_t fileSize;
+            uint32_t reservedChunks;
+            uint32_t pendingChunks;
+            streaming_request lastRequest;
+            asset_status status;
+        };
+
+        struct decompress_job
+        {
+            uint32_t asset;
+            uint32_t chunk;
+            streaming_buffer_reservation reservation;
+        };
+
+        void work();
+        void release(asset& a);
+
+        asset_streamer_desc m_desc {};
+        bool m_created = false;
+
+        std::vector<std::thread> m_workers;
+        bool m_stop = false;
+
+        std::mutex m_mutex;
+        std::condition_variable m_workAvailable;
+        std::vector<asset> m_assets;
+        std::deque<uint32_t> m_pending;
+        std::deque<decompress_job> m_jobs;
+    };
+}
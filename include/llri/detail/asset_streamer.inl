@@ -0,0 +1,296 @@
+/**
+ * @file asset_streamer.inl
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+#include <llri/asset.hpp> // unnecessary but helps intellisense
+
+namespace llri
+{
+    namespace detail
+    {
+        /**
+         * @brief Map a file into read-only memory. The file itself is closed again, the mapping keeps its contents accessible until unmapFile().
+        */
+        inline bool mapFile(const char* path, const uint8_t** data, uint64_t* size)
+        {
+#if defined(_WIN32)
+            HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+            if (file == INVALID_HANDLE_VALUE)
+                return false;
+
+            LARGE_INTEGER fileSize;
+            if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0)
+            {
+                CloseHandle(file);
+                return false;
+            }
+
+            HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            CloseHandle(file);
+            if (mapping == nullptr)
+                return false;
+
+            void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            CloseHandle(mapping);
+            if (view == nullptr)
+                return false;
+
+            *data = static_cast<const uint8_t*>(view);
+            *size = static_cast<uint64_t>(fileSize.QuadPart);
+#else
+            const int file = open(path, O_RDONLY);
+            if (file < 0)
+                return false;
+
+            struct stat info {};
+            if (fstat(file, &info) != 0 || info.st_size == 0)
+            {
+                close(file);
+                return false;
+            }
+
+            void* view = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+            close(file);
+            if (view == MAP_FAILED)
+                return false;
+
+            *data = static_cast<const uint8_t*>(view);
+            *size = static_cast<uint64_t>(info.st_size);
+#endif
+            return true;
+        }
+
+        inline void unmapFile(const uint8_t* data, uint64_t size)
+        {
+#if defined(_WIN32)
+            static_cast<void>(size);
+            UnmapViewOfFile(data);
+#else
+            munmap(const_cast<uint8_t*>(data), static_cast<size_t>(size));
+#endif
+        }
+    }
+
+    inline std::string to_string(asset_status status)
+    {
+        switch(status)
+        {
+            case asset_status::Loading:
+                return "Loading";
+            case asset_status::Complete:
+                return "Complete";
+            case asset_status::Failed:
+                return "Failed";
+        }
+
+        return "Invalid asset_status value";
+    }
+
+    inline result asset_streamer::create(const asset_streamer_desc& desc)
+    {
+        if (desc.uploader == nullptr || desc.decompress == nullptr)
+            return result::ErrorInvalidUsage;
+
+        destroy();
+
+        m_desc = desc;
+        m_stop = false;
+        m_created = true;
+
+        uint32_t numWorkers = desc.numWorkers;
+        if (numWorkers == 0)
+            numWorkers = std::max(std::thread::hardware_concurrency(), 1u);
+
+        for (uint32_t i = 0; i < numWorkers; i++)
+            m_workers.emplace_back(&asset_streamer::work, this);
+
+        return result::Success;
+    }
+
+    inline void asset_streamer::destroy()
+    {
+        if (!m_created)
+            return;
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_workAvailable.notify_all();
+
+        // workers finish the chunks that are left, so that every reservation in the uploader is committed before they exit
+        for (auto& worker : m_workers)
+            worker.join();
+
+        for (auto& a : m_assets)
+            release(a);
+
+        m_workers.clear();
+        m_assets.clear();
+        m_pending.clear();
+        m_jobs.clear();
+        m_created = false;
+    }
+
+    inline result asset_streamer::stream(const asset_stream_desc& desc, asset_request* request)
+    {
+        if (request == nullptr || desc.path == nullptr || desc.path[0] == '\0' || desc.buffer == nullptr || desc.state > resource_state::MaxEnum || desc.numChunks == 0 || desc.chunks == nullptr)
+            return result::ErrorInvalidUsage;
+
+        const resource_desc bufferDesc = desc.buffer->getDesc();
+        if (bufferDesc.type != resource_type::Buffer || bufferDesc.memoryType != memory_type::Local || !bufferDesc.usage.contains(resource_usage_flag_bits::TransferDst))
+            return result::ErrorInvalidUsage;
+
+        for (uint32_t i = 0; i < desc.numChunks; i++)
+        {
+            const compressed_chunk& chunk = desc.chunks[i];
+            if (chunk.sourceSize == 0 || chunk.size == 0 || chunk.bufferOffset + chunk.size > bufferDesc.width)
+                return result::ErrorInvalidUsage;
+        }
+
+        asset a { desc.buffer, desc.state, std::vector<compressed_chunk>(desc.chunks, desc.chunks + desc.numChunks), nullptr, 0, 0, 0, streaming_request {}, asset_status::Loading };
+        if (!detail::mapFile(desc.path, &a.file, &a.fileSize))
+        {
+            a.file = nullptr;
+            a.status = asset_status::Failed;
+        }
+        else
+        {
+            for (const auto& chunk : a.chunks)
+            {
+                if (chunk.sourceOffset + chunk.sourceSize > a.fileSize)
+                {
+                    a.status = asset_status::Failed;
+                    release(a);
+                    break;
+                }
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_created)
+        {
+            release(a);
+            return result::ErrorInvalidUsage;
+        }
+
+        request->index = static_cast<uint32_t>(m_assets.size());
+        if (a.status == asset_status::Loading)
+            m_pending.push_back(request->index);
+        m_assets.push_back(std::move(a));
+        return result::Success;
+    }
+
+    inline result asset_streamer::update()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (!m_created)
+            return result::ErrorInvalidUsage;
+
+        bool scheduled = false;
+        while (!m_pending.empty())
+        {
+            const uint32_t index = m_pending.front();
+            asset& a = m_assets[index];
+
+            while (a.status == asset_status::Loading && a.reservedChunks < a.chunks.size())
+            {
+                const compressed_chunk& chunk = a.chunks[a.reservedChunks];
+
+                streaming_buffer_reservation reservation;
+                const result r = m_desc.uploader->reserve(streaming_buffer_upload { a.buffer, chunk.bufferOffset, chunk.size, nullptr, a.state }, &reservation);
+                if (r == result::NotReady)
+                {
+                    // the staging buffer is full, the remaining chunks are reserved after the next flush
+                    lock.unlock();
+                    if (scheduled)
+                        m_workAvailable.notify_all();
+                    return result::Success;
+                }
+
+                if (r != result::Success)
+                {
+                    a.status = asset_status::Failed;
+                    break;
+                }
+
+                m_jobs.push_back(decompress_job { index, a.reservedChunks, reservation });
+                a.reservedChunks++;
+                a.pendingChunks++;
+                a.lastRequest = reservation.request;
+                scheduled = true;
+            }
+
+            if (a.status == asset_status::Failed && a.pendingChunks == 0)
+                release(a);
+
+            m_pending.pop_front();
+        }
+
+        lock.unlock();
+        if (scheduled)
+            m_workAvailable.notify_all();
+        return result::Success;
+    }
+
+    inline asset_status asset_streamer::queryStatus(const asset_request& request)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (request.index >= m_assets.size())
+            return asset_status::Failed;
+
+        asset& a = m_assets[request.index];
+        if (a.status != asset_status::Loading || a.reservedChunks < a.chunks.size() || a.pendingChunks > 0)
+            return a.status;
+
+        // uploads complete in order, so the last chunk completes last
+        if (m_desc.uploader->isComplete(a.lastRequest))
+            a.status = asset_status::Complete;
+        return a.status;
+    }
+
+    inline void asset_streamer::work()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        while (true)
+        {
+            m_workAvailable.wait(lock, [this] { return m_stop || !m_jobs.empty(); });
+            if (m_jobs.empty())
+                return;
+
+            const decompress_job job = m_jobs.front();
+            m_jobs.pop_front();
+
+            const asset& source = m_assets[job.asset];
+            const compressed_chunk chunk = source.chunks[job.chunk];
+            const uint8_t* file = source.file;
+
+            lock.unlock();
+
+            // the file's pages are read in here, on the worker, while the other workers decompress
+            const bool decompressed = m_desc.decompress(file + chunk.sourceOffset, static_cast<size_t>(chunk.sourceSize), job.reservation.data, static_cast<size_t>(chunk.size), m_desc.userData);
+            m_desc.uploader->commit(job.reservation.request);
+
+            lock.lock();
+
+            asset& a = m_assets[job.asset];
+            if (!decompressed)
+                a.status = asset_status::Failed;
+
+            a.pendingChunks--;
+            if (a.pendingChunks == 0 && (a.reservedChunks == a.chunks.size() || a.status == asset_status::Failed))
+                release(a);
+        }
+    }
+
+    inline void asset_streamer::release(asset& a)
+    {
+        if (a.file != nullptr)
+            detail::unmapFile(a.file, a.fileSize);
+        a.file = nullptr;
+    }
+}
@@ -0,0 +1,178 @@
+/**
+ * @file callback.hpp
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+#include <llri/llri.hpp> // unnecessary but helps intellisense
+
+namespace llri
+{
+    /**
+     * @brief Describes the severity of a callback message.
+     * @note message_severity is meant to be used for message filtering, and has no binding impact on the implementation's behaviour.
+    */
+    enum struct message_severity : uint8_t
+    {
+        /**
+         * @brief Extra, often excessive information about API calls, diagnostics, support, etc.
+        */
+        Verbose,
+        /**
+         * @brief Information about the implementation, operations, or resource details.
+        */
+        Info,
+        /**
+         * @brief A potential issue in the application. The issue may not be harmful, but could still lead to performance drops or unexpected behaviour.
+        */
+        Warning,
+        /**
+         * @brief Invalid (possibly fatal) API usage was detected.
+        */
+        Error,
+        /**
+         * @brief Data/memory corruption occurred.
+        */
+        Corruption,
+        /**
+         * @brief The highest value in this enum.
+        */
+        MaxEnum = Corruption
+    };
+
+    /**
+     * @brief Converts a message_severity to a string.
+     * @return The enum value as a string, or "Invalid message_severity value" if the value was not recognized as an enum member.
+    */
+    inline std::string to_string(message_severity severity);
+
+    /**
+     * @brief Describes the source of the callback message.
+    */
+    enum struct message_source : uint8_t
+    {
+        /**
+         * @brief The message came from the LLRI API. Either through validation or through other means.
+        */
+        API,
+        /**
+         * @brief The message came from the implementation.
+         * Implementation validation needs to be enabled through instance_extension::DriverValidation and/or GPUValidation for this kind of message to appear.
+         *
+         * @note This value never occurs if LLRI_DISABLE_IMPLEMENTATION_MESSAGE_POLLING is defined.
+        */
+        Implementation,
+        /**
+         * @brief The highest value in this enum.
+        */
+        MaxEnum = Implementation
+    };
+
+    /**
+     * @brief Converts a message_severity to a string.
+     * @return The enum value as a string, or "Invalid message_severity value" if the value was not recognized as an enum member.
+    */
+    inline std::string to_string(message_source source);
+
+    /**
+     * @brief The callback function.
+     * The callback passes numerous parameters which help classify the message's severity and source. It also passes the userData pointer that was initially passed in callback_desc.
+    */
+    using message_callback = void(
+        message_severity severity,
+        message_source source,
+        const char* message,
+        void* userData
+        );
+
+    /**
+     * @brief Describes when messages are sent to the message callback.
+    */
+    enum struct message_delivery : uint8_t
+    {
+        /**
+         * @brief Messages are sent to the callback immediately, on the thread that raised them. This includes implementation threads, e.g. a driver's validation layer calling back from within an API call.
+        */
+        Immediate,
+        /**
+         * @brief Messages are pushed into a lock-free queue and are only sent to the callback when llri::pollMessages() is called.
+         * Raising a message never allocates or blocks, and messages that are raised again while an identical message is still pending are de-duplicated, which rate-limits repeated messages to one per llri::pollMessages() call.
+         * Pending messages are stored in fixed-size entries, so messages longer than 511 characters are truncated.
+        */
+        Deferred,
+        /**
+         * @brief The highest value in this enum.
+        */
+        MaxEnum = Deferred
+    };
+
+    /**
+     * @brief Converts a message_delivery to a string.
+     * @return The enum value as a string, or "Invalid message_delivery value" if the value was not recognized as an enum member.
+    */
+    inline std::string to_string(message_delivery delivery);
+
+    namespace detail
+    {
+        /**
+         * @brief The callback and user data that messages raised by an object are sent to.
+         * Every object stores its own copy, inherited from the Instance that created it, so that routing a message never touches shared state.
+        */
+        struct message_target
+        {
+            message_callback* callback = nullptr;
+            void* userData = nullptr;
+        };
+
+        /**
+         * @brief Global message callback, not part of the public API - should not be accessed directly but instead be set through llri::setMessageCallback().
+        */
+        inline message_callback* m_messageCallback;
+        /**
+         * @brief Global user data, not part of the public API - should not be accessed directly but instead be set through llri::setMessageCallback().
+        */
+        inline void* m_userData;
+    }
+
+    /**
+     * @brief The message callback allows the user to subscribe to callback messages so that they can write the message into their own logging system. These messages may be validation errors, implementation errors, informational messages, warnings, or anything else that the API or its implementation wishes to forward.
+     *
+     * The callback contains contextual information about the message, like for example its severity.
+     *
+     * The callback set here is the default for Instances: an Instance created with instance_desc::messageCallback set to nullptr copies the callback and user data that are set at the time of llri::createInstance(). Changing the callback afterwards does not affect existing Instances.
+     *
+     * @note Implementation messages only occur if instance_extension::DriverValidation and/or GPUValidation are enabled. If no message callback is set, some implementations might still output messages (Vulkan tends to print to stdout, whereas DirectX tends to print to the "Output" window in Visual Studio).
+     * @note This function is not thread-safe and **must not** be called while llri::createInstance() or llri::pollMessages() are executing on other threads.
+     *
+     * @param callback The callback, the function passed must conform to the message_callback definition. You **may** set this value to nullptr, in which case no messages are sent.
+     * @param userData Optional user data pointer. Not used by LLRI but it's passed around and sent along the callback.
+    */
+    inline void setMessageCallback(message_callback* callback, void* userData = nullptr)
+    {
+        detail::m_messageCallback = callback;
+        detail::m_userData = userData;
+    }
+
+    /**
+     * @brief Sets when messages are sent to the message callback. The default is message_delivery::Immediate.
+     *
+     * @note Messages that are still pending when switching from message_delivery::Deferred to message_delivery::Immediate are sent on the next llri::pollMessages() call.
+     *
+     * @param delivery The delivery mode. If the value is more than message_delivery::MaxEnum, the call is ignored.
+    */
+    inline void setMessageDelivery(message_delivery delivery);
+
+    /**
+     * @brief Sends all pending deferred messages to the message callback of the object that raised them, on the calling thread.
+     *
+     * Messages that were de-duplicated while pending are sent once with their repeat count appended. If messages were dropped because the queue was full, a single warning that reports the number of dropped messages is sent to every callback that messages were dropped for.
+     *
+     * This function is intended to be called once per frame, or continuously from a dedicated logging thread.
+     *
+     * @note llri::pollMessages() **must not** be called from multiple threads simultaneously.
+     *
+     * @return The number of messages that were sent to a message callback.
+    */
+    inline size_t pollMessages();
+}
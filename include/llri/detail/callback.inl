@@ -0,0 +1,101 @@
+/**
+ * @file callback.inl
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+#include <llri/llri.hpp> // unnecessary but helps intellisense
+
+namespace llri
+{
+    inline std::string to_string(message_severity severity)
+    {
+        switch (severity)
+        {
+        case message_severity::Verbose:
+            return "Verbose";
+        case message_severity::Info:
+            return "Info";
+        case message_severity::Warning:
+            return "Warning";
+        case message_severity::Error:
+            return "Error";
+        case message_severity::Corruption:
+            return "Corruption";
+        }
+
+        return "Invalid message_severity value";
+    }
+
+    inline std::string to_string(message_source source)
+    {
+        switch (source)
+        {
+        case message_source::API:
+            return "API";
+        case message_source::Implementation:
+            return "Implementation";
+        }
+
+        return "Invalid message_source value";
+    }
+
+    inline std::string to_string(message_delivery delivery)
+    {
+        switch (delivery)
+        {
+        case message_delivery::Immediate:
+            return "Immediate";
+        case message_delivery::Deferred:
+            return "Deferred";
+        }
+
+        return "Invalid message_delivery value";
+    }
+
+    inline void setMessageDelivery(message_delivery delivery)
+    {
+        if (delivery > message_delivery::MaxEnum)
+            return;
+
+        detail::m_messageDelivery.store(delivery, std::memory_order_relaxed);
+    }
+
+    inline size_t pollMessages()
+    {
+        size_t count = 0;
+
+        detail::message_entry entry;
+        uint32_t repeats = 0;
+        while (detail::m_messageQueue.pop(entry, repeats))
+        {
+            if (repeats > 0)
+            {
+                entry.append(" (repeated ");
+                entry.append(repeats);
+                entry.append(" more times)");
+            }
+
+            entry.target.callback(entry.severity, entry.source, entry.text, entry.target.userData);
+            count++;
+        }
+
+        // dropped messages are reported to the targets that they were raised for
+        detail::m_messageQueue.takeDropped([&entry, &count](const detail::message_target& target, uint32_t dropped)
+        {
+            entry.severity = message_severity::Warning;
+            entry.source = message_source::API;
+            entry.length = 0;
+            entry.text[0] = '\0';
+            entry.append("in pollMessages: ");
+            entry.append(dropped);
+            entry.append(" messages were dropped because the message queue was full.");
+
+            target.callback(entry.severity, entry.source, entry.text, target.userData);
+            count++;
+        });
+
+        return count;
+    }
+}
@@ -0,0 +1,149 @@
+/**
+ * @file command_group.inl
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+#include <llri/llri.hpp> // unnecessary but helps intellisense
+
+namespace llri
+{
+    inline queue_type CommandGroup::getType() const
+    {
+        return m_type;
+    }
+
+    inline CommandGroup::native_command_group* CommandGroup::getNative() const
+    {
+        return m_ptr;
+    }
+
+    inline result CommandGroup::reset()
+    {
+#ifdef LLRI_DETAIL_ENABLE_VALIDATION
+        LLRI_DETAIL_VALIDATION_FULL(m_validationLevel)
+        {
+            for (auto* cmdList : m_cmdLists)
+            {
+                LLRI_DETAIL_VALIDATION_REQUIRE(cmdList->getState() != command_list_state::Recording, result::ErrorInvalidState)
+            }
+        }
+#endif
+
+        LLRI_DETAIL_CALL_IMPL_STATISTICS(impl_reset(), m_validationCallbackMessenger, *m_statistics, device_call::Reset)
+    }
+
+    inline result CommandGroup::allocate(const command_list_alloc_desc& desc, CommandList** cmdList)
+    {
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(cmdList != nullptr, result::ErrorInvalidUsage)
+        }
+
+        *cmdList = nullptr;
+
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(desc.usage <= command_list_usage::MaxEnum, result::ErrorInvalidUsage)
+        }
+
+        LLRI_DETAIL_VALIDATION_FULL(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(detail::hasSingleBit(desc.nodeMask), result::ErrorInvalidNodeMask)
+            LLRI_DETAIL_VALIDATION_REQUIRE(desc.nodeMask < (1u << m_device->m_adapter->queryNodeCount()), result::ErrorInvalidNodeMask)
+        }
+
+        LLRI_DETAIL_TRACE_SCOPE()
+        const auto callBegin = detail::statisticsNow();
+        const result r = impl_allocate(desc, cmdList);
+        m_statistics->recordCall(device_call::Allocate, callBegin);
+        if (r == result::Success)
+            m_device->m_lifetime.track(detail::tracked_object::CommandList);
+
+        LLRI_DETAIL_POLL_API_MESSAGES(m_validationCallbackMessenger)
+        return r;
+    }
+
+    inline result CommandGroup::allocate(const command_list_alloc_desc& desc, uint8_t count, std::vector<CommandList*>* cmdLists)
+    {
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(cmdLists != nullptr, result::ErrorInvalidUsage)
+        }
+
+        cmdLists->clear();
+
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(desc.usage <= command_list_usage::MaxEnum, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(count > 0, result::ErrorInvalidUsage)
+        }
+
+        LLRI_DETAIL_TRACE_SCOPE()
+        const auto callBegin = detail::statisticsNow();
+        const result r = impl_allocate(desc, count, cmdLists);
+        m_statistics->recordCall(device_call::Allocate, callBegin);
+        if (r == result::Success)
+            m_device->m_lifetime.track(detail::tracked_object::CommandList, count);
+
+        LLRI_DETAIL_POLL_API_MESSAGES(m_validationCallbackMessenger)
+        return r;
+    }
+
+    inline result CommandGroup::free(CommandList* cmdList)
+    {
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(cmdList != nullptr, result::ErrorInvalidUsage)
+        }
+
+        LLRI_DETAIL_VALIDATION_FULL(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(m_cmdLists.contains(cmdList), result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(cmdList->getState() != command_list_state::Recording, result::ErrorInvalidState)
+        }
+
+        LLRI_DETAIL_TRACE_SCOPE()
+        const result r = impl_free(cmdList);
+        if (r == result::Success)
+            m_device->m_lifetime.untrack(detail::tracked_object::CommandList);
+
+        LLRI_DETAIL_POLL_API_MESSAGES(m_validationCallbackMessenger)
+        return r;
+    }
+
+    inline result CommandGroup::free(uint8_t numCommandLists, CommandList** cmdLists)
+    {
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(cmdLists != nullptr, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(numCommandLists > 0, result::ErrorInvalidUsage)
+        }
+
+#ifdef LLRI_DETAIL_ENABLE_VALIDATION
+        LLRI_DETAIL_VALIDATION_FULL(m_validationLevel)
+        {
+            for (size_t i = 0; i < numCommandLists; i++)
+            {
+                LLRI_DETAIL_VALIDATION_REQUIRE_ITER(cmdLists[i] != nullptr, i, result::ErrorInvalidUsage)
+                LLRI_DETAIL_VALIDATION_REQUIRE_ITER(m_cmdLists.contains(cmdLists[i]), i, result::ErrorInvalidUsage)
+                LLRI_DETAIL_VALIDATION_REQUIRE_ITER(cmdLists[i]->getState() != command_list_state::Recording, i, result::ErrorInvalidState)
+            }
+        }
+#endif
+
+        LLRI_DETAIL_TRACE_SCOPE()
+        const result r = impl_free(numCommandLists, cmdLists);
+        if (r == result::Success)
+            m_device->m_lifetime.untrack(detail::tracked_object::CommandList, numCommandLists);
+
+        LLRI_DETAIL_POLL_API_MESSAGES(m_validationCallbackMessenger)
+        return r;
+    }
+
+    inline CommandList* CommandGroup::resolve(handle<CommandList> h) const
+    {
+        return m_cmdLists.resolve(h);
+    }
+}
@@ -0,0 +1,461 @@
+/**
+ * @file command_list.hpp
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+#include <llri/llri.hpp> // unnecessary but helps intellisense
+
+namespace llri
+{
+    class CommandGroup;
+    struct resource_barrier;
+    class QueryPool;
+    class Resource;
+
+    /**
+     * @brief Describes how the CommandList is going to be used. A CommandList's usage is exclusive and can not be changed after allocation.
+    */
+    enum struct command_list_usage : uint8_t
+    {
+        /**
+         * @brief The CommandList will be directly submitted to a Queue.
+        */
+        Direct,
+        /**
+         * @brief The CommandList is indirect and can be submitted to another CommandList before that CommandList is submitted to a queue.
+         * This can be useful for recording a set of commands that can be dynamically submitted to other lists, which might save CPU time.
+         *
+         * Indirect CommandLists **can not** be submitted to a queue directly.
+        */
+        Indirect,
+        /**
+         * @brief The highest value in this enum.
+        */
+        MaxEnum = Indirect
+    };
+
+    /**
+     * @brief Converts a command_list_usage to a string.
+     * @return The enum value as a string, or "Invalid command_list_usage value" if the value was not recognized as an enum member.
+    */
+    inline std::string to_string(command_list_usage usage);
+
+    /**
+     * @brief Describes how the command list(s) should be allocated what their usage will be.
+    */
+    struct command_list_alloc_desc
+    {
+        /**
+         * @brief The Device node on which the command list(s) should be allocated. Every bit in the mask corresponds to a node (if present) and for command list allocation a single bit **must** be set.
+         *
+         * For convenience, 0 **may** be passed, which is interpreted as 1 and refers to the first/default node.
+         *
+         * @note Valid usage (ErrorInvalidNodeMask): The node mask **must not** have a bit set if the bit is at a position more than or equals Adapter::queryNodeCount().
+         * @note Valid usage (ErrorInvalidNodeMask): The node mask **must not** have more than one bit set to positive.
+        */
+        uint32_t nodeMask;
+
+        /**
+         * @brief Describes if the CommandList will be used to be submitted to Queues directly or if they will be submitted indirectly through other CommandLists.
+         *
+         * @note Valid usage (ErrorInvalidUsage): The usage must be less or equal to command_list_usage::MaxEnum.
+        */
+        command_list_usage usage;
+    };
+    
+    /**
+     * @brief The current state of the CommandList.
+     *
+     * The CommandList's state defines which operations can be applied to it. 
+    */
+    enum struct command_list_state : uint8_t
+    {
+        /**
+         * @brief The default state of a CommandList. A CommandList is in this state just after creation, or after having been reset through CommandGroup::reset(). From here, CommandList **may** transition into command_list_state::Recording through CommandList::begin().
+        */
+        Empty,
+        /**
+         * @brief When a CommandList is in this state, commands may be submitted to the CommandList, but it **can not** be used for any other operations. Once CommandList::end() is called, it is transitioned into the command_list_state::Ready state.
+        */
+        Recording,
+        /**
+         * @brief A CommandList in this state **can** be submitted through Queue::submit(). CommandLists in this state **can not** be opened for recording again but instead **must** be reset through CommandGroup::reset() before they **can** be used for recording again.
+        */
+        Ready
+    };
+
+    /**
+     * @brief Contextual information about how (and on what GPU) the CommandList will be submitted, and what kind of information was previously set (if this is an indirect CommandList).
+    */
+    struct command_list_begin_desc
+    {
+        // Empty placeholder structure for future begin information
+    };
+
+    /**
+     * @brief Describes a copy between a region of a texture subresource and a buffer, used by CommandList::copyBufferToTexture() and CommandList::copyTextureToBuffer().
+     *
+     * In the buffer, the region is laid out as extent.depth slices of extent.height rows, where each row starts bufferRowPitch bytes after the previous row and holds extent.width tightly packed texels of format_size(resource_desc::textureFormat) bytes.
+    */
+    struct texture_copy_desc
+    {
+        /**
+         * @brief The buffer that is copied from or to.
+         *
+         * @note Valid usage (ErrorInvalidUsage): buffer **must** be a valid non-null pointer to a Resource with resource_type::Buffer.
+        */
+        Resource* buffer;
+        /**
+         * @brief The offset in bytes into the buffer at which the region starts.
+         *
+         * @note Valid usage (ErrorInvalidUsage): bufferOffset **must** be a multiple of 512 and a multiple of format_size(resource_desc::textureFormat).
+         * @note Valid usage (ErrorInvalidUsage): bufferOffset + bufferRowPitch * extent.height * extent.depth **must** be less than or equal to the buffer's size.
+        */
+        uint64_t bufferOffset;
+        /**
+         * @brief The number of bytes between the start of two consecutive rows in the buffer.
+         *
+         * @note Valid usage (ErrorInvalidUsage): bufferRowPitch **must** be a multiple of 256 and a multiple of format_size(resource_desc::textureFormat).
+         * @note Valid usage (ErrorInvalidUsage): bufferRowPitch **must** be at least extent.width * format_size(resource_desc::textureFormat).
+        */
+        uint32_t bufferRowPitch;
+
+        /**
+         * @brief The texture that is copied from or to.
+         *
+         * @note Valid usage (ErrorInvalidUsage): texture **must** be a valid non-null pointer to a Resource with a texture resource_type.
+         * @note Valid usage (ErrorInvalidUsage): texture **must** have been created with sample_count::Count1 and a textureFormat that has a color component.
+        */
+        Resource* texture;
+        /**
+         * @brief The mip level of the texture subresource.
+         *
+         * @note Valid usage (ErrorInvalidUsage): mipLevel **must** be less than resource_desc::mipLevels.
+        */
+        uint32_t mipLevel;
+        /**
+         * @brief The array layer of the texture subresource.
+         *
+         * @note Valid usage (ErrorInvalidUsage): arrayLayer **must** be less than resource_desc::depthOrArrayLayers, unless if resource_desc::type is Texture3D, then it **must** be 0.
+        */
+        uint32_t arrayLayer;
+        /**
+         * @brief The offset in texels of the region in the texture subresource.
+         *
+         * @note Valid usage (ErrorInvalidUsage): x, y and z **must not** be negative.
+         * @note Valid usage (ErrorInvalidUsage): if resource_desc::type is Texture1D then y **must** be 0. If resource_desc::type is not Texture3D then z **must** be 0.
+        */
+        offset_3d textureOffset;
+        /**
+         * @brief The size in texels of the region.
+         *
+         * @note Valid usage (ErrorInvalidUsage): width, height and depth **must not** be 0.
+         * @note Valid usage (ErrorInvalidUsage): textureOffset + extent **must not** exceed the size of the texture subresource, which is the size of the texture at mipLevel, or 1 for the depth of textures that are not Texture3D.
+        */
+        extent_3d extent;
+    };
+
+    /**
+     * @brief Converts a command_list_state to a string.
+     * @return The enum value as a string, or "Invalid command_list_state value" if the value was not recognized as an enum member.
+    */
+    inline std::string to_string(command_list_state state);
+
+    class CommandList
+    {
+        friend class Device;
+        friend class CommandGroup;
+        friend class Queue;
+        template<typename, typename> friend class detail::object_pool;
+        
+    public:
+        using native_command_list = void;
+
+        /**
+         * Get the desc that the CommandList was allocated with.
+         */
+        [[nodiscard]] command_list_alloc_desc getDesc() const;
+
+        /**
+         * @brief Gets the native CommandList pointer, which depending on the llri::getImplementation() is a pointer to the following:
+         *
+         * DirectX12: ID3D12CommandList*
+         * Vulkan: VkCommandBuffer
+         * Null: an internal object that records the commands that are emulated on submit
+         * CPU: an internal object that records the commands that are executed on submit
+         */
+        [[nodiscard]] native_command_list* getNative() const;
+
+        /**
+         * @brief Get the CommandGroup that the CommandList was allocated from. The CommandList **can** only be submitted to Queues of the CommandGroup's queue_type.
+        */
+        [[nodiscard]] CommandGroup* getGroup() const;
+
+        /**
+         * @brief Get the CommandList's generational handle, which can be resolved through CommandGroup::resolve() and is safe to hold on to after the CommandList is freed.
+        */
+        [[nodiscard]] handle<CommandList> getHandle() const;
+        
+        /**
+         * @brief Set the CommandList in a command_list_state::Recording state.
+         *
+         * The CommandList **must** be in the command_list_state::Empty state for it to transition into a command_list_state::Recording state.
+         * If the CommandList is in the command_list_state::Ready state, it **must** first be reset to command_list_state::Empty through CommandGroup::reset() before calling this function.
+         *
+         * @param desc Contains contextual information about how (and on what GPU) the CommandList will be submitted, and what kind of information was previously set if this is an indirect CommandList.
+         *
+         * @note Valid usage (ErrorInvalidState): The CommandList **must** be in the command_list_state::Empty state.
+         *
+         * @return Success upon correct execution of the operation.
+         * @return command_list_begin_desc defined return values: -
+         *
+         * @note The memory required for CommandList recording is allocated through its CommandGroup. Because of this, commandLists allocated through the same CommandGroup **can not** be recorded simultaneously and are thus not thread-safe. For multi-threaded recording, it is recommended to create at least one separate CommandGroup per thread to prevent this from becoming an issue.
+        */
+        result begin(const command_list_begin_desc& desc);
+
+        /**
+         * @brief Set the CommandList in the command_list_state::Ready state.
+         *
+         * The CommandList **must** be in the command_list_state::Recording state for it to transition into a command_list_state::Ready state.
+         *
+         * @note Valid usage (ErrorInvalidState): The CommandList **must** be in the command_list_state::Recording state.
+         *
+         * @return Success upon correct execution of the operation.
+        */
+        result end();
+
+        /**
+         * @brief Shorthand convenience function for recording the CommandList.
+         * This is the equivalent of calling CommandList::begin(), running the commands in the passed function, and then calling CommandList::end().
+         *
+         * Prior to this function call, CommandList must be in the command_list_state::Empty state. Afterwards it will be in the command_list_state::Ready state.
+         *
+         * @note Read the documentation for CommandList::begin() and CommandList::end() for information on their valid usage, return values, etc.
+         *
+         * @param desc Contains contextual information about how (and on what GPU) the CommandList will be executed, and what kind of information the CommandList inherits if this is an indirect CommandList.
+         * @param function A function (usually a lambda), with Args as parameters. Within the scope of the function, CommandList commands **can** be recorded.
+         * @param args The parameter values to be passed into function.
+         *
+         * @return Success upon correct execution of the operation.
+         * @return Any errors listed in CommandList::begin() and CommandList::end().
+        */
+        template<typename Func, typename ...Args>
+        result record(const command_list_begin_desc& desc, Func&& function, Args&&... args);
+
+        /**
+         * @brief Returns the current state of the CommandList.
+         *
+         * After creation, CommandList will initially be in the command_list_state::Empty state. Once CommandList::begin() is called, the CommandList will be in the command_list_state::Recording state. After that, when CommandList::end() is called, CommandList will be put in the command_list_state::Ready state, in which it will stay until CommandGroup::reset() is called.
+        */
+        [[nodiscard]] command_list_state getState() const { return m_state; }
+        
+        /**
+         * @brief Insert one or more resource memory dependencies.
+         *
+         * @note Valid usage (ErrorInvalidState): The CommandList **must** be in the Recording state.
+         *
+         * @note Valid usage (ErrorInvalidUsage): numBarriers **must** be more than 0.
+         * @note Valid usage (ErrorInvalidUsage): barriers **must** be a valid non-null pointer to a resource_barrier array of size numBarriers.
+         *
+         * @return Success upon correct excution of the operation.
+         * @return resource_barrier defined result values: ErrorInvalidUsage, ErrorInvalidState.
+        */
+        result resourceBarrier(uint32_t numBarriers, const resource_barrier* barriers);
+
+        /**
+         * @brief Insert one or more resource memory dependencies.
+         *
+         * @note Utility function; the equivalent of calling resourceBarrier(count, arr);
+         * @note Valid usage (ErrorInvalidState): The CommandList **must** be in the Recording state.
+         *
+         * @return Success upon correct excution of the operation.
+         * @return resource_barrier defined result values: ErrorInvalidUsage, ErrorInvalidState.
+         */
+        template<size_t count>
+	    result resourceBarrier(const resource_barrier(&arr)[count])
+	    {
+	        return resourceBarrier(count, arr);
+	    }
+
+        /**
+         * @brief Insert a resource memory dependency.
+         *
+         * @note Utility function; the equivalent of calling resourceBarrier(1, &barrier);
+         * @note Valid usage (ErrorInvalidState): The CommandList **must** be in the Recording state.
+         *
+         * @return Success upon correct excution of the operation.
+         * @return resource_barrier defined result values: ErrorInvalidUsage, ErrorInvalidState.
+         */
+        result resourceBarrier(const resource_barrier& barrier);
+
+        /**
+         * @brief Reset a range of queries in a QueryPool so that they can be written again.
+         * Queries **must** be reset before they're written, and after their results have been read back if the QueryPool is reused.
+         *
+         * @param pool The QueryPool that holds the queries.
+         * @param first The index of the first query in the range.
+         * @param count The number of queries in the range.
+         *
+         * @note Valid usage (ErrorInvalidState): The CommandList **must** be in the Recording state.
+         * @note Valid usage (ErrorInvalidUsage): pool **must** be a valid non-null pointer to a QueryPool.
+         * @note Valid usage (ErrorInvalidUsage): count **must** be more than 0.
+         * @note Valid usage (ErrorInvalidUsage): first + count **must** be less than or equal to query_pool_desc::count.
+         *
+         * @return Success upon correct execution of the operation.
+        */
+        result resetQueries(QueryPool* pool, uint32_t first, uint32_t count);
+
+        /**
+         * @brief Write a GPU timestamp into a query once all previously recorded commands have completed.
+         *
+         * @param pool The QueryPool that holds the query. pool **must** be created with query_type::Timestamp.
+         * @param index The index of the query in the pool.
+         *
+         * @note Valid usage (ErrorInvalidState): The CommandList **must** be in the Recording state.
+         * @note Valid usage (ErrorInvalidUsage): pool **must** be a valid non-null pointer to a QueryPool.
+         * @note Valid usage (ErrorInvalidUsage): pool **must** have been created with query_type::Timestamp.
+         * @note Valid usage (ErrorInvalidUsage): The CommandList's CommandGroup **must not** have been created with queue_type::Transfer, because not all implementations support timestamps on transfer queues.
+         * @note Valid usage (ErrorInvalidUsage): index **must** be less than query_pool_desc::count.
+         *
+         * @return Success upon correct execution of the operation.
+        */
+        result writeTimestamp(QueryPool* pool, uint32_t index);
+
+        /**
+         * @brief Start counting into a query. Every beginQuery() **must** be matched by an endQuery() on the same query, in the same CommandList.
+         *
+         * @param pool The QueryPool that holds the query.
+         * @param index The index of the query in the pool.
+         *
+         * @note Valid usage (ErrorInvalidState): The CommandList **must** be in the Recording state.
+         * @note Valid usage (ErrorInvalidUsage): pool **must** be a valid non-null pointer to a QueryPool.
+         * @note Valid usage (ErrorInvalidUsage): pool **must not** have been created with query_type::Timestamp.
+         * @note Valid usage (ErrorInvalidUsage): index **must** be less than query_pool_desc::count.
+         * @note Valid usage (ErrorInvalidUsage): If pool was created with query_type::Occlusion, the CommandList's CommandGroup **must** have been created with queue_type::Graphics.
+         * @note Valid usage (ErrorInvalidUsage): If pool was created with query_type::PipelineStatistics, the CommandList's CommandGroup **must not** have been created with queue_type::Transfer.
+         *
+         * @return Success upon correct execution of the operation.
+        */
+        result beginQuery(QueryPool* pool, uint32_t index);
+
+        /**
+         * @brief Stop counting into a query that was started with beginQuery().
+         *
+         * @param pool The QueryPool that holds the query.
+         * @param index The index of the query in the pool.
+         *
+         * @note Valid usage: The same valid usage as beginQuery() applies.
+         *
+         * @return Success upon correct execution of the operation.
+        */
+        result endQuery(QueryPool* pool, uint32_t index);
+
+        /**
+         * @brief Copy the results of a range of queries into a buffer on the GPU, once the queries have completed.
+         * Because the copy happens on the GPU, reading the results back through a memory_type::Read buffer never stalls the CPU on the queries themselves.
+         *
+         * Each query writes queryResultCount(desc.type) tightly packed uint64_t values, so query n in the range is written at dstOffset + n * queryResultCount(desc.type) * sizeof(uint64_t).
+         *
+         * @param pool The QueryPool that holds the queries.
+         * @param first The index of the first query in the range.
+         * @param count The number of queries in the range.
+         * @param dst The buffer that receives the results. dst **must** be in the resource_state::TransferDst state.
+         * @param dstOffset The offset in bytes into dst.
+         *
+         * @note Valid usage (ErrorInvalidState): The CommandList **must** be in the Recording state.
+         * @note Valid usage (ErrorInvalidUsage): pool and dst **must** be valid non-null pointers.
+         * @note Valid usage (ErrorInvalidUsage): count **must** be more than 0 and first + count **must** be less than or equal to query_pool_desc::count.
+         * @note Valid usage (ErrorInvalidUsage): dst **must** be a resource_type::Buffer with resource_usage_flag_bits::TransferDst, in memory_type::Local or memory_type::Read.
+         * @note Valid usage (ErrorInvalidUsage): dstOffset **must** be a multiple of 8, and the results **must** fit in dst.
+         * @note Valid usage (ErrorInvalidUsage): The CommandList's CommandGroup **must not** have been created with queue_type::Transfer.
+         *
+         * @return Success upon correct execution of the operation.
+        */
+        result copyQueryResults(QueryPool* pool, uint32_t first, uint32_t count, Resource* dst, uint64_t dstOffset);
+
+        /**
+         * @brief Copy a range of bytes from one buffer to another.
+         *
+         * @param src The buffer to copy from. src **must** be in the resource_state::TransferSrc state, or in the resource_state::Upload state if it was created with memory_type::Upload.
+         * @param srcOffset The offset in bytes into src.
+         * @param dst The buffer to copy to. dst **must** be in the resource_state::TransferDst state.
+         * @param dstOffset The offset in bytes into dst.
+         * @param size The number of bytes to copy.
+         *
+         * @note Valid usage (ErrorInvalidState): The CommandList **must** be in the Recording state.
+         * @note Valid usage (ErrorInvalidUsage): src and dst **must** be valid non-null pointers to Resources with resource_type::Buffer.
+         * @note Valid usage (ErrorInvalidUsage): src and dst **must not** be the same Resource.
+         * @note Valid usage (ErrorInvalidUsage): src **must** have been created with resource_usage_flag_bits::TransferSrc, in memory_type::Local or memory_type::Upload.
+         * @note Valid usage (ErrorInvalidUsage): dst **must** have been created with resource_usage_flag_bits::TransferDst, in memory_type::Local or memory_type::Read.
+         * @note Valid usage (ErrorInvalidUsage): size **must** be more than 0.
+         * @note Valid usage (ErrorInvalidUsage): srcOffset + size **must** be less than or equal to the size of src, and dstOffset + size **must** be less than or equal to the size of dst.
+         *
+         * @return Success upon correct execution of the operation.
+        */
+        result copyBuffer(Resource* src, uint64_t srcOffset, Resource* dst, uint64_t dstOffset, uint64_t size);
+
+        /**
+         * @brief Copy a region of a buffer into a texture subresource.
+         *
+         * @param desc Describes the buffer region and the texture region. desc.buffer **must** be in the resource_state::TransferSrc state, or in the resource_state::Upload state if it was created with memory_type::Upload. desc.texture **must** be in the resource_state::TransferDst state.
+         *
+         * @note Valid usage (ErrorInvalidState): The CommandList **must** be in the Recording state.
+         * @note Valid usage (ErrorInvalidUsage): desc.buffer **must** have been created with resource_usage_flag_bits::TransferSrc, in memory_type::Local or memory_type::Upload.
+         * @note Valid usage (ErrorInvalidUsage): desc.texture **must** have been created with resource_usage_flag_bits::TransferDst.
+         *
+         * @return Success upon correct execution of the operation.
+         * @return texture_copy_desc defined result values: ErrorInvalidUsage.
+        */
+        result copyBufferToTexture(const texture_copy_desc& desc);
+
+        /**
+         * @brief Copy a region of a texture subresource into a buffer.
+         *
+         * @param desc Describes the texture region and the buffer region. desc.texture **must** be in the resource_state::TransferSrc state and desc.buffer **must** be in the resource_state::TransferDst state.
+         *
+         * @note Valid usage (ErrorInvalidState): The CommandList **must** be in the Recording state.
+         * @note Valid usage (ErrorInvalidUsage): desc.texture **must** have been created with resource_usage_flag_bits::TransferSrc.
+         * @note Valid usage (ErrorInvalidUsage): desc.buffer **must** have been created with resource_usage_flag_bits::TransferDst, in memory_type::Local or memory_type::Read.
+         *
+         * @return Success upon correct execution of the operation.
+         * @return texture_copy_desc defined result values: ErrorInvalidUsage.
+        */
+        result copyTextureToBuffer(const texture_copy_desc& desc);
+    private:
+        // Force private constructor/deconstructor so that only alloc/free can manage lifetime
+        CommandList() = default;
+        ~CommandList() = default;
+
+        handle<CommandList> m_handle;
+        native_command_list* m_ptr = nullptr;
+        CommandGroup* m_group = nullptr;
+
+        void* m_deviceHandle = nullptr;
+        void* m_deviceFunctionTable = nullptr;
+
+        command_list_alloc_desc m_desc;
+        command_list_state m_state = command_list_state::Empty;
+
+        void* m_validationCallbackMessenger = nullptr;
+        validation_level m_validationLevel = validation_level::Full;
+        detail::message_target m_messageTarget;
+        detail::device_statistics_recorder* m_statistics = nullptr;
+
+        result impl_begin(const command_list_begin_desc& desc);
+        result impl_end();
+        
+        result impl_resourceBarrier(uint32_t numBarriers, const resource_barrier* barriers);
+
+        result impl_resetQueries(QueryPool* pool, uint32_t first, uint32_t count);
+        result impl_writeTimestamp(QueryPool* pool, uint32_t index);
+        result impl_beginQuery(QueryPool* pool, uint32_t index);
+        result impl_endQuery(QueryPool* pool, uint32_t index);
+        result impl_copyQueryResults(QueryPool* pool, uint32_t first, uint32_t count, Resource* dst, uint64_t dstOffset);
+
+        result impl_copyBuffer(Resource* src, uint64_t srcOffset, Resource* dst, uint64_t dstOffset, uint64_t size);
+        result impl_copyBufferToTexture(const texture_copy_desc& desc);
+        result impl_copyTextureToBuffer(const texture_copy_desc& desc);
+    };
+}
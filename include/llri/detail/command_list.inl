@@ -0,0 +1,437 @@
+/**
+ * @file command_list.inl
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+#include <llri/llri.hpp> // unnecessary but helps intellisense
+
+namespace llri
+{
+    inline std::string to_string(command_list_usage usage)
+    {
+        switch(usage)
+        {
+            case command_list_usage::Direct:
+                return "Direct";
+            case command_list_usage::Indirect:
+                return "Indirect";
+        }
+
+        return "Invalid command_list_usage value";
+    }
+
+    inline std::string to_string(command_list_state state)
+    {
+        switch(state)
+        {
+            case command_list_state::Empty:
+                return "Empty";
+            case command_list_state::Recording:
+                return "Recording";
+            case command_list_state::Ready:
+                return "Ready";
+        }
+
+        return "Invalid command_list_state value";
+    }
+
+    inline command_list_alloc_desc CommandList::getDesc() const
+    {
+        return m_desc;
+    }
+
+    inline CommandList::native_command_list* CommandList::getNative() const
+    {
+        return m_ptr;
+    }
+
+    inline CommandGroup* CommandList::getGroup() const
+    {
+        return m_group;
+    }
+
+    inline handle<CommandList> CommandList::getHandle() const
+    {
+        return m_handle;
+    }
+
+    inline result CommandList::begin(const command_list_begin_desc& desc)
+    {
+        LLRI_DETAIL_VALIDATION_FULL(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(getState() == command_list_state::Empty, result::ErrorInvalidState)
+            LLRI_DETAIL_VALIDATION_REQUIRE(m_group->m_currentlyRecording == nullptr, result::ErrorOccupied)
+        }
+
+#ifdef LLRI_DETAIL_ENABLE_VALIDATION
+        m_group->m_currentlyRecording = this;
+#endif
+
+        LLRI_DETAIL_CALL_IMPL_STATISTICS(impl_begin(desc), m_validationCallbackMessenger, *m_statistics, device_call::Begin)
+    }
+
+    inline result CommandList::end()
+    {
+        LLRI_DETAIL_VALIDATION_FULL(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(getState() == command_list_state::Recording, result::ErrorInvalidState)
+        }
+
+#ifdef LLRI_DETAIL_ENABLE_VALIDATION
+        m_group->m_currentlyRecording = nullptr;
+#endif
+
+        LLRI_DETAIL_CALL_IMPL_STATISTICS(impl_end(), m_validationCallbackMessenger, *m_statistics, device_call::End)
+    }
+
+    template<typename Func, typename ...Args>
+    result CommandList::record(const command_list_begin_desc& desc, Func&& function, Args&&... args)
+    {
+        const result r = begin(desc);
+        if (r != result::Success)
+            return r;
+
+        std::invoke(std::forward<Func>(function), std::forward<Args>(args)...);
+
+        return end();
+    }
+    
+    inline result CommandList::resourceBarrier(uint32_t numBarriers, const resource_barrier* barriers)
+    {
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(numBarriers > 0, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(barriers != nullptr, result::ErrorInvalidUsage)
+        }
+
+#ifdef LLRI_DETAIL_ENABLE_VALIDATION
+        LLRI_DETAIL_VALIDATION_FULL(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(getState() == command_list_state::Recording, llri::result::ErrorInvalidState)
+
+            for (size_t i = 0; i < numBarriers; i++)
+            {
+                LLRI_DETAIL_VALIDATION_REQUIRE_ITER(barriers[i].type <= resource_barrier_type::MaxEnum, i, result::ErrorInvalidUsage)
+            
+                switch (barriers[i].type)
+                {
+                    case resource_barrier_type::ReadWrite:
+                    {
+                        LLRI_DETAIL_VALIDATION_REQUIRE_ITER(barriers[i].rw.resource != nullptr, i, result::ErrorInvalidUsage)
+                        break;
+                    }
+                    case resource_barrier_type::Transition:
+                    {
+                        LLRI_DETAIL_VALIDATION_REQUIRE_ITER(barriers[i].trans.resource != nullptr, i, result::ErrorInvalidUsage)
+                        LLRI_DETAIL_VALIDATION_REQUIRE_ITER(barriers[i].trans.oldState != barriers[i].trans.newState, i, result::ErrorInvalidUsage)
+						
+						const resource_desc& resourceDesc = barriers[i].trans.resource->m_desc;
+						
+						// validate subresource range
+						if (resourceDesc.type != resource_type::Buffer && barriers[i].trans.subresourceRange != texture_subresource_range::all())
+						{
+							LLRI_DETAIL_VALIDATION_REQUIRE_ITER(barriers[i].trans.subresourceRange.baseMipLevel < resourceDesc.mipLevels, i, result::ErrorInvalidUsage)
+							
+							LLRI_DETAIL_VALIDATION_REQUIRE_ITER(barriers[i].trans.subresourceRange.numMipLevels > 0, i, result::ErrorInvalidUsage)
+							
+							LLRI_DETAIL_VALIDATION_REQUIRE_ITER((barriers[i].trans.subresourceRange.baseMipLevel + barriers[i].trans.subresourceRange.numMipLevels) <= resourceDesc.mipLevels, i, result::ErrorInvalidUsage)
+							
+							LLRI_DETAIL_VALIDATION_REQUIRE_ITER(barriers[i].trans.subresourceRange.baseArrayLayer < resourceDesc.depthOrArrayLayers, i, result::ErrorInvalidUsage)
+							
+							LLRI_DETAIL_VALIDATION_REQUIRE_ITER((resourceDesc.type != resource_type::Texture3D) || (barriers[i].trans.subresourceRange.baseArrayLayer == 0), i, result::ErrorInvalidUsage)
+							
+							if (resourceDesc.type == resource_type::Texture3D)
+							{
+								LLRI_DETAIL_VALIDATION_REQUIRE_ITER(barriers[i].trans.subresourceRange.numArrayLayers == 1, i, result::ErrorInvalidUsage)
+							}
+							else
+							{
+								LLRI_DETAIL_VALIDATION_REQUIRE_ITER(barriers[i].trans.subresourceRange.numArrayLayers > 0, i, result::ErrorInvalidUsage)
+								
+								LLRI_DETAIL_VALIDATION_REQUIRE_ITER((barriers[i].trans.subresourceRange.baseArrayLayer + barriers[i].trans.subresourceRange.numArrayLayers) <= resourceDesc.depthOrArrayLayers, i, result::ErrorInvalidUsage)
+							}
+						}
+						
+						// validate new state correctness
+                        LLRI_DETAIL_VALIDATION_REQUIRE_ITER(barriers[i].trans.newState <= resource_state::MaxEnum, i, result::ErrorInvalidUsage)
+                    
+                        const detail::resource_state_requirements& requirements = detail::resourceStateRequirements[static_cast<size_t>(barriers[i].trans.newState)];
+                        LLRI_DETAIL_VALIDATION_REQUIRE_ITER((requirements.types & detail::resourceTypeBit(resourceDesc.type)) != 0, i, result::ErrorInvalidState)
+                        LLRI_DETAIL_VALIDATION_REQUIRE_ITER((requirements.memoryTypes & detail::memoryTypeBit(resourceDesc.memoryType)) != 0, i, result::ErrorInvalidState)
+                        LLRI_DETAIL_VALIDATION_REQUIRE_ITER(resourceDesc.usage.all(requirements.requiredUsage), i, result::ErrorInvalidState)
+                        LLRI_DETAIL_VALIDATION_REQUIRE_ITER(resourceDesc.type == resource_type::Buffer || resourceDesc.usage.all(requirements.requiredTextureUsage), i, result::ErrorInvalidState)
+                        LLRI_DETAIL_VALIDATION_REQUIRE_ITER(resourceDesc.usage.none(requirements.forbiddenUsage), i, result::ErrorInvalidState)
+                    
+                        break;
+                    }
+                    case resource_barrier_type::Aliasing:
+                    {
+                        LLRI_DETAIL_VALIDATION_REQUIRE_ITER(barriers[i].alias.after != nullptr, i, result::ErrorInvalidUsage)
+                        LLRI_DETAIL_VALIDATION_REQUIRE_ITER(barriers[i].alias.after->m_heap != nullptr, i, result::ErrorInvalidUsage)
+                        LLRI_DETAIL_VALIDATION_REQUIRE_ITER(barriers[i].alias.before == nullptr || barriers[i].alias.before->m_heap == barriers[i].alias.after->m_heap, i, result::ErrorInvalidUsage)
+                        LLRI_DETAIL_VALIDATION_REQUIRE_ITER(barriers[i].alias.afterState <= resource_state::MaxEnum, i, result::ErrorInvalidUsage)
+                        break;
+                    }
+                    case resource_barrier_type::Release:
+                    case resource_barrier_type::Acquire:
+                    {
+                        const resource_barrier_ownership& own = barriers[i].own;
+                        LLRI_DETAIL_VALIDATION_REQUIRE_ITER(own.resource != nullptr, i, result::ErrorInvalidUsage)
+                        LLRI_DETAIL_VALIDATION_REQUIRE_ITER(own.state <= resource_state::MaxEnum, i, result::ErrorInvalidUsage)
+                        LLRI_DETAIL_VALIDATION_REQUIRE_ITER(own.srcQueue <= queue_type::MaxEnum, i, result::ErrorInvalidUsage)
+                        LLRI_DETAIL_VALIDATION_REQUIRE_ITER(own.dstQueue <= queue_type::MaxEnum, i, result::ErrorInvalidUsage)
+                        LLRI_DETAIL_VALIDATION_REQUIRE_ITER(own.srcQueue != own.dstQueue, i, result::ErrorInvalidUsage)
+
+                        const queue_type owner = barriers[i].type == resource_barrier_type::Release ? own.srcQueue : own.dstQueue;
+                        LLRI_DETAIL_VALIDATION_REQUIRE_ITER(m_group->m_type == owner, i, result::ErrorInvalidUsage)
+                        break;
+                    }
+                }
+            }
+        }
+#endif
+
+        m_statistics->recordBarriers(numBarriers);
+        LLRI_DETAIL_CALL_IMPL_STATISTICS(impl_resourceBarrier(numBarriers, barriers), m_validationCallbackMessenger, *m_statistics, device_call::ResourceBarrier)
+    }
+    
+    inline result CommandList::resourceBarrier(const resource_barrier& barrier)
+    {
+        return resourceBarrier(1, &barrier);
+    }
+
+    inline result CommandList::resetQueries(QueryPool* pool, uint32_t first, uint32_t count)
+    {
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(pool != nullptr, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(count > 0, result::ErrorInvalidUsage)
+        }
+
+        LLRI_DETAIL_VALIDATION_FULL(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(getState() == command_list_state::Recording, result::ErrorInvalidState)
+            LLRI_DETAIL_VALIDATION_REQUIRE(static_cast<uint64_t>(first) + count <= pool->m_desc.count, result::ErrorInvalidUsage)
+        }
+
+        LLRI_DETAIL_CALL_IMPL(impl_resetQueries(pool, first, count), m_validationCallbackMessenger)
+    }
+
+    inline result CommandList::writeTimestamp(QueryPool* pool, uint32_t index)
+    {
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(pool != nullptr, result::ErrorInvalidUsage)
+        }
+
+        LLRI_DETAIL_VALIDATION_FULL(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(getState() == command_list_state::Recording, result::ErrorInvalidState)
+            LLRI_DETAIL_VALIDATION_REQUIRE(pool->m_desc.type == query_type::Timestamp, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(m_group->m_type != queue_type::Transfer, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(index < pool->m_desc.count, result::ErrorInvalidUsage)
+        }
+
+        LLRI_DETAIL_CALL_IMPL(impl_writeTimestamp(pool, index), m_validationCallbackMessenger)
+    }
+
+    inline result CommandList::beginQuery(QueryPool* pool, uint32_t index)
+    {
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(pool != nullptr, result::ErrorInvalidUsage)
+        }
+
+        LLRI_DETAIL_VALIDATION_FULL(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(getState() == command_list_state::Recording, result::ErrorInvalidState)
+            LLRI_DETAIL_VALIDATION_REQUIRE(pool->m_desc.type != query_type::Timestamp, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(index < pool->m_desc.count, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE_IF(pool->m_desc.type == query_type::Occlusion, m_group->m_type == queue_type::Graphics, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE_IF(pool->m_desc.type == query_type::PipelineStatistics, m_group->m_type != queue_type::Transfer, result::ErrorInvalidUsage)
+        }
+
+        LLRI_DETAIL_CALL_IMPL(impl_beginQuery(pool, index), m_validationCallbackMessenger)
+    }
+
+    inline result CommandList::endQuery(QueryPool* pool, uint32_t index)
+    {
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(pool != nullptr, result::ErrorInvalidUsage)
+        }
+
+        LLRI_DETAIL_VALIDATION_FULL(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(getState() == command_list_state::Recording, result::ErrorInvalidState)
+            LLRI_DETAIL_VALIDATION_REQUIRE(pool->m_desc.type != query_type::Timestamp, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(index < pool->m_desc.count, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE_IF(pool->m_desc.type == query_type::Occlusion, m_group->m_type == queue_type::Graphics, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE_IF(pool->m_desc.type == query_type::PipelineStatistics, m_group->m_type != queue_type::Transfer, result::ErrorInvalidUsage)
+        }
+
+        LLRI_DETAIL_CALL_IMPL(impl_endQuery(pool, index), m_validationCallbackMessenger)
+    }
+
+    inline result CommandList::copyQueryResults(QueryPool* pool, uint32_t first, uint32_t count, Resource* dst, uint64_t dstOffset)
+    {
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(pool != nullptr, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(dst != nullptr, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(count > 0, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(dstOffset % sizeof(uint64_t) == 0, result::ErrorInvalidUsage)
+        }
+
+#ifdef LLRI_DETAIL_ENABLE_VALIDATION
+        LLRI_DETAIL_VALIDATION_FULL(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(getState() == command_list_state::Recording, result::ErrorInvalidState)
+            LLRI_DETAIL_VALIDATION_REQUIRE(m_group->m_type != queue_type::Transfer, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(static_cast<uint64_t>(first) + count <= pool->m_desc.count, result::ErrorInvalidUsage)
+
+            const resource_desc& dstDesc = dst->m_desc;
+            LLRI_DETAIL_VALIDATION_REQUIRE(dstDesc.type == resource_type::Buffer, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(dstDesc.usage.contains(resource_usage_flag_bits::TransferDst), result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(dstDesc.memoryType == memory_type::Local || dstDesc.memoryType == memory_type::Read, result::ErrorInvalidUsage)
+
+            const uint64_t size = static_cast<uint64_t>(count) * queryResultCount(pool->m_desc.type) * sizeof(uint64_t);
+            LLRI_DETAIL_VALIDATION_REQUIRE(dstOffset + size <= dstDesc.width, result::ErrorInvalidUsage)
+        }
+#endif
+
+        LLRI_DETAIL_CALL_IMPL(impl_copyQueryResults(pool, first, count, dst, dstOffset), m_validationCallbackMessenger)
+    }
+
+    inline result CommandList::copyBuffer(Resource* src, uint64_t srcOffset, Resource* dst, uint64_t dstOffset, uint64_t size)
+    {
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(src != nullptr, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(dst != nullptr, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(src != dst, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(size > 0, result::ErrorInvalidUsage)
+        }
+
+#ifdef LLRI_DETAIL_ENABLE_VALIDATION
+        LLRI_DETAIL_VALIDATION_FULL(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(getState() == command_list_state::Recording, result::ErrorInvalidState)
+
+            const resource_desc& srcDesc = src->m_desc;
+            LLRI_DETAIL_VALIDATION_REQUIRE(srcDesc.type == resource_type::Buffer, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(srcDesc.usage.contains(resource_usage_flag_bits::TransferSrc), result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(srcDesc.memoryType == memory_type::Local || srcDesc.memoryType == memory_type::Upload, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(srcOffset + size <= srcDesc.width, result::ErrorInvalidUsage)
+
+            const resource_desc& dstDesc = dst->m_desc;
+            LLRI_DETAIL_VALIDATION_REQUIRE(dstDesc.type == resource_type::Buffer, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(dstDesc.usage.contains(resource_usage_flag_bits::TransferDst), result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(dstDesc.memoryType == memory_type::Local || dstDesc.memoryType == memory_type::Read, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(dstOffset + size <= dstDesc.width, result::ErrorInvalidUsage)
+        }
+#endif
+
+        LLRI_DETAIL_CALL_IMPL(impl_copyBuffer(src, srcOffset, dst, dstOffset, size), m_validationCallbackMessenger)
+    }
+
+    inline result CommandList::copyBufferToTexture(const texture_copy_desc& desc)
+    {
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(desc.buffer != nullptr, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(desc.texture != nullptr, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(desc.bufferOffset % 512 == 0, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(desc.bufferRowPitch % 256 == 0, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(desc.extent.width > 0 && desc.extent.height > 0 && desc.extent.depth > 0, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(desc.textureOffset.x >= 0 && desc.textureOffset.y >= 0 && desc.textureOffset.z >= 0, result::ErrorInvalidUsage)
+        }
+
+#ifdef LLRI_DETAIL_ENABLE_VALIDATION
+        LLRI_DETAIL_VALIDATION_FULL(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(getState() == command_list_state::Recording, result::ErrorInvalidState)
+
+            const resource_desc& bufferDesc = desc.buffer->m_desc;
+            LLRI_DETAIL_VALIDATION_REQUIRE(bufferDesc.type == resource_type::Buffer, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(bufferDesc.usage.contains(resource_usage_flag_bits::TransferSrc), result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(bufferDesc.memoryType == memory_type::Local || bufferDesc.memoryType == memory_type::Upload, result::ErrorInvalidUsage)
+
+            const resource_desc& textureDesc = desc.texture->m_desc;
+            LLRI_DETAIL_VALIDATION_REQUIRE(textureDesc.type != resource_type::Buffer, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(textureDesc.usage.contains(resource_usage_flag_bits::TransferDst), result::ErrorInvalidUsage)
+
+            LLRI_DETAIL_VALIDATION_REQUIRE(textureDesc.sampleCount == sample_count::Count1, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(has_color_component(textureDesc.textureFormat), result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(desc.mipLevel < textureDesc.mipLevels, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE_IF(textureDesc.type == resource_type::Texture3D, desc.arrayLayer == 0, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE_IF(textureDesc.type != resource_type::Texture3D, desc.arrayLayer < textureDesc.depthOrArrayLayers, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE_IF(textureDesc.type == resource_type::Texture1D, desc.textureOffset.y == 0, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE_IF(textureDesc.type != resource_type::Texture3D, desc.textureOffset.z == 0, result::ErrorInvalidUsage)
+
+            const extent_3d mipExtent = detail::mipExtent(textureDesc, desc.mipLevel);
+            LLRI_DETAIL_VALIDATION_REQUIRE(static_cast<uint64_t>(desc.textureOffset.x) + desc.extent.width <= mipExtent.width, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(static_cast<uint64_t>(desc.textureOffset.y) + desc.extent.height <= mipExtent.height, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(static_cast<uint64_t>(desc.textureOffset.z) + desc.extent.depth <= mipExtent.depth, result::ErrorInvalidUsage)
+
+            LLRI_DETAIL_VALIDATION_REQUIRE(desc.bufferOffset % format_size(textureDesc.textureFormat) == 0, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(desc.bufferRowPitch % format_size(textureDesc.textureFormat) == 0, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(desc.bufferRowPitch >= static_cast<uint64_t>(desc.extent.width) * format_size(textureDesc.textureFormat), result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(desc.bufferOffset + static_cast<uint64_t>(desc.bufferRowPitch) * desc.extent.height * desc.extent.depth <= bufferDesc.width, result::ErrorInvalidUsage)
+        }
+#endif
+
+        LLRI_DETAIL_CALL_IMPL(impl_copyBufferToTexture(desc), m_validationCallbackMessenger)
+    }
+
+    inline result CommandList::copyTextureToBuffer(const texture_copy_desc& desc)
+    {
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(desc.buffer != nullptr, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(desc.texture != nullptr, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(desc.bufferOffset % 512 == 0, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(desc.bufferRowPitch % 256 == 0, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(desc.extent.width > 0 && desc.extent.height > 0 && desc.extent.depth > 0, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(desc.textureOffset.x >= 0 && desc.textureOffset.y >= 0 && desc.textureOffset.z >= 0, result::ErrorInvalidUsage)
+        }
+
+#ifdef LLRI_DETAIL_ENABLE_VALIDATION
+        LLRI_DETAIL_VALIDATION_FULL(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(getState() == command_list_state::Recording, result::ErrorInvalidState)
+
+            const resource_desc& textureDesc = desc.texture->m_desc;
+            LLRI_DETAIL_VALIDATION_REQUIRE(textureDesc.type != resource_type::Buffer, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(textureDesc.usage.contains(resource_usage_flag_bits::TransferSrc), result::ErrorInvalidUsage)
+
+            const resource_desc& bufferDesc = desc.buffer->m_desc;
+            LLRI_DETAIL_VALIDATION_REQUIRE(bufferDesc.type == resource_type::Buffer, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(bufferDesc.usage.contains(resource_usage_flag_bits::TransferDst), result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(bufferDesc.memoryType == memory_type::Local || bufferDesc.memoryType == memory_type::Read, result::ErrorInvalidUsage)
+
+            LLRI_DETAIL_VALIDATION_REQUIRE(textureDesc.sampleCount == sample_count::Count1, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(has_color_component(textureDesc.textureFormat), result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(desc.mipLevel < textureDesc.mipLevels, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE_IF(textureDesc.type == resource_type::Texture3D, desc.arrayLayer == 0, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE_IF(textureDesc.type != resource_type::Texture3D, desc.arrayLayer < textureDesc.depthOrArrayLayers, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE_IF(textureDesc.type == resource_type::Texture1D, desc.textureOffset.y == 0, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE_IF(textureDesc.type != resource_type::Texture3D, desc.textureOffset.z == 0, result::ErrorInvalidUsage)
+
+            const extent_3d mipExtent = detail::mipExtent(textureDesc, desc.mipLevel);
+            LLRI_DETAIL_VALIDATION_REQUIRE(static_cast<uint64_t>(desc.textureOffset.x) + desc.extent.width <= mipExtent.width, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(static_cast<uint64_t>(desc.textureOffset.y) + desc.extent.height <= mipExtent.height, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(static_cast<uint64_t>(desc.textureOffset.z) + desc.extent.depth <= mipExtent.depth, result::ErrorInvalidUsage)
+
+            LLRI_DETAIL_VALIDATION_REQUIRE(desc.bufferOffset % format_size(textureDesc.textureFormat) == 0, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(desc.bufferRowPitch % format_size(textureDesc.textureFormat) == 0, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(desc.bufferRowPitch >= static_cast<uint64_t>(desc.extent.width) * format_size(textureDesc.textureFormat), result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(desc.bufferOffset + static_cast<uint64_t>(desc.bufferRowPitch) * desc.extent.height * desc.extent.depth <= bufferDesc.width, result::ErrorInvalidUsage)
+        }
+#endif
+
+        LLRI_DETAIL_CALL_IMPL(impl_copyTextureToBuffer(desc), m_validationCallbackMessenger)
+    }
+}
@@ -0,0 +1,836 @@
+/**
+ * @file device.inl
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+#include <llri/llri.hpp> // unnecessary but helps intellisense
+
+namespace llri
+{
+    inline device_desc Device::getDesc() const
+    {
+        return m_desc;
+    }
+
+    inline Device::native_device* Device::getNative() const
+    {
+        return m_ptr;
+    }
+    
+    inline Adapter* Device::getAdapter() const
+    {
+        return m_adapter;
+    }
+    
+    inline Queue* Device::getQueue(queue_type type, uint8_t index)
+    {
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(type <= queue_type::MaxEnum, nullptr)
+        }
+
+        std::vector<Queue*>* queues = nullptr;
+        switch(type)
+        {
+            // code editor's note: validation is done per queue type here to make the message more clear about which queue type was exceeded
+            
+            case queue_type::Graphics:
+            {
+                queues = &m_graphicsQueues;
+
+                LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+                {
+                    LLRI_DETAIL_VALIDATION_REQUIRE(index < static_cast<uint8_t>(m_graphicsQueues.size()), nullptr)
+                }
+                break;
+            }
+            case queue_type::Compute:
+            {
+                queues = &m_computeQueues;
+
+                LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+                {
+                    LLRI_DETAIL_VALIDATION_REQUIRE(index < static_cast<uint8_t>(m_computeQueues.size()), nullptr)
+                }
+                break;
+            }
+            case queue_type::Transfer:
+            {
+                queues = &m_transferQueues;
+
+                LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+                {
+                    LLRI_DETAIL_VALIDATION_REQUIRE(index < static_cast<uint8_t>(m_transferQueues.size()), nullptr)
+                }
+                break;
+            }
+        }
+
+        return queues->at(index);
+    }
+
+    inline uint8_t Device::queryQueueCount(queue_type type)
+    {
+        switch (type)
+        {
+            case queue_type::Graphics:
+                return static_cast<uint8_t>(m_graphicsQueues.size());
+            case queue_type::Compute:
+                return static_cast<uint8_t>(m_computeQueues.size());
+            case queue_type::Transfer:
+                return static_cast<uint8_t>(m_transferQueues.size());
+        }
+
+        return 0;
+    }
+
+    inline result Device::createCommandGroup(queue_type type, CommandGroup** cmdGroup)
+    {
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(cmdGroup != nullptr, result::ErrorInvalidUsage)
+        }
+
+        *cmdGroup = nullptr;
+
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(type <= queue_type::MaxEnum, result::ErrorInvalidUsage)
+        }
+
+        LLRI_DETAIL_VALIDATION_FULL(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(queryQueueCount(type) > 0, result::ErrorInvalidUsage)
+        }
+
+        LLRI_DETAIL_TRACE_SCOPE()
+        const auto callBegin = detail::statisticsNow();
+        const result r = impl_createCommandGroup(type, cmdGroup);
+        m_statistics.recordCall(device_call::CreateCommandGroup, callBegin);
+        if (r == result::Success)
+            m_lifetime.track(detail::tracked_object::CommandGroup);
+
+        LLRI_DETAIL_POLL_API_MESSAGES(m_validationCallbackMessenger)
+        return r;
+    }
+
+    inline void Device::destroyCommandGroup(CommandGroup* cmdGroup)
+    {
+        if (!cmdGroup)
+            return;
+
+        if (cmdGroup->m_ptr && !cmdGroup->m_cmdLists.empty())
+        {
+            std::vector<CommandList*> cmdLists;
+            cmdLists.reserve(cmdGroup->m_cmdLists.size());
+            for (auto element : cmdGroup->m_cmdLists)
+                cmdLists.push_back(element);
+            cmdGroup->free(static_cast<uint8_t>(cmdLists.size()), cmdLists.data());
+        }
+
+        // CommandLists that weren't freed above are destroyed along with the CommandGroup
+        m_lifetime.untrack(detail::tracked_object::CommandList, cmdGroup->m_cmdLists.size());
+        m_lifetime.untrack(detail::tracked_object::CommandGroup);
+        impl_destroyCommandGroup(cmdGroup);
+        LLRI_DETAIL_POLL_API_MESSAGES(m_validationCallbackMessenger)
+    }
+
+    inline result Device::createFence(fence_flags flags, Fence** fence)
+    {
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(fence != nullptr, result::ErrorInvalidUsage)
+        }
+
+        *fence = nullptr;
+
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(flags == fence_flag_bits::None || flags == fence_flag_bits::Signaled, result::ErrorInvalidUsage)
+        }
+
+        LLRI_DETAIL_TRACE_SCOPE()
+        const auto callBegin = detail::statisticsNow();
+        const result r = impl_createFence(flags, fence);
+        m_statistics.recordCall(device_call::CreateFence, callBegin);
+        if (r == result::Success)
+            m_lifetime.track(detail::tracked_object::Fence);
+
+        LLRI_DETAIL_POLL_API_MESSAGES(m_validationCallbackMessenger)
+        return r;
+    }
+
+    inline void Device::destroyFence(Fence* fence)
+    {
+        if (!fence)
+            return;
+
+        m_lifetime.untrack(detail::tracked_object::Fence);
+        impl_destroyFence(fence);
+        LLRI_DETAIL_POLL_API_MESSAGES(m_validationCallbackMessenger)
+    }
+
+    inline result Device::waitFences(uint32_t numFences, Fence** fences, uint64_t timeout)
+    {
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(fences != nullptr, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(numFences > 0, result::ErrorInvalidUsage)
+        }
+
+#ifdef LLRI_DETAIL_ENABLE_VALIDATION
+        LLRI_DETAIL_VALIDATION_FULL(m_validationLevel)
+        {
+            for (size_t i = 0; i < numFences; i++)
+            {
+                LLRI_DETAIL_VALIDATION_REQUIRE_ITER(fences[i] != nullptr, i, result::ErrorInvalidUsage)
+                LLRI_DETAIL_VALIDATION_REQUIRE_ITER(fences[i]->m_signaled, i, result::ErrorNotSignaled)
+            }
+        }
+#endif
+
+        LLRI_DETAIL_CALL_IMPL_STATISTICS(impl_waitFences(numFences, fences, timeout), m_validationCallbackMessenger, m_statistics, device_call::WaitFences)
+    }
+
+    inline result Device::waitFence(Fence* fence, uint64_t timeout)
+    {
+        return waitFences(1, &fence, timeout);
+    }
+
+    inline result Device::createSemaphore(Semaphore** semaphore)
+    {
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(semaphore != nullptr, result::ErrorInvalidUsage)
+        }
+
+        *semaphore = nullptr;
+
+        LLRI_DETAIL_TRACE_SCOPE()
+        const auto callBegin = detail::statisticsNow();
+        const result r = impl_createSemaphore(semaphore);
+        m_statistics.recordCall(device_call::CreateSemaphore, callBegin);
+        if (r == result::Success)
+            m_lifetime.track(detail::tracked_object::Semaphore);
+
+        LLRI_DETAIL_POLL_API_MESSAGES(m_validationCallbackMessenger)
+        return r;
+    }
+
+    inline void Device::destroySemaphore(Semaphore* semaphore)
+    {
+        if (!semaphore)
+            return;
+
+        m_lifetime.untrack(detail::tracked_object::Semaphore);
+        impl_destroySemaphore(semaphore);
+        LLRI_DETAIL_POLL_API_MESSAGES(m_validationCallbackMessenger)
+    }
+
+    inline result Device::createQueryPool(const query_pool_desc& desc, QueryPool** pool)
+    {
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(pool != nullptr, result::ErrorInvalidUsage)
+        }
+
+        *pool = nullptr;
+
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(desc.type <= query_type::MaxEnum, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(desc.count > 0, result::ErrorInvalidUsage)
+        }
+
+        LLRI_DETAIL_VALIDATION_FULL(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE_IF(desc.type == query_type::PipelineStatistics, m_desc.features.pipelineStatisticsQuery, result::ErrorFeatureNotSupported)
+        }
+
+        LLRI_DETAIL_TRACE_SCOPE()
+        const auto callBegin = detail::statisticsNow();
+        const result r = impl_createQueryPool(desc, pool);
+        m_statistics.recordCall(device_call::CreateQueryPool, callBegin);
+        if (r == result::Success)
+            m_lifetime.track(detail::tracked_object::QueryPool);
+
+        LLRI_DETAIL_POLL_API_MESSAGES(m_validationCallbackMessenger)
+        return r;
+    }
+
+    inline void Device::destroyQueryPool(QueryPool* pool)
+    {
+        if (!pool)
+            return;
+
+        m_lifetime.untrack(detail::tracked_object::QueryPool);
+        impl_destroyQueryPool(pool);
+        LLRI_DETAIL_POLL_API_MESSAGES(m_validationCallbackMessenger)
+    }
+
+#ifdef LLRI_DETAIL_ENABLE_VALIDATION
+    inline result Device::validateNodeMasks(uint32_t createNodeMask, uint32_t visibleNodeMask)
+    {
+        // convert zero to one for validation on nodemasks
+        if (createNodeMask == 0)
+            createNodeMask = 1;
+
+        if (visibleNodeMask == 0)
+            visibleNodeMask = 1;
+
+        LLRI_DETAIL_VALIDATION_REQUIRE(detail::hasSingleBit(createNodeMask), result::ErrorInvalidNodeMask)
+        LLRI_DETAIL_VALIDATION_REQUIRE(createNodeMask < (1u << m_adapter->queryNodeCount()), result::ErrorInvalidNodeMask)
+        LLRI_DETAIL_VALIDATION_REQUIRE(visibleNodeMask < (1u << m_adapter->queryNodeCount()), result::ErrorInvalidNodeMask)
+
+        LLRI_DETAIL_VALIDATION_REQUIRE((visibleNodeMask & createNodeMask) == createNodeMask, result::ErrorInvalidNodeMask)
+        return result::Success;
+    }
+
+    inline result Device::validateResourceDesc(const resource_desc& desc)
+    {
+        // Valid descs are accepted by the combined checks below. Only if one of them fails does reportInvalidResourceDesc() run the individual checks,
+        // to report which requirement desc doesn't meet. Keeping the error reporting out of this function keeps it small enough to inline.
+        const bool isTexture = desc.type != resource_type::Buffer;
+
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+        {
+            if (desc.type > resource_type::MaxEnum || desc.usage > resource_usage_flag_bits::All || desc.memoryType > memory_type::MaxEnum ||
+                desc.initialState > resource_state::MaxEnum || desc.sharingMode > resource_sharing_mode::MaxEnum ||
+                (isTexture && (desc.sampleCount > sample_count::MaxEnum || desc.textureFormat > format::MaxEnum)))
+                return reportInvalidResourceDesc(desc);
+        }
+
+        LLRI_DETAIL_VALIDATION_FULL(m_validationLevel)
+        {
+            // node masks of 0 select the first node, which every Adapter has, so they don't need to be checked against the Adapter
+            if (!detail::meetsResourceRequirements(desc) ||
+                ((desc.createNodeMask | desc.visibleNodeMask) != 0 && !detail::meetsNodeMaskRequirements(desc.createNodeMask, desc.visibleNodeMask, m_adapter->queryNodeCount())) ||
+                (isTexture && !detail::supportsTexture(m_adapter->queryFormatProperties()[static_cast<size_t>(desc.textureFormat)], desc)))
+                return reportInvalidResourceDesc(desc);
+        }
+
+        return result::Success;
+    }
+
+    inline result Device::reportInvalidResourceDesc(const resource_desc& desc)
+    {
+        // The checks below **must** reject every desc that validateResourceDesc()'s combined checks reject.
+        const bool isTexture = desc.type != resource_type::Buffer;
+
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(desc.type <= resource_type::MaxEnum, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(desc.usage <= resource_usage_flag_bits::All, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(desc.memoryType <= memory_type::MaxEnum, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(desc.initialState <= resource_state::MaxEnum, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(desc.sharingMode <= resource_sharing_mode::MaxEnum, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE_IF(isTexture, desc.sampleCount <= sample_count::MaxEnum, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE_IF(isTexture, desc.textureFormat <= format::MaxEnum, result::ErrorInvalidUsage)
+        }
+
+        if (m_validationLevel < validation_level::Full)
+            return result::Success;
+
+        // In resource creation, there are a lot of combinations that can be incorrect
+        // checks for these combinations can get confusing,
+        // our rule will be to only check against previously checked variables. e.g. if we check desc.type first, we only need to check that its valid,
+        // but if we check desc.usage we must check if its valid with desc.type
+
+        // desc.create/visibleNodeMask
+        const result nodeMaskResult = validateNodeMasks(desc.createNodeMask, desc.visibleNodeMask);
+        if (nodeMaskResult != result::Success)
+            return nodeMaskResult;
+
+        const detail::resource_type_requirements& typeRequirements = detail::resourceTypeRequirements[static_cast<size_t>(desc.type)];
+        const detail::memory_type_requirements& memoryRequirements = detail::memoryTypeRequirements[static_cast<size_t>(desc.memoryType)];
+
+        // desc.usage
+        LLRI_DETAIL_VALIDATION_REQUIRE_IF(desc.usage.contains(resource_usage_flag_bits::DenyShaderResource), desc.usage.contains(resource_usage_flag_bits::DepthStencilAttachment), result::ErrorInvalidUsage)
+
+        LLRI_DETAIL_VALIDATION_REQUIRE_MESSAGE(
+            !desc.usage.contains(resource_usage_flag_bits::DenyShaderResource) || detail::denyShaderResourceValidUsage.all(desc.usage),
+            "desc.usage ( " + to_string(desc.usage) + ") has the DenyShaderResource bit set but it has shader related usage flags set. Allowed flags are: " + to_string(detail::denyShaderResourceValidUsage),
+            result::ErrorInvalidUsage)
+
+        // desc.usage against desc.type
+        LLRI_DETAIL_VALIDATION_REQUIRE_MESSAGE(
+            typeRequirements.validUsage.all(desc.usage),
+            "desc.type is " + to_string(desc.type) + " but desc.usage has invalid resource_usage_flag_bits set. Valid flag bits for this type are: " + to_string(typeRequirements.validUsage),
+            result::ErrorInvalidUsage)
+
+        // desc.memoryType against desc.type and desc.usage
+        LLRI_DETAIL_VALIDATION_REQUIRE((typeRequirements.memoryTypes & detail::memoryTypeBit(desc.memoryType)) != 0, result::ErrorInvalidUsage)
+        LLRI_DETAIL_VALIDATION_REQUIRE(desc.usage.none(memoryRequirements.forbiddenUsage), result::ErrorInvalidUsage)
+
+        // desc.initialState against desc.type, desc.usage and desc.memoryType
+        LLRI_DETAIL_VALIDATION_REQUIRE_MESSAGE(
+            (detail::resourceStateRequirements[static_cast<size_t>(desc.initialState)].types & detail::resourceTypeBit(desc.type)) != 0,
+            "desc.initialState (" + to_string(desc.initialState) + ") is not a valid state for desc.type (" + to_string(desc.type) + ").",
+            result::ErrorInvalidUsage)
+
+        LLRI_DETAIL_VALIDATION_REQUIRE_MESSAGE(
+            detail::meetsStateRequirements(desc, desc.initialState),
+            "desc (usage: " + to_string(desc.usage) + ", memoryType: " + to_string(desc.memoryType) + ") does not meet the requirements of desc.initialState (" + to_string(desc.initialState) + ").",
+            result::ErrorInvalidUsage)
+
+        LLRI_DETAIL_VALIDATION_REQUIRE((memoryRequirements.initialStates & detail::resourceStateBit(desc.initialState)) != 0, result::ErrorInvalidUsage)
+
+        // dimensions against desc.type
+        LLRI_DETAIL_VALIDATION_REQUIRE(desc.width > 0 && desc.width <= detail::maxResourceDimension, result::ErrorInvalidUsage)
+        LLRI_DETAIL_VALIDATION_REQUIRE(desc.height >= typeRequirements.minHeight && desc.height <= typeRequirements.maxHeight, result::ErrorInvalidUsage)
+        LLRI_DETAIL_VALIDATION_REQUIRE(desc.depthOrArrayLayers >= typeRequirements.minDepthOrArrayLayers && desc.depthOrArrayLayers <= typeRequirements.maxDepthOrArrayLayers, result::ErrorInvalidUsage)
+        LLRI_DETAIL_VALIDATION_REQUIRE(desc.mipLevels >= typeRequirements.minMipLevels, result::ErrorInvalidUsage)
+        LLRI_DETAIL_VALIDATION_REQUIRE(desc.sampleCount != sample_count{} && (typeRequirements.sampleCounts & static_cast<uint8_t>(desc.sampleCount)) == static_cast<uint8_t>(desc.sampleCount), result::ErrorInvalidUsage)
+
+        if (isTexture)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE_IF(desc.width == 1, desc.mipLevels == 1, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE_IF(desc.usage.contains(resource_usage_flag_bits::ShaderWrite), desc.sampleCount == sample_count::Count1, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE_IF(desc.sampleCount > sample_count::Count1, desc.usage.contains(resource_usage_flag_bits::ColorAttachment) || desc.usage.contains(resource_usage_flag_bits::DepthStencilAttachment), result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE_IF(desc.mipLevels > 1, desc.sampleCount == sample_count::Count1, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE_IF(desc.mipLevels > 1, desc.mipLevels < 32 && (desc.width >> desc.mipLevels) != 0, result::ErrorInvalidUsage)
+
+            LLRI_DETAIL_VALIDATION_REQUIRE(desc.textureFormat != format::Undefined, result::ErrorInvalidUsage)
+
+            const format_properties& formatProperties = m_adapter->queryFormatProperties(desc.textureFormat);
+            LLRI_DETAIL_VALIDATION_REQUIRE(formatProperties.supported, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(formatProperties.supportsSampleCount(desc.sampleCount), result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(formatProperties.supportsType(desc.type), result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(formatProperties.usage.all(desc.usage), result::ErrorInvalidUsage)
+        }
+
+        return result::Success;
+    }
+#endif
+
+    inline result Device::createResource(const resource_desc& desc, Resource** resource)
+    {
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(resource != nullptr, result::ErrorInvalidUsage)
+        }
+
+        *resource = nullptr;
+
+#ifdef LLRI_DETAIL_ENABLE_VALIDATION
+        const result validationResult = validateResourceDesc(desc);
+        if (validationResult != result::Success)
+            return validationResult;
+#endif
+
+        LLRI_DETAIL_TRACE_SCOPE()
+        const auto callBegin = detail::statisticsNow();
+        const result r = impl_createResource(desc, resource);
+        m_statistics.recordCall(device_call::CreateResource, callBegin);
+        if (r == result::Success)
+        {
+            m_statistics.recordAllocation(desc.memoryType, (*resource)->m_allocationSize);
+            m_lifetime.trackAllocation(detail::tracked_object::Resource, desc.memoryType, (*resource)->m_allocationSize);
+        }
+
+        LLRI_DETAIL_POLL_API_MESSAGES(m_validationCallbackMessenger)
+        return r;
+    }
+
+    inline void Device::destroyResource(Resource* resource)
+    {
+        if (!resource)
+            return;
+
+        m_lifetime.untrackAllocation(detail::tracked_object::Resource, resource->m_desc.memoryType, resource->m_allocationSize);
+        impl_destroyResource(resource);
+        LLRI_DETAIL_POLL_API_MESSAGES(m_validationCallbackMessenger)
+    }
+
+    inline result Device::createMemoryHeap(const memory_heap_desc& desc, MemoryHeap** heap)
+    {
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(heap != nullptr, result::ErrorInvalidUsage)
+        }
+
+        *heap = nullptr;
+
+#ifdef LLRI_DETAIL_ENABLE_VALIDATION
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(desc.size > 0, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(desc.memoryType <= memory_type::MaxEnum, result::ErrorInvalidUsage)
+        }
+
+        LLRI_DETAIL_VALIDATION_FULL(m_validationLevel)
+        {
+            const result nodeMaskResult = validateNodeMasks(desc.createNodeMask, desc.visibleNodeMask);
+            if (nodeMaskResult != result::Success)
+                return nodeMaskResult;
+        }
+#endif
+
+        LLRI_DETAIL_TRACE_SCOPE()
+        const auto callBegin = detail::statisticsNow();
+        const result r = impl_createMemoryHeap(desc, heap);
+        m_statistics.recordCall(device_call::CreateMemoryHeap, callBegin);
+        if (r == result::Success)
+        {
+            m_statistics.recordAllocation(desc.memoryType, desc.size);
+            m_lifetime.trackAllocation(detail::tracked_object::MemoryHeap, desc.memoryType, desc.size);
+        }
+
+        LLRI_DETAIL_POLL_API_MESSAGES(m_validationCallbackMessenger)
+        return r;
+    }
+
+    inline void Device::destroyMemoryHeap(MemoryHeap* heap)
+    {
+        if (!heap)
+            return;
+
+        m_lifetime.untrackAllocation(detail::tracked_object::MemoryHeap, heap->m_desc.memoryType, heap->m_desc.size);
+        impl_destroyMemoryHeap(heap);
+        LLRI_DETAIL_POLL_API_MESSAGES(m_validationCallbackMessenger)
+    }
+
+    inline result Device::queryResourceAllocationInfo(const resource_desc& desc, resource_allocation_info* info)
+    {
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(info != nullptr, result::ErrorInvalidUsage)
+        }
+
+#ifdef LLRI_DETAIL_ENABLE_VALIDATION
+        const result validationResult = validateResourceDesc(desc);
+        if (validationResult != result::Success)
+            return validationResult;
+#endif
+
+        LLRI_DETAIL_CALL_IMPL(impl_queryResourceAllocationInfo(desc, info), m_validationCallbackMessenger)
+    }
+
+    inline result Device::createPlacedResource(MemoryHeap* heap, uint64_t offset, const resource_desc& desc, Resource** resource)
+    {
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(heap != nullptr, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(resource != nullptr, result::ErrorInvalidUsage)
+        }
+
+        *resource = nullptr;
+
+#ifdef LLRI_DETAIL_ENABLE_VALIDATION
+        const result validationResult = validateResourceDesc(desc);
+        if (validationResult != result::Success)
+            return validationResult;
+
+        LLRI_DETAIL_VALIDATION_FULL(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(desc.memoryType == heap->m_desc.memoryType, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(offset < heap->m_desc.size, result::ErrorInvalidUsage)
+
+            // compare nodemasks with zero converted to one
+            const uint32_t createNodeMask = desc.createNodeMask == 0 ? 1 : desc.createNodeMask;
+            const uint32_t visibleNodeMask = desc.visibleNodeMask == 0 ? 1 : desc.visibleNodeMask;
+            const uint32_t heapCreateNodeMask = heap->m_desc.createNodeMask == 0 ? 1 : heap->m_desc.createNodeMask;
+            const uint32_t heapVisibleNodeMask = heap->m_desc.visibleNodeMask == 0 ? 1 : heap->m_desc.visibleNodeMask;
+
+            LLRI_DETAIL_VALIDATION_REQUIRE(createNodeMask == heapCreateNodeMask, result::ErrorInvalidNodeMask)
+            LLRI_DETAIL_VALIDATION_REQUIRE((visibleNodeMask & heapVisibleNodeMask) == visibleNodeMask, result::ErrorInvalidNodeMask)
+
+            resource_allocation_info info {};
+            const result infoResult = impl_queryResourceAllocationInfo(desc, &info);
+            if (infoResult != result::Success)
+                return infoResult;
+
+            LLRI_DETAIL_VALIDATION_REQUIRE_MESSAGE(offset % info.alignment == 0,
+                "offset (" + std::to_string(offset) + ") is not a multiple of the resource's alignment (" + std::to_string(info.alignment) + ").",
+                result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE_MESSAGE(info.size <= heap->m_desc.size - offset,
+                "the resource (" + std::to_string(info.size) + " bytes at offset " + std::to_string(offset) + ") does not fit in the heap (" + std::to_string(heap->m_desc.size) + " bytes).",
+                result::ErrorInvalidUsage)
+        }
+#endif
+
+        LLRI_DETAIL_TRACE_SCOPE()
+        const auto callBegin = detail::statisticsNow();
+        const result r = impl_createPlacedResource(heap, offset, desc, resource);
+        m_statistics.recordCall(device_call::CreatePlacedResource, callBegin);
+        if (r == result::Success)
+        {
+            // the memory is held by the heap, so placed resources don't count towards the allocated bytes
+            m_lifetime.trackAllocation(detail::tracked_object::Resource, desc.memoryType, 0);
+        }
+
+        LLRI_DETAIL_POLL_API_MESSAGES(m_validationCallbackMessenger)
+        return r;
+    }
+
+    inline result Device::mapResource(Resource* resource, void** data)
+    {
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(resource != nullptr, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(data != nullptr, result::ErrorInvalidUsage)
+        }
+
+        *data = nullptr;
+
+        LLRI_DETAIL_VALIDATION_FULL(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(resource->m_desc.type == resource_type::Buffer, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(resource->m_desc.memoryType == memory_type::Upload || resource->m_desc.memoryType == memory_type::Read, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(resource->m_mapped == nullptr, result::ErrorInvalidState)
+        }
+
+        LLRI_DETAIL_TRACE_SCOPE()
+        const result r = impl_mapResource(resource, data);
+        if (r == result::Success)
+            resource->m_mapped = *data;
+
+        LLRI_DETAIL_POLL_API_MESSAGES(m_validationCallbackMessenger)
+        return r;
+    }
+
+    inline void Device::unmapResource(Resource* resource)
+    {
+        if (!resource || !resource->m_mapped)
+            return;
+
+        impl_unmapResource(resource);
+        resource->m_mapped = nullptr;
+        LLRI_DETAIL_POLL_API_MESSAGES(m_validationCallbackMessenger)
+    }
+
+    inline device_statistics Device::queryStatistics() const
+    {
+        return m_statistics.snapshot();
+    }
+
+    inline void Device::resetStatistics()
+    {
+        m_statistics.reset();
+    }
+
+    inline live_objects Device::queryLiveObjects() const
+    {
+        return m_lifetime.snapshot();
+    }
+
+    inline Resource* Device::resolve(handle<Resource> h) const
+    {
+        return m_resources.resolve(h);
+    }
+
+    inline Fence* Device::resolve(handle<Fence> h) const
+    {
+        return m_fences.resolve(h);
+    }
+
+    inline Semaphore* Device::resolve(handle<Semaphore> h) const
+    {
+        return m_semaphores.resolve(h);
+    }
+
+    inline result Device::setSimulatedTimingEXT(queue_type type, const simulated_timing_desc_ext& desc)
+    {
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(m_enabledExtensions.find(adapter_extension::SimulatedTiming) != m_enabledExtensions.end(), result::ErrorExtensionNotEnabled)
+            LLRI_DETAIL_VALIDATION_REQUIRE(type <= queue_type::MaxEnum, result::ErrorInvalidUsage)
+        }
+
+        LLRI_DETAIL_CALL_IMPL(impl_setSimulatedTimingEXT(type, desc), m_validationCallbackMessenger)
+    }
+
+    inline result Device::querySimulatedTimeEXT(uint64_t* time) const
+    {
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(m_enabledExtensions.find(adapter_extension::SimulatedTiming) != m_enabledExtensions.end(), result::ErrorExtensionNotEnabled)
+            LLRI_DETAIL_VALIDATION_REQUIRE(time != nullptr, result::ErrorInvalidUsage)
+        }
+
+        LLRI_DETAIL_CALL_IMPL(impl_querySimulatedTimeEXT(time), m_validationCallbackMessenger)
+    }
+
+    inline result Device::advanceSimulatedTimeEXT(uint64_t nanoseconds)
+    {
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(m_enabledExtensions.find(adapter_extension::SimulatedTiming) != m_enabledExtensions.end(), result::ErrorExtensionNotEnabled)
+        }
+
+        LLRI_DETAIL_CALL_IMPL(impl_advanceSimulatedTimeEXT(nanoseconds), m_validationCallbackMessenger)
+    }
+
+    inline result Device::importHostMemoryEXT(void* data, uint32_t size, Resource** resource)
+    {
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(m_enabledExtensions.find(adapter_extension::HostMemoryImport) != m_enabledExtensions.end(), result::ErrorExtensionNotEnabled)
+            LLRI_DETAIL_VALIDATION_REQUIRE(data != nullptr, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(size > 0, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(resource != nullptr, result::ErrorInvalidUsage)
+        }
+
+        *resource = nullptr;
+
+        LLRI_DETAIL_VALIDATION_FULL(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE_MESSAGE(reinterpret_cast<uintptr_t>(data) % m_hostMemoryImportAlignment == 0 && size % m_hostMemoryImportAlignment == 0,
+                "data and size (" + std::to_string(size) + ") must be multiples of adapter_limits::hostMemoryImportAlignment (" + std::to_string(m_hostMemoryImportAlignment) + ").",
+                result::ErrorInvalidUsage)
+        }
+
+        LLRI_DETAIL_TRACE_SCOPE()
+        const result r = impl_importHostMemoryEXT(data, size, resource);
+        if (r == result::Success)
+        {
+            // the memory is owned by the application, so imported resources don't count towards the allocated bytes
+            m_lifetime.trackAllocation(detail::tracked_object::Resource, memory_type::Upload, 0);
+        }
+
+        LLRI_DETAIL_POLL_API_MESSAGES(m_validationCallbackMessenger)
+        return r;
+    }
+
+    inline result Device::createExportableResourceEXT(const resource_desc& desc, external_memory_handle_type_ext handleType, Resource** resource)
+    {
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(m_enabledExtensions.find(adapter_extension::ExternalMemoryFd) != m_enabledExtensions.end(), result::ErrorExtensionNotEnabled)
+            LLRI_DETAIL_VALIDATION_REQUIRE(handleType <= external_memory_handle_type_ext::MaxEnum, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(resource != nullptr, result::ErrorInvalidUsage)
+        }
+
+        *resource = nullptr;
+
+#ifdef LLRI_DETAIL_ENABLE_VALIDATION
+        const result validationResult = validateResourceDesc(desc);
+        if (validationResult != result::Success)
+            return validationResult;
+
+        LLRI_DETAIL_VALIDATION_FULL(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE_IF(handleType == external_memory_handle_type_ext::DmaBuf, desc.type == resource_type::Buffer, result::ErrorInvalidUsage)
+        }
+#endif
+
+        LLRI_DETAIL_TRACE_SCOPE()
+        const result r = impl_createExportableResourceEXT(desc, handleType, resource);
+        if (r == result::Success)
+        {
+            (*resource)->m_exportable = true;
+            (*resource)->m_externalHandleType = handleType;
+
+            m_statistics.recordAllocation(desc.memoryType, (*resource)->m_allocationSize);
+            m_lifetime.trackAllocation(detail::tracked_object::Resource, desc.memoryType, (*resource)->m_allocationSize);
+        }
+
+        LLRI_DETAIL_POLL_API_MESSAGES(m_validationCallbackMessenger)
+        return r;
+    }
+
+    inline result Device::exportResourceMemoryFdEXT(Resource* resource, int* fd)
+    {
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(m_enabledExtensions.find(adapter_extension::ExternalMemoryFd) != m_enabledExtensions.end(), result::ErrorExtensionNotEnabled)
+            LLRI_DETAIL_VALIDATION_REQUIRE(resource != nullptr, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(fd != nullptr, result::ErrorInvalidUsage)
+        }
+
+        LLRI_DETAIL_VALIDATION_FULL(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(resource->m_exportable, result::ErrorInvalidUsage)
+        }
+
+        LLRI_DETAIL_CALL_IMPL(impl_exportResourceMemoryFdEXT(resource, fd), m_validationCallbackMessenger)
+    }
+
+    inline result Device::importResourceMemoryFdEXT(const resource_desc& desc, external_memory_handle_type_ext handleType, int fd, Resource** resource)
+    {
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(m_enabledExtensions.find(adapter_extension::ExternalMemoryFd) != m_enabledExtensions.end(), result::ErrorExtensionNotEnabled)
+            LLRI_DETAIL_VALIDATION_REQUIRE(handleType <= external_memory_handle_type_ext::MaxEnum, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(fd >= 0, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(resource != nullptr, result::ErrorInvalidUsage)
+        }
+
+        *resource = nullptr;
+
+#ifdef LLRI_DETAIL_ENABLE_VALIDATION
+        const result validationResult = validateResourceDesc(desc);
+        if (validationResult != result::Success)
+            return validationResult;
+
+        LLRI_DETAIL_VALIDATION_FULL(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE_IF(handleType == external_memory_handle_type_ext::DmaBuf, desc.type == resource_type::Buffer, result::ErrorInvalidUsage)
+        }
+#endif
+
+        LLRI_DETAIL_TRACE_SCOPE()
+        const result r = impl_importResourceMemoryFdEXT(desc, handleType, fd, resource);
+        if (r == result::Success)
+        {
+            // the memory was allocated by the exporting resource, which counts towards its allocated bytes instead
+            m_lifetime.trackAllocation(detail::tracked_object::Resource, desc.memoryType, 0);
+        }
+
+        LLRI_DETAIL_POLL_API_MESSAGES(m_validationCallbackMessenger)
+        return r;
+    }
+
+    inline result Device::createExportableSemaphoreEXT(Semaphore** semaphore)
+    {
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(m_enabledExtensions.find(adapter_extension::ExternalSemaphoreFd) != m_enabledExtensions.end(), result::ErrorExtensionNotEnabled)
+            LLRI_DETAIL_VALIDATION_REQUIRE(semaphore != nullptr, result::ErrorInvalidUsage)
+        }
+
+        *semaphore = nullptr;
+
+        LLRI_DETAIL_TRACE_SCOPE()
+        const result r = impl_createExportableSemaphoreEXT(semaphore);
+        if (r == result::Success)
+        {
+            (*semaphore)->m_exportable = true;
+            m_lifetime.track(detail::tracked_object::Semaphore);
+        }
+
+        LLRI_DETAIL_POLL_API_MESSAGES(m_validationCallbackMessenger)
+        return r;
+    }
+
+    inline result Device::exportSemaphoreSyncFdEXT(Semaphore* semaphore, int* fd)
+    {
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(m_enabledExtensions.find(adapter_extension::ExternalSemaphoreFd) != m_enabledExtensions.end(), result::ErrorExtensionNotEnabled)
+            LLRI_DETAIL_VALIDATION_REQUIRE(semaphore != nullptr, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(fd != nullptr, result::ErrorInvalidUsage)
+        }
+
+        LLRI_DETAIL_VALIDATION_FULL(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(semaphore->m_exportable, result::ErrorInvalidUsage)
+        }
+
+        LLRI_DETAIL_CALL_IMPL(impl_exportSemaphoreSyncFdEXT(semaphore, fd), m_validationCallbackMessenger)
+    }
+
+    inline result Device::importSemaphoreSyncFdEXT(Semaphore* semaphore, int fd)
+    {
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(m_enabledExtensions.find(adapter_extension::ExternalSemaphoreFd) != m_enabledExtensions.end(), result::ErrorExtensionNotEnabled)
+            LLRI_DETAIL_VALIDATION_REQUIRE(semaphore != nullptr, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(fd >= -1, result::ErrorInvalidUsage)
+        }
+
+        LLRI_DETAIL_CALL_IMPL(impl_importSemaphoreSyncFdEXT(semaphore, fd), m_validationCallbackMessenger)
+    }
+}
@@ -0,0 +1,48 @@
+/**
+ * @file external_fd_ext.hpp
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+#include <llri/llri.hpp> // unnecessary but helps intellisense
+
+namespace llri
+{
+    /**
+     * @brief The type of file descriptor that Resource memory is exported as or imported from, used by adapter_extension::ExternalMemoryFd.
+    */
+    enum struct external_memory_handle_type_ext : uint8_t
+    {
+        /**
+         * @brief A file descriptor whose contents are only meaningful to the same implementation and driver on the same Adapter, e.g. another process that renders or encodes with LLRI on the same GPU.
+        */
+        OpaqueFd,
+        /**
+         * @brief A Linux dma-buf file descriptor, which **may** also be imported by other APIs and devices, such as video encoders.
+         * Only buffers **may** be exported or imported as dma-buf, because the layout of textures in a dma-buf isn't defined.
+        */
+        DmaBuf,
+        /**
+         * @brief The highest value in this enum.
+        */
+        MaxEnum = DmaBuf
+    };
+
+    /**
+     * @brief Converts an external_memory_handle_type_ext to a string.
+     * @return The enum value as a string, or "Invalid external_memory_handle_type_ext value" if the value was not recognized as an enum member.
+    */
+    inline std::string to_string(external_memory_handle_type_ext type)
+    {
+        switch(type)
+        {
+            case external_memory_handle_type_ext::OpaqueFd:
+                return "OpaqueFd";
+            case external_memory_handle_type_ext::DmaBuf:
+                return "DmaBuf";
+        }
+
+        return "Invalid external_memory_handle_type_ext value";
+    }
+}
@@ -0,0 +1,179 @@
+/**
+ * @file job_scheduler.hpp
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+#include <llri/llri.hpp> // unnecessary but helps intellisense
+
+namespace llri
+{
+    class CommandList;
+    class Device;
+    class Fence;
+    class Queue;
+    class Semaphore;
+
+    /**
+     * @brief Identifies a job that was scheduled through job_scheduler::schedule(). Jobs are only valid until the next job_scheduler::flush().
+    */
+    struct job
+    {
+        uint32_t index = std::numeric_limits<uint32_t>::max();
+    };
+
+    /**
+     * @brief Describes a job, which is a list of CommandLists that are executed in order, after the jobs it depends on have completed.
+    */
+    struct job_desc
+    {
+        /**
+         * @brief The number of CommandLists in the job_desc::commandLists array.
+         *
+         * @note Valid usage (ErrorInvalidUsage): numCommandLists **must** be more than 0.
+        */
+        uint32_t numCommandLists;
+        /**
+         * @brief An array of CommandList pointers (of size numCommandLists) that the job executes.
+         *
+         * @note Valid usage (ErrorInvalidUsage): commandLists **must** be a valid non-null pointer to a CommandList* array.
+         * @note Valid usage (ErrorInvalidUsage): Each element in commandLists **must** be a valid non-null CommandList, and all of them **must** have been allocated from CommandGroups of the same queue_type.
+         * @note Valid usage (ErrorInvalidUsage): The Device **must** have at least one Queue of that queue_type.
+         * @note Valid usage (ErrorInvalidState): Each CommandList **must** be in the command_list_state::Ready state when flush() is called.
+        */
+        CommandList** commandLists;
+
+        /**
+         * @brief The number of jobs in the job_desc::dependencies array.
+        */
+        uint32_t numDependencies;
+        /**
+         * @brief An array of jobs (of size numDependencies) that **must** complete before this job executes.
+         *
+         * @note Valid usage: if numDependencies == 0 then dependencies **may** be nullptr.
+         * @note Valid usage (ErrorInvalidUsage): if numDependencies > 0 then dependencies **must** be a valid non-null pointer to an array of size numDependencies (or more).
+         * @note Valid usage (ErrorInvalidUsage): each element in dependencies **must** be a job that was scheduled since the last flush().
+        */
+        const job* dependencies;
+    };
+
+    /**
+     * @brief Describes how a job was submitted by job_scheduler::flush().
+    */
+    struct job_submission
+    {
+        /**
+         * @brief The type of the Queue that the job was submitted to.
+        */
+        queue_type queueType;
+        /**
+         * @brief The index of the Queue that the job was submitted to, as used in Device::getQueue().
+        */
+        uint8_t queueIndex;
+        /**
+         * @brief The number of Semaphores that the job waits on before it executes.
+        */
+        uint32_t numWaitSemaphores;
+        /**
+         * @brief The number of Semaphores that the job signals after it executes.
+        */
+        uint32_t numSignalSemaphores;
+    };
+
+    /**
+     * @brief Utility that submits jobs with dependencies to all of the Device's Queues, and inserts the Semaphores that their dependencies require.
+     *
+     * Jobs are scheduled through schedule() and submitted together on flush(). The queue_type of a job is the type of the CommandGroup that its CommandLists were allocated from, and
+     * jobs are spread over all Queues of that type: a job is submitted to the Queue of one of its dependencies if possible, and to the Queue with the fewest jobs otherwise.
+     *
+     * Semaphores are only inserted for dependencies on other Queues that aren't already implied by the submission order of a Queue, or by another Semaphore that the job waits on.
+     * Consecutive jobs on the same Queue that don't need Semaphores between them are merged into a single Queue::submit().
+     *
+     * The scheduler only synchronizes execution. Resources with resource_sharing_mode::Exclusive that are used by jobs of different queue_types still require resource_barrier::release() and resource_barrier::acquire() barriers in the jobs' CommandLists.
+     *
+     * @note job_scheduler is not thread-safe.
+    */
+    class job_scheduler
+    {
+    public:
+        job_scheduler() = default;
+        job_scheduler(const job_scheduler&) = delete;
+        job_scheduler& operator=(const job_scheduler&) = delete;
+        ~job_scheduler() { destroy(); }
+
+        /**
+         * @brief Prepare the scheduler for submitting to the Queues of device.
+         *
+         * @param device The Device whose Queues the jobs are submitted to.
+         * @param nodeMask The node mask used in Queue::submit(). Passing 0 is the equivalent of passing 1.
+         *
+         * @note Valid usage (ErrorInvalidUsage): device **must** be a valid non-null pointer to a Device.
+        */
+        result create(Device* device, uint32_t nodeMask = 0);
+
+        /**
+         * @brief Wait for all submitted jobs to complete, and destroy the scheduler's Fences and Semaphores. Calling destroy() on a scheduler that wasn't created has no effect.
+        */
+        void destroy();
+
+        /**
+         * @brief Schedule a job. The job isn't submitted until flush() is called.
+         *
+         * @param desc Describes the job's CommandLists and dependencies.
+         * @param output The job, which can be used as a dependency of jobs that are scheduled later.
+         *
+         * @return Success upon correct execution of the operation.
+         * @return job_desc defined result values: ErrorInvalidUsage.
+        */
+        result schedule(const job_desc& desc, job* output);
+
+        /**
+         * @brief Submit all jobs that were scheduled since the last flush(), in the order in which they were scheduled.
+         *
+         * @param submissions If not nullptr, the vector is filled with a job_submission for each job, indexed by job::index.
+         *
+         * @return Success upon correct execution of the operation.
+         * @return Device::createFence(), Device::createSemaphore() and Queue::submit() defined result values.
+        */
+        result flush(std::vector<job_submission>* submissions = nullptr);
+
+        /**
+         * @brief Block the CPU thread until all flushed jobs have completed.
+         *
+         * Semaphores are only reused after wait(), so applications that flush every frame **should** call wait() regularly, for example when they wait for their frame's Fence.
+         *
+         * @return Success upon correct execution of the operation.
+         * @return Device::waitFences() defined result values.
+        */
+        result wait();
+
+    private:
+        struct scheduled_job
+        {
+            std::vector<CommandList*> commandLists;
+            std::vector<uint32_t> dependencies;
+            queue_type type;
+        };
+
+        struct queue_slot
+        {
+            Queue* queue;
+            queue_type type;
+            uint8_t index;
+        };
+
+        result acquireSemaphore(Semaphore** semaphore);
+        result acquireFence(Fence** fence);
+
+        Device* m_device = nullptr;
+        uint32_t m_nodeMask = 0;
+        std::vector<queue_slot> m_queues;
+        std::vector<scheduled_job> m_jobs;
+
+        std::vector<Semaphore*> m_freeSemaphores;
+        std::vector<Semaphore*> m_usedSemaphores;
+        std::vector<Fence*> m_freeFences;
+        std::vector<Fence*> m_pendingFences;
+    };
+}
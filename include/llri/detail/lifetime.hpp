@@ -0,0 +1,184 @@
+/**
+ * @file lifetime.hpp
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+#include <llri/llri.hpp> // unnecessary but helps intellisense
+
+namespace llri
+{
+    /**
+     * @brief The number of objects that were created and not yet destroyed, as counted by an Instance that was created with instance_desc::trackObjectLifetimes enabled.
+    */
+    struct live_objects
+    {
+        /**
+         * @brief The number of live Devices. Always 0 for Device::queryLiveObjects().
+        */
+        uint64_t devices;
+        /**
+         * @brief The number of live CommandGroups.
+        */
+        uint64_t commandGroups;
+        /**
+         * @brief The number of live CommandLists. CommandLists are live from CommandGroup::allocate() until CommandGroup::free() or until their CommandGroup is destroyed.
+        */
+        uint64_t commandLists;
+        /**
+         * @brief The number of live Fences.
+        */
+        uint64_t fences;
+        /**
+         * @brief The number of live Semaphores.
+        */
+        uint64_t semaphores;
+        /**
+         * @brief The number of live QueryPools.
+        */
+        uint64_t queryPools;
+        /**
+         * @brief The number of live MemoryHeaps.
+        */
+        uint64_t memoryHeaps;
+        /**
+         * @brief The number of live Resources, including Resources that were placed in a MemoryHeap.
+        */
+        uint64_t resources;
+        /**
+         * @brief The number of bytes held by live Resources and MemoryHeaps, per memory_type, indexed by the memory_type value.
+         * This is the size of the implementation's allocation, like device_statistics::allocatedBytes. Placed Resources don't hold any bytes of their own, their memory is counted by their MemoryHeap.
+        */
+        std::array<uint64_t, static_cast<size_t>(memory_type::MaxEnum) + 1> resourceBytes;
+
+        /**
+         * @brief Returns true if no objects are live.
+        */
+        [[nodiscard]] bool empty() const;
+    };
+
+    /**
+     * @brief Converts live_objects to a string, listing only the object types that have live objects, e.g. "1 Device, 2 Resources (Local: 4096 bytes)".
+     * @return The live objects as a string, or "no live objects" if objects.empty() returns true.
+    */
+    inline std::string to_string(const live_objects& objects);
+
+    namespace detail
+    {
+        /**
+         * @brief The object types that are counted by lifetime_tracker.
+        */
+        enum struct tracked_object : uint8_t
+        {
+            Device,
+            CommandGroup,
+            CommandList,
+            Fence,
+            Semaphore,
+            QueryPool,
+            MemoryHeap,
+            Resource,
+            MaxEnum = Resource
+        };
+
+        /**
+         * @brief Counts the live objects of an Instance or a Device.
+         *
+         * Every Instance and Device holds its own tracker, and a Device's tracker forwards its counts to the tracker of the Instance that created it.
+         * Trackers are disabled unless the Instance was created with instance_desc::trackObjectLifetimes, in which case tracking costs a relaxed atomic add per create and destroy call.
+        */
+        class lifetime_tracker
+        {
+        public:
+            lifetime_tracker() = default;
+            lifetime_tracker(const lifetime_tracker&) = delete;
+            lifetime_tracker& operator=(const lifetime_tracker&) = delete;
+
+            void enable(lifetime_tracker* parent) noexcept
+            {
+                m_enabled = true;
+                m_parent = parent;
+            }
+
+            [[nodiscard]] bool enabled() const noexcept { return m_enabled; }
+
+            void track(tracked_object type, uint64_t count = 1) noexcept
+            {
+                if (!m_enabled)
+                    return;
+
+                m_objects[static_cast<size_t>(type)].fetch_add(count, std::memory_order_relaxed);
+                if (m_parent)
+                    m_parent->track(type, count);
+            }
+
+            void untrack(tracked_object type, uint64_t count = 1) noexcept
+            {
+                if (!m_enabled)
+                    return;
+
+                m_objects[static_cast<size_t>(type)].fetch_sub(count, std::memory_order_relaxed);
+                if (m_parent)
+                    m_parent->untrack(type, count);
+            }
+
+            /**
+             * @brief Tracks an object that holds memory, like a Resource or a MemoryHeap.
+            */
+            void trackAllocation(tracked_object type, memory_type memoryType, uint64_t bytes) noexcept
+            {
+                if (!m_enabled)
+                    return;
+
+                m_objects[static_cast<size_t>(type)].fetch_add(1, std::memory_order_relaxed);
+                m_bytes[static_cast<size_t>(memoryType)].fetch_add(bytes, std::memory_order_relaxed);
+                if (m_parent)
+                    m_parent->trackAllocation(type, memoryType, bytes);
+            }
+
+            void untrackAllocation(tracked_object type, memory_type memoryType, uint64_t bytes) noexcept
+            {
+                if (!m_enabled)
+                    return;
+
+                m_objects[static_cast<size_t>(type)].fetch_sub(1, std::memory_order_relaxed);
+                m_bytes[static_cast<size_t>(memoryType)].fetch_sub(bytes, std::memory_order_relaxed);
+                if (m_parent)
+                    m_parent->untrackAllocation(type, memoryType, bytes);
+            }
+
+            [[nodiscard]] live_objects snapshot() const noexcept
+            {
+                live_objects output {};
+                output.devices = count(tracked_object::Device);
+                output.commandGroups = count(tracked_object::CommandGroup);
+                output.commandLists = count(tracked_object::CommandList);
+                output.fences = count(tracked_object::Fence);
+                output.semaphores = count(tracked_object::Semaphore);
+                output.queryPools = count(tracked_object::QueryPool);
+                output.memoryHeaps = count(tracked_object::MemoryHeap);
+                output.resources = count(tracked_object::Resource);
+                for (size_t type = 0; type < output.resourceBytes.size(); type++)
+                    output.resourceBytes[type] = m_bytes[type].load(std::memory_order_relaxed);
+                return output;
+            }
+
+        private:
+            [[nodiscard]] uint64_t count(tracked_object type) const noexcept
+            {
+                return m_objects[static_cast<size_t>(type)].load(std::memory_order_relaxed);
+            }
+
+            std::array<std::atomic<uint64_t>, static_cast<size_t>(tracked_object::MaxEnum) + 1> m_objects {};
+            std::array<std::atomic<uint64_t>, static_cast<size_t>(memory_type::MaxEnum) + 1> m_bytes {};
+            lifetime_tracker* m_parent = nullptr;
+            bool m_enabled = false;
+        };
+
+        /**
+         * @brief Sends a warning to target if objects isn't empty. Used to report leaks when an Instance or Device is destroyed.
+        */
+        inline void reportLiveObjects(const message_target& target, const char* owner, const live_objects& objects);
+    }
+}
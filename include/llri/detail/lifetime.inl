@@ -0,0 +1,73 @@
+/**
+ * @file lifetime.inl
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+#include <llri/llri.hpp> // unnecessary but helps intellisense
+
+namespace llri
+{
+    inline bool live_objects::empty() const
+    {
+        if (devices != 0 || commandGroups != 0 || commandLists != 0 || fences != 0 || semaphores != 0 || queryPools != 0 || memoryHeaps != 0 || resources != 0)
+            return false;
+
+        return std::all_of(resourceBytes.begin(), resourceBytes.end(), [](uint64_t bytes) { return bytes == 0; });
+    }
+
+    inline std::string to_string(const live_objects& objects)
+    {
+        if (objects.empty())
+            return "no live objects";
+
+        std::string output;
+        auto append = [&output](uint64_t count, const char* name)
+        {
+            if (count == 0)
+                return;
+
+            if (!output.empty())
+                output += ", ";
+            output += std::to_string(count) + " " + name + (count == 1 ? "" : "s");
+        };
+
+        append(objects.devices, "Device");
+        append(objects.commandGroups, "CommandGroup");
+        append(objects.commandLists, "CommandList");
+        append(objects.fences, "Fence");
+        append(objects.semaphores, "Semaphore");
+        append(objects.queryPools, "QueryPool");
+        append(objects.memoryHeaps, "MemoryHeap");
+        append(objects.resources, "Resource");
+
+        std::string bytes;
+        for (size_t type = 0; type < objects.resourceBytes.size(); type++)
+        {
+            if (objects.resourceBytes[type] == 0)
+                continue;
+
+            if (!bytes.empty())
+                bytes += ", ";
+            bytes += to_string(static_cast<memory_type>(type)) + ": " + std::to_string(objects.resourceBytes[type]) + " bytes";
+        }
+
+        if (!bytes.empty())
+            output += " (" + bytes + ")";
+
+        return output;
+    }
+
+    namespace detail
+    {
+        inline void reportLiveObjects(const message_target& target, const char* owner, const live_objects& objects)
+        {
+            if (objects.empty())
+                return;
+
+            callUserCallback(target, message_severity::Warning, message_source::API,
+                std::string(owner) + " was destroyed while it still had live objects: " + to_string(objects) + ".");
+        }
+    }
+}
@@ -0,0 +1,101 @@
+/**
+ * @file memory_heap.hpp
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+#include <llri/llri.hpp> // unnecessary but helps intellisense
+
+namespace llri
+{
+    /**
+     * @brief MemoryHeap description to be used in Device::createMemoryHeap().
+    */
+    struct memory_heap_desc
+    {
+        /**
+         * @brief The device node on which the heap should be created. Passing 0 is the equivalent of passing 1.
+         *
+         * @note Valid usage (ErrorInvalidNodeMask): Exactly one bit **must** be set, and that bit **must** be less than 1 << Adapter::queryNodeCount().
+        */
+        uint32_t createNodeMask;
+        /**
+         * @brief A mask with the device nodes on which the heap's resources will be visible. Passing 0 is the equivalent of passing 1.
+         *
+         * @note Valid usage (ErrorInvalidNodeMask): At least the same bit as createNodeMask **must** be set.
+         * @note Valid usage (ErrorInvalidNodeMask): Any bits set to 1 in visibleNodeMask **must** be less than 1 << Adapter::queryNodeCount().
+        */
+        uint32_t visibleNodeMask;
+
+        /**
+         * @brief The size of the heap in bytes.
+         *
+         * @note Valid usage (ErrorInvalidUsage): size **must** be more than 0.
+        */
+        uint64_t size;
+        /**
+         * @brief The type of memory that the heap is allocated with. Every resource that is placed in the heap **must** be described with the same memory type.
+         *
+         * @note Valid usage (ErrorInvalidUsage): memoryType **must** be a valid memory_type enum value.
+        */
+        memory_type memoryType;
+    };
+
+    /**
+     * @brief The memory requirements of a resource, as queried through Device::queryResourceAllocationInfo().
+    */
+    struct resource_allocation_info
+    {
+        /**
+         * @brief The number of bytes that the resource occupies in a MemoryHeap.
+        */
+        uint64_t size;
+        /**
+         * @brief The alignment in bytes that the resource's offset in a MemoryHeap **must** be a multiple of.
+        */
+        uint64_t alignment;
+    };
+
+    /**
+     * @brief A MemoryHeap is a single block of device memory in which resources can be placed through Device::createPlacedResource().
+     *
+     * Placed resources don't allocate memory of their own, so resources whose lifetimes don't overlap can be placed at the same offset (aliased) to share their memory.
+     * Switching between aliased resources requires a resource_barrier::aliasing() barrier, after which the contents of the newly used resource are undefined.
+    */
+    class MemoryHeap
+    {
+        friend class Device;
+
+    public:
+        using native_memory_heap = void;
+
+        /**
+         * @brief Get the desc that the MemoryHeap was created with.
+        */
+        [[nodiscard]] memory_heap_desc getDesc() const;
+
+        /**
+         * @brief Gets the native MemoryHeap pointer, which depending on the llri::getImplementation() is a pointer to the following:
+         *
+         * DirectX12: ID3D12Heap*
+         * Vulkan: VkDeviceMemory
+         * Null: the host memory of memory_type::Upload and memory_type::Read heaps, nullptr otherwise
+         * CPU: the host memory that holds the heap's data
+         */
+        [[nodiscard]] native_memory_heap* getNative() const;
+
+    private:
+        // Force private constructor/deconstructor so that only create/destroy can manage lifetime
+        MemoryHeap() = default;
+        ~MemoryHeap() = default;
+
+        native_memory_heap* m_ptr = nullptr;
+        memory_heap_desc m_desc;
+
+        // used by implementations that need to know which of the adapter's memory types the heap was allocated from
+        uint32_t m_memoryTypeIndex = 0;
+        // used by implementations that keep host visible heaps mapped for their placed resources
+        void* m_mapped = nullptr;
+    };
+}
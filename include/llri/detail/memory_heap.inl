@@ -0,0 +1,21 @@
+/**
+ * @file memory_heap.inl
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+#include <llri/llri.hpp> // unnecessary but helps intellisense
+
+namespace llri
+{
+    inline memory_heap_desc MemoryHeap::getDesc() const
+    {
+        return m_desc;
+    }
+
+    inline MemoryHeap::native_memory_heap* MemoryHeap::getNative() const
+    {
+        return m_ptr;
+    }
+}
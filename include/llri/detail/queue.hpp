@@ -0,0 +1,373 @@
+/**
+ * @file queue.hpp
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+#include <llri/llri.hpp> // unnecessary but helps intellisense
+
+namespace llri
+{
+    class CommandList;
+    class Fence;
+    class Semaphore;
+
+    /**
+     * @brief Declare queue priority. Queues with a higher priority **may** be assigned more resources and processing time by the Adapter.
+    */
+    enum struct queue_priority : uint8_t
+    {
+        /**
+         * @brief Normal priority. Queues with this priority **may** be superseded in processing time by queues created with queue_priority::High.
+         *
+         * Normal priority only applies to in-application queue sorting and has no effect on system-wide queue sorting.
+        */
+        Normal,
+        /**
+         * @brief High priority. Queues with this priority **may** receive more processing time than queues created with queue_priority::Normal.
+         *
+         * High priority only applies to in-application queue sorting and has no effect on system-wide queue sorting.
+        */
+        High,
+        /**
+         * @brief The highest value in this enum.
+        */
+        MaxEnum = High
+    };
+
+    /**
+     * @brief Converts a queue_priority to a string.
+     * @return The enum value as a string, or "Invalid queue_priority value" if the value was not recognized as an enum member.
+    */
+    inline std::string to_string(queue_priority priority);
+
+    /**
+     * @brief Queue types define what kind of commands can be sent to the queue created with it.
+     * Some queue types support multiple types of commands, whereas others support only one or two types, which **might** enable additional performance optimizations for the said commands.
+    */
+    enum struct queue_type : uint8_t
+    {
+        /**
+         * @brief Graphics queues support all commands related to graphics, compute, and transfer operations.
+         *
+         * Graphics queues tend to be the most general purpose, but is most commonly available.
+        */
+        Graphics,
+        /**
+         * @brief Compute queues support all commands related to compute and transfer operations.
+         *
+         * Compute **may** use different Adapter resources than graphics commands, so sending compute commands through a Compute queue might help them be sent through to the Adapter sooner without interfering with Graphics commands.
+        */
+        Compute,
+        /**
+         * @brief Transfer queues only support transfer operations.
+         *
+         * Transfer queues **may** be optimized for PCIe operations, which **may** allow them to make better use of the PCIe lanes' speeds.
+        */
+        Transfer,
+        /**
+         * @brief The highest value in this enum.
+        */
+        MaxEnum = Transfer
+    };
+
+    /**
+     * @brief Converts a queue_type to a string.
+     * @return The enum value as a string, or "Invalid queue_type value" if the value was not recognized as an enum member.
+    */
+    inline std::string to_string(queue_type type);
+
+    /**
+     * @brief Describes the information needed to create a queue upon device creation.
+     *
+     * Queues are never created manually and can only be created through device_desc, after which they **may** be queried through Device::getQueue().
+    */
+    struct queue_desc
+    {
+        /**
+         * @brief The type of queue. This determines the set of commands that the queue can support, and the optimizations it **may** enable for that set of commands.
+         *
+         * @note Valid usage (ErrorInvalidUsage):  type must not be more than queue_type::MaxEnum.
+        */
+        queue_type type;
+        /**
+         * @brief The priority of the queue. This **may** affect which queues receive more or less adapter computing resources.
+         *
+         * @note Valid usage (ErrorInvalidUsage):  priority must not be more than queue_priority::MaxEnum.
+        */
+        queue_priority priority;
+    };
+
+    /**
+     * @brief Describes how command lists should be submitted to a queue.
+    */
+    struct submit_desc
+    {
+        /**
+         * @brief The nodeMask determines which adapter node the queues are submitted to. If this value is 0, it is interpreted as 1.
+         *
+         * @note Valid usage (ErrorInvalidNodeMask): Exactly one bit **must** be set, and that bit **must** be less than 1 << Adapter::queryNodeCount().
+         * @note Valid usage (ErrorIncompatibleNodeMask):  All the CommandLists in this submit **must** have been allocated with this nodemask.
+        */
+        uint32_t nodeMask;
+
+        /**
+         * @brief The number of CommandLists in the submit_desc::commandLists array.
+         *
+         * @note Valid usage (ErrorInvalidUsage): numCommandLists **must** be more than 0.
+        */
+        uint32_t numCommandLists;
+        /**
+         * @brief An array of CommandList pointers (of size numCommandLists) that ought to be submitted to the queue.
+         *
+         * @note Valid usage (ErrorInvalidUsage): commandLists **must** be a valid non-null pointer to a CommandList* array.
+         * @note Valid usage (ErrorInvalidUsage): Each element in commandLists **must** be a valid non-null CommandList.
+         * @note Valid usage (ErrorInvalidState): Each commandlist in the array **must** be in the command_list_state::Ready state.
+        */
+        CommandList** commandLists;
+
+        /**
+         * @brief The number of Semaphores in the submit_desc::waitSemaphores array.
+        */
+        uint32_t numWaitSemaphores;
+        /**
+         * @brief An array of Semaphores that the CommandLists must wait on prior to executing.
+         *
+         * @note Valid usage: if numWaitSemaphores == 0 then waitSemaphores **may** be nullptr.
+         * @note Valid usage (ErrorInvalidUsage): if numWaitSemaphores > 0 then waitSemaphores **must** be a valid non-null pointer to an array of size numWaitSemaphores (or more).
+         * @note Valid usage (ErrorInvalidUsage): if numWaitSemaphores > 0 then each element in waitSemaphores **must** be a valid non-null Semaphore pointer.
+        */
+        Semaphore** waitSemaphores;
+
+        /**
+         * @brief The number of Semaphores in the submit_desc::signalSemaphores array.
+        */
+        uint32_t numSignalSemaphores;
+        /**
+         * @brief An array of Semaphores that the CommandList signal after they are done executing.
+         *
+         * @note Valid usage: if numSignalSemaphores == 0 then signalSemaphores **may** be nullptr.
+         * @note Valid usage (ErrorInvalidUsage): if numSignalSemaphores > 0 then signalSemaphores **must** be a valid non-null pointer to an array of size numSignalSemaphores (or more).
+         * @note Valid usage (ErrorInvalidUsage): if numSignalSemaphores > 0 then each element in signalSemaphores **must** be a valid non-null Semaphore pointer.
+        */
+        Semaphore** signalSemaphores;
+
+        /**
+         * @brief A fence to signal after the CommandLists are done executing.
+         *
+         * @note Valid usage: fence may be a valid pointer to a Fence, or nullptr.
+         * @Note Valid usage (ErrorAlreadySignaled): if fence is not nullptr, then the Fence **must not** have already been signaled.
+        */
+        Fence* fence;
+    };
+
+    /**
+     * @brief Queues are used to send commands to the Adapter. This is done by submitting CommandLists and/or synchronization operations.
+    */
+    class Queue
+    {
+        friend class Instance;
+        friend class Device;
+
+    public:
+        using native_queue = void;
+
+        /**
+         * Get the desc that the Queue has been created with (internally).
+         */
+        [[nodiscard]] queue_desc getDesc() const;
+
+        /**
+         * @brief Gets the native Queue pointer, which depending on the llri::getImplementation() is a pointer to the following:
+         *
+         * DirectX12: ID3D12CommandQueue*
+         * Vulkan: VkQueue
+         * Null: an internal object that holds the Queue's simulated timeline
+         * CPU: an internal object that executes the Queue's submissions on a worker thread
+         *
+         * @param index The index of the device node to get the queue of. The function returns nullptr if the index exceeds the number of nodes in the device.
+         */
+        [[nodiscard]] native_queue* getNative(size_t index = 0) const;
+        
+        /**
+         * @brief Submit CommandLists to the queue, which means the commands they contain will be executed.
+         * @param desc Describes the CommandLists that get executed, and what synchronization they signal or wait upon.
+         *
+         * @return Success upon correct execution of the operation.
+         * @return submit_desc defined result values: ErrorInvalidUsage, ErrorInvalidNodeMask, ErrorIncompatibleNodeMask, ErrorInvalidState, ErrorAlreadySignaled.
+        */
+        result submit(const submit_desc& desc);
+
+        /**
+         * @brief Wait for the queue to go idle. This function blocks the CPU thread until all of the commands on the queue are done.
+         *
+         * This is the equivalent of adding a fence to the last submit and waiting for the said fence.
+         *
+         * @return Success upon correct execution of the operation.
+         * @return Implementation defined result values: ErrorOutOfHostMemory, ErrorOutOfDeviceMemory, ErrorDeviceLost.
+        */
+        result waitIdle();
+    private:
+        // Force private constructor/deconstructor so that only create/destroy can manage lifetime
+        Queue() = default;
+        ~Queue() = default;
+
+        std::vector<native_queue*> m_ptrs;
+        std::vector<Fence*> m_fences; // optional internal fences for waitIdle()
+
+        queue_desc m_desc;
+        Device* m_device = nullptr;
+
+        void* m_validationCallbackMessenger = nullptr;
+        validation_level m_validationLevel = validation_level::Full;
+        detail::message_target m_messageTarget;
+        detail::device_statistics_recorder* m_statistics = nullptr;
+
+        result impl_submit(const submit_desc& desc);
+        result impl_waitIdle();
+    };
+
+    /**
+     * @brief Determines how a queue_pool selects the Queue for each submission.
+    */
+    enum struct queue_pool_policy : uint8_t
+    {
+        /**
+         * @brief Submissions cycle through the Queues in order.
+        */
+        RoundRobin,
+        /**
+         * @brief Each submission goes to the Queue with the fewest CommandLists that haven't completed yet. Ties are resolved in favour of the Queue with the lowest index.
+        */
+        LeastLoaded,
+        /**
+         * @brief The highest value in this enum.
+        */
+        MaxEnum = LeastLoaded
+    };
+
+    /**
+     * @brief Converts a queue_pool_policy to a string.
+     * @return The enum value as a string, or "Invalid queue_pool_policy value" if the value was not recognized as an enum member.
+    */
+    inline std::string to_string(queue_pool_policy policy);
+
+    /**
+     * @brief Identifies a submission that was made through queue_pool::submit().
+    */
+    struct queue_pool_ticket
+    {
+        /**
+         * @brief The index of the Queue that the submission was made to, as used in Device::getQueue().
+        */
+        uint8_t queueIndex = std::numeric_limits<uint8_t>::max();
+        /**
+         * @brief The number of submissions that were made to the Queue through the pool up to and including this submission.
+        */
+        uint64_t value = 0;
+    };
+
+    /**
+     * @brief Utility that spreads submissions over all of a Device's Queues of a single queue_type, for example to keep multiple transfer queues busy in parallel.
+     *
+     * The pool signals one of its own Fences with every submission, which it uses to track which submissions have completed.
+     *
+     * @note queue_pool is not thread-safe.
+    */
+    class queue_pool
+    {
+    public:
+        queue_pool() = default;
+        queue_pool(const queue_pool&) = delete;
+        queue_pool& operator=(const queue_pool&) = delete;
+        ~queue_pool() { destroy(); }
+
+        /**
+         * @brief Prepare the pool for submitting to all Queues of type on device.
+         *
+         * @note Valid usage (ErrorInvalidUsage): device **must** be a valid non-null pointer to a Device.
+         * @note Valid usage (ErrorInvalidUsage): type **must not** be more than queue_type::MaxEnum, and device **must** have at least one Queue of type.
+         * @note Valid usage (ErrorInvalidUsage): policy **must not** be more than queue_pool_policy::MaxEnum.
+         *
+         * @return Success upon correct execution of the operation.
+        */
+        result create(Device* device, queue_type type, queue_pool_policy policy);
+
+        /**
+         * @brief Wait for all submissions to complete and destroy the pool's Fences. Calling destroy() on a pool that wasn't created has no effect.
+        */
+        void destroy();
+
+        /**
+         * @brief Submit to the Queue that the pool's queue_pool_policy selects.
+         *
+         * @param desc Describes the submission, refer to Queue::submit() for its usage.
+         * @param ticket If not nullptr, receives a ticket that identifies the submission in isComplete() and wait().
+         *
+         * @note Valid usage (ErrorInvalidUsage): desc.fence **must** be nullptr, because the pool signals its own Fence. Completion is queried through isComplete() and wait() instead.
+         *
+         * @return Success upon correct execution of the operation.
+         * @return Device::createFence() and Queue::submit() defined result values.
+        */
+        result submit(const submit_desc& desc, queue_pool_ticket* ticket = nullptr);
+
+        /**
+         * @brief Check, without blocking, if the submission that ticket identifies has completed.
+         *
+         * @return True if the submission has completed, or if ticket doesn't identify a submission of this pool.
+        */
+        [[nodiscard]] bool isComplete(const queue_pool_ticket& ticket);
+
+        /**
+         * @brief Block the CPU thread until the submission that ticket identifies, and all earlier submissions to the same Queue, have completed.
+         *
+         * @return Success upon correct execution of the operation.
+         * @return Device::waitFences() defined result values.
+        */
+        result wait(const queue_pool_ticket& ticket);
+
+        /**
+         * @brief Block the CPU thread until all submissions made through the pool have completed.
+         *
+         * @return Success upon correct execution of the operation.
+         * @return Device::waitFences() defined result values.
+        */
+        result waitIdle();
+
+        /**
+         * @brief The number of Queues that the pool submits to, or 0 if the pool wasn't created.
+        */
+        [[nodiscard]] uint8_t queryQueueCount() const { return static_cast<uint8_t>(m_queues.size()); }
+
+        /**
+         * @brief The number of CommandLists that were submitted to the Queue at index and haven't completed yet.
+        */
+        [[nodiscard]] uint32_t queryLoad(uint8_t index);
+
+    private:
+        struct in_flight
+        {
+            Fence* fence;
+            uint64_t value;
+            uint32_t numCommandLists;
+        };
+
+        struct pooled_queue
+        {
+            Queue* queue;
+            uint64_t submitted;
+            uint64_t completed;
+            uint32_t load;
+            std::vector<in_flight> pending;
+        };
+
+        result poll(pooled_queue& queue, uint64_t waitValue);
+
+        Device* m_device = nullptr;
+        queue_pool_policy m_policy = queue_pool_policy::RoundRobin;
+        std::vector<pooled_queue> m_queues;
+        size_t m_next = 0;
+        std::vector<Fence*> m_freeFences;
+    };
+}
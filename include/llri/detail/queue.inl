@@ -0,0 +1,272 @@
+/**
+ * @file queue.inl
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+#include <llri/llri.hpp> // unnecessary but helps intellisense
+
+namespace llri
+{
+    inline std::string to_string(queue_priority priority)
+    {
+        switch(priority)
+        {
+            case queue_priority::Normal:
+                return "Normal";
+            case queue_priority::High:
+                return "High";
+        }
+        return "Invalid queue_priority value";
+    }
+
+    inline std::string to_string(queue_type type)
+    {
+        switch(type)
+        {
+            case queue_type::Graphics:
+                return "Graphics";
+            case queue_type::Compute:
+                return "Compute";
+            case queue_type::Transfer:
+                return "Transfer";
+        }
+
+        return "Invalid queue_type value";
+    }
+
+    inline std::string to_string(queue_pool_policy policy)
+    {
+        switch(policy)
+        {
+            case queue_pool_policy::RoundRobin:
+                return "RoundRobin";
+            case queue_pool_policy::LeastLoaded:
+                return "LeastLoaded";
+        }
+
+        return "Invalid queue_pool_policy value";
+    }
+
+    inline queue_desc Queue::getDesc() const
+    {
+        return m_desc;
+    }
+
+    inline Queue::native_queue* Queue::getNative(size_t index) const
+    {
+        if (index >= m_ptrs.size())
+            return nullptr;
+        
+        return m_ptrs[index];
+    }
+
+    inline result Queue::submit(const submit_desc& desc)
+    {
+#ifdef LLRI_DETAIL_ENABLE_VALIDATION
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(desc.numCommandLists != 0, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(desc.commandLists != nullptr, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE_IF(desc.numWaitSemaphores > 0, desc.waitSemaphores != nullptr, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE_IF(desc.numSignalSemaphores > 0, desc.signalSemaphores != nullptr, result::ErrorInvalidUsage)
+        }
+
+        LLRI_DETAIL_VALIDATION_FULL(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(detail::hasSingleBit(desc.nodeMask), result::ErrorInvalidNodeMask)
+            LLRI_DETAIL_VALIDATION_REQUIRE(desc.nodeMask < (1u << m_device->m_adapter->queryNodeCount()), result::ErrorInvalidNodeMask)
+
+            for (size_t i = 0; i < desc.numCommandLists; i++)
+            {
+                LLRI_DETAIL_VALIDATION_REQUIRE_ITER(desc.commandLists[i] != nullptr, i, result::ErrorInvalidUsage)
+                LLRI_DETAIL_VALIDATION_REQUIRE_ITER(desc.commandLists[i]->getState() == llri::command_list_state::Ready, i, result::ErrorInvalidState)
+
+                const uint32_t descNodeMask = desc.nodeMask == 0 ? 1 : desc.nodeMask;
+                const uint32_t cmdListNodeMask = desc.commandLists[i]->m_desc.nodeMask == 0 ? 1 : desc.commandLists[i]->m_desc.nodeMask;
+
+                LLRI_DETAIL_VALIDATION_REQUIRE_ITER(descNodeMask == cmdListNodeMask, i, result::ErrorIncompatibleNodeMask)
+            }
+
+            for (size_t i = 0; i < desc.numWaitSemaphores; i++)
+                LLRI_DETAIL_VALIDATION_REQUIRE_ITER(desc.waitSemaphores[i] != nullptr, i, result::ErrorInvalidUsage)
+
+            for (size_t i = 0; i < desc.numSignalSemaphores; i++)
+                LLRI_DETAIL_VALIDATION_REQUIRE_ITER(desc.signalSemaphores[i] != nullptr, i, result::ErrorInvalidUsage)
+
+            LLRI_DETAIL_VALIDATION_REQUIRE_IF(desc.fence != nullptr, desc.fence->m_signaled == false, result::ErrorAlreadySignaled)
+        }
+#endif
+
+        LLRI_DETAIL_CALL_IMPL_STATISTICS(impl_submit(desc), m_validationCallbackMessenger, *m_statistics, device_call::Submit)
+    }
+
+    inline result Queue::waitIdle()
+    {
+        LLRI_DETAIL_CALL_IMPL_STATISTICS(impl_waitIdle(), m_validationCallbackMessenger, *m_statistics, device_call::WaitIdle)
+    }
+
+    inline result queue_pool::create(Device* device, queue_type type, queue_pool_policy policy)
+    {
+        if (device == nullptr || type > queue_type::MaxEnum || policy > queue_pool_policy::MaxEnum || device->queryQueueCount(type) == 0)
+            return result::ErrorInvalidUsage;
+
+        destroy();
+
+        m_device = device;
+        m_policy = policy;
+        for (uint8_t i = 0; i < device->queryQueueCount(type); i++)
+            m_queues.push_back(pooled_queue { device->getQueue(type, i), 0, 0, 0, {} });
+
+        return result::Success;
+    }
+
+    inline void queue_pool::destroy()
+    {
+        if (m_device == nullptr)
+            return;
+
+        static_cast<void>(waitIdle());
+
+        for (auto& queue : m_queues)
+        {
+            for (auto& entry : queue.pending)
+                m_device->destroyFence(entry.fence);
+        }
+
+        for (auto* fence : m_freeFences)
+            m_device->destroyFence(fence);
+
+        m_queues.clear();
+        m_freeFences.clear();
+        m_next = 0;
+        m_device = nullptr;
+    }
+
+    inline result queue_pool::submit(const submit_desc& desc, queue_pool_ticket* ticket)
+    {
+        if (m_device == nullptr || desc.fence != nullptr)
+            return result::ErrorInvalidUsage;
+
+        size_t index = m_next;
+        if (m_policy == queue_pool_policy::RoundRobin)
+        {
+            m_next = (m_next + 1) % m_queues.size();
+
+            // return the chosen queue's completed fences to the pool, so that callers that never check their tickets don't create a Fence per submit
+            const result r = poll(m_queues[index], 0);
+            if (r != result::Success)
+                return r;
+        }
+        else
+        {
+            index = 0;
+            for (size_t i = 0; i < m_queues.size(); i++)
+            {
+                const result r = poll(m_queues[i], 0);
+                if (r != result::Success)
+                    return r;
+
+                if (m_queues[i].load < m_queues[index].load)
+                    index = i;
+            }
+        }
+
+        Fence* fence = nullptr;
+        if (m_freeFences.empty())
+        {
+            const result r = m_device->createFence(fence_flag_bits::None, &fence);
+            if (r != result::Success)
+                return r;
+        }
+        else
+        {
+            fence = m_freeFences.back();
+            m_freeFences.pop_back();
+        }
+
+        submit_desc fenced = desc;
+        fenced.fence = fence;
+
+        pooled_queue& queue = m_queues[index];
+        const result r = queue.queue->submit(fenced);
+        if (r != result::Success)
+        {
+            m_freeFences.push_back(fence);
+            return r;
+        }
+
+        queue.submitted++;
+        queue.load += desc.numCommandLists;
+        queue.pending.push_back(in_flight { fence, queue.submitted, desc.numCommandLists });
+
+        if (ticket != nullptr)
+            *ticket = queue_pool_ticket { static_cast<uint8_t>(index), queue.submitted };
+
+        return result::Success;
+    }
+
+    inline bool queue_pool::isComplete(const queue_pool_ticket& ticket)
+    {
+        if (ticket.queueIndex >= m_queues.size())
+            return true;
+
+        pooled_queue& queue = m_queues[ticket.queueIndex];
+        if (ticket.value <= queue.completed)
+            return true;
+
+        return poll(queue, 0) == result::Success && ticket.value <= queue.completed;
+    }
+
+    inline result queue_pool::wait(const queue_pool_ticket& ticket)
+    {
+        if (ticket.queueIndex >= m_queues.size())
+            return result::Success;
+
+        return poll(m_queues[ticket.queueIndex], ticket.value);
+    }
+
+    inline result queue_pool::waitIdle()
+    {
+        for (auto& queue : m_queues)
+        {
+            const result r = poll(queue, queue.submitted);
+            if (r != result::Success)
+                return r;
+        }
+
+        return result::Success;
+    }
+
+    inline uint32_t queue_pool::queryLoad(uint8_t index)
+    {
+        if (index >= m_queues.size())
+            return 0;
+
+        static_cast<void>(poll(m_queues[index], 0));
+        return m_queues[index].load;
+    }
+
+    inline result queue_pool::poll(pooled_queue& queue, uint64_t waitValue)
+    {
+        // submissions to a Queue complete in order, so polling stops at the first submission that hasn't completed
+        // submissions up to waitValue are waited on instead
+        result r = result::Success;
+        size_t completed = 0;
+        for (; completed < queue.pending.size(); completed++)
+        {
+            const in_flight& entry = queue.pending[completed];
+            r = m_device->waitFence(entry.fence, entry.value <= waitValue ? LLRI_TIMEOUT_MAX : 0);
+            if (r != result::Success)
+                break;
+
+            m_freeFences.push_back(entry.fence);
+            queue.completed = entry.value;
+            queue.load -= entry.numCommandLists;
+        }
+
+        queue.pending.erase(queue.pending.begin(), queue.pending.begin() + static_cast<ptrdiff_t>(completed));
+        return r == result::Timeout ? result::Success : r;
+    }
+}
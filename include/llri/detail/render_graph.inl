@@ -0,0 +1,888 @@
+/**
+ * @file render_graph.inl
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+#include <llri/graph.hpp> // unnecessary but helps intellisense
+
+namespace llri
+{
+    namespace detail
+    {
+        constexpr uint64_t alignUp(uint64_t value, uint64_t alignment) noexcept
+        {
+            return alignment == 0 ? value : (value + alignment - 1) / alignment * alignment;
+        }
+
+        constexpr bool equalShape(const resource_desc& a, const resource_desc& b) noexcept
+        {
+            return a.createNodeMask == b.createNodeMask && a.visibleNodeMask == b.visibleNodeMask &&
+                a.type == b.type && a.usage == b.usage && a.memoryType == b.memoryType && a.initialState == b.initialState &&
+                a.width == b.width && a.height == b.height && a.depthOrArrayLayers == b.depthOrArrayLayers && a.mipLevels == b.mipLevels &&
+                a.sampleCount == b.sampleCount && a.textureFormat == b.textureFormat;
+        }
+    }
+
+    inline render_graph_pass& render_graph_pass::read(render_graph_resource resource, resource_state state)
+    {
+        return access(resource, state, false);
+    }
+
+    inline render_graph_pass& render_graph_pass::write(render_graph_resource resource, resource_state state)
+    {
+        return access(resource, state, true);
+    }
+
+    inline render_graph_pass& render_graph_pass::access(render_graph_resource resource, resource_state state, bool write)
+    {
+        auto& accesses = m_graph->m_passes[m_index].accesses;
+
+        // a read and a write in the same state are a single read-write access, different states are reported by compile()
+        for (auto& access : accesses)
+        {
+            if (access.resource == resource.index && access.state == state)
+            {
+                access.write |= write;
+                return *this;
+            }
+        }
+
+        accesses.push_back(render_graph::resource_access { resource.index, state, write });
+        return *this;
+    }
+
+    inline result render_graph::create(Device* device, const render_graph_desc& desc)
+    {
+        if (device == nullptr)
+            return result::ErrorInvalidUsage;
+
+        if (device->queryQueueCount(queue_type::Graphics) == 0)
+            return result::ErrorFeatureNotSupported;
+
+        destroy();
+
+        const result r = device->createFence(fence_flag_bits::None, &m_fence);
+        if (r != result::Success)
+            return r;
+
+        m_device = device;
+        m_desc = desc;
+
+        for (size_t type = 0; type <= static_cast<size_t>(queue_type::MaxEnum); type++)
+        {
+            if (device->queryQueueCount(static_cast<queue_type>(type)) > 0)
+                m_queues[type] = device->getQueue(static_cast<queue_type>(type), 0);
+        }
+
+        return result::Success;
+    }
+
+    inline void render_graph::destroy()
+    {
+        if (m_device == nullptr)
+            return;
+
+        static_cast<void>(wait());
+        releaseCompiled();
+
+        m_device->destroyFence(m_fence);
+        m_fence = nullptr;
+        m_inFlight = false;
+
+        m_queues = {};
+        m_passes.clear();
+        m_resources.clear();
+        m_compileCount = 0;
+        m_device = nullptr;
+    }
+
+    inline void render_graph::reset()
+    {
+        m_passes.clear();
+        m_resources.clear();
+    }
+
+    inline render_graph_resource render_graph::importResource(Resource* resource, resource_state state)
+    {
+        if (resource == nullptr)
+            return render_graph_resource {};
+
+        m_resources.push_back(declared_resource { resource, state, resource->getDesc() });
+        return render_graph_resource { static_cast<uint32_t>(m_resources.size() - 1) };
+    }
+
+    inline render_graph_resource render_graph::createTransient(const resource_desc& desc)
+    {
+        m_resources.push_back(declared_resource { nullptr, desc.initialState, desc });
+        return render_graph_resource { static_cast<uint32_t>(m_resources.size() - 1) };
+    }
+
+    inline render_graph_pass render_graph::addPass(std::string name, queue_type type, std::function<void(CommandList*)> record)
+    {
+        m_passes.push_back(pass { std::move(name), type, std::move(record), {} });
+        return render_graph_pass { this, static_cast<uint32_t>(m_passes.size() - 1) };
+    }
+
+    inline Resource* render_graph::getResource(render_graph_resource resource) const
+    {
+        if (resource.index >= m_resources.size())
+            return nullptr;
+
+        if (m_resources[resource.index].imported != nullptr)
+            return m_resources[resource.index].imported;
+
+        return resource.index < m_transients.size() ? m_transients[resource.index] : nullptr;
+    }
+
+    inline std::vector<render_graph_batch> render_graph::queryBatches() const
+    {
+        std::vector<render_graph_batch> output;
+        output.reserve(m_batches.size());
+
+        for (const auto& b : m_batches)
+        {
+            size_t numBarriers = b.release.size();
+            for (const auto& barriers : b.barriers)
+                numBarriers += barriers.size();
+
+            output.push_back(render_graph_batch {
+                b.queue, b.passes, static_cast<uint32_t>(numBarriers),
+                static_cast<uint32_t>(b.waitSemaphores.size()), static_cast<uint32_t>(b.signalSemaphores.size())
+            });
+        }
+
+        return output;
+    }
+
+    inline queue_type render_graph::queueFor(queue_type type) const
+    {
+        if (type == queue_type::Compute && m_desc.asyncCompute && m_queues[static_cast<size_t>(queue_type::Compute)] != nullptr)
+            return queue_type::Compute;
+
+        if (type == queue_type::Transfer && m_desc.asyncTransfer && m_queues[static_cast<size_t>(queue_type::Transfer)] != nullptr)
+            return queue_type::Transfer;
+
+        return queue_type::Graphics;
+    }
+
+    inline resource_state render_graph::effectiveState(const pass& p, const resource_access& access) const
+    {
+        return queueFor(p.type) == queue_type::Transfer ? resource_state::General : access.state;
+    }
+
+    inline const resource_desc& render_graph::describeResource(uint32_t resource) const
+    {
+        return m_resources[resource].desc;
+    }
+
+    inline result render_graph::validate() const
+    {
+        for (const auto& declared : m_resources)
+        {
+            if (declared.imported == nullptr && declared.desc.memoryType != memory_type::Local)
+                return result::ErrorInvalidUsage;
+
+            if (declared.state > resource_state::MaxEnum)
+                return result::ErrorInvalidUsage;
+        }
+
+        for (const auto& p : m_passes)
+        {
+            if (p.type > queue_type::MaxEnum)
+                return result::ErrorInvalidUsage;
+
+            for (size_t i = 0; i < p.accesses.size(); i++)
+            {
+                const resource_access& access = p.accesses[i];
+                if (access.resource >= m_resources.size() || access.state > resource_state::MaxEnum)
+                    return result::ErrorInvalidUsage;
+
+                for (size_t j = 0; j < i; j++)
+                {
+                    if (p.accesses[j].resource == access.resource)
+                        return result::ErrorInvalidUsage;
+                }
+
+                if (!detail::meetsStateRequirements(describeResource(access.resource), effectiveState(p, access)))
+                    return result::ErrorInvalidState;
+            }
+        }
+
+        return result::Success;
+    }
+
+    inline bool render_graph::matchesCompiledShape() const
+    {
+        if (!m_compiled || m_passes.size() != m_compiledPasses.size() || m_resources.size() != m_compiledResources.size())
+            return false;
+
+        for (size_t i = 0; i < m_passes.size(); i++)
+        {
+            const pass& a = m_passes[i];
+            const pass& b = m_compiledPasses[i];
+            if (a.type != b.type || a.accesses.size() != b.accesses.size())
+                return false;
+
+            for (size_t j = 0; j < a.accesses.size(); j++)
+            {
+                if (a.accesses[j].resource != b.accesses[j].resource || a.accesses[j].state != b.accesses[j].state || a.accesses[j].write != b.accesses[j].write)
+                    return false;
+            }
+        }
+
+        for (size_t i = 0; i < m_resources.size(); i++)
+        {
+            const declared_resource& a = m_resources[i];
+            const declared_resource& b = m_compiledResources[i];
+            if ((a.imported == nullptr) != (b.imported == nullptr) || a.state != b.state || a.desc.sharingMode != b.desc.sharingMode)
+                return false;
+
+            if (a.imported == nullptr && !detail::equalShape(a.desc, b.desc))
+                return false;
+        }
+
+        return true;
+    }
+
+    inline void render_graph::releaseCompiled()
+    {
+        for (auto*& group : m_commandGroups)
+        {
+            m_device->destroyCommandGroup(group);
+            group = nullptr;
+        }
+
+        for (auto* semaphore : m_semaphores)
+            m_device->destroySemaphore(semaphore);
+        m_semaphores.clear();
+
+        for (auto* resource : m_transients)
+        {
+            if (resource != nullptr)
+                m_device->destroyResource(resource);
+        }
+        m_transients.clear();
+
+        m_device->destroyMemoryHeap(m_heap);
+        m_heap = nullptr;
+        m_heapSize = 0;
+
+        m_batches.clear();
+        m_compiledPasses.clear();
+        m_compiledResources.clear();
+        m_compiled = false;
+    }
+
+    inline result render_graph::compile()
+    {
+        if (m_device == nullptr)
+            return result::ErrorInvalidUsage;
+
+        result r = validate();
+        if (r != result::Success)
+            return r;
+
+        if (matchesCompiledShape())
+            return result::Success;
+
+        r = wait();
+        if (r != result::Success)
+            return r;
+
+        releaseCompiled();
+
+        const size_t numPasses = m_passes.size();
+        const size_t numResources = m_resources.size();
+
+        std::vector<queue_type> passQueues(numPasses);
+        for (size_t p = 0; p < numPasses; p++)
+            passQueues[p] = queueFor(m_passes[p].type);
+
+        // Transient resources are always Exclusive, the ownership of Exclusive resources is transferred whenever they're used on another queue
+        std::vector<bool> exclusive(numResources);
+        for (size_t res = 0; res < numResources; res++)
+            exclusive[res] = m_resources[res].imported == nullptr || m_resources[res].desc.sharingMode == resource_sharing_mode::Exclusive;
+
+        // Dependencies follow the order in which the passes were declared.
+        // An access is exclusive if it writes, if it changes the resource's state, if it transfers the resource's ownership, or if it's the first use of the resource,
+        // exclusive accesses depend on every access before them, other accesses only depend on the last exclusive access.
+        std::vector<std::vector<uint32_t>> successors(numPasses);
+        {
+            std::vector<uint32_t> lastExclusive(numResources, noIndex);
+            std::vector<std::vector<uint32_t>> readers(numResources);
+            std::vector<resource_state> groupStates(numResources, resource_state::General);
+            std::vector<queue_type> groupQueues(numResources, queue_type::Graphics);
+
+            for (uint32_t p = 0; p < numPasses; p++)
+            {
+                for (const auto& access : m_passes[p].accesses)
+                {
+                    const uint32_t res = access.resource;
+                    const resource_state state = effectiveState(m_passes[p], access);
+                    const bool transfer = exclusive[res] && passQueues[p] != groupQueues[res];
+                    const bool exclusiveAccess = access.write || lastExclusive[res] == noIndex || state != groupStates[res] || transfer;
+
+                    if (lastExclusive[res] != noIndex)
+                        successors[lastExclusive[res]].push_back(p);
+
+                    if (exclusiveAccess)
+                    {
+                        for (auto reader : readers[res])
+                            successors[reader].push_back(p);
+
+                        readers[res].clear();
+                        lastExclusive[res] = p;
+                        groupStates[res] = state;
+                        groupQueues[res] = passQueues[p];
+                    }
+                    else
+                    {
+                        readers[res].push_back(p);
+                    }
+                }
+            }
+        }
+
+        std::vector<uint32_t> inDegree(numPasses, 0);
+        for (auto& s : successors)
+        {
+            std::sort(s.begin(), s.end());
+            s.erase(std::unique(s.begin(), s.end()), s.end());
+            for (auto successor : s)
+                inDegree[successor]++;
+        }
+
+        // Order the passes topologically. Of the passes that are ready, passes on the same queue as the previously scheduled pass are preferred,
+        // so that independent passes on the same queue end up in the same batch.
+        std::vector<uint32_t> order;
+        order.reserve(numPasses);
+        {
+            std::vector<uint32_t> ready;
+            for (uint32_t p = 0; p < numPasses; p++)
+            {
+                if (inDegree[p] == 0)
+                    ready.push_back(p);
+            }
+
+            while (!ready.empty())
+            {
+                auto next = std::min_element(ready.begin(), ready.end());
+                if (!order.empty())
+                {
+                    const queue_type previous = passQueues[order.back()];
+                    for (auto it = ready.begin(); it != ready.end(); ++it)
+                    {
+                        if (passQueues[*it] == previous && (passQueues[*next] != previous || *it < *next))
+                            next = it;
+                    }
+                }
+
+                const uint32_t p = *next;
+                ready.erase(next);
+                order.push_back(p);
+
+                for (auto successor : successors[p])
+                {
+                    if (--inDegree[successor] == 0)
+                        ready.push_back(successor);
+                }
+            }
+        }
+
+        // The users of each resource in the order in which they're executed, and the state that each transient resource is created in.
+        // Transient resources are created in the state of their last use, so that they're in the same state at the start of every execution.
+        std::vector<std::vector<uint32_t>> users(numResources);
+        std::vector<resource_state> createStates(numResources, resource_state::General);
+        for (auto p : order)
+        {
+            for (const auto& access : m_passes[p].accesses)
+            {
+                users[access.resource].push_back(p);
+                createStates[access.resource] = effectiveState(m_passes[p], access);
+            }
+        }
+
+        // Exclusive imported resources are owned by the Graphics queue at the start of an execution.
+        // If one of them is first used on another queue, the execution starts with a Graphics batch that releases it.
+        bool releaseFirst = false;
+        for (uint32_t res = 0; res < numResources; res++)
+            releaseFirst |= m_resources[res].imported != nullptr && exclusive[res] && !users[res].empty() && passQueues[users[res].front()] != queue_type::Graphics;
+
+        if (releaseFirst)
+            m_batches.push_back(batch { queue_type::Graphics, {}, {}, {}, {}, {}, nullptr });
+
+        // Consecutive passes on the same queue form a batch
+        std::vector<uint32_t> passBatch(numPasses, noIndex);
+        std::vector<uint32_t> passPosition(numPasses, noIndex);
+        for (uint32_t i = 0; i < order.size(); i++)
+        {
+            const uint32_t p = order[i];
+            if (m_batches.empty() || m_batches.back().queue != passQueues[p])
+                m_batches.push_back(batch { passQueues[p], {}, {}, {}, {}, {}, nullptr });
+
+            passBatch[p] = static_cast<uint32_t>(m_batches.size() - 1);
+            passPosition[p] = i;
+            m_batches.back().passes.push_back(p);
+            m_batches.back().barriers.emplace_back();
+        }
+
+        // The last batch runs on the Graphics queue and waits for every other queue,
+        // so that the Fence covers the entire execution and imported resources can be returned to their state from any state.
+        if (!m_batches.empty() && m_batches.back().queue != queue_type::Graphics)
+            m_batches.push_back(batch { queue_type::Graphics, {}, {}, {}, {}, {}, nullptr });
+
+        const size_t numBatches = m_batches.size();
+        constexpr size_t numQueueTypes = static_cast<size_t>(queue_type::MaxEnum) + 1;
+
+        // Each batch waits on the last batch of every other queue that it depends on, earlier work on that queue is implied by the queue's submission order
+        std::vector<std::array<uint32_t, numQueueTypes>> waits(numBatches);
+        for (auto& w : waits)
+            w.fill(noIndex);
+
+        auto addWait = [&](uint32_t waiter, uint32_t signaler)
+        {
+            const size_t queue = static_cast<size_t>(m_batches[signaler].queue);
+            if (m_batches[waiter].queue != m_batches[signaler].queue && (waits[waiter][queue] == noIndex || waits[waiter][queue] < signaler))
+                waits[waiter][queue] = signaler;
+        };
+
+        for (uint32_t p = 0; p < numPasses; p++)
+        {
+            for (auto successor : successors[p])
+                addWait(passBatch[successor], passBatch[p]);
+        }
+
+        for (uint32_t b = 0; b + 1 < numBatches; b++)
+            addWait(static_cast<uint32_t>(numBatches - 1), b);
+
+        if (releaseFirst)
+        {
+            for (uint32_t res = 0; res < numResources; res++)
+            {
+                if (m_resources[res].imported != nullptr && exclusive[res] && !users[res].empty())
+                    addWait(passBatch[users[res].front()], 0);
+            }
+        }
+
+        // predecessors[b] holds every batch that is guaranteed to complete before batch b starts
+        std::vector<std::vector<bool>> predecessors(numBatches, std::vector<bool>(numBatches, false));
+        {
+            std::array<uint32_t, numQueueTypes> lastOnQueue;
+            lastOnQueue.fill(noIndex);
+
+            for (uint32_t b = 0; b < numBatches; b++)
+            {
+                auto inherit = [&](uint32_t from)
+                {
+                    predecessors[b][from] = true;
+                    for (size_t i = 0; i < numBatches; i++)
+                    {
+                        if (predecessors[from][i])
+                            predecessors[b][i] = true;
+                    }
+                };
+
+                const size_t queue = static_cast<size_t>(m_batches[b].queue);
+                if (lastOnQueue[queue] != noIndex)
+                    inherit(lastOnQueue[queue]);
+
+                for (auto signaler : waits[b])
+                {
+                    if (signaler != noIndex)
+                        inherit(signaler);
+                }
+
+                lastOnQueue[queue] = b;
+            }
+        }
+
+        auto happensBefore = [&](uint32_t a, uint32_t b)
+        {
+            return passBatch[a] == passBatch[b] ? passPosition[a] < passPosition[b] : predecessors[passBatch[b]][passBatch[a]];
+        };
+
+        // Place the transient resources in the heap, in the order of their first use.
+        // Two transient resources may share memory if every use of one happens before every use of the other.
+        struct placement
+        {
+            uint32_t resource;
+            uint64_t offset;
+            uint64_t size;
+        };
+        std::vector<placement> placements;
+        std::vector<uint32_t> aliasBefore(numResources, noIndex);
+        std::vector<bool> aliased(numResources, false);
+
+        std::vector<uint32_t> transients;
+        for (uint32_t res = 0; res < numResources; res++)
+        {
+            if (m_resources[res].imported == nullptr && !users[res].empty())
+                transients.push_back(res);
+        }
+        std::sort(transients.begin(), transients.end(), [&](uint32_t a, uint32_t b) { return passPosition[users[a].front()] < passPosition[users[b].front()]; });
+
+        auto allBefore = [&](uint32_t a, uint32_t b)
+        {
+            for (auto userA : users[a])
+            {
+                for (auto userB : users[b])
+                {
+                    if (!happensBefore(userA, userB))
+                        return false;
+                }
+            }
+            return true;
+        };
+
+        std::vector<resource_desc> transientDescs(numResources);
+        for (auto res : transients)
+        {
+            resource_desc desc = m_resources[res].desc;
+            desc.createNodeMask = m_desc.nodeMask;
+            desc.visibleNodeMask = m_desc.nodeMask;
+            desc.initialState = createStates[res];
+            desc.sharingMode = resource_sharing_mode::Exclusive;
+            transientDescs[res] = desc;
+
+            resource_allocation_info info {};
+            r = m_device->queryResourceAllocationInfo(desc, &info);
+            if (r != result::Success)
+            {
+                releaseCompiled();
+                return r;
+            }
+
+            uint64_t offset = 0;
+            for (bool moved = true; moved;)
+            {
+                moved = false;
+                for (const auto& other : placements)
+                {
+                    const bool overlaps = offset < other.offset + other.size && other.offset < offset + info.size;
+                    if (overlaps && !allBefore(other.resource, res) && !allBefore(res, other.resource))
+                    {
+                        offset = detail::alignUp(other.offset + other.size, info.alignment);
+                        moved = true;
+                    }
+                }
+            }
+
+            uint32_t overlapping = 0;
+            for (const auto& other : placements)
+            {
+                if (offset < other.offset + other.size && other.offset < offset + info.size)
+                {
+                    aliased[other.resource] = true;
+                    aliasBefore[res] = other.resource;
+                    overlapping++;
+                }
+            }
+
+            // the previous user of the memory is only known if exactly one other resource overlaps with it
+            if (overlapping > 0)
+                aliased[res] = true;
+            if (overlapping != 1)
+                aliasBefore[res] = noIndex;
+
+            placements.push_back(placement { res, offset, info.size });
+            m_heapSize = std::max(m_heapSize, offset + info.size);
+        }
+
+        m_transients.resize(numResources, nullptr);
+        if (m_heapSize > 0)
+        {
+            r = m_device->createMemoryHeap(memory_heap_desc { m_desc.nodeMask, m_desc.nodeMask, m_heapSize, memory_type::Local }, &m_heap);
+            if (r != result::Success)
+            {
+                releaseCompiled();
+                return r;
+            }
+
+            for (const auto& p : placements)
+            {
+                r = m_device->createPlacedResource(m_heap, p.offset, transientDescs[p.resource], &m_transients[p.resource]);
+                if (r != result::Success)
+                {
+                    releaseCompiled();
+                    return r;
+                }
+            }
+        }
+
+        // Derive the barriers by following each resource's state and owner through the execution order.
+        // A state change between two queues is recorded on the more capable of the two queues (Graphics > Compute > Transfer),
+        // either at the end of the batch that last used the resource, or before the pass that uses it next.
+        // Exclusive resources are released at the end of the batch that last used them and acquired before the pass that uses them next.
+        struct tracked_state
+        {
+            bool used = false;
+            resource_state state = resource_state::General;
+            queue_type groupQueue = queue_type::Graphics;
+            bool singleQueue = true;
+            uint32_t groupBatch = noIndex;
+            queue_type lastQueue = queue_type::Graphics;
+            bool lastWrite = false;
+        };
+        std::vector<tracked_state> states(numResources);
+
+        for (auto p : order)
+        {
+            const uint32_t b = passBatch[p];
+            const queue_type queue = passQueues[p];
+            auto& barriers = m_batches[b].barriers[passPosition[p] - passPosition[m_batches[b].passes.front()]];
+
+            for (const auto& access : m_passes[p].accesses)
+            {
+                const uint32_t res = access.resource;
+                const resource_state state = effectiveState(m_passes[p], access);
+                tracked_state& tracked = states[res];
+
+                // transient resources take ownership without a transfer on their first use, because their contents are undefined
+                bool owned = tracked.used;
+                if (!tracked.used)
+                {
+                    const bool imported = m_resources[res].imported != nullptr;
+                    tracked.state = imported ? m_resources[res].state : createStates[res];
+                    tracked.groupQueue = queue_type::Graphics;
+                    tracked.groupBatch = 0;
+                    owned = imported;
+
+                    // placed textures are initialized by an aliasing barrier before their first use, even if they don't share their memory
+                    if (!imported && (aliased[res] || transientDescs[res].type != resource_type::Buffer))
+                        barriers.push_back(barrier { resource_barrier_type::Aliasing, res, aliasBefore[res], tracked.state, tracked.state });
+                }
+
+                if (owned && exclusive[res] && tracked.groupQueue != queue)
+                {
+                    auto& release = m_batches[tracked.groupBatch].release;
+                    if (state != tracked.state && tracked.groupQueue < queue)
+                    {
+                        release.push_back(barrier { resource_barrier_type::Transition, res, noIndex, tracked.state, state });
+                        tracked.state = state;
+                    }
+
+                    release.push_back(barrier { resource_barrier_type::Release, res, noIndex, tracked.state, tracked.state, tracked.groupQueue, queue });
+                    barriers.push_back(barrier { resource_barrier_type::Acquire, res, noIndex, tracked.state, tracked.state, tracked.groupQueue, queue });
+
+                    if (state != tracked.state)
+                    {
+                        barriers.push_back(barrier { resource_barrier_type::Transition, res, noIndex, tracked.state, state });
+                        tracked.state = state;
+                    }
+
+                    tracked.groupQueue = queue;
+                    tracked.singleQueue = true;
+                }
+                else if (state != tracked.state)
+                {
+                    const barrier transition { resource_barrier_type::Transition, res, noIndex, tracked.state, state };
+                    if (tracked.used && tracked.singleQueue && tracked.groupQueue != queue && tracked.groupQueue < queue)
+                        m_batches[tracked.groupBatch].release.push_back(transition);
+                    else
+                        barriers.push_back(transition);
+
+                    tracked.state = state;
+                    tracked.groupQueue = queue;
+                    tracked.singleQueue = true;
+                }
+                else if (!tracked.used)
+                {
+                    tracked.groupQueue = queue;
+                    tracked.singleQueue = true;
+                }
+                else
+                {
+                    if (state == resource_state::ShaderReadWrite && (access.write || tracked.lastWrite) && tracked.lastQueue == queue)
+                        barriers.push_back(barrier { resource_barrier_type::ReadWrite, res, noIndex, state, state });
+
+                    if (tracked.groupQueue != queue)
+                        tracked.singleQueue = false;
+                }
+
+                tracked.used = true;
+                tracked.groupBatch = b;
+                tracked.lastQueue = queue;
+                tracked.lastWrite = access.write;
+            }
+        }
+
+        // Imported resources are returned to their state, and Exclusive imported resources to the Graphics queue, by the last batch
+        for (uint32_t res = 0; res < numResources; res++)
+        {
+            const tracked_state& tracked = states[res];
+            if (m_resources[res].imported == nullptr || !tracked.used)
+                continue;
+
+            if (exclusive[res] && tracked.groupQueue != queue_type::Graphics)
+            {
+                m_batches[tracked.groupBatch].release.push_back(barrier { resource_barrier_type::Release, res, noIndex, tracked.state, tracked.state, tracked.groupQueue, queue_type::Graphics });
+                m_batches.back().release.push_back(barrier { resource_barrier_type::Acquire, res, noIndex, tracked.state, tracked.state, tracked.groupQueue, queue_type::Graphics });
+            }
+
+            if (tracked.state != m_resources[res].state)
+                m_batches.back().release.push_back(barrier { resource_barrier_type::Transition, res, noIndex, tracked.state, m_resources[res].state });
+        }
+
+        // Create the synchronization and CommandLists of each batch
+        for (uint32_t b = 0; b < numBatches; b++)
+        {
+            for (auto signaler : waits[b])
+            {
+                if (signaler == noIndex)
+                    continue;
+
+                Semaphore* semaphore;
+                r = m_device->createSemaphore(&semaphore);
+                if (r != result::Success)
+                {
+                    releaseCompiled();
+                    return r;
+                }
+
+                m_semaphores.push_back(semaphore);
+                m_batches[signaler].signalSemaphores.push_back(semaphore);
+                m_batches[b].waitSemaphores.push_back(semaphore);
+            }
+
+            CommandGroup*& group = m_commandGroups[static_cast<size_t>(m_batches[b].queue)];
+            if (group == nullptr)
+            {
+                r = m_device->createCommandGroup(m_batches[b].queue, &group);
+                if (r != result::Success)
+                {
+                    releaseCompiled();
+                    return r;
+                }
+            }
+
+            r = group->allocate(command_list_alloc_desc { m_desc.nodeMask, command_list_usage::Direct }, &m_batches[b].commandList);
+            if (r != result::Success)
+            {
+                releaseCompiled();
+                return r;
+            }
+        }
+
+        m_compiledPasses = m_passes;
+        m_compiledResources = m_resources;
+        m_compiled = true;
+        m_compileCount++;
+        return result::Success;
+    }
+
+    inline result render_graph::execute()
+    {
+        result r = compile();
+        if (r != result::Success)
+            return r;
+
+        if (m_batches.empty())
+            return result::Success;
+
+        r = wait();
+        if (r != result::Success)
+            return r;
+
+        for (auto* group : m_commandGroups)
+        {
+            if (group == nullptr)
+                continue;
+
+            r = group->reset();
+            if (r != result::Success)
+                return r;
+        }
+
+        auto recordBarriers = [this](CommandList* list, const std::vector<barrier>& barriers)
+        {
+            if (barriers.empty())
+                return result::Success;
+
+            m_scratchBarriers.clear();
+            for (const auto& b : barriers)
+            {
+                Resource* resource = getResource(render_graph_resource { b.resource });
+                switch (b.type)
+                {
+                    case resource_barrier_type::ReadWrite:
+                        m_scratchBarriers.push_back(resource_barrier::read_write(resource));
+                        break;
+                    case resource_barrier_type::Transition:
+                        m_scratchBarriers.push_back(resource_barrier::transition(resource, b.oldState, b.newState));
+                        break;
+                    case resource_barrier_type::Aliasing:
+                        m_scratchBarriers.push_back(resource_barrier::aliasing(getResource(render_graph_resource { b.before }), resource, b.newState));
+                        break;
+                    case resource_barrier_type::Release:
+                        m_scratchBarriers.push_back(resource_barrier::release(resource, b.newState, b.srcQueue, b.dstQueue));
+                        break;
+                    case resource_barrier_type::Acquire:
+                        m_scratchBarriers.push_back(resource_barrier::acquire(resource, b.newState, b.srcQueue, b.dstQueue));
+                        break;
+                }
+            }
+
+            return list->resourceBarrier(static_cast<uint32_t>(m_scratchBarriers.size()), m_scratchBarriers.data());
+        };
+
+        for (auto& b : m_batches)
+        {
+            r = b.commandList->begin(command_list_begin_desc {});
+            if (r != result::Success)
+                return r;
+
+            for (size_t i = 0; i < b.passes.size() && r == result::Success; i++)
+            {
+                r = recordBarriers(b.commandList, b.barriers[i]);
+
+                const auto& record = m_passes[b.passes[i]].record;
+                if (r == result::Success && record)
+                    record(b.commandList);
+            }
+
+            if (r == result::Success)
+                r = recordBarriers(b.commandList, b.release);
+
+            const result endResult = b.commandList->end();
+            if (r != result::Success)
+                return r;
+            if (endResult != result::Success)
+                return endResult;
+        }
+
+        for (size_t i = 0; i < m_batches.size(); i++)
+        {
+            batch& b = m_batches[i];
+            const bool last = i == m_batches.size() - 1;
+
+            const submit_desc desc {
+                m_desc.nodeMask,
+                1, &b.commandList,
+                static_cast<uint32_t>(b.waitSemaphores.size()), b.waitSemaphores.data(),
+                static_cast<uint32_t>(b.signalSemaphores.size()), b.signalSemaphores.data(),
+                last ? m_fence : nullptr
+            };
+
+            r = m_queues[static_cast<size_t>(b.queue)]->submit(desc);
+            if (r != result::Success)
+                return r;
+        }
+
+        m_inFlight = true;
+        return result::Success;
+    }
+
+    inline result render_graph::wait()
+    {
+        if (!m_inFlight)
+            return result::Success;
+
+        const result r = m_device->waitFence(m_fence, LLRI_TIMEOUT_MAX);
+        if (r == result::Success)
+            m_inFlight = false;
+
+        return r;
+    }
+}
@@ -0,0 +1,978 @@
+/**
+ * @file resource.hpp
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+#include <llri/llri.hpp> // unnecessary but helps intellisense
+
+namespace llri
+{
+    enum struct external_memory_handle_type_ext : uint8_t;
+
+    /**
+     * @brief Describes a range of subresources of a texture.
+     */
+    struct texture_subresource_range
+    {
+        /**
+         * @brief The first mip level, 0-indexed.
+         *
+         * @note Valid usage (ErrorInvalidUsage): **Must** be less than resource_desc::mipLevels.
+         */
+        uint32_t baseMipLevel;
+        /**
+         * @brief The number of mip levels.
+         *
+         * @note Valid usage (ErrorInvalidUsage): **Must** be at least 1.
+         * @note Valid usage (ErrorInvalidUsage): (baseMipLevel + numMipLevels) **must not** be more than  resource_desc::mipLevels.
+         */
+        uint32_t numMipLevels;
+        /**
+         * @brief The first array layer, 0-indexed.
+         *
+         * @note Valid usage (ErrorInvalidUsage): **Must** be less than resource_desc::depthOrArrayLayers.
+         * @note Valid usage (ErrorInvalidUsage): If resource_desc::type is Texture3D then this value **must** be 0.
+         */
+        uint32_t baseArrayLayer;
+        /**
+         * @brief The number of array layers.
+         *
+         * @note Valid usage (ErrorInvalidUsage): **Must** be at least 1, unless if resource_desc::type is Texture3D, then it **must** be 1.
+         * @note Valid usage (ErrorInvalidUsage): (baseArrayLayer + numArrayLayers) **must not** be more than resource_desc::depthOrArrayLayers.
+         */
+        uint32_t numArrayLayers;
+        
+        /**
+         * @brief texture_subresource_range with a pre-set value that will be interpreted as "all subresources of the texture".
+         *
+         * @note The values returned aren't defined in the public API and **may** be subject to change. A user **must not** try to reconstruct the result themselves because there's no guarantee that it'll work in the future.
+         */
+        static texture_subresource_range all()
+        {
+            return texture_subresource_range {
+                std::numeric_limits<uint32_t>::max(),
+                std::numeric_limits<uint32_t>::max(),
+                std::numeric_limits<uint32_t>::max(),
+                std::numeric_limits<uint32_t>::max()                
+            };
+        }
+        
+        inline bool operator==(const texture_subresource_range& other) const {
+            return baseMipLevel == other.baseMipLevel &&
+                numMipLevels == other.numMipLevels &&
+                baseArrayLayer == other.baseArrayLayer &&
+                numArrayLayers == other.numArrayLayers;
+        }
+        
+        inline bool operator!=(const texture_subresource_range& other) const {
+            return !((*this) == other);
+        }
+    };
+
+    /**
+     * @brief Describes the current state of a Resource. Resources are assigned a state upon creation using the resource_desc::initialState field. Afterwards they can transition to other states using resource barriers.
+    */
+    enum struct resource_state : uint8_t
+    {
+        /**
+         * @brief All types of device access are allowed in this state, but it is not as optimal as more explicit states.
+         *
+         * A resource **must** be in this state if it wishes to be used by a Transfer Queue. The exception are resources in memory_type::Upload, which stay in resource_state::Upload and **may** be copied from on a Transfer Queue in that state.
+        */
+        General,
+        /**
+         * @brief The resource can be mapped and data can be written to it from the CPU.
+         *
+         * @note Valid usage (ErrorInvalidState): Creating a resource in this state **requires** the resource to have been created with memory_type::Upload.
+         * @note Valid usage (ErrorInvalidState): Creating a resource in this state **requires** the resource to have been created without resource_usage_flag_bits::ShaderWrite.
+        */
+        Upload,
+        /**
+         * @brief The texture is used as a color attachment, meaning it can be written to by the fixed graphics pipeline.
+         *
+         * @note Valid usage (ErrorInvalidState): Creating or transitioning a resource to this state **requires** the resource to be of resource_type Texture1D, Texture2D, or Texture3D.
+         * @note Valid usage (ErrorInvalidState): Creating or transitioning a resource to this state **requires** the resource to have been created with resource_usage_flag_bits::ColorAttachment.
+        */
+        ColorAttachment,
+        /**
+         * @brief The texture is used as a depth stencil attachment, allowing both read and write access from the fixed graphics pipeline.
+         *
+         * @note Valid usage (ErrorInvalidState): Creating or transitioning a resource to this state **requires** the resource to be of resource_type Texture1D, Texture2D, or Texture3D.
+         * @note Valid usage (ErrorInvalidState): Creating or transitioning a resource to this state **requires** the resource to have been created with resource_usage_flag_bits::DepthStencilAttachment.
+        */
+        DepthStencilAttachment,
+        /**
+         * @brief The texture is used as a depth stencil attachment, but only allows read operations from the fixed graphics pipeline.
+         *
+         * @note Valid usage (ErrorInvalidState): Creating or transitioning a resource to this state **requires** the resource to be of resource_type Texture1D, Texture2D, or Texture3D.
+         * @note Valid usage (ErrorInvalidState): Creating or transitioning a resource to this state **requires** the resource to have been created with resource_usage_flag_bits::DepthStencilAttachment.
+        */
+        DepthStencilAttachmentReadOnly,
+        /**
+         * @brief The resource is used as a read-only resource from shaders.
+         *
+         * @note Valid usage (ErrorInvalidState): Creating or transitioning a texture to this state **requires** the texture to have been created with resource_usage_flag_bits::Sampled.
+        */
+        ShaderReadOnly,
+        /**
+         * @brief The resource is used as a read-write resource from shaders.
+         *
+         * Note that if a read-write resource is used in multiple consecutive passes/dispatches without transition then a resource barrier should be used to prevent simultaneous read/writes.
+         *
+         * @note Valid usage (ErrorInvalidState): Creating or transitioning a resource to this state **requires** the resource to have been created with resource_usage_flag_bits::ShaderWrite.
+        */
+        ShaderReadWrite,
+        /**
+         * @brief The resource is used as the source of a transfer operation.
+         *
+         * @note Valid usage (ErrorInvalidState): Creating or transitioning a resource to this state **requires** the resource to have been created with resource_usage_flag_bits::TransfersSrc.
+        */
+        TransferSrc,
+        /**
+         * @brief The resource is used as the destination of a transfer operation.
+         *
+         * @note Valid usage (ErrorInvalidState): Creating or transitioning a resource to this state **requires** the resource to have been created with resource_usage_flag_bits::TransferDst.
+        */
+        TransferDst,
+        /**
+         * @brief The resource is used as a vertex buffer.
+         *
+         * @note Valid usage (ErrorInvalidState): Creating or transitioning a resource to this state **requires** the resource to be of resource_type Buffer.
+        */
+        VertexBuffer,
+        /**
+         * @brief The resource is used as an index buffer.
+         *
+         * @note Valid usage (ErrorInvalidState): Creating or transitioning a resource to this state **requires** the resource to be of resource_type Buffer.
+        */
+        IndexBuffer,
+        /**
+         * @brief The resource is used as a constant buffer.
+         *
+         * @note Valid usage (ErrorInvalidState): Creating or transitioning a resource to this state **requires** the resource to be of resource_type Buffer.
+        */
+        ConstantBuffer,
+        /**
+         * @brief The highest value in this enum.
+        */
+        MaxEnum = ConstantBuffer
+    };
+    
+    /**
+     * @brief Converts a resource_state to a string.
+     * @return The enum value as a string, or "Invalid resource_state value" if the value was not recognized as an enum member.
+    */
+    std::string to_string(resource_state state);
+
+    /**
+     * @brief The type of resource. This determines how the memory for the resource is allocated and how the resource can be used.
+    */
+    enum struct resource_type : uint8_t
+    {
+        /**
+         * @brief A one-dimensional unformatted chunk of data. Buffers can't be sampled like textures, but they can be read from or written to.
+        */
+        Buffer,
+        /**
+         * @brief A one-dimensional texture. 1D textures only have a width, which is equivalent to the number of texels in the 1D texture. The size of the texels may vary per texture, depending on the texture's format.
+        */
+        Texture1D,
+        /**
+         * @brief A two-dimensional textures. 2D textures are described by a width and height, their size is equivalent to width * height * texel size. The size of the texels may vary per texture, depending on the texture's format.
+        */
+        Texture2D,
+        /**
+         * @brief A three-dimensional texture. 3D textures are described by a width, height, and depth, their size is equivalent to width * height * depth * texel size. The size of the texels may vary per texture, depending on the texture's format.
+         *
+         * 3D textures can not be arrays.
+        */
+        Texture3D,
+        /**
+         * @brief The highest value in this enum.
+        */
+        MaxEnum = Texture3D
+    };
+
+    /**
+     * @brief Converts a resource_type to a string.
+     * @return The enum value as a string, or "Invalid resource_type value" if the value was not recognized as an enum member.
+    */
+    std::string to_string(resource_type type);
+
+    /**
+     * @brief Describes the contents of a single texel in a texture.
+     *
+     * All enum values follow the same naming format.
+     *
+     * - Components: The components of the format are described by R, G, B, and A (red, green, blue, alpha respectively). The order of the components in the format describe the order in which they are stored. Some formats contain the D and S components, which stand for Depth and Stencil. If the format has an "X" component, the bits described may be allocated but will be unused.
+     * - Size: Components are usually directly followed by their respective size in bits. If consecutive components are the same size, their size can be found after the last consecutive component instead. The size of a texel is the combined size of each component, meaning R8G8B8A8 has 4 8-bit components, meaning the texel is of size 32.
+     * - Modifiers: The type of all of the components in the texel is defined at the end of each format name. The names mean the following:
+     *  - UNorm: unsigned normalized integer. Interpreted in the resource as an unsigned integer, but in shaders it is interpreted as a floating point value in the range [0, 1].
+     *  - Norm: signed normalized integer. Interpreted in the resource as a signed integer, but in shaders it is interpreted as a floating point value in the range [-1, 1].
+     *  - UInt: unsigned integer.
+     *  - Int: signed integer.
+     *  - Float: signed float.
+     *  - sRGB: unsigned normalized data with sRGB nonlinear encoding.
+    */
+    enum struct format : uint8_t
+    {
+        Undefined,
+
+        R8UNorm,
+        R8Norm,
+        R8UInt,
+        R8Int,
+
+        RG8UNorm,
+        RG8Norm,
+        RG8UInt,
+        RG8Int,
+
+        RGBA8UNorm,
+        RGBA8Norm,
+        RGBA8UInt,
+        RGBA8Int,
+        RGBA8sRGB,
+
+        BGRA8UNorm,
+        BGRA8sRGB,
+
+        RGB10A2UNorm,
+        RGB10A2UInt,
+
+        R16UNorm,
+        R16Norm,
+        R16UInt,
+        R16Int,
+        R16Float,
+
+        RG16UNorm,
+        RG16Norm,
+        RG16UInt,
+        RG16Int,
+        RG16Float,
+
+        RGBA16UNorm,
+        RGBA16Norm,
+        RGBA16UInt,
+        RGBA16Int,
+        RGBA16Float,
+
+        R32UInt,
+        R32Int,
+        R32Float,
+
+        RG32UInt,
+        RG32Int,
+        RG32Float,
+
+        RGB32UInt,
+        RGB32Int,
+        RGB32Float,
+
+        RGBA32UInt,
+        RGBA32Int,
+        RGBA32Float,
+
+        D16UNorm,
+        D32Float,
+        D24UNormS8UInt,
+        D32FloatS8X24UInt,
+        
+        /**
+         * @brief The first color format (inclusive).
+         */
+        FirstColorFormat = R8UNorm,
+        /**
+         * @brief The last color format (inclusive).
+         */
+        LastColorFormat = RGBA32Float,
+        /**
+         * @brief The first depth format (inclusive).
+         */
+        FirstDepthFormat = D16UNorm,
+        /**
+         * @brief The first combined depth stencil format (inclusive).
+         */
+        FirstStencilFormat = D24UNormS8UInt,
+        /**
+         * @brief The last combined depth stencil format (inclusive).
+         */
+        LastDepthStencilFormat = D32FloatS8X24UInt,
+        
+        /**
+         * @brief The highest value in this enum.
+        */
+        MaxEnum = D32FloatS8X24UInt
+    };
+
+    inline bool has_color_component(format f) {
+        return f >= format::FirstColorFormat && f <= format::LastColorFormat;
+    }
+
+    inline bool has_depth_component(format f) {
+        return f >= format::FirstDepthFormat && f <= format::LastDepthStencilFormat;
+    }
+
+    inline bool has_stencil_component(format f) {
+        return f >= format::FirstStencilFormat && f <= format::LastDepthStencilFormat;
+    }
+
+    /**
+     * @brief The size of a single texel of the format in bytes. This is the size that a texel takes up in a buffer when a texture is copied to or from it.
+     * @return The texel size in bytes, or 0 for format::Undefined and values that are not recognized as an enum member.
+    */
+    inline uint32_t format_size(format f);
+
+    /**
+     * @brief Converts a format to a string.
+     * @return The enum value as a string, or "Invalid format value" if the value was not recognized as an enum member.
+    */
+    std::string to_string(format f);
+
+    /**
+     * @brief Multi-sampling - the number of samples per pixel.
+    */
+    enum struct sample_count : uint8_t
+    {
+        Count1 = 1,
+        Count2 = 2,
+        Count4 = 4,
+        Count8 = 8,
+        Count16 = 16,
+        Count32 = 32,
+        /**
+         * @brief The highest value in this enum.
+        */
+        MaxEnum = Count32
+    };
+
+    /**
+     * @brief Converts a texture_sample_count to a string.
+     * @return The enum value as a string, or "Invalid sample_count value" if the value was not recognized as an enum member.
+    */
+    std::string to_string(sample_count count);
+
+    /**
+     * @brief Flag bits that describe how the resource will be allowed to be used. Each bit describes an enabled (or explicitly disabled) usage.
+    */
+    enum struct resource_usage_flag_bits : uint16_t
+    {
+        /**
+         * @brief Default resource usage.
+        */
+        None = 0,
+        /**
+         * @brief The resource is allowed to be copied from.
+        */
+        TransferSrc = 1 << 0,
+        /**
+         * @brief The resource is allowed to be copied to.
+        */
+        TransferDst = 1 << 1,
+        /**
+         * @brief If the resource is a texture, enabling this flag allows the texture to be sampled from.
+        */
+        Sampled = 1 << 2,
+        /**
+         * @brief The resource is allowed be written to from within a shader.
+        */
+        ShaderWrite = 1 << 3,
+        /**
+         * @brief The resource is allowed to be used as a color attachment.
+        */
+        ColorAttachment = 1 << 4,
+        /**
+         * @brief The resource is allowed to be used as a depth stencil attachment
+        */
+        DepthStencilAttachment = 1 << 5,
+        /**
+         * @brief The resource is not allowed to be used in a programmable shader.
+         *
+         * On some implementations, enabling this flag **may** increase bandwidth for depth stencil textures. Applications should set this flag for depth stencil textures if they are never accessed by programmable shaders.
+         *
+         * @note This flag bit is only valid in combination with the DepthStencilAttachment bit.
+        */
+        DenyShaderResource = 1 << 6,
+        /**
+         * @brief All flags combined. Not usually a supported usage set, but is occasionally used for validation and unit tests.
+         */
+        All = TransferSrc | TransferDst | Sampled | ShaderWrite | ColorAttachment | DepthStencilAttachment | DenyShaderResource
+    };
+    LLRI_DEFINE_FLAG_BIT_OPERATORS(resource_usage_flag_bits)
+    
+    /**
+     * @brief Converts a resource_usage_flag_bits to a string.
+     * @return The enum value as a string, or "Invalid resource_usage_flag_bits value" if the value was not recognized as an enum member.
+    */
+    std::string to_string(resource_usage_flag_bits bits);
+
+    /**
+     * @brief Describes how the resource will be allowed to be used. Only enable flags that apply to your usage. Enabling flags unnecessarily may result in fewer driver optimizations.
+    */
+    using resource_usage_flags = flags<resource_usage_flag_bits>;
+
+    /**
+     * @brief Converts resource_usage_flags to a string.
+     * @return The flags as a string, or "Invalid resource_usage_flags value" if the value was not recognized as a valid combination of resource_usage_flag_bits
+    */
+    std::string to_string(resource_usage_flags flags);
+
+    /**
+     * @brief The type of memory that a resource is allocated with. Different memory types support different operations and may perform better or worse for some operations.
+    */
+    enum struct memory_type : uint8_t
+    {
+        /**
+         * @brief Optimized for device access. Can not be written to or otherwise viewed by the host. It is recommended to use this for all resources that are used frequently (more than once) by the device.
+        */
+        Local,
+        /**
+         * @brief Allows the host to map the resource for writing. Reading is also permitted but is usually much slower than with explicit read resources.
+         *
+         * Device access for upload resources is slower than with Local resources, and for resources used more than once its recommended to copy over to a device local resource.
+         *
+         * Resources with this memory type **must** be created with initialState set to resource_state::Upload.
+        */
+        Upload,
+        /**
+         * @brief allows the host to map the resource for reading.
+         *
+         * Device access for read resources is typically much slower than Local resources, consider copying to the read resource instead of using the resource directly.
+        */
+        Read,
+        /**
+         * @brief The highest value in this enum.
+        */
+        MaxEnum = Read
+    };
+
+    /**
+     * @brief Converts a memory_type to a string.
+     * @return The enum value as a string, or "Invalid memory_type value" if the value was not recognized as an enum member.
+    */
+    std::string to_string(memory_type type);
+
+    /**
+     * @brief Determines whether a resource can be accessed by Queues of different queue_types without transferring its ownership.
+    */
+    enum struct resource_sharing_mode : uint8_t
+    {
+        /**
+         * @brief The resource is owned by a single queue_type at a time. Using it on a Queue of another type requires a resource_barrier::release() on the owning type, followed by a resource_barrier::acquire() on the new type.
+         *
+         * Exclusive resources allow implementations to use optimizations such as compression that concurrent resources may not support.
+         *
+         * A newly created resource is owned by the first queue_type that its Device was created with Queues of, in the order Graphics, Compute, Transfer, because that's where implementations set up its initial state.
+         * Resources that are first used by another queue_type **should** be released from that initial owner. Otherwise their contents are undefined on the new type.
+         *
+         * Vulkan: Textures are transitioned to their initialState on a Queue of the initial owner.
+         * DirectX: Queues don't own resources, so ownership transfers have no effect beyond the Semaphore that orders them.
+        */
+        Exclusive,
+        /**
+         * @brief The resource can be accessed by Queues of all types without ownership transfers, although accesses **must** still be synchronized through Semaphores.
+         *
+         * Concurrent access **may** disable implementation optimizations and thus **should** only be used for resources that switch queue_types frequently.
+        */
+        Concurrent,
+        /**
+         * @brief The highest value in this enum.
+        */
+        MaxEnum = Concurrent
+    };
+
+    /**
+     * @brief Converts a resource_sharing_mode to a string.
+     * @return The enum value as a string, or "Invalid resource_sharing_mode value" if the value was not recognized as an enum member.
+    */
+    std::string to_string(resource_sharing_mode mode);
+
+    /**
+     * @brief Resource description to be used in Device::createResource().
+    */
+    struct resource_desc
+    {
+        /**
+         * @brief The device node on which the resource should be created. Passing 0 is the equivalent of passing 1.
+         *
+         * @note Valid usage (ErrorInvalidNodeMask): Exactly one bit **must** be set, and that bit **must** be less than 1 << Adapter::queryNodeCount().
+        */
+        uint32_t createNodeMask;
+        /**
+         * @brief A mask with the device nodes on which the resource will be visible. Passing 0 is the equivalent of passing 1.
+         *
+         * @note Valid usage (ErrorInvalidNodeMask): At least the same bit as createNodeMask **must** be set.
+         * @note Valid usage (ErrorInvalidNodeMask): Any bits set to 1 in visibleNodeMask **must** be less than 1 << Adapter::queryNodeCount().
+        */
+        uint32_t visibleNodeMask;
+
+        /**
+         * @brief The type of resource.
+         *
+         * @note Valid usage (ErrorInvalidUsage): type **must** be a valid resource_type enum value.
+        */
+        resource_type type;
+        /**
+         * @brief Flags that determine how the resource may be used.
+         *
+         * @note Valid usage (ErrorInvalidUsage): usage **must** be a valid combination of resource_usage_flag_bits.
+         * @note Valid usage (ErrorInvalidUsage): if usage has the DenyShaderResource bit set then it **must** also have the DepthStencilAttachment bit set.
+         * @note Valid usage (ErrorInvalidUsage): if usage has the DenyShaderResource bit set then the only other compatible bits are TransferSrc, TransferDst, and DepthStencilAttachment.
+         * @note Valid usage (ErrorInvalidUsage): if type is Buffer then usage **can only** have the following bits set: TransferSrc, TransferDst, ShaderWrite.
+         * @note Valid usage (ErrorInvalidUsage): if type is not Buffer then all enabled usage flags **must** be supported for the set format. Format resource_usage support can be checked through Adapter::queryFormatProperties(format).
+        */
+        resource_usage_flags usage;
+        /**
+         * @brief The type of memory that the resource is created on / optimized for.
+         *
+         * @note memoryType **must** be a valid resource_memory_type enum value.
+         * @note Valid usage (ErrorInvalidUsage): if type is not Buffer then memoryType **must** be set to Local.
+         * @note Valid usage (ErrorInvalidUsage): if memoryType is set to Upload or Read then usage **must not** have the following bits set: ShaderWrite, ColorAttachment, DepthStencilAttachment, DenyShaderResource.
+         * @note Valid usage (ErrorInvalidUsage): if memoryType is set to Upload then initialState **must** be Upload.
+         * @note Valid usage (ErrorInvalidUsage): if memoryType is set to Read then initialState **must** be TransferDst.
+        */
+        memory_type memoryType;
+        /**
+         * @brief The state in which the resource should be first after allocation.
+         *
+         * @note Valid usage (ErrorInvalidUsage): initialState must be a valid resource_state enum value.
+         * @note Valid usage (ErrorInvalidState): the conditions in the selected resource_state **must** be met.
+        */
+        resource_state initialState;
+
+        /**
+         * @brief The width of the resource. If the resource is a Buffer then this determines the size of the Buffer in bytes. If the resource is a texture then the width is the number of texels on the x axis.
+         *
+         * @note Valid usage (ErrorInvalidUsage): width **must not** be 0.
+         * @note Valid usage (ErrorInvalidUsage): width **must not** be more than 16384.
+        */
+        uint32_t width;
+        /**
+         * @brief The number of texels on the y axis of the texture.
+         *
+         * @note Ignored if type is resource_type::Buffer.
+         * @note Valid usage (ErrorInvalidUsage): height **must not** be 0.
+         * @note Valid usage (ErrorInvalidUsage): height **must not** be more than 16384.
+         * @note Valid usage (ErrorInvalidUsage): if type is resource_type::Texture1D then height **must** be 1.
+         * @note Valid usage (ErrorInvalidUsage): if type is resource_type::Texture3D then height **must not** be more than 2048.
+        */
+        uint32_t height;
+        /**
+         * @brief The number of texels on the z axis of the texture. This either determines the depth of a Texture3D, or the number of array layers for the other Texture types.
+         *
+         * @note Ignored if type is resource_type::Buffer.
+         * @note Valid usage (ErrorInvalidUsage): depthOrArrayLayers **must not** be 0.
+         * @note Valid usage (ErrorInvalidUsage): depthOrArrayLayers **must not** be more than 2048.
+        */
+        uint16_t depthOrArrayLayers;
+        /**
+         * @brief The number of mipmap levels on the texture.
+         *
+         * @note Ignored if type is resource_type::Buffer.
+         * @note Valid usage (ErrorInvalidUsage): mipLevels **must not** be 0.
+         * @note Valid usage (ErrorInvalidUsage): if width is 1 then mipLevels **must** be 1.
+         * @note Valid usage (ErrorInvalidUsage): if mipLevels is more than 1 then width **must** be >= pow(2, mipLevels).
+        */
+        uint16_t mipLevels;
+
+        /**
+         * @brief The number of samples per pixel.
+         *
+         * @note Ignored if type is resource_type::Buffer.
+         * @note Valid usage (ErrorInvalidUsage): sampleCount **must** be a valid texture_sample_count enum value.
+         * @note Valid usage (ErrorInvalidUsage): sampleCount **must** be supported for the format value. Use Adapter::queryFormatProperties().
+         * @note Valid usage (ErrorInvalidUsage): if mipLevels is more than 1 then sampleCount **must** be Count1.
+         * @note Valid usage (ErrorInvalidUsage): if sampleCount is more than Count1 then usage **must** have ColorAttachment and/or DepthStencilAttachment set.
+         * @note Valid usage (ErrorInvalidUsage): if usage has the ShaderWrite bit set then sampleCount **must** be Count1.
+        */
+        sample_count sampleCount;
+        /**
+         * @brief The format of the texture.
+         *
+         * @note Ignored if type is resource_type::Buffer.
+         * @note Valid usage (ErrorInvalidUsage): textureFormat **must** be a valid format enum value.
+         * @note Valid usage (ErrorInvalidUsage): textureFormat **must not** be Undefined.
+         * @note Valid usage (ErrorInvalidUsage): textureFormat **must** be supported. Query support through Adapter::queryFormatProperties().
+         * @note Valid usage (ErrorInvalidUsage): textureFormat **must** support type. Query support for resource types per format using Adapter::queryFormatProperties().
+        */
+        format textureFormat;
+
+        /**
+         * @brief Whether Queues of different queue_types can access the resource without ownership transfers.
+         *
+         * @note Valid usage (ErrorInvalidUsage): sharingMode **must** be a valid resource_sharing_mode enum value.
+        */
+        resource_sharing_mode sharingMode;
+
+        /**
+         * @brief Convenience function for creating a buffer resource_desc.
+        */
+        static constexpr resource_desc buffer(resource_usage_flags usage, memory_type memoryType, resource_state initialState, uint32_t sizeInBytes, uint32_t createNodeMask = 0, uint32_t visibleNodeMask = 0, resource_sharing_mode sharingMode = resource_sharing_mode::Exclusive) noexcept;
+    };
+
+    class MemoryHeap;
+
+    namespace detail
+    {
+        /**
+         * @brief The fields of a Resource that barriers and copies read for every Resource they record, stored contiguously per Device in the Resource pool instead of in the Resource itself.
+        */
+        struct resource_hot_fields
+        {
+            void* resource;
+            void* memory;
+        };
+    }
+
+    class Resource
+    {
+        friend class Device;
+        friend class CommandList;
+        template<typename, typename> friend class detail::object_pool;
+
+    public:
+        using native_resource = void;
+        using native_memory = void;
+
+        /**
+         * @brief Get the desc that the Resource was created with.
+         */
+        [[nodiscard]] resource_desc getDesc() const;
+        
+        /**
+         * @brief Gets the native Resource pointer, which depending on the llri::getImplementation() is a pointer to the following:
+         *
+         * DirectX12: ID3D12Resource*
+         * Vulkan: VkImage OR VkBuffer depending on getDesc()::type
+         * Null: nullptr
+         * CPU: nullptr
+         */
+        [[nodiscard]] native_resource* getNative() const;
+        
+        /**
+         * @brief Gets the native memory pointer, which depending on the llri::getImplementation() is a pointer to the following:
+         *
+         * DirectX12: nullptr
+         * Vulkan: VkDeviceMemory
+         * Null: the host memory of memory_type::Upload and memory_type::Read buffers, nullptr otherwise
+         * CPU: the host memory that holds the Resource's data
+         *
+         * For resources that were placed in a MemoryHeap, Vulkan returns the heap's VkDeviceMemory, and Null and CPU return a pointer to the Resource's offset in the heap's host memory.
+         * For resources that were created through Device::importHostMemoryEXT(), DirectX12 returns the ID3D12Heap* that wraps the host memory, Vulkan returns the imported VkDeviceMemory, and Null and CPU return the imported host memory.
+         */
+        [[nodiscard]] native_memory* getNativeMemory() const;
+
+        /**
+         * @brief Get the Resource's generational handle, which can be resolved through Device::resolve() and is safe to hold on to after the Resource is destroyed.
+        */
+        [[nodiscard]] handle<Resource> getHandle() const;
+
+        /**
+         * @brief Get the MemoryHeap that the Resource was placed in.
+         * @return The MemoryHeap that was passed to Device::createPlacedResource(), or nullptr if the Resource was created through Device::createResource() and thus owns its memory.
+        */
+        [[nodiscard]] MemoryHeap* getHeap() const;
+
+        /**
+         * @brief Get the offset in bytes at which the Resource was placed in its MemoryHeap, or 0 if getHeap() returns nullptr.
+        */
+        [[nodiscard]] uint64_t getHeapOffset() const;
+    private:
+        // Force private constructor/deconstructor so that only create/destroy can manage lifetime
+        Resource() = default;
+        ~Resource() = default;
+
+        handle<Resource> m_handle;
+        // the native resource and memory, in the Device's array of hot fields
+        detail::resource_hot_fields* m_hot = nullptr;
+        resource_desc m_desc;
+        
+        uint64_t m_allocationSize = 0;
+        void* m_mapped = nullptr;
+
+        MemoryHeap* m_heap = nullptr;
+        uint64_t m_heapOffset = 0;
+
+        // imported memory is owned by the application, so it isn't freed when the Resource is destroyed
+        bool m_imported = false;
+
+        // set for resources created through Device::createExportableResourceEXT()
+        bool m_exportable = false;
+        external_memory_handle_type_ext m_externalHandleType {};
+    };
+
+    namespace detail
+    {
+        /**
+         * @brief Returns the bit that represents the resource_type in a resource_type bitmask.
+        */
+        constexpr uint8_t resourceTypeBit(resource_type type) noexcept
+        {
+            return static_cast<uint8_t>(1u << static_cast<uint8_t>(type));
+        }
+
+        /**
+         * @brief Returns the size in texels of a mip level of a texture. The depth of textures that aren't resource_type::Texture3D is 1, because their depthOrArrayLayers describes array layers.
+         * @note mipLevel **must** be less than desc.mipLevels.
+        */
+        inline extent_3d mipExtent(const resource_desc& desc, uint32_t mipLevel) noexcept
+        {
+            return extent_3d {
+                std::max(desc.width >> mipLevel, 1u),
+                std::max(desc.height >> mipLevel, 1u),
+                desc.type == resource_type::Texture3D ? std::max(static_cast<uint32_t>(desc.depthOrArrayLayers) >> mipLevel, 1u) : 1u
+            };
+        }
+
+        /**
+         * @brief Returns the bit that represents the memory_type in a memory_type bitmask.
+        */
+        constexpr uint8_t memoryTypeBit(memory_type type) noexcept
+        {
+            return static_cast<uint8_t>(1u << static_cast<uint8_t>(type));
+        }
+
+        /**
+         * @brief The conditions that a resource_state places on a Resource that is created in, or transitioned to, that state.
+        */
+        struct resource_state_requirements
+        {
+            /**
+             * @brief A resource_type bitmask of the types that may be in this state.
+            */
+            uint8_t types;
+            /**
+             * @brief A memory_type bitmask of the memory types that may be in this state.
+            */
+            uint8_t memoryTypes;
+            /**
+             * @brief The usage flags that the resource **must** have been created with.
+            */
+            resource_usage_flags requiredUsage;
+            /**
+             * @brief The usage flags that textures **must** have been created with, in addition to requiredUsage.
+            */
+            resource_usage_flags requiredTextureUsage;
+            /**
+             * @brief The usage flags that the resource **must not** have been created with.
+            */
+            resource_usage_flags forbiddenUsage;
+        };
+
+        constexpr uint8_t allBufferTypes = resourceTypeBit(resource_type::Buffer);
+        constexpr uint8_t allTextureTypes = resourceTypeBit(resource_type::Texture1D) | resourceTypeBit(resource_type::Texture2D) | resourceTypeBit(resource_type::Texture3D);
+        constexpr uint8_t allMemoryTypes = memoryTypeBit(memory_type::Local) | memoryTypeBit(memory_type::Upload) | memoryTypeBit(memory_type::Read);
+
+        /**
+         * @brief The requirements of each resource_state, indexed by resource_state. These reflect the valid usage notes on resource_state.
+        */
+        constexpr std::array<resource_state_requirements, static_cast<size_t>(resource_state::MaxEnum) + 1> resourceStateRequirements {{
+            /* General */                        { allBufferTypes | allTextureTypes, allMemoryTypes, resource_usage_flag_bits::None, resource_usage_flag_bits::None, resource_usage_flag_bits::None },
+            /* Upload */                         { allBufferTypes | allTextureTypes, memoryTypeBit(memory_type::Upload), resource_usage_flag_bits::None, resource_usage_flag_bits::None, resource_usage_flag_bits::ShaderWrite },
+            /* ColorAttachment */                { allTextureTypes, allMemoryTypes, resource_usage_flag_bits::ColorAttachment, resource_usage_flag_bits::None, resource_usage_flag_bits::None },
+            /* DepthStencilAttachment */         { allTextureTypes, allMemoryTypes, resource_usage_flag_bits::DepthStencilAttachment, resource_usage_flag_bits::None, resource_usage_flag_bits::None },
+            /* DepthStencilAttachmentReadOnly */ { allTextureTypes, allMemoryTypes, resource_usage_flag_bits::DepthStencilAttachment, resource_usage_flag_bits::None, resource_usage_flag_bits::None },
+            /* ShaderReadOnly */                 { allBufferTypes | allTextureTypes, allMemoryTypes, resource_usage_flag_bits::None, resource_usage_flag_bits::Sampled, resource_usage_flag_bits::None },
+            /* ShaderReadWrite */                { allBufferTypes | allTextureTypes, allMemoryTypes, resource_usage_flag_bits::ShaderWrite, resource_usage_flag_bits::None, resource_usage_flag_bits::None },
+            /* TransferSrc */                    { allBufferTypes | allTextureTypes, allMemoryTypes, resource_usage_flag_bits::TransferSrc, resource_usage_flag_bits::None, resource_usage_flag_bits::None },
+            /* TransferDst */                    { allBufferTypes | allTextureTypes, allMemoryTypes, resource_usage_flag_bits::TransferDst, resource_usage_flag_bits::None, resource_usage_flag_bits::None },
+            /* VertexBuffer */                   { allBufferTypes, allMemoryTypes, resource_usage_flag_bits::None, resource_usage_flag_bits::None, resource_usage_flag_bits::None },
+            /* IndexBuffer */                    { allBufferTypes, allMemoryTypes, resource_usage_flag_bits::None, resource_usage_flag_bits::None, resource_usage_flag_bits::None },
+            /* ConstantBuffer */                 { allBufferTypes, allMemoryTypes, resource_usage_flag_bits::None, resource_usage_flag_bits::None, resource_usage_flag_bits::None }
+        }};
+
+        /**
+         * @brief Returns true if the resource described by desc meets all of the requirements of state.
+         * @note state **must** be less or equal to resource_state::MaxEnum.
+        */
+        constexpr bool meetsStateRequirements(const resource_desc& desc, resource_state state) noexcept
+        {
+            const resource_state_requirements& requirements = resourceStateRequirements[static_cast<size_t>(state)];
+            const bool isTexture = desc.type != resource_type::Buffer;
+
+            return (requirements.types & resourceTypeBit(desc.type)) != 0 &&
+                (requirements.memoryTypes & memoryTypeBit(desc.memoryType)) != 0 &&
+                desc.usage.all(requirements.requiredUsage) &&
+                (!isTexture || desc.usage.all(requirements.requiredTextureUsage)) &&
+                desc.usage.none(requirements.forbiddenUsage);
+        }
+
+        /**
+         * @brief Returns the bit that represents the resource_state in a resource_state bitmask.
+        */
+        constexpr uint16_t resourceStateBit(resource_state state) noexcept
+        {
+            return static_cast<uint16_t>(1u << static_cast<uint8_t>(state));
+        }
+
+        /**
+         * @brief The largest width, height and depthOrArrayLayers that a resource_desc may have.
+        */
+        constexpr uint32_t maxResourceDimension = 16348;
+
+        /**
+         * @brief The conditions that a resource_type places on the other members of a resource_desc. Members that the type doesn't use (e.g. the height of buffers) accept every value.
+        */
+        struct resource_type_requirements
+        {
+            /**
+             * @brief The usage flags that resources of this type may be created with.
+            */
+            resource_usage_flags validUsage;
+            /**
+             * @brief A memory_type bitmask of the memory types that resources of this type may be created in.
+            */
+            uint8_t memoryTypes;
+            /**
+             * @brief A sample_count bitmask of the sample counts that resources of this type may be created with.
+            */
+            uint8_t sampleCounts;
+            uint32_t minHeight;
+            uint32_t maxHeight;
+            uint16_t minDepthOrArrayLayers;
+            uint16_t maxDepthOrArrayLayers;
+            uint16_t minMipLevels;
+        };
+
+        /**
+         * @brief The requirements of each resource_type, indexed by resource_type. These reflect the valid usage notes on resource_desc.
+        */
+        constexpr std::array<resource_type_requirements, static_cast<size_t>(resource_type::MaxEnum) + 1> resourceTypeRequirements {{
+            /* Buffer */    { resource_usage_flag_bits::TransferSrc | resource_usage_flag_bits::TransferDst | resource_usage_flag_bits::ShaderWrite, allMemoryTypes, static_cast<uint8_t>(sample_count::Count1), 0, UINT32_MAX, 0, UINT16_MAX, 0 },
+            /* Texture1D */ { resource_usage_flag_bits::All, memoryTypeBit(memory_type::Local), static_cast<uint8_t>(sample_count::Count1), 1, 1, 1, maxResourceDimension, 1 },
+            /* Texture2D */ { resource_usage_flag_bits::All, memoryTypeBit(memory_type::Local), static_cast<uint8_t>((static_cast<uint8_t>(sample_count::MaxEnum) << 1) - 1), 1, maxResourceDimension, 1, maxResourceDimension, 1 },
+            /* Texture3D */ { resource_usage_flag_bits::All, memoryTypeBit(memory_type::Local), static_cast<uint8_t>(sample_count::Count1), 1, 2048, 1, maxResourceDimension, 1 }
+        }};
+
+        /**
+         * @brief The conditions that a memory_type places on the usage and initial state of a resource_desc.
+        */
+        struct memory_type_requirements
+        {
+            /**
+             * @brief The usage flags that resources in this memory type **must not** have been created with.
+            */
+            resource_usage_flags forbiddenUsage;
+            /**
+             * @brief A resource_state bitmask of the states that resources in this memory type may be created in.
+            */
+            uint16_t initialStates;
+        };
+
+        constexpr resource_usage_flags hostVisibleForbiddenUsage = resource_usage_flag_bits::ShaderWrite | resource_usage_flag_bits::ColorAttachment | resource_usage_flag_bits::DepthStencilAttachment | resource_usage_flag_bits::DenyShaderResource;
+
+        /**
+         * @brief The requirements of each memory_type, indexed by memory_type. These reflect the valid usage notes on memory_type.
+        */
+        constexpr std::array<memory_type_requirements, static_cast<size_t>(memory_type::MaxEnum) + 1> memoryTypeRequirements {{
+            /* Local */  { resource_usage_flag_bits::None, UINT16_MAX },
+            /* Upload */ { hostVisibleForbiddenUsage, resourceStateBit(resource_state::Upload) },
+            /* Read */   { hostVisibleForbiddenUsage, resourceStateBit(resource_state::TransferDst) }
+        }};
+
+        /**
+         * @brief The only usage flags that a resource with resource_usage_flag_bits::DenyShaderResource may have.
+        */
+        constexpr resource_usage_flags denyShaderResourceValidUsage = resource_usage_flag_bits::DenyShaderResource | resource_usage_flag_bits::DepthStencilAttachment |
+            resource_usage_flag_bits::TransferSrc | resource_usage_flag_bits::TransferDst;
+
+        /**
+         * @brief The usage flags that a resource_desc may and must have for a combination of resource_type, memory_type and resource_state.
+         * Combinations that are invalid regardless of usage allow no usage flags and require all of them, which no resource_desc can meet.
+        */
+        struct resource_usage_requirements
+        {
+            resource_usage_flags allowedUsage;
+            resource_usage_flags requiredUsage;
+        };
+
+        constexpr size_t resourceUsageRequirementsIndex(resource_type type, memory_type memoryType, resource_state state) noexcept
+        {
+            return (static_cast<size_t>(type) * (static_cast<size_t>(memory_type::MaxEnum) + 1) + static_cast<size_t>(memoryType)) * (static_cast<size_t>(resource_state::MaxEnum) + 1) + static_cast<size_t>(state);
+        }
+
+        constexpr size_t resourceUsageRequirementsCount = resourceUsageRequirementsIndex(resource_type::MaxEnum, memory_type::MaxEnum, resource_state::MaxEnum) + 1;
+
+        /**
+         * @brief Merges resourceTypeRequirements, memoryTypeRequirements and resourceStateRequirements into a single table of usage requirements.
+        */
+        constexpr std::array<resource_usage_requirements, resourceUsageRequirementsCount> mergeResourceUsageRequirements() noexcept
+        {
+            std::array<resource_usage_requirements, resourceUsageRequirementsCount> output {};
+            for (uint8_t t = 0; t <= static_cast<uint8_t>(resource_type::MaxEnum); t++)
+            {
+                for (uint8_t m = 0; m <= static_cast<uint8_t>(memory_type::MaxEnum); m++)
+                {
+                    for (uint8_t s = 0; s <= static_cast<uint8_t>(resource_state::MaxEnum); s++)
+                    {
+                        const auto type = static_cast<resource_type>(t);
+                        const auto memoryType = static_cast<memory_type>(m);
+                        const auto state = static_cast<resource_state>(s);
+
+                        const resource_type_requirements& typeRequirements = resourceTypeRequirements[t];
+                        const memory_type_requirements& memoryRequirements = memoryTypeRequirements[m];
+                        const resource_state_requirements& stateRequirements = resourceStateRequirements[s];
+
+                        resource_usage_requirements& requirements = output[resourceUsageRequirementsIndex(type, memoryType, state)];
+                        if ((typeRequirements.memoryTypes & memoryTypeBit(memoryType)) == 0 || (memoryRequirements.initialStates & resourceStateBit(state)) == 0 ||
+                            (stateRequirements.types & resourceTypeBit(type)) == 0 || (stateRequirements.memoryTypes & memoryTypeBit(memoryType)) == 0)
+                        {
+                            requirements = { resource_usage_flag_bits::None, resource_usage_flag_bits::All };
+                            continue;
+                        }
+
+                        requirements.allowedUsage = typeRequirements.validUsage.value & ~memoryRequirements.forbiddenUsage.value & ~stateRequirements.forbiddenUsage.value;
+                        requirements.requiredUsage = stateRequirements.requiredUsage.value | (type != resource_type::Buffer ? stateRequirements.requiredTextureUsage.value : resource_usage_flag_bits::None);
+                    }
+                }
+            }
+            return output;
+        }
+
+        /**
+         * @brief The usage requirements of every combination of resource_type, memory_type and resource_state, indexed by resourceUsageRequirementsIndex().
+        */
+        constexpr std::array<resource_usage_requirements, resourceUsageRequirementsCount> resourceUsageRequirements = mergeResourceUsageRequirements();
+
+        /**
+         * @brief Returns true if desc meets the requirements of its type, memory type and initial state, and the rules that apply to its dimensions and usage.
+         * The type, memory type and initial state are checked with a single lookup in resourceUsageRequirements, so that valid descs are accepted in a few instructions.
+         * Node masks and format support depend on the Adapter and aren't checked.
+         * @note desc.type, desc.memoryType and desc.initialState **must** be less or equal to their MaxEnum.
+        */
+        constexpr bool meetsResourceRequirements(const resource_desc& desc) noexcept
+        {
+            const resource_usage_requirements& usage = resourceUsageRequirements[resourceUsageRequirementsIndex(desc.type, desc.memoryType, desc.initialState)];
+            const resource_type_requirements& type = resourceTypeRequirements[static_cast<size_t>(desc.type)];
+            const auto sampleCount = static_cast<uint8_t>(desc.sampleCount);
+
+            if (!usage.allowedUsage.all(desc.usage) || !desc.usage.all(usage.requiredUsage))
+                return false;
+
+            if (desc.usage.contains(resource_usage_flag_bits::DenyShaderResource) &&
+                (!denyShaderResourceValidUsage.all(desc.usage) || !desc.usage.contains(resource_usage_flag_bits::DepthStencilAttachment)))
+                return false;
+
+            // unsigned wrap around turns each range check into a single comparison
+            if (desc.width - 1u >= maxResourceDimension ||
+                desc.height - type.minHeight > type.maxHeight - type.minHeight ||
+                static_cast<uint32_t>(desc.depthOrArrayLayers - type.minDepthOrArrayLayers) > static_cast<uint32_t>(type.maxDepthOrArrayLayers - type.minDepthOrArrayLayers) ||
+                desc.mipLevels < type.minMipLevels ||
+                sampleCount == 0 || !hasSingleBit(sampleCount) || (type.sampleCounts & sampleCount) != sampleCount)
+                return false;
+
+            if (desc.type == resource_type::Buffer)
+                return true;
+
+            // mip levels and multi-sampling only apply to textures
+            if (desc.sampleCount != sample_count::Count1)
+                return desc.mipLevels == 1 && desc.usage.none(resource_usage_flag_bits::ShaderWrite) &&
+                    desc.usage.any(resource_usage_flag_bits::ColorAttachment | resource_usage_flag_bits::DepthStencilAttachment) && desc.textureFormat != format::Undefined;
+
+            return (desc.mipLevels == 1 || (desc.mipLevels < 32 && (desc.width >> desc.mipLevels) != 0)) && desc.textureFormat != format::Undefined;
+        }
+    }
+}
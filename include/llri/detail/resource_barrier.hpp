@@ -0,0 +1,251 @@
+/**
+ * @file resource_barrier.hpp
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+#include <llri/llri.hpp> // unnecessary but helps intellisense
+
+namespace llri
+{
+    class Resource;
+
+    /**
+     * @brief The type of resource_barrier - this type is used to determine which value to pick from the anonymous resource_barrier union.
+     */
+    enum struct resource_barrier_type : uint8_t
+    {
+        /**
+         * @brief Use the resource_barrier_transition struct.
+         */
+        ReadWrite,
+        /**
+         * @brief Use the resource_barrier_read_write struct.
+         */
+        Transition,
+        /**
+         * @brief Use the resource_barrier_aliasing struct.
+         */
+        Aliasing,
+        /**
+         * @brief Use the resource_barrier_ownership struct to release ownership of the resource from resource_barrier_ownership::srcQueue.
+         */
+        Release,
+        /**
+         * @brief Use the resource_barrier_ownership struct to acquire ownership of the resource on resource_barrier_ownership::dstQueue.
+         */
+        Acquire,
+        /**
+         * @brief The highest value in this enum.
+        */
+        MaxEnum = Acquire
+    };
+
+    /**
+     * @brief Converts a resource_barrier_type to a string.
+     * @return The enum value as a string, or "Invalid resource_barrier_type value" if the value was not recognized as an enum member.
+    */
+    inline std::string to_string(resource_barrier_type type)
+    {
+        switch(type)
+        {
+            case resource_barrier_type::ReadWrite:
+                return "ReadWrite";
+            case resource_barrier_type::Transition:
+                return "Transition";
+            case resource_barrier_type::Aliasing:
+                return "Aliasing";
+            case resource_barrier_type::Release:
+                return "Release";
+            case resource_barrier_type::Acquire:
+                return "Acquire";
+            default:
+                break;
+        }
+        
+        return "Invalid resource_barrier_type value";
+    }
+
+    /**
+     * @brief Transitions a resource from one state to another. Operations and memory dependencies on the resource are handled properly according to the transition.
+     */
+    struct resource_barrier_transition
+    {
+        /**
+         * @brief The resource that needs to be transitioned.
+         *
+         * @note Valid usage (ErrorInvalidUsage): **Must** be a valid non-null pointer to a resource object.
+        */
+        Resource* resource;
+        /**
+         * @brief The state that the resource is transitioning from.
+         *
+         * @note Valid usage: oldState **must** match the resource's current state or in the case of subresource_range transitions it **must** match with  the resource's current state for every subresource in the transition.
+         */
+        resource_state oldState;
+        /**
+         * @brief The state to transition to.
+         *
+         * @note Valid usage (ErrorInvalidUsage): newState **must not** be more than resource_state::MaxEnum.
+         * @note Valid usage (ErrorInvalidState): the conditions described in the resource_state **must** be met.
+         * @note Valid usage (ErrorInvalidUsage): newState **must not** be the same as oldState.
+        */
+        resource_state newState;
+        
+        /**
+         * @brief The range of subresources to transition if the resource is a resource_type::Texture1D, Texture2D, or Texture3D.
+         *
+         * @note Ignored if resource is resource_type::Buffer.
+         * @note Valid usage (ErrorInvalidUsage): the conditions in texture_subresource_range **must** be met.
+         */
+        texture_subresource_range subresourceRange;
+    };
+
+    /**
+     * @brief All ReadWrite writing operations on this Resource must complete before any future ReadWrite operations can begin.
+     *
+     * You do not need to insert a read_write barrier between two passes if the resource is only being read to in both passes, nor do you need an additional read_write barrier if the resource is already being transitioned to/from a ReadWrite state using resource_barrier_transition.
+     */
+    struct resource_barrier_read_write
+    {
+        /**
+         * @brief The resource that the barrier applies to.
+         *
+         * @note Valid usage (ErrorInvalidUsage): **Must** be a valid non-null pointer to a resource object.
+         * @note Valid usage (ErrorInvalidState): **Must** be in the resource_state::ReadWrite state.
+         */
+        Resource* resource;
+    };
+
+    /**
+     * @brief Switches the memory of a MemoryHeap from one placed resource to another placed resource that overlaps with it.
+     *
+     * All operations on resources that overlap with after **must** complete before after is used, and the contents of after are undefined after the barrier.
+     * Attachments **should** thus be cleared, and other resources fully overwritten, before after is read from.
+     */
+    struct resource_barrier_aliasing
+    {
+        /**
+         * @brief The resource that was using the memory until now, or nullptr if any placed resource in the heap may have been using the memory.
+         *
+         * @note Valid usage (ErrorInvalidUsage): If before isn't nullptr, then before **must** have been created through Device::createPlacedResource() in the same MemoryHeap as after.
+         */
+        Resource* before;
+        /**
+         * @brief The resource that is going to use the memory.
+         *
+         * @note Valid usage (ErrorInvalidUsage): **Must** be a valid non-null pointer to a resource object that was created through Device::createPlacedResource().
+         */
+        Resource* after;
+        /**
+         * @brief The state that after is in. Its state doesn't change, but some implementations (e.g. Vulkan) reinitialize its layout in this state because the memory's previous contents are discarded.
+         *
+         * @note Valid usage (ErrorInvalidUsage): afterState **must not** be more than resource_state::MaxEnum.
+         * @note Valid usage: afterState **must** match after's current state.
+         */
+        resource_state afterState;
+    };
+
+    /**
+     * @brief Transfers ownership of a resource_sharing_mode::Exclusive resource from Queues of one queue_type to Queues of another queue_type.
+     *
+     * An ownership transfer consists of two barriers with identical parameters: a resource_barrier::release() recorded in a CommandList of srcQueue's type, and a resource_barrier::acquire() recorded in a CommandList of dstQueue's type.
+     * The CommandList with the acquire barrier **must** wait on a Semaphore that is signaled after the CommandList with the release barrier is executed.
+     *
+     * Ownership transfers of resource_sharing_mode::Concurrent resources, or between queue_types that the implementation doesn't distinguish, only act as a regular memory dependency.
+     * Without an ownership transfer, the contents of an Exclusive resource are undefined when it's used on a Queue of another type.
+     */
+    struct resource_barrier_ownership
+    {
+        /**
+         * @brief The resource whose ownership is transferred.
+         *
+         * @note Valid usage (ErrorInvalidUsage): **Must** be a valid non-null pointer to a resource object.
+         */
+        Resource* resource;
+        /**
+         * @brief The state that the resource is in. Its state doesn't change during the transfer.
+         *
+         * @note Valid usage (ErrorInvalidUsage): state **must not** be more than resource_state::MaxEnum.
+         * @note Valid usage: state **must** match the resource's current state.
+         */
+        resource_state state;
+        /**
+         * @brief The queue_type that currently owns the resource.
+         *
+         * @note Valid usage (ErrorInvalidUsage): srcQueue **must not** be more than queue_type::MaxEnum.
+         * @note Valid usage (ErrorInvalidUsage): srcQueue **must not** be the same as dstQueue.
+         * @note Valid usage (ErrorInvalidUsage): Release barriers **must** be recorded in a CommandList whose CommandGroup was created with srcQueue.
+         */
+        queue_type srcQueue;
+        /**
+         * @brief The queue_type that the resource is transferred to.
+         *
+         * @note Valid usage (ErrorInvalidUsage): dstQueue **must not** be more than queue_type::MaxEnum.
+         * @note Valid usage (ErrorInvalidUsage): Acquire barriers **must** be recorded in a CommandList whose CommandGroup was created with dstQueue.
+         */
+        queue_type dstQueue;
+    };
+
+    /**
+     * @brief Describes a memory dependency.
+     */
+    struct resource_barrier
+    {
+        resource_barrier_type type;
+        
+        union {
+            resource_barrier_read_write rw;
+            resource_barrier_transition trans;
+            resource_barrier_aliasing alias;
+            resource_barrier_ownership own;
+        };
+        
+        static resource_barrier read_write(Resource* resource)
+        {
+            resource_barrier barrier {};
+            barrier.type = resource_barrier_type::ReadWrite;
+            barrier.rw = resource_barrier_read_write { resource };
+            return barrier;
+        }
+        
+        static resource_barrier transition(Resource* resource, resource_state oldState, resource_state newState, texture_subresource_range range = texture_subresource_range::all())
+        {
+            resource_barrier barrier {};
+            barrier.type = resource_barrier_type::Transition;
+            barrier.trans = resource_barrier_transition { resource, oldState, newState, range };
+            return barrier;
+        }
+
+        static resource_barrier aliasing(Resource* before, Resource* after, resource_state afterState)
+        {
+            resource_barrier barrier {};
+            barrier.type = resource_barrier_type::Aliasing;
+            barrier.alias = resource_barrier_aliasing { before, after, afterState };
+            return barrier;
+        }
+
+        /**
+         * @brief Release the ownership of an Exclusive resource from srcQueue, to be acquired on dstQueue with acquire().
+         *
+         * srcQueue **must** be the resource's current owner. Until the first ownership transfer, that's the Device's initial owner, which is described in resource_sharing_mode::Exclusive.
+         * For example, a texture that's created on a Device with Graphics Queues is owned by queue_type::Graphics, even if it's only meant to be used by queue_type::Compute.
+         */
+        static resource_barrier release(Resource* resource, resource_state state, queue_type srcQueue, queue_type dstQueue)
+        {
+            resource_barrier barrier {};
+            barrier.type = resource_barrier_type::Release;
+            barrier.own = resource_barrier_ownership { resource, state, srcQueue, dstQueue };
+            return barrier;
+        }
+
+        static resource_barrier acquire(Resource* resource, resource_state state, queue_type srcQueue, queue_type dstQueue)
+        {
+            resource_barrier barrier {};
+            barrier.type = resource_barrier_type::Acquire;
+            barrier.own = resource_barrier_ownership { resource, state, srcQueue, dstQueue };
+            return barrier;
+        }
+    };
+}
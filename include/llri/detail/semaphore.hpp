@@ -0,0 +1,58 @@
+/**
+ * @file semaphore.hpp
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+#include <llri/llri.hpp> // unnecessary but helps intellisense
+
+namespace llri
+{
+    /**
+     * @brief Semaphore is a synchronization structure that enables synchronization between GPU events.
+     * Semaphores are signaled by Queue and Swapchain, after which Queue can wait on them, enabling GPU event synchronization without CPU interference.
+    */
+    class Semaphore
+    {
+        friend class Device;
+        friend class Queue;
+        template<typename, typename> friend class detail::object_pool;
+
+    public:
+        using native_semaphore = void;
+
+        /**
+         * @brief Gets the native Semaphore  pointer, which depending on the llri::getImplementation() is a pointer to the following:
+         *
+         * DirectX12: ID3D12Fence*
+         * Vulkan: VkSemaphore
+         * Null: nullptr
+         * CPU: an internal object that is signaled when the submission completes
+         */
+        [[nodiscard]] native_semaphore* getNative() const
+        {
+            return m_ptr;
+        }
+
+        /**
+         * @brief Get the Semaphore's generational handle, which can be resolved through Device::resolve() and is safe to hold on to after the Semaphore is destroyed.
+        */
+        [[nodiscard]] handle<Semaphore> getHandle() const
+        {
+            return m_handle;
+        }
+        
+    private:
+        // Force private constructor/deconstructor so that only create/destroy can manage lifetime
+        Semaphore() = default;
+        ~Semaphore() = default;
+
+        handle<Semaphore> m_handle;
+        native_semaphore* m_ptr = nullptr;
+        uint64_t m_counter = 0;
+
+        // set for semaphores created through Device::createExportableSemaphoreEXT()
+        bool m_exportable = false;
+    };
+}
@@ -0,0 +1,39 @@
+/**
+ * @file simulated_timing_ext.hpp
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+#include <llri/llri.hpp> // unnecessary but helps intellisense
+
+namespace llri
+{
+    /**
+     * @brief Describes the simulated costs of the work submitted to a Queue, used by adapter_extension::SimulatedTiming.
+     *
+     * Each Queue is a timeline that executes its submissions in order. A submission starts once the Queue finished its previous submission, once all of its wait semaphores are signaled, and no earlier than submitLatency after the Device's simulated time at which it was submitted.
+     * The submission then takes the sum of the cost of its commands, after which its signal semaphores are signaled. Its Fence is signaled fenceLatency later.
+     *
+     * All times are in simulated nanoseconds. A value-initialized simulated_timing_desc_ext makes all work free, which is the default for every queue_type.
+    */
+    struct simulated_timing_desc_ext
+    {
+        /**
+         * @brief The cost of every recorded command. A resource barrier counts as a command for every barrier in the resourceBarrier() call.
+        */
+        uint64_t commandCost;
+        /**
+         * @brief The number of bytes per simulated second that copy commands transfer, in addition to their command cost. 0 means that copies only cost commandCost.
+        */
+        uint64_t copyBandwidth;
+        /**
+         * @brief The time between Queue::submit() and the moment that the Queue **can** start executing the submission.
+        */
+        uint64_t submitLatency;
+        /**
+         * @brief The time between the end of a submission and the moment that its Fence is signaled.
+        */
+        uint64_t fenceLatency;
+    };
+}
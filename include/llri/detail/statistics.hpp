@@ -0,0 +1,291 @@
+/**
+ * @file statistics.hpp
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+#include <llri/llri.hpp> // unnecessary but helps intellisense
+
+namespace llri
+{
+    /**
+     * @brief The LLRI calls whose implementation time is measured in device_statistics.
+    */
+    enum struct device_call : uint8_t
+    {
+        /**
+         * @brief Device::createCommandGroup().
+        */
+        CreateCommandGroup,
+        /**
+         * @brief Device::createFence().
+        */
+        CreateFence,
+        /**
+         * @brief Device::waitFences() and Device::waitFence().
+        */
+        WaitFences,
+        /**
+         * @brief Device::createSemaphore().
+        */
+        CreateSemaphore,
+        /**
+         * @brief Device::createResource().
+        */
+        CreateResource,
+        /**
+         * @brief Device::createQueryPool().
+        */
+        CreateQueryPool,
+        /**
+         * @brief Device::createMemoryHeap().
+        */
+        CreateMemoryHeap,
+        /**
+         * @brief Device::createPlacedResource().
+        */
+        CreatePlacedResource,
+        /**
+         * @brief CommandGroup::allocate().
+        */
+        Allocate,
+        /**
+         * @brief CommandGroup::reset().
+        */
+        Reset,
+        /**
+         * @brief CommandList::begin().
+        */
+        Begin,
+        /**
+         * @brief CommandList::end().
+        */
+        End,
+        /**
+         * @brief CommandList::resourceBarrier().
+        */
+        ResourceBarrier,
+        /**
+         * @brief Queue::submit().
+        */
+        Submit,
+        /**
+         * @brief Queue::waitIdle().
+        */
+        WaitIdle,
+        /**
+         * @brief The highest value in this enum.
+        */
+        MaxEnum = WaitIdle
+    };
+
+    /**
+     * @brief Converts a device_call to a string.
+     * @return The enum value as a string, or "Invalid device_call value" if the value was not recognized as an enum member.
+    */
+    inline std::string to_string(device_call call);
+
+    /**
+     * @brief The number of buckets in call_statistics::histogram.
+    */
+    constexpr size_t statisticsHistogramBuckets = 32;
+
+    /**
+     * @brief Statistics about a single device_call.
+    */
+    struct call_statistics
+    {
+        /**
+         * @brief The number of times that the implementation was called.
+         * Calls that fail LLRI validation don't reach the implementation and aren't counted.
+        */
+        uint64_t count;
+        /**
+         * @brief The total wall-clock time spent inside the implementation, in nanoseconds.
+        */
+        uint64_t totalNanoseconds;
+        /**
+         * @brief Histogram of the wall-clock time of each call.
+         * Bucket 0 counts calls that took less than 2 nanoseconds, bucket n (n > 0) counts calls that took [2^n, 2^(n+1)) nanoseconds. The last bucket also counts all longer calls.
+        */
+        std::array<uint64_t, statisticsHistogramBuckets> histogram;
+    };
+
+    /**
+     * @brief A snapshot of a Device's statistics, counted since the Device was created or since the last Device::resetStatistics().
+    */
+    struct device_statistics
+    {
+        /**
+         * @brief Statistics per device_call, indexed by the device_call value.
+        */
+        std::array<call_statistics, static_cast<size_t>(device_call::MaxEnum) + 1> calls;
+
+        /**
+         * @brief The total number of barriers that were passed to CommandList::resourceBarrier().
+        */
+        uint64_t barriers;
+
+        /**
+         * @brief The number of bytes that Device::createResource() and Device::createMemoryHeap() allocated, per memory_type, indexed by the memory_type value.
+         * This is the size of the implementation's allocation, which **may** be larger than the size that the resource was described with. Device::createPlacedResource() doesn't allocate memory and isn't included.
+        */
+        std::array<uint64_t, static_cast<size_t>(memory_type::MaxEnum) + 1> allocatedBytes;
+
+        /**
+         * @brief Utility function to access calls[call].
+        */
+        [[nodiscard]] const call_statistics& get(device_call call) const { return calls[static_cast<size_t>(call)]; }
+    };
+
+    namespace detail
+    {
+        inline uint64_t statisticsNow() noexcept
+        {
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+        }
+
+        constexpr size_t statisticsBucket(uint64_t nanoseconds) noexcept
+        {
+            size_t bucket = 0;
+            while (nanoseconds > 1 && bucket < statisticsHistogramBuckets - 1)
+            {
+                nanoseconds >>= 1;
+                bucket++;
+            }
+            return bucket;
+        }
+
+        /**
+         * @brief Collects a Device's statistics.
+         *
+         * Every thread records into its own block of counters, so recording never contends with other threads. Each counter only has a single writer, so recording is a relaxed load and store.
+         * Reading sums all blocks, and resetting stores the current sums as a baseline which is subtracted from later reads, so that reset never writes into another thread's counters.
+        */
+        class device_statistics_recorder
+        {
+        public:
+            device_statistics_recorder() noexcept : m_id(nextId()) { }
+            device_statistics_recorder(const device_statistics_recorder&) = delete;
+            device_statistics_recorder& operator=(const device_statistics_recorder&) = delete;
+
+            void recordCall(device_call call, uint64_t begin) noexcept
+            {
+                const uint64_t duration = statisticsNow() - begin;
+                block& b = local();
+                const auto index = static_cast<size_t>(call);
+                increment(b.histogram[index][statisticsBucket(duration)], 1);
+                increment(b.totalNanoseconds[index], duration);
+            }
+
+            void recordBarriers(uint32_t count) noexcept
+            {
+                increment(local().barriers, count);
+            }
+
+            void recordAllocation(memory_type type, uint64_t bytes) noexcept
+            {
+                increment(local().allocatedBytes[static_cast<size_t>(type)], bytes);
+            }
+
+            [[nodiscard]] device_statistics snapshot() const
+            {
+                std::lock_guard lock(m_mutex);
+                device_statistics output = sum();
+
+                for (size_t call = 0; call < output.calls.size(); call++)
+                {
+                    output.calls[call].count = 0;
+                    output.calls[call].totalNanoseconds -= m_baseline.calls[call].totalNanoseconds;
+                    for (size_t bucket = 0; bucket < statisticsHistogramBuckets; bucket++)
+                    {
+                        output.calls[call].histogram[bucket] -= m_baseline.calls[call].histogram[bucket];
+                        output.calls[call].count += output.calls[call].histogram[bucket];
+                    }
+                }
+
+                output.barriers -= m_baseline.barriers;
+                for (size_t type = 0; type < output.allocatedBytes.size(); type++)
+                    output.allocatedBytes[type] -= m_baseline.allocatedBytes[type];
+
+                return output;
+            }
+
+            void reset()
+            {
+                std::lock_guard lock(m_mutex);
+                m_baseline = sum();
+            }
+
+        private:
+            struct block
+            {
+                std::array<std::array<std::atomic<uint64_t>, statisticsHistogramBuckets>, static_cast<size_t>(device_call::MaxEnum) + 1> histogram {};
+                std::array<std::atomic<uint64_t>, static_cast<size_t>(device_call::MaxEnum) + 1> totalNanoseconds {};
+                std::atomic<uint64_t> barriers { 0 };
+                std::array<std::atomic<uint64_t>, static_cast<size_t>(memory_type::MaxEnum) + 1> allocatedBytes {};
+            };
+
+            static uint64_t nextId() noexcept
+            {
+                static std::atomic<uint64_t> id { 0 };
+                return id.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            static void increment(std::atomic<uint64_t>& counter, uint64_t value) noexcept
+            {
+                // only the owning thread writes to its counters, so there's no need for an atomic read-modify-write
+                counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+            }
+
+            block& local()
+            {
+                // recorder ids are never reused, so a cached block of a destroyed recorder is never returned
+                thread_local uint64_t cachedId = std::numeric_limits<uint64_t>::max();
+                thread_local block* cachedBlock = nullptr;
+                if (cachedId == m_id)
+                    return *cachedBlock;
+
+                // threads that alternate between Devices look their block up again, which only contends with other lookups and with reads
+                // a thread that reuses the id of an exited thread continues in its block, which keeps the number of blocks bounded by the number of live threads
+                block* b;
+                {
+                    std::lock_guard lock(m_mutex);
+                    auto& owned = m_blocks[std::this_thread::get_id()];
+                    if (!owned)
+                        owned = std::make_unique<block>();
+                    b = owned.get();
+                }
+
+                cachedId = m_id;
+                cachedBlock = b;
+                return *b;
+            }
+
+            device_statistics sum() const
+            {
+                device_statistics output {};
+                for (const auto& [thread, b] : m_blocks)
+                {
+                    for (size_t call = 0; call < output.calls.size(); call++)
+                    {
+                        output.calls[call].totalNanoseconds += b->totalNanoseconds[call].load(std::memory_order_relaxed);
+                        for (size_t bucket = 0; bucket < statisticsHistogramBuckets; bucket++)
+                            output.calls[call].histogram[bucket] += b->histogram[call][bucket].load(std::memory_order_relaxed);
+                    }
+
+                    output.barriers += b->barriers.load(std::memory_order_relaxed);
+                    for (size_t type = 0; type < output.allocatedBytes.size(); type++)
+                        output.allocatedBytes[type] += b->allocatedBytes[type].load(std::memory_order_relaxed);
+                }
+                return output;
+            }
+
+            const uint64_t m_id;
+            mutable std::mutex m_mutex;
+            std::unordered_map<std::thread::id, std::unique_ptr<block>> m_blocks;
+            device_statistics m_baseline {};
+        };
+    }
+}
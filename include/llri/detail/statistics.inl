@@ -0,0 +1,50 @@
+/**
+ * @file statistics.inl
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+#include <llri/llri.hpp> // unnecessary but helps intellisense
+
+namespace llri
+{
+    inline std::string to_string(device_call call)
+    {
+        switch (call)
+        {
+            case device_call::CreateCommandGroup:
+                return "CreateCommandGroup";
+            case device_call::CreateFence:
+                return "CreateFence";
+            case device_call::WaitFences:
+                return "WaitFences";
+            case device_call::CreateSemaphore:
+                return "CreateSemaphore";
+            case device_call::CreateResource:
+                return "CreateResource";
+            case device_call::CreateQueryPool:
+                return "CreateQueryPool";
+            case device_call::CreateMemoryHeap:
+                return "CreateMemoryHeap";
+            case device_call::CreatePlacedResource:
+                return "CreatePlacedResource";
+            case device_call::Allocate:
+                return "Allocate";
+            case device_call::Reset:
+                return "Reset";
+            case device_call::Begin:
+                return "Begin";
+            case device_call::End:
+                return "End";
+            case device_call::ResourceBarrier:
+                return "ResourceBarrier";
+            case device_call::Submit:
+                return "Submit";
+            case device_call::WaitIdle:
+                return "WaitIdle";
+        }
+
+        return "Invalid device_call value";
+    }
+}
@@ -0,0 +1,384 @@
+/**
+ * @file streaming_uploader.hpp
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+#include <llri/llri.hpp> // unnecessary but helps intellisense
+
+namespace llri
+{
+    class CommandGroup;
+    class CommandList;
+    class Device;
+    class Fence;
+    class Queue;
+    class Resource;
+    class Semaphore;
+
+    /**
+     * @brief Describes how a streaming_uploader uses its Device.
+    */
+    struct streaming_uploader_desc
+    {
+        /**
+         * @brief The size in bytes of the memory_type::Upload buffer that uploads are staged in. Uploads that don't fit in the remaining space are rejected until earlier uploads complete.
+         *
+         * @note Valid usage (ErrorInvalidUsage): ringSize **must** be more than 0.
+        */
+        uint32_t ringSize;
+
+        /**
+         * @brief The maximum number of bytes that a single streaming_uploader::flush() submits, or 0 to submit everything that was enqueued.
+         * The budget applies per flush(), not per frame: calling flush() more than once per frame submits up to this many bytes each time. Applications that call flush() once per frame can use it to limit the bandwidth that streaming takes away from rendering.
+         *
+         * The first upload of every flush() is submitted regardless of its size, so that uploads that are larger than the budget still make progress.
+        */
+        uint64_t flushBudget;
+
+        /**
+         * @brief The queue_type whose Queue uses the uploaded resources. Ownership of the resources is transferred to this type once their upload completes.
+         *
+         * The uploader releases Exclusive resources from this type, so they **must** be owned by it when they're enqueued. Newly created resources are owned by the Device's initial owner (see resource_sharing_mode::Exclusive),
+         * so with a destination of queue_type::Compute on a Device with Graphics Queues, new resources **must** be released from queue_type::Graphics and acquired on queue_type::Compute first.
+         *
+         * @note Valid usage (ErrorInvalidUsage): destination **must** be queue_type::Graphics or queue_type::Compute.
+         * @note Valid usage (ErrorFeatureNotSupported): The Device **must** have been created with at least one Queue of this type.
+        */
+        queue_type destination;
+
+        /**
+         * @brief The device node that the staging buffer, CommandLists and submits use. Passing 0 is the equivalent of passing 1.
+         *
+         * @note Valid usage (ErrorInvalidNodeMask): Exactly one bit **must** be set, and that bit **must** be less than 1 << Adapter::queryNodeCount().
+        */
+        uint32_t nodeMask;
+    };
+
+    /**
+     * @brief Describes an upload of host memory into a range of a buffer.
+    */
+    struct streaming_buffer_upload
+    {
+        /**
+         * @brief The buffer that is written to.
+         *
+         * @note Valid usage (ErrorInvalidUsage): buffer **must** be a valid non-null pointer to a Resource with resource_type::Buffer, created with resource_usage_flag_bits::TransferDst in memory_type::Local.
+        */
+        Resource* buffer;
+        /**
+         * @brief The offset in bytes into the buffer at which the data is written.
+        */
+        uint64_t offset;
+        /**
+         * @brief The number of bytes to upload.
+         *
+         * @note Valid usage (ErrorInvalidUsage): size **must** be more than 0, and offset + size **must** be less than or equal to the size of the buffer.
+        */
+        uint64_t size;
+        /**
+         * @brief The host memory that is uploaded. The data is copied by streaming_uploader::enqueue(), so it **may** be released as soon as enqueue() returns.
+         *
+         * @note Valid usage (ErrorInvalidUsage): data **must** be a valid non-null pointer to at least size bytes.
+        */
+        const void* data;
+        /**
+         * @brief The state that the buffer is in when the upload is submitted, which is also the state that it's in on the destination Queue once the upload completes.
+         *
+         * @note Valid usage (ErrorInvalidUsage): state **must** be a valid enum value, and all pending uploads to the same Resource **must** use the same state.
+        */
+        resource_state state;
+    };
+
+    /**
+     * @brief Describes an upload of host memory into a region of a texture subresource.
+    */
+    struct streaming_texture_upload
+    {
+        /**
+         * @brief The texture that is written to.
+         *
+         * @note Valid usage (ErrorInvalidUsage): texture **must** be a valid non-null pointer to a Resource with a texture resource_type, created with resource_usage_flag_bits::TransferDst, sample_count::Count1 and a textureFormat that has a color component.
+        */
+        Resource* texture;
+        /**
+         * @brief The mip level of the texture subresource.
+         *
+         * @note Valid usage (ErrorInvalidUsage): mipLevel **must** be less than resource_desc::mipLevels.
+        */
+        uint32_t mipLevel;
+        /**
+         * @brief The array layer of the texture subresource.
+         *
+         * @note Valid usage (ErrorInvalidUsage): arrayLayer **must** be less than resource_desc::depthOrArrayLayers, unless if resource_desc::type is Texture3D, then it **must** be 0.
+        */
+        uint32_t arrayLayer;
+        /**
+         * @brief The offset in texels of the region in the texture subresource.
+         *
+         * @note Valid usage (ErrorInvalidUsage): textureOffset and extent **must** meet the valid usage of texture_copy_desc::textureOffset and texture_copy_desc::extent.
+        */
+        offset_3d textureOffset;
+        /**
+         * @brief The size in texels of the region.
+        */
+        extent_3d extent;
+        /**
+         * @brief The host memory that is uploaded, laid out as extent.depth slices of extent.height rows. The data is copied by streaming_uploader::enqueue(), so it **may** be released as soon as enqueue() returns.
+         *
+         * @note Valid usage (ErrorInvalidUsage): data **must** be a valid non-null pointer to at least dataRowPitch * extent.height * extent.depth bytes.
+        */
+        const void* data;
+        /**
+         * @brief The number of bytes between the start of two consecutive rows in data, or 0 if the rows are tightly packed.
+         *
+         * @note Valid usage (ErrorInvalidUsage): if dataRowPitch isn't 0, it **must** be at least extent.width * format_size(resource_desc::textureFormat).
+        */
+        uint32_t dataRowPitch;
+        /**
+         * @brief The state that the texture is in when the upload is submitted, which is also the state that it's in on the destination Queue once the upload completes.
+         *
+         * @note Valid usage (ErrorInvalidUsage): state **must** be a valid enum value, and all pending uploads to the same Resource **must** use the same state.
+        */
+        resource_state state;
+    };
+
+    /**
+     * @brief Identifies an upload that was enqueued through streaming_uploader::enqueue() or streaming_uploader::reserve().
+     *
+     * Uploads complete in the order in which they were enqueued, so a completed request implies that all requests with a lower value have completed too.
+    */
+    struct streaming_request
+    {
+        uint64_t value = 0;
+    };
+
+    /**
+     * @brief Staging memory that was reserved for a buffer upload through streaming_uploader::reserve().
+    */
+    struct streaming_buffer_reservation
+    {
+        /**
+         * @brief The mapped staging memory that streaming_buffer_upload::size bytes are written to.
+        */
+        uint8_t* data;
+        /**
+         * @brief The request that is passed to streaming_uploader::commit() once data has been written.
+        */
+        streaming_request request;
+    };
+
+    /**
+     * @brief Staging memory that was reserved for a texture upload through streaming_uploader::reserve().
+    */
+    struct streaming_texture_reservation
+    {
+        /**
+         * @brief The mapped staging memory that the texels are written to, laid out as streaming_texture_upload::extent.depth slices of extent.height rows.
+        */
+        uint8_t* data;
+        /**
+         * @brief The number of bytes between the start of two consecutive rows in data.
+        */
+        uint32_t rowPitch;
+        /**
+         * @brief The request that is passed to streaming_uploader::commit() once data has been written.
+        */
+        streaming_request request;
+    };
+
+    /**
+     * @brief Utility that streams host memory into buffers and textures through the Device's first Transfer Queue, without stalling the destination Queue.
+     *
+     * Uploads are enqueued from any thread, which copies their data into a persistently mapped memory_type::Upload ring buffer. flush() records all uploads that fit in
+     * streaming_uploader_desc::flushBudget into a single copy CommandList and submits it to the Transfer Queue. The destination Queue transitions the resources to resource_state::General,
+     * which resources **must** be in to be used by a Transfer Queue, and releases them to the Transfer Queue before the copy, and acquires them and transitions them back to their state afterwards,
+     * synchronized through Semaphores, so exclusive resources change ownership correctly and concurrent resources are unaffected.
+     * If the Device has no Transfer Queue, the copies are recorded and submitted on the destination Queue instead, with the resources in resource_state::TransferDst.
+     *
+     * A request is complete once the destination Queue has acquired its resource, after which the resource **may** be used on any Queue of the destination type.
+     * Because the acquire is submitted to the destination Queue during flush(), submits to that same Queue after flush() **may** use the resource without waiting on the request.
+     *
+     * @note enqueue(), reserve() and commit() are thread-safe. The other functions are thread-safe with respect to each other, but flush() submits to the Device's Queues, so it **must not** be called while other threads submit to the same Queues.
+     * @note Resources **must not** be destroyed or used on other Queues until the requests that upload to them have completed.
+    */
+    class streaming_uploader
+    {
+    public:
+        streaming_uploader() = default;
+        streaming_uploader(const streaming_uploader&) = delete;
+        streaming_uploader& operator=(const streaming_uploader&) = delete;
+        ~streaming_uploader() { destroy(); }
+
+        /**
+         * @brief Create the uploader's staging buffer and CommandGroups.
+         *
+         * @note Valid usage (ErrorInvalidUsage): device **must** be a valid non-null pointer to a Device.
+         *
+         * @return Success upon correct execution of the operation.
+         * @return streaming_uploader_desc defined result values: ErrorInvalidUsage, ErrorFeatureNotSupported, ErrorInvalidNodeMask.
+         * @return Device::createResource(), Device::mapResource() and Device::createCommandGroup() defined result values.
+        */
+        result create(Device* device, const streaming_uploader_desc& desc);
+
+        /**
+         * @brief Wait for all submitted uploads to complete, and destroy the uploader's Device objects. Uploads that were enqueued but not flushed are discarded. Calling destroy() on an uploader that wasn't created has no effect.
+        */
+        void destroy();
+
+        /**
+         * @brief Copy the data of a buffer upload into the staging buffer and queue it for the next flush().
+         *
+         * @param upload Describes the buffer range and the data.
+         * @param request If not nullptr, the request that can be used to check whether the upload has completed.
+         *
+         * @return Success upon correct execution of the operation.
+         * @return NotReady if the staging buffer doesn't have enough space left until earlier uploads complete. The upload **may** be enqueued again after flush().
+         * @return ErrorInvalidUsage if the uploader wasn't created, if the upload doesn't meet the valid usage of streaming_buffer_upload, or if its data is larger than streaming_uploader_desc::ringSize.
+        */
+        result enqueue(const streaming_buffer_upload& upload, streaming_request* request = nullptr);
+
+        /**
+         * @brief Copy the data of a texture upload into the staging buffer and queue it for the next flush(). Rows are padded in the staging buffer as required by CommandList::copyBufferToTexture().
+         *
+         * @param upload Describes the texture region and the data.
+         * @param request If not nullptr, the request that can be used to check whether the upload has completed.
+         *
+         * @return Success upon correct execution of the operation.
+         * @return NotReady if the staging buffer doesn't have enough space left until earlier uploads complete. The upload **may** be enqueued again after flush().
+         * @return ErrorInvalidUsage if the uploader wasn't created, if the upload doesn't meet the valid usage of streaming_texture_upload, or if its padded data is larger than streaming_uploader_desc::ringSize.
+        */
+        result enqueue(const streaming_texture_upload& upload, streaming_request* request = nullptr);
+
+        /**
+         * @brief Reserve staging memory for a buffer upload, so that its data can be written into the mapped staging buffer directly instead of being copied by enqueue().
+         * upload.data is ignored.
+         *
+         * The upload isn't submitted until commit() is called with reservation->request, and because uploads are submitted in order, uploads that are enqueued later wait for it too.
+         * Reservations **should** thus be committed soon after they were made, and **must** be committed before the uploader is destroyed.
+         *
+         * @param upload Describes the buffer range.
+         * @param reservation The reserved staging memory and the upload's request.
+         *
+         * @return Success upon correct execution of the operation.
+         * @return NotReady if the staging buffer doesn't have enough space left until earlier uploads complete. The upload **may** be reserved again after flush().
+         * @return ErrorInvalidUsage if the uploader wasn't created, if reservation is nullptr, if the upload doesn't meet the valid usage of streaming_buffer_upload, or if its data is larger than streaming_uploader_desc::ringSize.
+        */
+        result reserve(const streaming_buffer_upload& upload, streaming_buffer_reservation* reservation);
+
+        /**
+         * @brief Reserve staging memory for a texture upload, so that its texels can be written into the mapped staging buffer directly instead of being copied by enqueue().
+         * upload.data and upload.dataRowPitch are ignored.
+         *
+         * The upload isn't submitted until commit() is called with reservation->request, and because uploads are submitted in order, uploads that are enqueued later wait for it too.
+         * Reservations **should** thus be committed soon after they were made, and **must** be committed before the uploader is destroyed.
+         *
+         * @param upload Describes the texture region.
+         * @param reservation The reserved staging memory and the upload's request.
+         *
+         * @return Success upon correct execution of the operation.
+         * @return NotReady if the staging buffer doesn't have enough space left until earlier uploads complete. The upload **may** be reserved again after flush().
+         * @return ErrorInvalidUsage if the uploader wasn't created, if reservation is nullptr, if the upload doesn't meet the valid usage of streaming_texture_upload, or if its padded data is larger than streaming_uploader_desc::ringSize.
+        */
+        result reserve(const streaming_texture_upload& upload, streaming_texture_reservation* reservation);
+
+        /**
+         * @brief Mark a reserved upload as written, after which the next flush() **may** submit it.
+         *
+         * @note This function is thread-safe, so reservations **may** be written and committed on other threads.
+        */
+        void commit(const streaming_request& request);
+
+        /**
+         * @brief Submit the enqueued uploads, in the order in which they were enqueued, until streaming_uploader_desc::flushBudget is reached. Uploads that don't fit in the budget remain queued for the next flush().
+         *
+         * @return Success upon correct execution of the operation.
+         * @return ErrorInvalidUsage if the uploader wasn't created.
+         * @return CommandGroup::allocate(), CommandList, Device::createSemaphore(), Device::createFence() and Queue::submit() defined result values.
+        */
+        result flush();
+
+        /**
+         * @brief Check, without blocking, if a request has completed.
+        */
+        [[nodiscard]] bool isComplete(const streaming_request& request);
+
+        /**
+         * @brief Block the CPU thread until a request has completed.
+         *
+         * @return Success upon correct execution of the operation.
+         * @return NotReady if the request hasn't been submitted through flush() yet, in which case waiting on it would never return.
+         * @return Device::waitFence() defined result values.
+        */
+        result wait(const streaming_request& request);
+
+        /**
+         * @brief Block the CPU thread until all submitted uploads have completed.
+         *
+         * @return Success upon correct execution of the operation.
+         * @return Device::waitFence() defined result values.
+        */
+        result waitIdle();
+
+        /**
+         * @brief The number of bytes in the staging buffer that are taken by uploads that were enqueued but not yet submitted.
+        */
+        [[nodiscard]] uint64_t queryQueuedBytes();
+
+    private:
+        struct queued_upload
+        {
+            Resource* resource;
+            resource_state state;
+            uint64_t dstOffset;
+            uint64_t size;
+            texture_copy_desc textureCopy;
+            uint64_t ringOffset;
+            uint64_t ringEnd;
+            bool ready;
+        };
+
+        struct in_flight
+        {
+            CommandList* prepareList;
+            CommandList* copyList;
+            CommandList* finishList;
+            std::array<Semaphore*, 2> semaphores;
+            Fence* fence;
+            uint64_t value;
+            uint64_t ringEnd;
+        };
+
+        result allocate(queued_upload upload, uint64_t alignment, uint64_t* value, uint8_t** data);
+
+        result record(size_t count, in_flight* batch);
+        result acquireSemaphore(Semaphore** semaphore);
+        result acquireFence(Fence** fence);
+        void release(const in_flight& batch);
+        result poll(uint64_t waitValue);
+
+        Device* m_device = nullptr;
+        streaming_uploader_desc m_desc {};
+
+        Queue* m_transferQueue = nullptr;
+        Queue* m_destinationQueue = nullptr;
+        CommandGroup* m_transferGroup = nullptr;
+        CommandGroup* m_destinationGroup = nullptr;
+
+        Resource* m_ring = nullptr;
+        uint8_t* m_ringData = nullptr;
+        uint64_t m_ringHead = 0;
+        uint64_t m_ringTail = 0;
+
+        std::mutex m_mutex;
+        std::vector<queued_upload> m_queued;
+        std::vector<in_flight> m_inFlight;
+        uint64_t m_enqueued = 0;
+        uint64_t m_submitted = 0;
+        uint64_t m_completed = 0;
+
+        std::vector<Semaphore*> m_freeSemaphores;
+        std::vector<Fence*> m_freeFences;
+    };
+}
@@ -0,0 +1,551 @@
+/**
+ * @file streaming_uploader.inl
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+#include <llri/llri.hpp> // unnecessary but helps intellisense
+
+namespace llri
+{
+    inline result streaming_uploader::create(Device* device, const streaming_uploader_desc& desc)
+    {
+        if (device == nullptr || desc.ringSize == 0)
+            return result::ErrorInvalidUsage;
+
+        if (desc.destination != queue_type::Graphics && desc.destination != queue_type::Compute)
+            return result::ErrorInvalidUsage;
+
+        if (device->queryQueueCount(desc.destination) == 0)
+            return result::ErrorFeatureNotSupported;
+
+        destroy();
+
+        m_device = device;
+        m_desc = desc;
+        m_destinationQueue = device->getQueue(desc.destination, 0);
+        if (device->queryQueueCount(queue_type::Transfer) > 0)
+            m_transferQueue = device->getQueue(queue_type::Transfer, 0);
+
+        result r = device->createCommandGroup(desc.destination, &m_destinationGroup);
+        if (r == result::Success && m_transferQueue != nullptr)
+            r = device->createCommandGroup(queue_type::Transfer, &m_transferGroup);
+
+        if (r == result::Success)
+            r = device->createResource(resource_desc::buffer(resource_usage_flag_bits::TransferSrc, memory_type::Upload, resource_state::Upload, desc.ringSize, desc.nodeMask, desc.nodeMask), &m_ring);
+
+        void* data = nullptr;
+        if (r == result::Success)
+            r = device->mapResource(m_ring, &data);
+
+        if (r != result::Success)
+        {
+            destroy();
+            return r;
+        }
+
+        m_ringData = static_cast<uint8_t*>(data);
+        return result::Success;
+    }
+
+    inline void streaming_uploader::destroy()
+    {
+        if (m_device == nullptr)
+            return;
+
+        static_cast<void>(waitIdle());
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        for (const auto& batch : m_inFlight)
+        {
+            release(batch);
+            m_device->destroyFence(batch.fence);
+        }
+
+        for (auto* semaphore : m_freeSemaphores)
+            m_device->destroySemaphore(semaphore);
+        for (auto* fence : m_freeFences)
+            m_device->destroyFence(fence);
+
+        if (m_ring != nullptr)
+        {
+            m_device->unmapResource(m_ring);
+            m_device->destroyResource(m_ring);
+        }
+
+        if (m_transferGroup != nullptr)
+            m_device->destroyCommandGroup(m_transferGroup);
+        if (m_destinationGroup != nullptr)
+            m_device->destroyCommandGroup(m_destinationGroup);
+
+        m_freeSemaphores.clear();
+        m_freeFences.clear();
+        m_inFlight.clear();
+        m_queued.clear();
+
+        m_transferQueue = nullptr;
+        m_destinationQueue = nullptr;
+        m_transferGroup = nullptr;
+        m_destinationGroup = nullptr;
+        m_ring = nullptr;
+        m_ringData = nullptr;
+        m_ringHead = m_ringTail = 0;
+        m_enqueued = m_submitted = m_completed = 0;
+        m_device = nullptr;
+    }
+
+    inline result streaming_uploader::enqueue(const streaming_buffer_upload& upload, streaming_request* request)
+    {
+        if (upload.data == nullptr)
+            return result::ErrorInvalidUsage;
+
+        streaming_buffer_reservation reservation;
+        const result r = reserve(upload, &reservation);
+        if (r != result::Success)
+            return r;
+
+        // the copy happens outside of the lock so that threads can fill the ring simultaneously
+        std::memcpy(reservation.data, upload.data, upload.size);
+        commit(reservation.request);
+
+        if (request != nullptr)
+            *request = reservation.request;
+        return result::Success;
+    }
+
+    inline result streaming_uploader::reserve(const streaming_buffer_upload& upload, streaming_buffer_reservation* reservation)
+    {
+        if (upload.buffer == nullptr || reservation == nullptr || upload.size == 0 || upload.state > resource_state::MaxEnum)
+            return result::ErrorInvalidUsage;
+
+        const resource_desc desc = upload.buffer->getDesc();
+        if (desc.type != resource_type::Buffer || desc.memoryType != memory_type::Local || !desc.usage.contains(resource_usage_flag_bits::TransferDst))
+            return result::ErrorInvalidUsage;
+
+        if (upload.offset + upload.size > desc.width)
+            return result::ErrorInvalidUsage;
+
+        uint8_t* data = nullptr;
+        uint64_t value = 0;
+        const queued_upload queued { upload.buffer, upload.state, upload.offset, upload.size, texture_copy_desc {}, 0, 0, false };
+        const result r = allocate(queued, 16, &value, &data);
+        if (r != result::Success)
+            return r;
+
+        *reservation = streaming_buffer_reservation { data, streaming_request { value } };
+        return result::Success;
+    }
+
+    inline result streaming_uploader::enqueue(const streaming_texture_upload& upload, streaming_request* request)
+    {
+        if (upload.data == nullptr)
+            return result::ErrorInvalidUsage;
+
+        streaming_texture_reservation reservation;
+        const result r = reserve(upload, &reservation);
+        if (r != result::Success)
+            return r;
+
+        const uint64_t rowSize = upload.extent.width * static_cast<uint64_t>(format_size(upload.texture->getDesc().textureFormat));
+        const uint64_t dataRowPitch = upload.dataRowPitch != 0 ? upload.dataRowPitch : rowSize;
+        const uint64_t numRows = static_cast<uint64_t>(upload.extent.height) * upload.extent.depth;
+
+        const auto* src = static_cast<const uint8_t*>(upload.data);
+        for (uint64_t row = 0; row < numRows; row++)
+            std::memcpy(reservation.data + row * reservation.rowPitch, src + row * dataRowPitch, rowSize);
+
+        commit(reservation.request);
+
+        if (request != nullptr)
+            *request = reservation.request;
+        return result::Success;
+    }
+
+    inline result streaming_uploader::reserve(const streaming_texture_upload& upload, streaming_texture_reservation* reservation)
+    {
+        if (upload.texture == nullptr || reservation == nullptr || upload.state > resource_state::MaxEnum)
+            return result::ErrorInvalidUsage;
+
+        const resource_desc desc = upload.texture->getDesc();
+        if (desc.type == resource_type::Buffer || desc.sampleCount != sample_count::Count1 || !has_color_component(desc.textureFormat) || !desc.usage.contains(resource_usage_flag_bits::TransferDst))
+            return result::ErrorInvalidUsage;
+
+        if (upload.mipLevel >= desc.mipLevels || upload.arrayLayer >= (desc.type == resource_type::Texture3D ? 1u : desc.depthOrArrayLayers))
+            return result::ErrorInvalidUsage;
+
+        const extent_3d mip = detail::mipExtent(desc, upload.mipLevel);
+        if (upload.extent.width == 0 || upload.extent.height == 0 || upload.extent.depth == 0 || upload.textureOffset.x < 0 || upload.textureOffset.y < 0 || upload.textureOffset.z < 0)
+            return result::ErrorInvalidUsage;
+
+        if (static_cast<uint32_t>(upload.textureOffset.x) + upload.extent.width > mip.width || static_cast<uint32_t>(upload.textureOffset.y) + upload.extent.height > mip.height || static_cast<uint32_t>(upload.textureOffset.z) + upload.extent.depth > mip.depth)
+            return result::ErrorInvalidUsage;
+
+        const uint64_t texelSize = format_size(desc.textureFormat);
+        const uint64_t rowSize = upload.extent.width * texelSize;
+        if (upload.dataRowPitch != 0 && upload.dataRowPitch < rowSize)
+            return result::ErrorInvalidUsage;
+
+        // CommandList::copyBufferToTexture() requires the offset and row pitch to be multiples of both the texel size and 512 or 256 bytes respectively
+        uint64_t offsetAlignment = 512;
+        while (offsetAlignment % texelSize != 0)
+            offsetAlignment += 512;
+
+        uint64_t pitchAlignment = 256;
+        while (pitchAlignment % texelSize != 0)
+            pitchAlignment += 256;
+
+        const uint64_t rowPitch = (rowSize + pitchAlignment - 1) / pitchAlignment * pitchAlignment;
+        const uint64_t numRows = static_cast<uint64_t>(upload.extent.height) * upload.extent.depth;
+        const texture_copy_desc copy { nullptr, 0, static_cast<uint32_t>(rowPitch), upload.texture, upload.mipLevel, upload.arrayLayer, upload.textureOffset, upload.extent };
+
+        uint8_t* data = nullptr;
+        uint64_t value = 0;
+        const queued_upload queued { upload.texture, upload.state, 0, rowPitch * numRows, copy, 0, 0, false };
+        const result r = allocate(queued, offsetAlignment, &value, &data);
+        if (r != result::Success)
+            return r;
+
+        *reservation = streaming_texture_reservation { data, static_cast<uint32_t>(rowPitch), streaming_request { value } };
+        return result::Success;
+    }
+
+    inline void streaming_uploader::commit(const streaming_request& request)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        // queued uploads are the ones after the last submitted upload, in order
+        if (request.value > m_submitted && request.value - m_submitted - 1 < m_queued.size())
+            m_queued[request.value - m_submitted - 1].ready = true;
+    }
+
+    inline result streaming_uploader::flush()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (m_device == nullptr)
+            return result::ErrorInvalidUsage;
+
+        result r = poll(0);
+        if (r != result::Success)
+            return r;
+
+        // uploads are submitted in order, so the first upload that is still being copied into the ring ends the batch
+        size_t count = 0;
+        uint64_t bytes = 0;
+        while (count < m_queued.size() && m_queued[count].ready)
+        {
+            if (count > 0 && m_desc.flushBudget != 0 && bytes + m_queued[count].size > m_desc.flushBudget)
+                break;
+
+            bytes += m_queued[count].size;
+            count++;
+        }
+
+        if (count == 0)
+            return result::Success;
+
+        in_flight batch { nullptr, nullptr, nullptr, { nullptr, nullptr }, nullptr, m_submitted + count, m_queued[count - 1].ringEnd };
+        r = record(count, &batch);
+
+        if (r == result::Success)
+            r = acquireFence(&batch.fence);
+
+        if (r == result::Success)
+        {
+            if (m_transferQueue != nullptr)
+            {
+                Semaphore* released[] = { batch.semaphores[0] };
+                Semaphore* copied[] = { batch.semaphores[1] };
+
+                r = m_destinationQueue->submit(submit_desc { m_desc.nodeMask, 1, &batch.prepareList, 0, nullptr, 1, released, nullptr });
+                if (r == result::Success)
+                    r = m_transferQueue->submit(submit_desc { m_desc.nodeMask, 1, &batch.copyList, 1, released, 1, copied, nullptr });
+                if (r == result::Success)
+                    r = m_destinationQueue->submit(submit_desc { m_desc.nodeMask, 1, &batch.finishList, 1, copied, 0, nullptr, batch.fence });
+            }
+            else
+            {
+                r = m_destinationQueue->submit(submit_desc { m_desc.nodeMask, 1, &batch.copyList, 0, nullptr, 0, nullptr, batch.fence });
+            }
+        }
+
+        if (r != result::Success)
+        {
+            // the uploads remain queued, a Fence that was never submitted would never be signaled
+            release(batch);
+            if (batch.fence != nullptr)
+                m_freeFences.push_back(batch.fence);
+            return r;
+        }
+
+        m_queued.erase(m_queued.begin(), m_queued.begin() + static_cast<ptrdiff_t>(count));
+        m_inFlight.push_back(batch);
+        m_submitted = batch.value;
+        return result::Success;
+    }
+
+    inline bool streaming_uploader::isComplete(const streaming_request& request)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (request.value <= m_completed)
+            return true;
+
+        return poll(0) == result::Success && request.value <= m_completed;
+    }
+
+    inline result streaming_uploader::wait(const streaming_request& request)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (request.value <= m_completed)
+            return result::Success;
+
+        if (request.value > m_submitted)
+            return result::NotReady;
+
+        return poll(request.value);
+    }
+
+    inline result streaming_uploader::waitIdle()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return poll(m_submitted);
+    }
+
+    inline uint64_t streaming_uploader::queryQueuedBytes()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        uint64_t bytes = 0;
+        for (const auto& upload : m_queued)
+            bytes += upload.size;
+        return bytes;
+    }
+
+    inline result streaming_uploader::allocate(queued_upload upload, uint64_t alignment, uint64_t* value, uint8_t** data)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (m_device == nullptr || upload.size > m_desc.ringSize)
+            return result::ErrorInvalidUsage;
+
+        const result r = poll(0);
+        if (r != result::Success)
+            return r;
+
+        // ring positions only ever increase, the offset into the buffer is the position modulo the ring's size
+        const uint64_t ringSize = m_desc.ringSize;
+        if (m_ringHead == m_ringTail)
+            m_ringHead = m_ringTail = (m_ringHead + ringSize - 1) / ringSize * ringSize;
+
+        uint64_t lap = m_ringHead - m_ringHead % ringSize;
+        uint64_t offset = (m_ringHead % ringSize + alignment - 1) / alignment * alignment;
+        if (offset + upload.size > ringSize)
+        {
+            lap += ringSize;
+            offset = 0;
+        }
+
+        if (lap + offset + upload.size - m_ringTail > ringSize)
+            return result::NotReady;
+
+        m_ringHead = lap + offset + upload.size;
+
+        upload.ringOffset = offset;
+        upload.ringEnd = m_ringHead;
+        m_queued.push_back(upload);
+
+        *value = ++m_enqueued;
+        *data = m_ringData + offset;
+        return result::Success;
+    }
+
+    inline result streaming_uploader::record(size_t count, in_flight* batch)
+    {
+        // uploads to the same resource share their barriers
+        std::vector<std::pair<Resource*, resource_state>> resources;
+        for (size_t i = 0; i < count; i++)
+        {
+            const queued_upload& upload = m_queued[i];
+            if (std::none_of(resources.begin(), resources.end(), [&upload](const std::pair<Resource*, resource_state>& r) { return r.first == upload.resource; }))
+                resources.emplace_back(upload.resource, upload.state);
+        }
+
+        // resources are copied to in TransferDst on the destination Queue, and in General, the only state that Transfer Queues support, on the Transfer Queue
+        const resource_state copyState = m_transferQueue != nullptr ? resource_state::General : resource_state::TransferDst;
+        std::vector<resource_barrier> toCopyState, fromCopyState;
+        for (const auto& [resource, state] : resources)
+        {
+            if (state != copyState)
+            {
+                toCopyState.push_back(resource_barrier::transition(resource, state, copyState));
+                fromCopyState.push_back(resource_barrier::transition(resource, copyState, state));
+            }
+        }
+
+        auto recordList = [this](CommandGroup* group, CommandList** cmd, const std::function<result(CommandList*)>& commands)
+        {
+            result r = group->allocate(command_list_alloc_desc { m_desc.nodeMask, command_list_usage::Direct }, cmd);
+            if (r == result::Success)
+                r = (*cmd)->begin(command_list_begin_desc {});
+            if (r == result::Success)
+                r = commands(*cmd);
+            if (r == result::Success)
+                r = (*cmd)->end();
+            return r;
+        };
+
+        auto barriers = [](CommandList* cmd, const std::vector<resource_barrier>& b)
+        {
+            return b.empty() ? result::Success : cmd->resourceBarrier(static_cast<uint32_t>(b.size()), b.data());
+        };
+
+        auto copies = [this, count](CommandList* cmd)
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                const queued_upload& upload = m_queued[i];
+
+                result r;
+                if (upload.textureCopy.texture != nullptr)
+                {
+                    texture_copy_desc copy = upload.textureCopy;
+                    copy.buffer = m_ring;
+                    copy.bufferOffset = upload.ringOffset;
+                    r = cmd->copyBufferToTexture(copy);
+                }
+                else
+                {
+                    r = cmd->copyBuffer(m_ring, upload.ringOffset, upload.resource, upload.dstOffset, upload.size);
+                }
+
+                if (r != result::Success)
+                    return r;
+            }
+
+            return result::Success;
+        };
+
+        if (m_transferQueue == nullptr)
+        {
+            return recordList(m_destinationGroup, &batch->copyList, [&](CommandList* cmd)
+            {
+                result r = barriers(cmd, toCopyState);
+                if (r == result::Success)
+                    r = copies(cmd);
+                if (r == result::Success)
+                    r = barriers(cmd, fromCopyState);
+                return r;
+            });
+        }
+
+        const queue_type destination = m_desc.destination;
+        std::vector<resource_barrier> toTransfer, fromTransfer, toDestination, fromDestination;
+        for (const auto& resource : resources)
+        {
+            toTransfer.push_back(resource_barrier::release(resource.first, copyState, destination, queue_type::Transfer));
+            fromDestination.push_back(resource_barrier::acquire(resource.first, copyState, destination, queue_type::Transfer));
+            toDestination.push_back(resource_barrier::release(resource.first, copyState, queue_type::Transfer, destination));
+            fromTransfer.push_back(resource_barrier::acquire(resource.first, copyState, queue_type::Transfer, destination));
+        }
+
+        result r = acquireSemaphore(&batch->semaphores[0]);
+        if (r == result::Success)
+            r = acquireSemaphore(&batch->semaphores[1]);
+
+        if (r == result::Success)
+        {
+            r = recordList(m_destinationGroup, &batch->prepareList, [&](CommandList* cmd)
+            {
+                const result br = barriers(cmd, toCopyState);
+                return br == result::Success ? barriers(cmd, toTransfer) : br;
+            });
+        }
+
+        if (r == result::Success)
+        {
+            r = recordList(m_transferGroup, &batch->copyList, [&](CommandList* cmd)
+            {
+                result cr = barriers(cmd, fromDestination);
+                if (cr == result::Success)
+                    cr = copies(cmd);
+                if (cr == result::Success)
+                    cr = barriers(cmd, toDestination);
+                return cr;
+            });
+        }
+
+        if (r == result::Success)
+        {
+            r = recordList(m_destinationGroup, &batch->finishList, [&](CommandList* cmd)
+            {
+                const result br = barriers(cmd, fromTransfer);
+                return br == result::Success ? barriers(cmd, fromCopyState) : br;
+            });
+        }
+
+        return r;
+    }
+
+    inline result streaming_uploader::acquireSemaphore(Semaphore** semaphore)
+    {
+        if (m_freeSemaphores.empty())
+            return m_device->createSemaphore(semaphore);
+
+        *semaphore = m_freeSemaphores.back();
+        m_freeSemaphores.pop_back();
+        return result::Success;
+    }
+
+    inline result streaming_uploader::acquireFence(Fence** fence)
+    {
+        if (m_freeFences.empty())
+            return m_device->createFence(fence_flag_bits::None, fence);
+
+        *fence = m_freeFences.back();
+        m_freeFences.pop_back();
+        return result::Success;
+    }
+
+    inline void streaming_uploader::release(const in_flight& batch)
+    {
+        if (batch.prepareList != nullptr)
+            static_cast<void>(m_destinationGroup->free(batch.prepareList));
+        if (batch.finishList != nullptr)
+            static_cast<void>(m_destinationGroup->free(batch.finishList));
+        if (batch.copyList != nullptr)
+            static_cast<void>((m_transferQueue != nullptr ? m_transferGroup : m_destinationGroup)->free(batch.copyList));
+
+        for (auto* semaphore : batch.semaphores)
+        {
+            if (semaphore != nullptr)
+                m_freeSemaphores.push_back(semaphore);
+        }
+    }
+
+    inline result streaming_uploader::poll(uint64_t waitValue)
+    {
+        // batches complete in order, so polling stops at the first batch that hasn't completed
+        // batches up to waitValue are waited on instead
+        result r = result::Success;
+        size_t completed = 0;
+        for (; completed < m_inFlight.size(); completed++)
+        {
+            const in_flight& batch = m_inFlight[completed];
+            r = m_device->waitFence(batch.fence, batch.value <= waitValue ? LLRI_TIMEOUT_MAX : 0);
+            if (r != result::Success)
+                break;
+
+            release(batch);
+            m_freeFences.push_back(batch.fence);
+            m_completed = batch.value;
+            m_ringTail = batch.ringEnd;
+        }
+
+        m_inFlight.erase(m_inFlight.begin(), m_inFlight.begin() + static_cast<ptrdiff_t>(completed));
+        return r == result::Timeout ? result::Success : r;
+    }
+}
@@ -0,0 +1,210 @@
+/**
+ * @file trace.hpp
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+#include <llri/llri.hpp> // unnecessary but helps intellisense
+
+namespace llri
+{
+    enum struct queue_type : uint8_t;
+
+    /**
+     * @brief Enable or disable recording of trace spans. Tracing is disabled by default.
+     *
+     * If LLRI is compiled with LLRI_ENABLE_TRACING, every LLRI call that calls into the implementation records a span with its name, thread and duration while tracing is enabled.
+     * Without LLRI_ENABLE_TRACING, no CPU spans are recorded and only spans added through traceGPUSpan() end up in the trace.
+     *
+     * @note This function is thread-safe.
+    */
+    inline void setTraceEnabled(bool enabled);
+
+    /**
+     * @brief Returns true if trace spans are currently being recorded.
+    */
+    [[nodiscard]] inline bool isTraceEnabled();
+
+    /**
+     * @brief Record a GPU span, measured with two timestamps written by CommandList::writeTimestamp().
+     * GPU spans are placed on a separate track from the CPU spans, with a track per Queue because spans of different queues **may** overlap without nesting.
+     *
+     * GPU timestamps have their own time base, so the GPU track is rebased such that the earliest GPU span starts when the earliest recorded Queue::submit() returned.
+     * This places GPU work roughly where it executed but it isn't an exact clock calibration.
+     *
+     * @param queueType The type of the Queue that executed the timestamps.
+     * @param queueIndex The index of the Queue that executed the timestamps, as passed to Device::getQueue().
+     * @param name The name of the span. The name is copied.
+     * @param beginTimestamp The timestamp at the start of the span.
+     * @param endTimestamp The timestamp at the end of the span.
+     * @param timestampPeriod The timestamp period of the Adapter that wrote the timestamps, see adapter_limits::timestampPeriod.
+     *
+     * @note This function is thread-safe. GPU spans are recorded even if tracing is disabled, so that they can be collected independently of the CPU spans.
+    */
+    inline void traceGPUSpan(queue_type queueType, uint8_t queueIndex, std::string_view name, uint64_t beginTimestamp, uint64_t endTimestamp, float timestampPeriod);
+
+    /**
+     * @brief Remove all recorded CPU and GPU spans.
+     *
+     * @note This function is thread-safe.
+    */
+    inline void clearTrace();
+
+    /**
+     * @brief Write all recorded spans to stream as Chrome trace event JSON, which can be opened in chrome://tracing or Perfetto.
+     * CPU spans are grouped per thread in the "LLRI CPU" process, GPU spans are grouped per Queue in the "LLRI GPU" process.
+     *
+     * @note This function is thread-safe, but spans that are being recorded while the trace is written **may** not be included.
+    */
+    inline void writeTrace(std::ostream& stream);
+
+    namespace detail
+    {
+        /**
+         * @brief A recorded span in nanoseconds since the trace epoch.
+        */
+        struct trace_span
+        {
+            const char* name;
+            uint64_t begin;
+            uint64_t end;
+        };
+
+        /**
+         * @brief A recorded GPU span in nanoseconds in the GPU's time base.
+        */
+        struct trace_gpu_span
+        {
+            queue_type queueType;
+            uint8_t queueIndex;
+            std::string name;
+            uint64_t begin;
+            uint64_t end;
+        };
+
+        /**
+         * @brief Spans recorded by a single thread. Each thread only contends on its own mutex while recording.
+        */
+        struct trace_thread_buffer
+        {
+            uint32_t threadId;
+            std::mutex mutex;
+            std::vector<trace_span> spans;
+        };
+
+        /**
+         * @brief Global trace state, not part of the public API - should not be accessed directly but instead through the trace functions.
+        */
+        inline std::atomic<bool> m_traceEnabled { false };
+        inline const std::chrono::steady_clock::time_point m_traceEpoch = std::chrono::steady_clock::now();
+
+        inline std::mutex m_traceMutex;
+        inline std::vector<std::unique_ptr<trace_thread_buffer>> m_traceBuffers;
+        inline std::vector<trace_gpu_span> m_traceGPUSpans;
+
+        inline uint64_t traceNow()
+        {
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_traceEpoch).count());
+        }
+
+        inline trace_thread_buffer& traceThreadBuffer()
+        {
+            // buffers are owned by m_traceBuffers so that their spans outlive the thread that recorded them
+            thread_local trace_thread_buffer* buffer = nullptr;
+            if (!buffer)
+            {
+                std::lock_guard lock(m_traceMutex);
+                auto& created = m_traceBuffers.emplace_back(std::make_unique<trace_thread_buffer>());
+                created->threadId = static_cast<uint32_t>(m_traceBuffers.size());
+                buffer = created.get();
+            }
+
+            return *buffer;
+        }
+
+        /**
+         * @brief The track id of a Queue's GPU spans, unique per queue type and index. Track 0 is left unused.
+        */
+        constexpr uint32_t traceGPUTrack(queue_type queueType, uint8_t queueIndex)
+        {
+            return (static_cast<uint32_t>(queueType) << 8u | queueIndex) + 1;
+        }
+
+        /**
+         * @brief Records a span from construction until destruction, if tracing was enabled at construction.
+        */
+        class trace_scope
+        {
+        public:
+            explicit trace_scope(const char* name) noexcept : m_name(name)
+            {
+                if (m_traceEnabled.load(std::memory_order_relaxed))
+                    m_begin = traceNow();
+            }
+
+            trace_scope(const trace_scope&) = delete;
+            trace_scope& operator=(const trace_scope&) = delete;
+
+            ~trace_scope()
+            {
+                if (m_begin == noSpan)
+                    return;
+
+                const uint64_t end = traceNow();
+                trace_thread_buffer& buffer = traceThreadBuffer();
+                std::lock_guard lock(buffer.mutex);
+                buffer.spans.push_back(trace_span { m_name, m_begin, end });
+            }
+
+        private:
+            static constexpr uint64_t noSpan = std::numeric_limits<uint64_t>::max();
+
+            const char* m_name;
+            uint64_t m_begin = noSpan;
+        };
+
+        inline void writeTraceString(std::ostream& stream, std::string_view str)
+        {
+            stream << '"';
+            for (const char c : str)
+            {
+                if (c == '"' || c == '\\')
+                    stream << '\\' << c;
+                else if (static_cast<unsigned char>(c) < 0x20)
+                    stream << ' ';
+                else
+                    stream << c;
+            }
+            stream << '"';
+        }
+
+        inline void writeTraceEvent(std::ostream& stream, bool& first, std::string_view name, uint32_t pid, uint32_t tid, uint64_t begin, uint64_t end)
+        {
+            stream << (first ? "\n" : ",\n") << R"({"name":)";
+            writeTraceString(stream, name);
+            // trace event timestamps are in microseconds
+            stream << R"(,"cat":"llri","ph":"X","pid":)" << pid << R"(,"tid":)" << tid
+                << R"(,"ts":)" << static_cast<double>(begin) / 1000.0
+                << R"(,"dur":)" << static_cast<double>(end - begin) / 1000.0 << "}";
+            first = false;
+        }
+
+        inline void writeTraceMetadata(std::ostream& stream, bool& first, const char* type, uint32_t pid, uint32_t tid, std::string_view name)
+        {
+            stream << (first ? "\n" : ",\n") << R"({"name":")" << type << R"(","ph":"M","pid":)" << pid << R"(,"tid":)" << tid << R"(,"args":{"name":)";
+            writeTraceString(stream, name);
+            stream << "}}";
+            first = false;
+        }
+    }
+}
+
+#ifdef LLRI_ENABLE_TRACING
+/**
+ * @brief Records a trace span for the remainder of the enclosing scope, named after the enclosing function.
+*/
+#define LLRI_DETAIL_TRACE_SCOPE() const detail::trace_scope llriTraceScope(__func__);
+#else
+#define LLRI_DETAIL_TRACE_SCOPE()
+#endif
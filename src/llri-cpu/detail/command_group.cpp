@@ -0,0 +1,71 @@
+/**
+ * @file command_group.cpp
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <llri/llri.hpp>
+#include <llri-cpu/utils.hpp>
+
+namespace llri
+{
+    result CommandGroup::impl_reset()
+    {
+        for (auto* cmdList : m_cmdLists)
+        {
+            static_cast<detail::cpu_command_list*>(cmdList->m_ptr)->commands.clear();
+            cmdList->m_state = command_list_state::Empty;
+        }
+
+        return result::Success;
+    }
+
+    result CommandGroup::impl_allocate(const command_list_alloc_desc& desc, CommandList** cmdList)
+    {
+        auto* output = m_cmdLists.allocate();
+        output->m_ptr = new detail::cpu_command_list();
+        output->m_group = this;
+
+        output->m_deviceHandle = m_device->m_ptr;
+        output->m_deviceFunctionTable = m_deviceFunctionTable;
+
+        output->m_desc = desc;
+        output->m_state = command_list_state::Empty;
+
+        output->m_validationCallbackMessenger = m_validationCallbackMessenger;
+        output->m_validationLevel = m_validationLevel;
+        output->m_messageTarget = m_messageTarget;
+        output->m_statistics = m_statistics;
+
+        *cmdList = output;
+        return result::Success;
+    }
+
+    result CommandGroup::impl_allocate(const command_list_alloc_desc& desc, uint8_t count, std::vector<CommandList*>* cmdLists)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            CommandList* cmdList;
+            impl_allocate(desc, &cmdList);
+            cmdLists->push_back(cmdList);
+        }
+
+        return result::Success;
+    }
+
+    result CommandGroup::impl_free(CommandList* cmdList)
+    {
+        // Delete wrapper
+        delete static_cast<detail::cpu_command_list*>(cmdList->m_ptr);
+        m_cmdLists.free(cmdList);
+        return result::Success;
+    }
+
+    result CommandGroup::impl_free(uint8_t numCommandLists, CommandList** cmdLists)
+    {
+        for (size_t i = 0; i < numCommandLists; i++)
+            impl_free(cmdLists[i]);
+
+        return result::Success;
+    }
+}
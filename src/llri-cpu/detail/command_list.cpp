@@ -0,0 +1,144 @@
+/**
+ * @file command_list.cpp
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <llri/llri.hpp>
+#include <llri-cpu/utils.hpp>
+
+namespace llri
+{
+    namespace detail
+    {
+        /**
+         * @brief Describes the copy between a texture subresource region and a buffer region, in the direction from the buffer to the texture.
+        */
+        cpu_copy_region textureCopyRegion(const texture_copy_desc& desc, uint8_t* bufferMemory, uint8_t* textureMemory, const resource_desc& textureDesc)
+        {
+            const uint64_t texelSize = format_size(textureDesc.textureFormat);
+            const extent_3d mip = mipExtent(textureDesc, desc.mipLevel);
+
+            const uint64_t textureRowPitch = mip.width * texelSize;
+            const uint64_t textureSlicePitch = textureRowPitch * mip.height;
+            const uint64_t textureOffset = subresourceOffset(textureDesc, desc.mipLevel, desc.arrayLayer) +
+                static_cast<uint64_t>(desc.textureOffset.z) * textureSlicePitch +
+                static_cast<uint64_t>(desc.textureOffset.y) * textureRowPitch +
+                static_cast<uint64_t>(desc.textureOffset.x) * texelSize;
+
+            return cpu_copy_region {
+                bufferMemory + desc.bufferOffset,
+                textureMemory + textureOffset,
+                desc.extent.width * texelSize,
+                desc.extent.height,
+                desc.extent.depth,
+                desc.bufferRowPitch,
+                static_cast<uint64_t>(desc.bufferRowPitch) * desc.extent.height,
+                textureRowPitch,
+                textureSlicePitch
+            };
+        }
+    }
+
+    result CommandList::impl_begin([[maybe_unused]] const command_list_begin_desc& desc)
+    {
+        static_cast<detail::cpu_command_list*>(m_ptr)->commands.clear();
+
+        m_state = command_list_state::Recording;
+        return result::Success;
+    }
+
+    result CommandList::impl_end()
+    {
+        m_state = command_list_state::Ready;
+        return result::Success;
+    }
+
+    result CommandList::impl_resourceBarrier([[maybe_unused]] uint32_t numBarriers, [[maybe_unused]] const resource_barrier* barriers)
+    {
+        // commands are executed in order and every command completes before the next one starts, so there's nothing to synchronize
+        return result::Success;
+    }
+
+    result CommandList::impl_resetQueries(QueryPool* pool, uint32_t first, uint32_t count)
+    {
+        static_cast<detail::cpu_command_list*>(m_ptr)->commands.push_back(detail::cpu_command {
+            detail::cpu_command_type::ResetQueries, static_cast<detail::cpu_query_pool*>(pool->m_ptr), first, count, {}
+        });
+        return result::Success;
+    }
+
+    result CommandList::impl_writeTimestamp(QueryPool* pool, uint32_t index)
+    {
+        static_cast<detail::cpu_command_list*>(m_ptr)->commands.push_back(detail::cpu_command {
+            detail::cpu_command_type::WriteTimestamp, static_cast<detail::cpu_query_pool*>(pool->m_ptr), index, 1, {}
+        });
+        return result::Success;
+    }
+
+    result CommandList::impl_beginQuery([[maybe_unused]] QueryPool* pool, [[maybe_unused]] uint32_t index)
+    {
+        // the query only becomes available at endQuery()
+        return result::Success;
+    }
+
+    result CommandList::impl_endQuery(QueryPool* pool, uint32_t index)
+    {
+        static_cast<detail::cpu_command_list*>(m_ptr)->commands.push_back(detail::cpu_command {
+            detail::cpu_command_type::EndQuery, static_cast<detail::cpu_query_pool*>(pool->m_ptr), index, 1, {}
+        });
+        return result::Success;
+    }
+
+    result CommandList::impl_copyQueryResults(QueryPool* pool, uint32_t first, uint32_t count, Resource* dst, uint64_t dstOffset)
+    {
+        // the copy region only holds the destination, the source is read from the pool when the command executes
+        detail::cpu_copy_region region {};
+        region.dst = static_cast<uint8_t*>(dst->m_hot->memory) + dstOffset;
+
+        static_cast<detail::cpu_command_list*>(m_ptr)->commands.push_back(detail::cpu_command {
+            detail::cpu_command_type::CopyQueryResults, static_cast<detail::cpu_query_pool*>(pool->m_ptr), first, count, region
+        });
+        return result::Success;
+    }
+
+    result CommandList::impl_copyBuffer(Resource* src, uint64_t srcOffset, Resource* dst, uint64_t dstOffset, uint64_t size)
+    {
+        const detail::cpu_copy_region region {
+            static_cast<uint8_t*>(src->m_hot->memory) + srcOffset,
+            static_cast<uint8_t*>(dst->m_hot->memory) + dstOffset,
+            size, 1, 1, size, size, size, size
+        };
+
+        static_cast<detail::cpu_command_list*>(m_ptr)->commands.push_back(detail::cpu_command {
+            detail::cpu_command_type::Copy, nullptr, 0, 0, region
+        });
+        return result::Success;
+    }
+
+    result CommandList::impl_copyBufferToTexture(const texture_copy_desc& desc)
+    {
+        const detail::cpu_copy_region region = detail::textureCopyRegion(desc,
+            static_cast<uint8_t*>(desc.buffer->m_hot->memory), static_cast<uint8_t*>(desc.texture->m_hot->memory), desc.texture->m_desc);
+
+        static_cast<detail::cpu_command_list*>(m_ptr)->commands.push_back(detail::cpu_command {
+            detail::cpu_command_type::Copy, nullptr, 0, 0, region
+        });
+        return result::Success;
+    }
+
+    result CommandList::impl_copyTextureToBuffer(const texture_copy_desc& desc)
+    {
+        // the same region as copyBufferToTexture(), in the opposite direction
+        detail::cpu_copy_region region = detail::textureCopyRegion(desc,
+            static_cast<uint8_t*>(desc.buffer->m_hot->memory), static_cast<uint8_t*>(desc.texture->m_hot->memory), desc.texture->m_desc);
+        std::swap(region.src, region.dst);
+        std::swap(region.srcRowPitch, region.dstRowPitch);
+        std::swap(region.srcSlicePitch, region.dstSlicePitch);
+
+        static_cast<detail::cpu_command_list*>(m_ptr)->commands.push_back(detail::cpu_command {
+            detail::cpu_command_type::Copy, nullptr, 0, 0, region
+        });
+        return result::Success;
+    }
+}
@@ -0,0 +1,428 @@
+/**
+ * @file device.cpp
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <llri/llri.hpp>
+#include <llri-cpu/utils.hpp>
+
+#if defined(__linux__)
+    #include <fcntl.h>
+    #include <sys/eventfd.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace llri
+{
+#if defined(__linux__)
+    namespace detail
+    {
+        /**
+         * @brief Maps size bytes of a memfd into shared memory, which other processes that map the same memfd can see.
+        */
+        void* mapSharedMemory(int fd, uint64_t size)
+        {
+            void* memory = mmap(nullptr, static_cast<size_t>(size), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            return memory == MAP_FAILED ? nullptr : memory;
+        }
+    }
+#endif
+
+    result Device::impl_createCommandGroup(queue_type type, CommandGroup** cmdGroup)
+    {
+        auto* output = new CommandGroup();
+        output->m_device = this;
+        output->m_deviceFunctionTable = m_functionTable;
+        output->m_validationCallbackMessenger = m_validationCallbackMessenger;
+        output->m_validationLevel = m_validationLevel;
+        output->m_messageTarget = m_messageTarget;
+        output->m_statistics = &m_statistics;
+        output->m_type = type;
+
+        *cmdGroup = output;
+        return result::Success;
+    }
+
+    void Device::impl_destroyCommandGroup(CommandGroup* cmdGroup)
+    {
+        // the CommandList wrappers are destroyed along with the CommandGroup's pool
+        for (auto* cmdList : cmdGroup->m_cmdLists)
+            delete static_cast<detail::cpu_command_list*>(cmdList->m_ptr);
+
+        delete cmdGroup;
+    }
+
+    result Device::impl_createFence(fence_flags flags, Fence** fence)
+    {
+        auto* sync = new detail::cpu_sync();
+        sync->signaled = (flags & fence_flag_bits::Signaled) == fence_flag_bits::Signaled;
+
+        auto* output = m_fences.allocate();
+        output->m_flags = flags;
+        output->m_ptr = sync;
+        output->m_signaled = sync->signaled;
+
+        *fence = output;
+        return result::Success;
+    }
+
+    void Device::impl_destroyFence(Fence* fence)
+    {
+        delete static_cast<detail::cpu_sync*>(fence->m_ptr);
+        m_fences.free(fence);
+    }
+
+    result Device::impl_waitFences(uint32_t numFences, Fence** fences, uint64_t timeout)
+    {
+        const auto deadline = timeout == LLRI_TIMEOUT_MAX ? std::chrono::steady_clock::time_point::max() : std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout);
+
+        for (size_t i = 0; i < numFences; i++)
+        {
+            if (!detail::waitUntil(*static_cast<detail::cpu_sync*>(fences[i]->m_ptr), deadline))
+                return result::Timeout;
+        }
+
+        for (size_t i = 0; i < numFences; i++)
+        {
+            auto* sync = static_cast<detail::cpu_sync*>(fences[i]->m_ptr);
+            std::lock_guard<std::mutex> lock(sync->mutex);
+            sync->signaled = false;
+            fences[i]->m_signaled = false;
+        }
+
+        return result::Success;
+    }
+
+    result Device::impl_createSemaphore(Semaphore** semaphore)
+    {
+        auto* output = m_semaphores.allocate();
+        output->m_ptr = new detail::cpu_sync();
+
+        *semaphore = output;
+        return result::Success;
+    }
+
+    void Device::impl_destroySemaphore(Semaphore* semaphore)
+    {
+        auto* sync = static_cast<detail::cpu_sync*>(semaphore->m_ptr);
+        detail::closeSyncFds(*sync);
+        delete sync;
+        m_semaphores.free(semaphore);
+    }
+
+    result Device::impl_createQueryPool(const query_pool_desc& desc, QueryPool** pool)
+    {
+        auto* queries = new detail::cpu_query_pool();
+        queries->results.resize(static_cast<size_t>(desc.count) * queryResultCount(desc.type), 0);
+        queries->available.resize(desc.count, false);
+
+        auto* output = new QueryPool();
+        output->m_desc = desc;
+        output->m_ptr = queries;
+        output->m_validationCallbackMessenger = m_validationCallbackMessenger;
+        output->m_validationLevel = m_validationLevel;
+        output->m_messageTarget = m_messageTarget;
+
+        *pool = output;
+        return result::Success;
+    }
+
+    void Device::impl_destroyQueryPool(QueryPool* pool)
+    {
+        delete static_cast<detail::cpu_query_pool*>(pool->m_ptr);
+        delete pool;
+    }
+
+    result Device::impl_createResource(const resource_desc& desc, Resource** resource)
+    {
+        // every resource is backed by zero-initialized host memory, textures store their subresources linearly
+        const uint64_t size = detail::resourceSize(desc);
+
+        auto* output = m_resources.allocate();
+        output->m_desc = desc;
+        output->m_hot->memory = new (std::nothrow) uint8_t[size] {};
+        output->m_allocationSize = size;
+
+        if (!output->m_hot->memory)
+        {
+            m_resources.free(output);
+            return result::ErrorOutOfDeviceMemory;
+        }
+
+        *resource = output;
+        return result::Success;
+    }
+
+    void Device::impl_destroyResource(Resource* resource)
+    {
+#if defined(__linux__)
+        if (!resource->m_heap)
+        {
+            auto* device = static_cast<detail::cpu_device*>(m_ptr);
+            std::unique_lock<std::mutex> lock(device->sharedMemoryMutex);
+
+            const auto it = device->sharedMemory.find(resource);
+            if (it != device->sharedMemory.end())
+            {
+                // shared memory is mapped, and is only released once every process unmapped it and closed its memfd
+                if (it->second >= 0)
+                    close(it->second);
+                device->sharedMemory.erase(it);
+                lock.unlock();
+
+                munmap(resource->m_hot->memory, static_cast<size_t>(detail::resourceSize(resource->m_desc)));
+                m_resources.free(resource);
+                return;
+            }
+        }
+#endif
+
+        // placed resources point into the memory of their heap, and imported memory is owned by the application
+        if (!resource->m_heap && !resource->m_imported)
+            delete[] static_cast<uint8_t*>(resource->m_hot->memory);
+
+        m_resources.free(resource);
+    }
+
+    result Device::impl_createMemoryHeap(const memory_heap_desc& desc, MemoryHeap** heap)
+    {
+        auto* memory = new (std::nothrow) uint8_t[desc.size] {};
+        if (!memory)
+            return result::ErrorOutOfDeviceMemory;
+
+        auto* output = new MemoryHeap();
+        output->m_desc = desc;
+        output->m_ptr = memory;
+
+        *heap = output;
+        return result::Success;
+    }
+
+    void Device::impl_destroyMemoryHeap(MemoryHeap* heap)
+    {
+        delete[] static_cast<uint8_t*>(heap->m_ptr);
+        delete heap;
+    }
+
+    result Device::impl_queryResourceAllocationInfo(const resource_desc& desc, resource_allocation_info* info)
+    {
+        *info = resource_allocation_info { detail::resourceSize(desc), detail::cpuResourceAlignment };
+        return result::Success;
+    }
+
+    result Device::impl_createPlacedResource(MemoryHeap* heap, uint64_t offset, const resource_desc& desc, Resource** resource)
+    {
+        // placed resources share the heap's host memory, so resources that overlap really alias each other
+        auto* output = m_resources.allocate();
+        output->m_desc = desc;
+        output->m_hot->memory = static_cast<uint8_t*>(heap->m_ptr) + offset;
+        output->m_heap = heap;
+        output->m_heapOffset = offset;
+
+        *resource = output;
+        return result::Success;
+    }
+
+    result Device::impl_mapResource(Resource* resource, void** data)
+    {
+        *data = resource->m_hot->memory;
+        return result::Success;
+    }
+
+    void Device::impl_unmapResource([[maybe_unused]] Resource* resource)
+    {
+        // the host memory stays allocated until the Resource is destroyed
+    }
+
+    result Device::impl_setSimulatedTimingEXT([[maybe_unused]] queue_type type, [[maybe_unused]] const simulated_timing_desc_ext& desc)
+    {
+        // work is executed for real, so its timing can't be simulated
+        return result::ErrorExtensionNotSupported;
+    }
+
+    result Device::impl_querySimulatedTimeEXT([[maybe_unused]] uint64_t* time) const
+    {
+        return result::ErrorExtensionNotSupported;
+    }
+
+    result Device::impl_advanceSimulatedTimeEXT([[maybe_unused]] uint64_t nanoseconds)
+    {
+        return result::ErrorExtensionNotSupported;
+    }
+
+    result Device::impl_importHostMemoryEXT(void* data, uint32_t size, Resource** resource)
+    {
+        // the host memory is used as the buffer's memory directly, so copies from the buffer read from it
+        auto* output = m_resources.allocate();
+        output->m_desc = resource_desc::buffer(resource_usage_flag_bits::TransferSrc, memory_type::Upload, resource_state::Upload, size);
+        output->m_hot->memory = data;
+        output->m_imported = true;
+
+        *resource = output;
+        return result::Success;
+    }
+
+    result Device::impl_createExportableResourceEXT([[maybe_unused]] const resource_desc& desc, [[maybe_unused]] external_memory_handle_type_ext handleType, [[maybe_unused]] Resource** resource)
+    {
+#if defined(__linux__)
+        // resources are backed by host memory, which can't be exported as a dma-buf
+        if (handleType != external_memory_handle_type_ext::OpaqueFd)
+            return result::ErrorExtensionNotSupported;
+
+        // the memory is a memfd instead of heap memory so that other processes can map it too, memfds are zero-initialized
+        const uint64_t size = detail::resourceSize(desc);
+        const int fd = memfd_create("llri-resource", MFD_CLOEXEC);
+        if (fd < 0)
+            return result::ErrorOutOfHostMemory;
+
+        void* memory = nullptr;
+        if (ftruncate(fd, static_cast<off_t>(size)) != 0 || (memory = detail::mapSharedMemory(fd, size)) == nullptr)
+        {
+            close(fd);
+            return result::ErrorOutOfDeviceMemory;
+        }
+
+        auto* output = m_resources.allocate();
+        output->m_desc = desc;
+        output->m_hot->memory = memory;
+        output->m_allocationSize = size;
+
+        auto* device = static_cast<detail::cpu_device*>(m_ptr);
+        {
+            std::lock_guard<std::mutex> lock(device->sharedMemoryMutex);
+            device->sharedMemory[output] = fd;
+        }
+
+        *resource = output;
+        return result::Success;
+#else
+        return result::ErrorExtensionNotSupported;
+#endif
+    }
+
+    result Device::impl_exportResourceMemoryFdEXT([[maybe_unused]] Resource* resource, [[maybe_unused]] int* fd)
+    {
+#if defined(__linux__)
+        auto* device = static_cast<detail::cpu_device*>(m_ptr);
+        std::lock_guard<std::mutex> lock(device->sharedMemoryMutex);
+
+        // every export returns a new file descriptor, which refers to the same memfd
+        const int output = fcntl(device->sharedMemory.at(resource), F_DUPFD_CLOEXEC, 0);
+        if (output < 0)
+            return result::ErrorOutOfHostMemory;
+
+        *fd = output;
+        return result::Success;
+#else
+        return result::ErrorExtensionNotSupported;
+#endif
+    }
+
+    result Device::impl_importResourceMemoryFdEXT([[maybe_unused]] const resource_desc& desc, [[maybe_unused]] external_memory_handle_type_ext handleType, [[maybe_unused]] int fd, [[maybe_unused]] Resource** resource)
+    {
+#if defined(__linux__)
+        if (handleType != external_memory_handle_type_ext::OpaqueFd)
+            return result::ErrorExtensionNotSupported;
+
+        const uint64_t size = detail::resourceSize(desc);
+        struct stat info {};
+        if (fstat(fd, &info) != 0 || static_cast<uint64_t>(info.st_size) < size)
+            return result::ErrorInvalidUsage;
+
+        void* memory = detail::mapSharedMemory(fd, size);
+        if (memory == nullptr)
+            return result::ErrorInvalidUsage;
+
+        // the mapping keeps the memfd alive, so the file descriptor isn't needed anymore
+        close(fd);
+
+        auto* output = m_resources.allocate();
+        output->m_desc = desc;
+        output->m_hot->memory = memory;
+
+        auto* device = static_cast<detail::cpu_device*>(m_ptr);
+        {
+            std::lock_guard<std::mutex> lock(device->sharedMemoryMutex);
+            device->sharedMemory[output] = -1;
+        }
+
+        *resource = output;
+        return result::Success;
+#else
+        return result::ErrorExtensionNotSupported;
+#endif
+    }
+
+    result Device::impl_createExportableSemaphoreEXT(Semaphore** semaphore)
+    {
+#if defined(__linux__)
+        // any Semaphore can be exported, its eventfd is only created when it's exported
+        return impl_createSemaphore(semaphore);
+#else
+        static_cast<void>(semaphore);
+        return result::ErrorExtensionNotSupported;
+#endif
+    }
+
+    result Device::impl_exportSemaphoreSyncFdEXT([[maybe_unused]] Semaphore* semaphore, [[maybe_unused]] int* fd)
+    {
+#if defined(__linux__)
+        auto* sync = static_cast<detail::cpu_sync*>(semaphore->m_ptr);
+        std::lock_guard<std::mutex> lock(sync->mutex);
+
+        if (sync->signaled)
+        {
+            sync->signaled = false;
+            *fd = -1;
+            return result::Success;
+        }
+
+        // the pending signal is redirected to an eventfd, which the Queue's thread writes to once the submission completed
+        if (sync->exportedFd < 0)
+        {
+            sync->exportedFd = eventfd(0, EFD_CLOEXEC);
+            if (sync->exportedFd < 0)
+                return result::ErrorOutOfHostMemory;
+        }
+
+        const int output = fcntl(sync->exportedFd, F_DUPFD_CLOEXEC, 0);
+        if (output < 0)
+            return result::ErrorOutOfHostMemory;
+
+        *fd = output;
+        return result::Success;
+#else
+        return result::ErrorExtensionNotSupported;
+#endif
+    }
+
+    result Device::impl_importSemaphoreSyncFdEXT([[maybe_unused]] Semaphore* semaphore, [[maybe_unused]] int fd)
+    {
+#if defined(__linux__)
+        auto* sync = static_cast<detail::cpu_sync*>(semaphore->m_ptr);
+        {
+            std::lock_guard<std::mutex> lock(sync->mutex);
+            if (sync->importedFd >= 0)
+                close(sync->importedFd);
+
+            if (fd == -1)
+            {
+                sync->importedFd = -1;
+                sync->signaled = true;
+            }
+            else
+            {
+                sync->importedFd = fd;
+            }
+        }
+
+        sync->condition.notify_all();
+        return result::Success;
+#else
+        return result::ErrorExtensionNotSupported;
+#endif
+    }
+}
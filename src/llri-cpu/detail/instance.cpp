@@ -0,0 +1,152 @@
+/**
+ * @file instance.cpp
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <llri/llri.hpp>
+#include <llri-cpu/utils.hpp>
+
+namespace llri
+{
+    namespace detail
+    {
+        result impl_createInstance(const instance_desc& desc, Instance** instance, [[maybe_unused]] bool enableImplementationMessagePolling)
+        {
+            auto* output = new Instance();
+            output->m_desc = desc;
+            output->m_validationLevel = desc.validationLevel;
+            output->m_messageTarget = detail::instanceMessageTarget(desc);
+
+            // there is no driver to receive messages from
+            output->m_shouldConstructValidationCallbackMessenger = false;
+            output->m_validationCallbackMessenger = nullptr;
+
+            *instance = output;
+            return result::Success;
+        }
+
+        void impl_destroyInstance(Instance* instance)
+        {
+            for (auto& [ptr, adapter] : instance->m_cachedAdapters)
+                delete adapter;
+
+            delete instance;
+        }
+
+        void impl_pollAPIMessages([[maybe_unused]] const message_target& target, [[maybe_unused]] messenger_type* messenger)
+        {
+            // Empty because there is no API to poll
+        }
+    }
+
+    result Instance::impl_enumerateAdapters(std::vector<Adapter*>* adapters)
+    {
+        // the CPU implementation has a single adapter, which is never lost
+        void* handle = detail::cpuAdapterHandle();
+
+        auto cached = m_cachedAdapters.find(handle);
+        if (cached != m_cachedAdapters.end())
+        {
+            cached->second->m_ptr = handle;
+            adapters->push_back(cached->second);
+            return result::Success;
+        }
+
+        Adapter* adapter = new Adapter();
+        adapter->m_ptr = handle;
+        adapter->m_instance = this;
+        adapter->m_validationLevel = m_validationLevel;
+        adapter->m_messageTarget = m_messageTarget;
+        adapter->m_nodeCount = 1;
+
+        m_cachedAdapters[handle] = adapter;
+        adapters->push_back(adapter);
+        return result::Success;
+    }
+
+    result Instance::impl_createDevice(const device_desc& desc, Device** device)
+    {
+        auto* state = new detail::cpu_device();
+
+        auto* output = new Device();
+        output->m_ptr = state;
+        output->m_desc = desc;
+        output->m_adapter = desc.adapter;
+        output->m_validationCallbackMessenger = m_validationCallbackMessenger;
+        output->m_validationLevel = m_validationLevel;
+        output->m_messageTarget = m_messageTarget;
+
+        for (size_t i = 0; i < desc.numQueues; i++)
+        {
+            auto& queueDesc = desc.queues[i];
+
+            auto* queue = new Queue();
+            queue->m_desc = queueDesc;
+            queue->m_device = output;
+            queue->m_ptrs = { new detail::cpu_queue(&state->pool) };
+            queue->m_validationCallbackMessenger = output->m_validationCallbackMessenger;
+            queue->m_validationLevel = output->m_validationLevel;
+            queue->m_messageTarget = output->m_messageTarget;
+            queue->m_statistics = &output->m_statistics;
+
+            switch(queueDesc.type)
+            {
+                case queue_type::Graphics:
+                    output->m_graphicsQueues.push_back(queue);
+                    break;
+                case queue_type::Compute:
+                    output->m_computeQueues.push_back(queue);
+                    break;
+                case queue_type::Transfer:
+                    output->m_transferQueues.push_back(queue);
+                    break;
+            }
+        }
+
+        *device = output;
+        return result::Success;
+    }
+
+    void Instance::impl_destroyDevice(Device* device)
+    {
+        // Cleanup queue wrappers, which joins the queue threads before the thread pool that they use is destroyed
+        for (auto* queues : { &device->m_graphicsQueues, &device->m_computeQueues, &device->m_transferQueues })
+        {
+            for (auto* queue : *queues)
+            {
+                delete static_cast<detail::cpu_queue*>(queue->m_ptrs[0]);
+                delete queue;
+            }
+        }
+
+        // Delete device wrapper
+        delete static_cast<detail::cpu_device*>(device->m_ptr);
+        delete device;
+    }
+
+    result Instance::impl_createSurfaceEXT([[maybe_unused]] const surface_win32_desc_ext& desc, [[maybe_unused]] SurfaceEXT** surface)
+    {
+        return result::ErrorExtensionNotSupported;
+    }
+
+    result Instance::impl_createSurfaceEXT([[maybe_unused]] const surface_cocoa_desc_ext& desc, [[maybe_unused]] SurfaceEXT** surface)
+    {
+        return result::ErrorExtensionNotSupported;
+    }
+
+    result Instance::impl_createSurfaceEXT([[maybe_unused]] const surface_xlib_desc_ext& desc, [[maybe_unused]] SurfaceEXT** surface)
+    {
+        return result::ErrorExtensionNotSupported;
+    }
+
+    result Instance::impl_createSurfaceEXT([[maybe_unused]] const surface_xcb_desc_ext& desc, [[maybe_unused]] SurfaceEXT** surface)
+    {
+        return result::ErrorExtensionNotSupported;
+    }
+
+    void Instance::impl_destroySurfaceEXT(SurfaceEXT* surface)
+    {
+        delete surface;
+    }
+}
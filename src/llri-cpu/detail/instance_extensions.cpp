@@ -0,0 +1,20 @@
+/**
+ * @file instance_extensions.cpp
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <llri/llri.hpp>
+#include <llri-cpu/utils.hpp>
+
+namespace llri
+{
+    namespace detail
+    {
+        [[nodiscard]] bool queryInstanceExtensionSupport([[maybe_unused]] instance_extension ext)
+        {
+            // there is no driver to validate and presenting is not emulated
+            return false;
+        }
+    }
+}
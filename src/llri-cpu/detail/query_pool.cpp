@@ -0,0 +1,28 @@
+/**
+ * @file query_pool.cpp
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <llri/llri.hpp>
+#include <llri-cpu/utils.hpp>
+#include <algorithm>
+
+namespace llri
+{
+    result QueryPool::impl_getResults(uint32_t first, uint32_t count, uint64_t* results)
+    {
+        auto* queries = static_cast<detail::cpu_query_pool*>(m_ptr);
+        std::lock_guard<std::mutex> lock(queries->mutex);
+
+        for (size_t i = first; i < static_cast<size_t>(first) + count; i++)
+        {
+            if (!queries->available[i])
+                return result::NotReady;
+        }
+
+        const size_t stride = queryResultCount(m_desc.type);
+        std::copy_n(queries->results.begin() + static_cast<ptrdiff_t>(first * stride), count * stride, results);
+        return result::Success;
+    }
+}
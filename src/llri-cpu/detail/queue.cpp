@@ -0,0 +1,186 @@
+/**
+ * @file queue.cpp
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <llri/llri.hpp>
+#include <llri-cpu/utils.hpp>
+#include <cstring>
+
+namespace llri
+{
+    namespace detail
+    {
+        /**
+         * @brief The minimum number of bytes that a thread copies at once, so that small copies aren't slowed down by spreading them across threads.
+        */
+        constexpr size_t copyGrainSize = 64 * 1024;
+
+        void executeCopy(const cpu_copy_region& region, cpu_thread_pool& pool)
+        {
+            // a single row is split into byte ranges, multiple rows are split into ranges of rows
+            const size_t numRows = static_cast<size_t>(region.rows) * region.slices;
+            if (numRows == 1)
+            {
+                pool.parallelFor(region.rowSize, copyGrainSize, [&region](size_t begin, size_t end) {
+                    std::memcpy(region.dst + begin, region.src + begin, end - begin);
+                });
+                return;
+            }
+
+            const size_t rowsPerGrain = std::max<size_t>(copyGrainSize / region.rowSize, 1);
+            pool.parallelFor(numRows, rowsPerGrain, [&region](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; i++)
+                {
+                    const uint64_t slice = i / region.rows;
+                    const uint64_t row = i % region.rows;
+                    std::memcpy(region.dst + slice * region.dstSlicePitch + row * region.dstRowPitch,
+                        region.src + slice * region.srcSlicePitch + row * region.srcRowPitch, region.rowSize);
+                }
+            });
+        }
+
+        void executeCommands(const cpu_command_list& cmdList, cpu_thread_pool& pool)
+        {
+            for (const cpu_command& cmd : cmdList.commands)
+            {
+                if (cmd.type == cpu_command_type::Copy)
+                {
+                    executeCopy(cmd.copy, pool);
+                    continue;
+                }
+
+                std::lock_guard<std::mutex> lock(cmd.pool->mutex);
+                const size_t stride = cmd.pool->results.size() / cmd.pool->available.size();
+                const auto begin = cmd.pool->results.begin() + static_cast<ptrdiff_t>(cmd.first * stride);
+
+                switch (cmd.type)
+                {
+                    case cpu_command_type::ResetQueries:
+                    {
+                        std::fill_n(cmd.pool->available.begin() + cmd.first, cmd.count, false);
+                        break;
+                    }
+                    case cpu_command_type::WriteTimestamp:
+                    {
+                        *begin = cpuTimestamp();
+                        cmd.pool->available[cmd.first] = true;
+                        break;
+                    }
+                    case cpu_command_type::EndQuery:
+                    {
+                        // nothing was drawn or dispatched, so all counters are zero
+                        std::fill_n(begin, stride, 0);
+                        cmd.pool->available[cmd.first] = true;
+                        break;
+                    }
+                    case cpu_command_type::CopyQueryResults:
+                    {
+                        std::memcpy(cmd.copy.dst, &*begin, cmd.count * stride * sizeof(uint64_t));
+                        break;
+                    }
+                    case cpu_command_type::Copy:
+                        break;
+                }
+            }
+        }
+
+        cpu_queue::cpu_queue(cpu_thread_pool* pool) : m_pool(pool)
+        {
+            m_thread = std::thread(&cpu_queue::work, this);
+        }
+
+        cpu_queue::~cpu_queue()
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_stop = true;
+            }
+
+            m_condition.notify_one();
+            m_thread.join();
+        }
+
+        void cpu_queue::submit(cpu_submission&& submission)
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_submissions.push_back(std::move(submission));
+            }
+
+            m_condition.notify_one();
+        }
+
+        void cpu_queue::waitIdle()
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_idleCondition.wait(lock, [this] { return m_submissions.empty() && !m_executing; });
+        }
+
+        void cpu_queue::work()
+        {
+            while (true)
+            {
+                cpu_submission submission;
+                {
+                    std::unique_lock<std::mutex> lock(m_mutex);
+                    m_condition.wait(lock, [this] { return m_stop || !m_submissions.empty(); });
+                    if (m_stop)
+                        return;
+
+                    submission = std::move(m_submissions.front());
+                    m_submissions.pop_front();
+                    m_executing = true;
+                }
+
+                for (auto* semaphore : submission.waitSemaphores)
+                    waitAndReset(*semaphore);
+
+                for (const auto* cmdList : submission.commandLists)
+                    executeCommands(*cmdList, *m_pool);
+
+                for (auto* semaphore : submission.signalSemaphores)
+                    signal(*semaphore);
+
+                if (submission.fence)
+                    signal(*submission.fence);
+
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    m_executing = false;
+                }
+
+                m_idleCondition.notify_all();
+            }
+        }
+    }
+
+    result Queue::impl_submit(const submit_desc& desc)
+    {
+        detail::cpu_submission submission;
+        submission.fence = desc.fence ? static_cast<detail::cpu_sync*>(desc.fence->m_ptr) : nullptr;
+
+        for (size_t i = 0; i < desc.numCommandLists; i++)
+            submission.commandLists.push_back(static_cast<const detail::cpu_command_list*>(desc.commandLists[i]->m_ptr));
+
+        for (size_t i = 0; i < desc.numWaitSemaphores; i++)
+            submission.waitSemaphores.push_back(static_cast<detail::cpu_sync*>(desc.waitSemaphores[i]->m_ptr));
+
+        for (size_t i = 0; i < desc.numSignalSemaphores; i++)
+            submission.signalSemaphores.push_back(static_cast<detail::cpu_sync*>(desc.signalSemaphores[i]->m_ptr));
+
+        // the submission executes asynchronously on the queue's thread, which signals the fence once it completes
+        if (desc.fence != nullptr)
+            desc.fence->m_signaled = true;
+
+        static_cast<detail::cpu_queue*>(m_ptrs[0])->submit(std::move(submission));
+        return result::Success;
+    }
+
+    result Queue::impl_waitIdle()
+    {
+        static_cast<detail::cpu_queue*>(m_ptrs[0])->waitIdle();
+        return result::Success;
+    }
+}
@@ -0,0 +1,166 @@
+/**
+ * @file utils.cpp
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <llri-cpu/utils.hpp>
+
+#if defined(__linux__)
+    #include <cerrno>
+    #include <poll.h>
+    #include <unistd.h>
+#endif
+
+namespace llri
+{
+    namespace detail
+    {
+        void signal(cpu_sync& sync)
+        {
+            {
+                std::lock_guard<std::mutex> lock(sync.mutex);
+#if defined(__linux__)
+                if (sync.exportedFd >= 0)
+                {
+                    // the eventfd becomes readable for every process that holds a copy of it, the Semaphore itself stays unsignaled
+                    const uint64_t value = 1;
+                    [[maybe_unused]] const auto written = write(sync.exportedFd, &value, sizeof(value));
+                    close(sync.exportedFd);
+                    sync.exportedFd = -1;
+                    return;
+                }
+#endif
+                sync.signaled = true;
+            }
+
+            sync.condition.notify_all();
+        }
+
+        bool waitUntil(cpu_sync& sync, std::chrono::steady_clock::time_point deadline)
+        {
+            std::unique_lock<std::mutex> lock(sync.mutex);
+            if (deadline == std::chrono::steady_clock::time_point::max())
+            {
+                sync.condition.wait(lock, [&sync] { return sync.signaled; });
+                return true;
+            }
+
+            return sync.condition.wait_until(lock, deadline, [&sync] { return sync.signaled; });
+        }
+
+        void waitAndReset(cpu_sync& sync)
+        {
+            std::unique_lock<std::mutex> lock(sync.mutex);
+#if defined(__linux__)
+            if (sync.importedFd >= 0)
+            {
+                // the import is temporary, so it only replaces the payload of this wait
+                const int fd = sync.importedFd;
+                sync.importedFd = -1;
+                lock.unlock();
+
+                pollfd descriptor { fd, POLLIN, 0 };
+                while (poll(&descriptor, 1, -1) < 0 && errno == EINTR) { }
+                close(fd);
+                return;
+            }
+#endif
+            sync.condition.wait(lock, [&sync] { return sync.signaled; });
+            sync.signaled = false;
+        }
+
+        void closeSyncFds([[maybe_unused]] cpu_sync& sync)
+        {
+#if defined(__linux__)
+            if (sync.exportedFd >= 0)
+                close(sync.exportedFd);
+            if (sync.importedFd >= 0)
+                close(sync.importedFd);
+#endif
+            sync.exportedFd = -1;
+            sync.importedFd = -1;
+        }
+
+        cpu_thread_pool::cpu_thread_pool(size_t numThreads)
+        {
+            for (size_t i = 0; i < numThreads; i++)
+                m_threads.emplace_back(&cpu_thread_pool::work, this);
+        }
+
+        cpu_thread_pool::~cpu_thread_pool()
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_stop = true;
+            }
+
+            m_condition.notify_all();
+            for (auto& thread : m_threads)
+                thread.join();
+        }
+
+        void cpu_thread_pool::parallelFor(size_t count, size_t grainSize, const std::function<void(size_t, size_t)>& function)
+        {
+            const size_t numRanges = std::min((count + grainSize - 1) / grainSize, m_threads.size() + 1);
+            if (numRanges <= 1)
+            {
+                function(0, count);
+                return;
+            }
+
+            const size_t rangeSize = (count + numRanges - 1) / numRanges;
+
+            // the calling thread executes the first range and then waits for the others
+            struct
+            {
+                std::mutex mutex;
+                std::condition_variable condition;
+                size_t remaining = 0;
+            } state;
+
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                for (size_t begin = rangeSize; begin < count; begin += rangeSize)
+                {
+                    const size_t end = std::min(begin + rangeSize, count);
+                    state.remaining++;
+
+                    m_tasks.emplace_back([&state, &function, begin, end] {
+                        function(begin, end);
+
+                        // notify while holding the lock so that state outlives the notification
+                        std::lock_guard<std::mutex> stateLock(state.mutex);
+                        if (--state.remaining == 0)
+                            state.condition.notify_one();
+                    });
+                }
+            }
+
+            m_condition.notify_all();
+            function(0, rangeSize);
+
+            std::unique_lock<std::mutex> lock(state.mutex);
+            state.condition.wait(lock, [&state] { return state.remaining == 0; });
+        }
+
+        void cpu_thread_pool::work()
+        {
+            while (true)
+            {
+                std::function<void()> task;
+                {
+                    std::unique_lock<std::mutex> lock(m_mutex);
+                    m_condition.wait(lock, [this] { return m_stop || !m_tasks.empty(); });
+                    if (m_stop)
+                        return;
+
+                    task = std::move(m_tasks.front());
+                    m_tasks.pop_front();
+                }
+
+                task();
+            }
+        }
+    }
+}
@@ -0,0 +1,298 @@
+/**
+ * @file utils.hpp
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+#include <llri/llri.hpp>
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <new>
+#include <thread>
+#include <unordered_map>
+
+namespace llri
+{
+    namespace detail
+    {
+        /**
+         * @brief The name of the single Adapter that the CPU implementation exposes.
+        */
+        constexpr const char* cpuAdapterName = "LLRI CPU Adapter";
+
+        /**
+         * @brief The vendor ID that the CPU Adapter reports, which doesn't match any PCI vendor.
+        */
+        constexpr uint32_t cpuVendorId = 0x4C4C5243; // "LLRC"
+
+        /**
+         * @brief Stands in for the native pointer of the CPU Adapter, because LLRI considers Adapters without one lost.
+        */
+        inline void* cpuAdapterHandle()
+        {
+            static char handle;
+            return &handle;
+        }
+
+        /**
+         * @brief The number of queues that the CPU Adapter reports per queue_type. Every Queue has its own worker thread.
+        */
+        constexpr uint8_t cpuQueueCount(queue_type type)
+        {
+            switch (type)
+            {
+                case queue_type::Graphics:
+                    return 1;
+                case queue_type::Compute:
+                    return 2;
+                case queue_type::Transfer:
+                    return 2;
+            }
+
+            return 0;
+        }
+
+        /**
+         * @brief The number of bytes of a texture subresource. Subresources are stored linearly, with tightly packed rows and slices.
+        */
+        inline uint64_t subresourceSize(const resource_desc& desc, uint32_t mipLevel)
+        {
+            const extent_3d extent = mipExtent(desc, mipLevel);
+            return static_cast<uint64_t>(extent.width) * extent.height * extent.depth * format_size(desc.textureFormat) * static_cast<uint64_t>(desc.sampleCount);
+        }
+
+        /**
+         * @brief The offset in bytes of a texture subresource in the Resource's memory. Array layers are stored one after the other, each with all of its mip levels.
+        */
+        inline uint64_t subresourceOffset(const resource_desc& desc, uint32_t mipLevel, uint32_t arrayLayer)
+        {
+            uint64_t layerSize = 0;
+            uint64_t offset = 0;
+            for (uint32_t mip = 0; mip < desc.mipLevels; mip++)
+            {
+                if (mip == mipLevel)
+                    offset = layerSize;
+
+                layerSize += subresourceSize(desc, mip);
+            }
+
+            return layerSize * arrayLayer + offset;
+        }
+
+        /**
+         * @brief The number of bytes of host memory that hold the Resource's data.
+        */
+        inline uint64_t resourceSize(const resource_desc& desc)
+        {
+            if (desc.type == resource_type::Buffer)
+                return desc.width;
+
+            const uint32_t arrayLayers = desc.type == resource_type::Texture3D ? 1 : desc.depthOrArrayLayers;
+            return subresourceOffset(desc, 0, arrayLayers);
+        }
+
+        /**
+         * @brief The alignment that the CPU implementation reports for resources that are placed in a MemoryHeap.
+        */
+        constexpr uint64_t cpuResourceAlignment = 256;
+
+        /**
+         * @brief A binary synchronization primitive that backs Fences and Semaphores. Queues signal it once their submission completed.
+        */
+        struct cpu_sync
+        {
+            std::mutex mutex;
+            std::condition_variable condition;
+            bool signaled = false;
+
+            /**
+             * @brief An eventfd that was exported through Device::exportSemaphoreSyncFdEXT(), which receives the next signal instead of the signaled flag.
+            */
+            int exportedFd = -1;
+            /**
+             * @brief A sync file descriptor that was imported through Device::importSemaphoreSyncFdEXT(), which the next waitAndReset() waits on instead of the signaled flag.
+            */
+            int importedFd = -1;
+        };
+
+        /**
+         * @brief Signals sync and wakes up all threads that wait on it. If sync was exported, its file descriptor is signaled instead.
+        */
+        void signal(cpu_sync& sync);
+
+        /**
+         * @brief Blocks until sync is signaled, or until the deadline has passed. A deadline of time_point::max() never passes.
+         * @return true if sync was signaled before the deadline.
+        */
+        bool waitUntil(cpu_sync& sync, std::chrono::steady_clock::time_point deadline);
+
+        /**
+         * @brief Blocks until sync is signaled, and then unsignals it again. Semaphores are consumed by the submission that waits on them.
+         * If a file descriptor was imported into sync, the function blocks until it's readable instead and then closes it.
+        */
+        void waitAndReset(cpu_sync& sync);
+
+        /**
+         * @brief Closes the file descriptors that were exported from or imported into sync but never signaled or waited on.
+        */
+        void closeSyncFds(cpu_sync& sync);
+
+        /**
+         * @brief A fixed set of worker threads that execute the work of transfer commands. Every Device owns one pool, which is shared by all of its Queues.
+        */
+        class cpu_thread_pool
+        {
+        public:
+            explicit cpu_thread_pool(size_t numThreads);
+            ~cpu_thread_pool();
+
+            cpu_thread_pool(const cpu_thread_pool&) = delete;
+            cpu_thread_pool& operator=(const cpu_thread_pool&) = delete;
+
+            /**
+             * @brief Splits [0, count) into ranges of at least grainSize elements and calls function(begin, end) for every range.
+             * The ranges are executed on the pool's threads and on the calling thread, and the function returns once all of them completed.
+            */
+            void parallelFor(size_t count, size_t grainSize, const std::function<void(size_t, size_t)>& function);
+
+        private:
+            void work();
+
+            std::vector<std::thread> m_threads;
+            std::deque<std::function<void()>> m_tasks;
+            std::mutex m_mutex;
+            std::condition_variable m_condition;
+            bool m_stop = false;
+        };
+
+        /**
+         * @brief The state of a Device.
+        */
+        struct cpu_device
+        {
+            cpu_thread_pool pool { std::max(std::thread::hardware_concurrency(), 2u) - 1 };
+
+            /**
+             * @brief The memfds that back exportable resources, or -1 for resources that imported one. Both are mapped into the resource's memory, and unmapped when it's destroyed.
+            */
+            std::unordered_map<const Resource*, int> sharedMemory;
+            std::mutex sharedMemoryMutex;
+        };
+
+        /**
+         * @brief The state of a QueryPool. Queries are written by Queue threads and read by the host, so access is guarded by a mutex.
+        */
+        struct cpu_query_pool
+        {
+            std::mutex mutex;
+            std::vector<uint64_t> results;
+            std::vector<bool> available;
+        };
+
+        enum struct cpu_command_type : uint8_t
+        {
+            ResetQueries,
+            WriteTimestamp,
+            EndQuery,
+            CopyQueryResults,
+            /**
+             * @brief Copies slices of rows of bytes, which describes both buffer copies and copies between buffers and textures.
+            */
+            Copy
+        };
+
+        /**
+         * @brief A region of memory that is copied, laid out as slices of rows.
+        */
+        struct cpu_copy_region
+        {
+            uint8_t* src;
+            uint8_t* dst;
+            uint64_t rowSize;
+            uint32_t rows;
+            uint32_t slices;
+            uint64_t srcRowPitch;
+            uint64_t srcSlicePitch;
+            uint64_t dstRowPitch;
+            uint64_t dstSlicePitch;
+        };
+
+        /**
+         * @brief A recorded command that is executed when the CommandList is submitted.
+        */
+        struct cpu_command
+        {
+            cpu_command_type type;
+            cpu_query_pool* pool;
+            uint32_t first;
+            uint32_t count;
+            cpu_copy_region copy;
+        };
+
+        /**
+         * @brief The recorded commands of a CommandList.
+        */
+        struct cpu_command_list
+        {
+            std::vector<cpu_command> commands;
+        };
+
+        /**
+         * @brief A Queue submission, which holds everything that the Queue's thread needs to execute it.
+        */
+        struct cpu_submission
+        {
+            std::vector<const cpu_command_list*> commandLists;
+            std::vector<cpu_sync*> waitSemaphores;
+            std::vector<cpu_sync*> signalSemaphores;
+            cpu_sync* fence;
+        };
+
+        /**
+         * @brief Executes the recorded commands in order. Copies are spread across the thread pool.
+        */
+        void executeCommands(const cpu_command_list& cmdList, cpu_thread_pool& pool);
+
+        /**
+         * @brief A Queue, which executes its submissions in order on its own worker thread.
+        */
+        class cpu_queue
+        {
+        public:
+            explicit cpu_queue(cpu_thread_pool* pool);
+            ~cpu_queue();
+
+            cpu_queue(const cpu_queue&) = delete;
+            cpu_queue& operator=(const cpu_queue&) = delete;
+
+            void submit(cpu_submission&& submission);
+
+            /**
+             * @brief Blocks until all submissions have completed.
+            */
+            void waitIdle();
+
+        private:
+            void work();
+
+            cpu_thread_pool* m_pool;
+            std::thread m_thread;
+            std::deque<cpu_submission> m_submissions;
+            std::mutex m_mutex;
+            std::condition_variable m_condition;
+            std::condition_variable m_idleCondition;
+            bool m_executing = false;
+            bool m_stop = false;
+        };
+
+        /**
+         * @brief Nanoseconds on a monotonic clock, used for timestamp queries. The CPU Adapter reports a timestamp period of 1.
+        */
+        inline uint64_t cpuTimestamp()
+        {
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+        }
+    }
+}
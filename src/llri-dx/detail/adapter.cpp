@@ -9,6 +9,24 @@
 
 namespace llri
 {
+    namespace detail
+    {
+        /**
+         * @brief Queries if the adapter can open existing heaps through ID3D12Device3::OpenExistingHeapFromAddress(), which is used to import host memory.
+        */
+        bool queryExistingHeapSupport(IDXGIAdapter* adapter)
+        {
+            ID3D12Device* device = nullptr;
+            if (FAILED(D3D12CreateDevice(adapter, D3D_FEATURE_LEVEL_12_0, IID_PPV_ARGS(&device))))
+                return false;
+
+            D3D12_FEATURE_DATA_EXISTING_HEAPS existingHeaps {};
+            const bool supported = SUCCEEDED(device->CheckFeatureSupport(D3D12_FEATURE_EXISTING_HEAPS, &existingHeaps, sizeof(existingHeaps))) && existingHeaps.Supported;
+            device->Release();
+            return supported;
+        }
+    }
+
     adapter_info Adapter::impl_queryInfo() const
     {
         DXGI_ADAPTER_DESC1 desc;
@@ -33,17 +51,56 @@ namespace llri
     adapter_features Adapter::impl_queryFeatures() const
     {
         adapter_features features{};
+        features.pipelineStatisticsQuery = true; // always supported in DX12
         return features;
     }
 
     adapter_limits Adapter::impl_queryLimits() const
     {
         adapter_limits output{};
+
+        // DX12 only exposes the timestamp frequency through a command queue
+        ID3D12Device* device = nullptr;
+        if (SUCCEEDED(detail::D3D12CreateDevice(static_cast<IDXGIAdapter*>(m_ptr), D3D_FEATURE_LEVEL_12_0, IID_PPV_ARGS(&device))))
+        {
+            const D3D12_COMMAND_QUEUE_DESC queueDesc { D3D12_COMMAND_LIST_TYPE_DIRECT, D3D12_COMMAND_QUEUE_PRIORITY_NORMAL, D3D12_COMMAND_QUEUE_FLAG_NONE, 0 };
+            ID3D12CommandQueue* queue = nullptr;
+            if (SUCCEEDED(device->CreateCommandQueue(&queueDesc, IID_PPV_ARGS(&queue))))
+            {
+                UINT64 frequency = 0;
+                if (SUCCEEDED(queue->GetTimestampFrequency(&frequency)) && frequency != 0)
+                    output.timestampPeriod = static_cast<float>(1000000000.0 / static_cast<double>(frequency));
+                queue->Release();
+            }
+            device->Release();
+        }
+
+        // existing heaps are opened for the whole VirtualAlloc() allocation, which is aligned to the allocation granularity
+        if (detail::queryExistingHeapSupport(static_cast<IDXGIAdapter*>(m_ptr)))
+        {
+            SYSTEM_INFO systemInfo;
+            GetSystemInfo(&systemInfo);
+            output.hostMemoryImportAlignment = systemInfo.dwAllocationGranularity;
+        }
+
         return output;
     }
 
-    bool Adapter::impl_queryExtensionSupport([[maybe_unused]] adapter_extension ext) const
+    bool Adapter::impl_queryExtensionSupport(adapter_extension ext) const
     {
+        switch(ext)
+        {
+            case adapter_extension::SimulatedTiming:
+                // DirectX 12 executes work on a GPU, so its timing can't be simulated
+                return false;
+            case adapter_extension::HostMemoryImport:
+                return detail::queryExistingHeapSupport(static_cast<IDXGIAdapter*>(m_ptr));
+            case adapter_extension::ExternalMemoryFd:
+            case adapter_extension::ExternalSemaphoreFd:
+                // DirectX 12 shares memory and fences through NT handles instead of file descriptors
+                return false;
+        }
+
         return false;
     }
 
@@ -106,9 +163,19 @@ namespace llri
         return 0;
     }
 
-    std::unordered_map<format, format_properties> Adapter::impl_queryFormatProperties() const
+    std::vector<queue_family_info> Adapter::impl_queryQueueFamilies() const
+    {
+        // DirectX12 has no queue families, but each command list type runs on its own engine
+        return {
+            queue_family_info { queue_type::Graphics, impl_queryQueueCount(queue_type::Graphics), true },
+            queue_family_info { queue_type::Compute, impl_queryQueueCount(queue_type::Compute), true },
+            queue_family_info { queue_type::Transfer, impl_queryQueueCount(queue_type::Transfer), true }
+        };
+    }
+
+    std::array<format_properties, static_cast<size_t>(format::MaxEnum) + 1> Adapter::impl_queryFormatProperties() const
     {
-        std::unordered_map<format, format_properties> result;
+        std::array<format_properties, static_cast<size_t>(format::MaxEnum) + 1> result {};
 
         ID3D12Device* device;
         detail::D3D12CreateDevice(static_cast<IDXGIAdapter*>(m_ptr), D3D_FEATURE_LEVEL_12_0, IID_PPV_ARGS(&device));
@@ -130,21 +197,14 @@ namespace llri
             const bool supported = sup1 != D3D12_FORMAT_SUPPORT1_NONE;
 
             // get sample counts
-            std::unordered_map<sample_count, bool> sampleCounts {
-                { sample_count::Count1, false },
-                { sample_count::Count2, false },
-                { sample_count::Count4, false },
-                { sample_count::Count8, false },
-                { sample_count::Count16, false },
-                { sample_count::Count32, false }
-            };
-
-            for (auto& pair : sampleCounts)
+            uint8_t sampleCounts = 0;
+            for (uint8_t count = static_cast<uint8_t>(sample_count::Count1); count <= static_cast<uint8_t>(sample_count::MaxEnum); count <<= 1)
             {
-                UINT count;
-                features.MultisampleQualityLevels(dxFormat, static_cast<UINT>(pair.first), D3D12_MULTISAMPLE_QUALITY_LEVELS_FLAG_NONE, count);
+                UINT levels;
+                features.MultisampleQualityLevels(dxFormat, static_cast<UINT>(count), D3D12_MULTISAMPLE_QUALITY_LEVELS_FLAG_NONE, levels);
 
-                pair.second = count;
+                if (levels)
+                    sampleCounts |= count;
             }
 
             // get usage flags
@@ -166,20 +226,23 @@ namespace llri
             }
 
             // get types
-            const std::unordered_map<resource_type, bool> types {
-                { resource_type::Buffer, false },
-                { resource_type::Texture1D, (sup1 & D3D12_FORMAT_SUPPORT1_TEXTURE1D) == D3D12_FORMAT_SUPPORT1_TEXTURE1D },
-                { resource_type::Texture2D, (sup1 & D3D12_FORMAT_SUPPORT1_TEXTURE2D) == D3D12_FORMAT_SUPPORT1_TEXTURE2D },
-                { resource_type::Texture3D, (sup1 & D3D12_FORMAT_SUPPORT1_TEXTURE3D) == D3D12_FORMAT_SUPPORT1_TEXTURE3D }
-            };
+            uint8_t types = 0;
+            if ((sup1 & D3D12_FORMAT_SUPPORT1_TEXTURE1D) == D3D12_FORMAT_SUPPORT1_TEXTURE1D)
+                types |= 1u << static_cast<uint8_t>(resource_type::Texture1D);
+
+            if ((sup1 & D3D12_FORMAT_SUPPORT1_TEXTURE2D) == D3D12_FORMAT_SUPPORT1_TEXTURE2D)
+                types |= 1u << static_cast<uint8_t>(resource_type::Texture2D);
+
+            if ((sup1 & D3D12_FORMAT_SUPPORT1_TEXTURE3D) == D3D12_FORMAT_SUPPORT1_TEXTURE3D)
+                types |= 1u << static_cast<uint8_t>(resource_type::Texture3D);
 
             // gather results
-            result.insert({ form, format_properties { 
+            result[f] = format_properties { 
                 supported,
                 types,
                 usageFlags,
                 sampleCounts
-            } });
+            };
         }
 
         device->Release();
@@ -45,7 +45,7 @@ namespace llri
         // Dx12 command lists are opened by default, close to comply with our system
         dx12CommandList->Close();
 
-        auto* output = new CommandList();
+        auto* output = m_cmdLists.allocate();
         output->m_ptr = dx12CommandList;
         output->m_group = this;
 
@@ -56,8 +56,9 @@ namespace llri
         output->m_state = command_list_state::Empty;
 
         output->m_validationCallbackMessenger = m_validationCallbackMessenger;
-
-        m_cmdLists.emplace(output);
+        output->m_validationLevel = m_validationLevel;
+        output->m_messageTarget = m_messageTarget;
+        output->m_statistics = m_statistics;
 
         *cmdList = output;
         return result::Success;
@@ -97,7 +98,7 @@ namespace llri
             // Dx12 command lists are opened by default, close to comply with our system
             dx12CommandList->Close();
 
-            auto* cmdList = new CommandList();
+            auto* cmdList = m_cmdLists.allocate();
             cmdList->m_ptr = dx12CommandList;
             cmdList->m_group = this;
 
@@ -108,8 +109,10 @@ namespace llri
             cmdList->m_state = command_list_state::Empty;
 
             cmdList->m_validationCallbackMessenger = m_validationCallbackMessenger;
+            cmdList->m_validationLevel = m_validationLevel;
+            cmdList->m_messageTarget = m_messageTarget;
+            cmdList->m_statistics = m_statistics;
 
-            m_cmdLists.emplace(cmdList);
             cmdLists->push_back(cmdList);
         }
 
@@ -121,11 +124,8 @@ namespace llri
         // Free internal pointer
         static_cast<IUnknown*>(cmdList->m_ptr)->Release();
 
-        // Remove from commandlist list
-        m_cmdLists.erase(cmdList);
-
         // Delete wrapper
-        delete cmdList;
+        m_cmdLists.free(cmdList);
         return result::Success;
     }
 
@@ -46,7 +46,7 @@ namespace llri
                     D3D12_RESOURCE_BARRIER dx12Barrier{};
                     dx12Barrier.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE;
                     dx12Barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_UAV;
-                    dx12Barrier.UAV = D3D12_RESOURCE_UAV_BARRIER { static_cast<ID3D12Resource*>(barrier.rw.resource->m_resource) };
+                    dx12Barrier.UAV = D3D12_RESOURCE_UAV_BARRIER { static_cast<ID3D12Resource*>(barrier.rw.resource->m_hot->resource) };
                     dx12Barriers.push_back(dx12Barrier);
                     break;
                 }
@@ -58,7 +58,7 @@ namespace llri
                         dx12Barrier.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE;
                         dx12Barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
                         dx12Barrier.Transition = D3D12_RESOURCE_TRANSITION_BARRIER {
-                            static_cast<ID3D12Resource*>(barrier.rw.resource->m_resource),
+                            static_cast<ID3D12Resource*>(barrier.rw.resource->m_hot->resource),
                             D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES,
                             detail::mapResourceState(barrier.trans.oldState),
                             detail::mapResourceState(barrier.trans.newState)
@@ -77,7 +77,7 @@ namespace llri
                                 dx12Barrier.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE;
                                 dx12Barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
                                 dx12Barrier.Transition = D3D12_RESOURCE_TRANSITION_BARRIER {
-                                    static_cast<ID3D12Resource*>(barrier.rw.resource->m_resource),
+                                    static_cast<ID3D12Resource*>(barrier.rw.resource->m_hot->resource),
                                     D3D12CalcSubresource(m, a, 0, desc.mipLevels, arrayLayers),
                                     detail::mapResourceState(barrier.trans.oldState),
                                     detail::mapResourceState(barrier.trans.newState)
@@ -86,11 +86,107 @@ namespace llri
                             }
                         }
                     }
+                    break;
+                }
+                case resource_barrier_type::Aliasing:
+                {
+                    D3D12_RESOURCE_BARRIER dx12Barrier{};
+                    dx12Barrier.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE;
+                    dx12Barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_ALIASING;
+                    dx12Barrier.Aliasing = D3D12_RESOURCE_ALIASING_BARRIER {
+                        barrier.alias.before ? static_cast<ID3D12Resource*>(barrier.alias.before->m_hot->resource) : nullptr,
+                        static_cast<ID3D12Resource*>(barrier.alias.after->m_hot->resource)
+                    };
+                    dx12Barriers.push_back(dx12Barrier);
+                    break;
+                }
+                case resource_barrier_type::Release:
+                case resource_barrier_type::Acquire:
+                {
+                    // DX12 resources aren't owned by a queue type, the Semaphore between the two CommandLists is sufficient
+                    break;
                 }
             }
         }
 
-        static_cast<ID3D12GraphicsCommandList*>(m_ptr)->ResourceBarrier(numBarriers, dx12Barriers.data());
+        if (dx12Barriers.empty())
+            return result::Success;
+
+        static_cast<ID3D12GraphicsCommandList*>(m_ptr)->ResourceBarrier(static_cast<UINT>(dx12Barriers.size()), dx12Barriers.data());
+        return result::Success;
+    }
+
+    result CommandList::impl_resetQueries([[maybe_unused]] QueryPool* pool, [[maybe_unused]] uint32_t first, [[maybe_unused]] uint32_t count)
+    {
+        // DX12 queries don't need to be reset before they're written
+        return result::Success;
+    }
+
+    result CommandList::impl_writeTimestamp(QueryPool* pool, uint32_t index)
+    {
+        auto* dx12CmdList = static_cast<ID3D12GraphicsCommandList*>(m_ptr);
+        auto* dx12QueryHeap = static_cast<ID3D12QueryHeap*>(pool->m_ptr);
+
+        dx12CmdList->EndQuery(dx12QueryHeap, D3D12_QUERY_TYPE_TIMESTAMP, index);
+        dx12CmdList->ResolveQueryData(dx12QueryHeap, D3D12_QUERY_TYPE_TIMESTAMP, index, 1, static_cast<ID3D12Resource*>(pool->m_readback), static_cast<UINT64>(index) * sizeof(uint64_t));
+        return result::Success;
+    }
+
+    result CommandList::impl_beginQuery(QueryPool* pool, uint32_t index)
+    {
+        static_cast<ID3D12GraphicsCommandList*>(m_ptr)->BeginQuery(static_cast<ID3D12QueryHeap*>(pool->m_ptr), detail::mapQueryType(pool->m_desc.type), index);
+        return result::Success;
+    }
+
+    result CommandList::impl_endQuery(QueryPool* pool, uint32_t index)
+    {
+        auto* dx12CmdList = static_cast<ID3D12GraphicsCommandList*>(m_ptr);
+        auto* dx12QueryHeap = static_cast<ID3D12QueryHeap*>(pool->m_ptr);
+        const D3D12_QUERY_TYPE type = detail::mapQueryType(pool->m_desc.type);
+
+        dx12CmdList->EndQuery(dx12QueryHeap, type, index);
+
+        // also resolve into the pool's own readback buffer so that QueryPool::getResults() works without copyQueryResults()
+        const UINT64 offset = static_cast<UINT64>(index) * queryResultCount(pool->m_desc.type) * sizeof(uint64_t);
+        dx12CmdList->ResolveQueryData(dx12QueryHeap, type, index, 1, static_cast<ID3D12Resource*>(pool->m_readback), offset);
+        return result::Success;
+    }
+
+    result CommandList::impl_copyQueryResults(QueryPool* pool, uint32_t first, uint32_t count, Resource* dst, uint64_t dstOffset)
+    {
+        static_cast<ID3D12GraphicsCommandList*>(m_ptr)->ResolveQueryData(static_cast<ID3D12QueryHeap*>(pool->m_ptr), detail::mapQueryType(pool->m_desc.type),
+            first, count, static_cast<ID3D12Resource*>(dst->m_hot->resource), dstOffset);
+        return result::Success;
+    }
+
+    result CommandList::impl_copyBuffer(Resource* src, uint64_t srcOffset, Resource* dst, uint64_t dstOffset, uint64_t size)
+    {
+        static_cast<ID3D12GraphicsCommandList*>(m_ptr)->CopyBufferRegion(static_cast<ID3D12Resource*>(dst->m_hot->resource), dstOffset,
+            static_cast<ID3D12Resource*>(src->m_hot->resource), srcOffset, size);
+        return result::Success;
+    }
+
+    result CommandList::impl_copyBufferToTexture(const texture_copy_desc& desc)
+    {
+        const D3D12_TEXTURE_COPY_LOCATION src = detail::mapBufferCopyLocation(desc);
+        const D3D12_TEXTURE_COPY_LOCATION dst = detail::mapTextureCopyLocation(desc);
+
+        static_cast<ID3D12GraphicsCommandList*>(m_ptr)->CopyTextureRegion(&dst,
+            static_cast<UINT>(desc.textureOffset.x), static_cast<UINT>(desc.textureOffset.y), static_cast<UINT>(desc.textureOffset.z), &src, nullptr);
+        return result::Success;
+    }
+
+    result CommandList::impl_copyTextureToBuffer(const texture_copy_desc& desc)
+    {
+        const D3D12_TEXTURE_COPY_LOCATION src = detail::mapTextureCopyLocation(desc);
+        const D3D12_TEXTURE_COPY_LOCATION dst = detail::mapBufferCopyLocation(desc);
+
+        const D3D12_BOX box {
+            static_cast<UINT>(desc.textureOffset.x), static_cast<UINT>(desc.textureOffset.y), static_cast<UINT>(desc.textureOffset.z),
+            static_cast<UINT>(desc.textureOffset.x) + desc.extent.width, static_cast<UINT>(desc.textureOffset.y) + desc.extent.height, static_cast<UINT>(desc.textureOffset.z) + desc.extent.depth
+        };
+
+        static_cast<ID3D12GraphicsCommandList*>(m_ptr)->CopyTextureRegion(&dst, 0, 0, 0, &src, &box);
         return result::Success;
     }
 }
@@ -15,6 +15,9 @@ namespace llri
         output->m_device = this;
         output->m_deviceFunctionTable = m_functionTable;
         output->m_validationCallbackMessenger = m_validationCallbackMessenger;
+        output->m_validationLevel = m_validationLevel;
+        output->m_messageTarget = m_messageTarget;
+        output->m_statistics = &m_statistics;
         output->m_type = type;
 
         ID3D12CommandAllocator* allocator;
@@ -60,7 +63,7 @@ namespace llri
         if (FAILED(r))
             return detail::mapHRESULT(r);
 
-        auto* output = new Fence();
+        auto* output = m_fences.allocate();
         output->m_flags = flags;
         output->m_counter = 0;
         output->m_event = CreateEvent(nullptr, false, false, nullptr);
@@ -81,7 +84,7 @@ namespace llri
         if (fence->m_ptr)
             static_cast<ID3D12Fence*>(fence->m_ptr)->Release();
 
-        delete fence;
+        m_fences.free(fence);
     }
 
     result Device::impl_waitFences(uint32_t numFences, Fence** fences, uint64_t timeout)
@@ -131,7 +134,7 @@ namespace llri
         if (FAILED(r))
             return detail::mapHRESULT(r);
 
-        auto* output = new Semaphore();
+        auto* output = m_semaphores.allocate();
         output->m_ptr = dx12Fence;
 
         *semaphore = output;
@@ -143,25 +146,71 @@ namespace llri
         if (semaphore->m_ptr)
             static_cast<ID3D12Fence*>(semaphore->m_ptr)->Release();
 
-        delete semaphore;
+        m_semaphores.free(semaphore);
     }
 
-    result Device::impl_createResource(const resource_desc& desc, Resource** resource)
+    result Device::impl_createQueryPool(const query_pool_desc& desc, QueryPool** pool)
+    {
+        const D3D12_QUERY_HEAP_DESC heapDesc { detail::mapQueryHeapType(desc.type), desc.count, 0 };
+
+        ID3D12QueryHeap* dx12QueryHeap = nullptr;
+        auto r = static_cast<ID3D12Device*>(m_ptr)->CreateQueryHeap(&heapDesc, IID_PPV_ARGS(&dx12QueryHeap));
+        if (FAILED(r))
+            return detail::mapHRESULT(r);
+
+        // DX12 queries are resolved into a buffer before they can be read by the CPU
+        // the buffer stays mapped so that QueryPool::getResults() is a plain copy
+        const CD3DX12_HEAP_PROPERTIES heapProperties(D3D12_HEAP_TYPE_READBACK);
+        const CD3DX12_RESOURCE_DESC bufferDesc = CD3DX12_RESOURCE_DESC::Buffer(static_cast<UINT64>(desc.count) * queryResultCount(desc.type) * sizeof(uint64_t));
+
+        ID3D12Resource* dx12Readback = nullptr;
+        r = static_cast<ID3D12Device*>(m_ptr)->CreateCommittedResource(&heapProperties, D3D12_HEAP_FLAG_NONE, &bufferDesc, D3D12_RESOURCE_STATE_COPY_DEST, nullptr, IID_PPV_ARGS(&dx12Readback));
+        if (FAILED(r))
+        {
+            dx12QueryHeap->Release();
+            return detail::mapHRESULT(r);
+        }
+
+        void* data = nullptr;
+        r = dx12Readback->Map(0, nullptr, &data);
+        if (FAILED(r))
+        {
+            dx12Readback->Release();
+            dx12QueryHeap->Release();
+            return detail::mapHRESULT(r);
+        }
+
+        auto* output = new QueryPool();
+        output->m_desc = desc;
+        output->m_ptr = dx12QueryHeap;
+        output->m_deviceHandle = m_ptr;
+        output->m_readback = dx12Readback;
+        output->m_readbackData = data;
+        output->m_validationCallbackMessenger = m_validationCallbackMessenger;
+        output->m_validationLevel = m_validationLevel;
+        output->m_messageTarget = m_messageTarget;
+
+        *pool = output;
+        return result::Success;
+    }
+
+    void Device::impl_destroyQueryPool(QueryPool* pool)
     {
-        const bool isTexture = desc.type != resource_type::Buffer;
+        if (pool->m_readback)
+        {
+            static_cast<ID3D12Resource*>(pool->m_readback)->Unmap(0, nullptr);
+            static_cast<ID3D12Resource*>(pool->m_readback)->Release();
+        }
 
-        D3D12_RESOURCE_DESC dx12Desc;
-        dx12Desc.Dimension = detail::mapResourceType(desc.type);
-        dx12Desc.Alignment = 0;
-        dx12Desc.Width = static_cast<UINT64>(desc.width);
-        dx12Desc.Height = isTexture ? desc.height : 1;
-        dx12Desc.DepthOrArraySize = isTexture ? static_cast<UINT16>(desc.depthOrArrayLayers) : 1;
-        dx12Desc.MipLevels = isTexture ? static_cast<UINT16>(desc.mipLevels) : 1;
-        dx12Desc.Format = isTexture ? detail::mapTextureFormat(desc.textureFormat) : DXGI_FORMAT_UNKNOWN;
-        dx12Desc.SampleDesc = isTexture ? DXGI_SAMPLE_DESC{ static_cast<UINT>(desc.sampleCount), D3D12_MULTISAMPLE_QUALITY_LEVELS_FLAG_NONE } : DXGI_SAMPLE_DESC{ 1, 0 };
-        dx12Desc.Layout = isTexture ? D3D12_TEXTURE_LAYOUT_UNKNOWN : D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
-        dx12Desc.Flags = detail::mapResourceUsage(desc.usage);
+        if (pool->m_ptr)
+            static_cast<ID3D12QueryHeap*>(pool->m_ptr)->Release();
+
+        delete pool;
+    }
 
+    result Device::impl_createResource(const resource_desc& desc, Resource** resource)
+    {
+        const D3D12_RESOURCE_DESC dx12Desc = detail::mapResourceDesc(desc);
         const D3D12_RESOURCE_STATES initialState = detail::mapResourceState(desc.initialState);
 
         D3D12_HEAP_PROPERTIES heapProperties { detail::mapResourceMemoryType(desc.memoryType),
@@ -175,16 +224,186 @@ namespace llri
         if (FAILED(r))
             return detail::mapHRESULT(r);
 
-        auto* output = new Resource();
+        auto* output = m_resources.allocate();
         output->m_desc = desc;
-        output->m_resource = dx12Resource;
+        output->m_hot->resource = dx12Resource;
+        output->m_allocationSize = static_cast<ID3D12Device*>(m_ptr)->GetResourceAllocationInfo(desc.visibleNodeMask, 1, &dx12Desc).SizeInBytes;
         *resource = output;
         return result::Success;
     }
 
     void Device::impl_destroyResource(Resource* resource)
     {
-        static_cast<ID3D12Resource*>(resource->m_resource)->Release();
-        delete resource;
+        static_cast<ID3D12Resource*>(resource->m_hot->resource)->Release();
+
+        // imported resources hold the heap that wraps the host memory, releasing it doesn't free the host memory
+        if (resource->m_imported)
+            static_cast<ID3D12Heap*>(resource->m_hot->memory)->Release();
+
+        m_resources.free(resource);
+    }
+
+    result Device::impl_createMemoryHeap(const memory_heap_desc& desc, MemoryHeap** heap)
+    {
+        D3D12_HEAP_DESC heapDesc;
+        heapDesc.SizeInBytes = desc.size;
+        heapDesc.Properties = D3D12_HEAP_PROPERTIES { detail::mapResourceMemoryType(desc.memoryType),
+            D3D12_CPU_PAGE_PROPERTY_UNKNOWN, D3D12_MEMORY_POOL_UNKNOWN,
+            desc.createNodeMask, desc.visibleNodeMask };
+        heapDesc.Alignment = D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT;
+        // equal to D3D12_HEAP_FLAG_ALLOW_ALL_BUFFERS_AND_TEXTURES, which lets buffers and textures share the heap on resource heap tier 2 adapters
+        heapDesc.Flags = D3D12_HEAP_FLAG_NONE;
+
+        ID3D12Heap* dx12Heap = nullptr;
+        const auto r = static_cast<ID3D12Device*>(m_ptr)->CreateHeap(&heapDesc, IID_PPV_ARGS(&dx12Heap));
+        if (FAILED(r))
+            return detail::mapHRESULT(r);
+
+        auto* output = new MemoryHeap();
+        output->m_desc = desc;
+        output->m_ptr = dx12Heap;
+
+        *heap = output;
+        return result::Success;
+    }
+
+    void Device::impl_destroyMemoryHeap(MemoryHeap* heap)
+    {
+        static_cast<ID3D12Heap*>(heap->m_ptr)->Release();
+        delete heap;
+    }
+
+    result Device::impl_queryResourceAllocationInfo(const resource_desc& desc, resource_allocation_info* info)
+    {
+        const D3D12_RESOURCE_DESC dx12Desc = detail::mapResourceDesc(desc);
+        const D3D12_RESOURCE_ALLOCATION_INFO dx12Info = static_cast<ID3D12Device*>(m_ptr)->GetResourceAllocationInfo(desc.visibleNodeMask, 1, &dx12Desc);
+        if (dx12Info.SizeInBytes == std::numeric_limits<UINT64>::max())
+            return result::ErrorInvalidUsage;
+
+        *info = resource_allocation_info { dx12Info.SizeInBytes, dx12Info.Alignment };
+        return result::Success;
+    }
+
+    result Device::impl_createPlacedResource(MemoryHeap* heap, uint64_t offset, const resource_desc& desc, Resource** resource)
+    {
+        const D3D12_RESOURCE_DESC dx12Desc = detail::mapResourceDesc(desc);
+        const D3D12_RESOURCE_STATES initialState = detail::mapResourceState(desc.initialState);
+
+        ID3D12Resource* dx12Resource = nullptr;
+        const auto r = static_cast<ID3D12Device*>(m_ptr)->CreatePlacedResource(static_cast<ID3D12Heap*>(heap->m_ptr), offset, &dx12Desc, initialState, nullptr, IID_PPV_ARGS(&dx12Resource));
+        if (FAILED(r))
+            return detail::mapHRESULT(r);
+
+        auto* output = m_resources.allocate();
+        output->m_desc = desc;
+        output->m_hot->resource = dx12Resource;
+        output->m_heap = heap;
+        output->m_heapOffset = offset;
+        *resource = output;
+        return result::Success;
+    }
+
+    result Device::impl_mapResource(Resource* resource, void** data)
+    {
+        // Read buffers are read by the host, so the entire buffer may be read. Upload buffers are write-only for the host.
+        const D3D12_RANGE readRange { 0, resource->m_desc.memoryType == memory_type::Read ? resource->m_desc.width : 0 };
+
+        const HRESULT r = static_cast<ID3D12Resource*>(resource->m_hot->resource)->Map(0, &readRange, data);
+        if (FAILED(r))
+            return detail::mapHRESULT(r);
+
+        return result::Success;
+    }
+
+    void Device::impl_unmapResource(Resource* resource)
+    {
+        // Upload buffers may have been written in their entirety, Read buffers weren't written
+        const D3D12_RANGE writtenRange { 0, resource->m_desc.memoryType == memory_type::Upload ? resource->m_desc.width : 0 };
+        static_cast<ID3D12Resource*>(resource->m_hot->resource)->Unmap(0, &writtenRange);
+    }
+
+    result Device::impl_setSimulatedTimingEXT([[maybe_unused]] queue_type type, [[maybe_unused]] const simulated_timing_desc_ext& desc)
+    {
+        // DirectX 12 executes work on a GPU, so its timing can't be simulated
+        return result::ErrorExtensionNotSupported;
+    }
+
+    result Device::impl_querySimulatedTimeEXT([[maybe_unused]] uint64_t* time) const
+    {
+        return result::ErrorExtensionNotSupported;
+    }
+
+    result Device::impl_advanceSimulatedTimeEXT([[maybe_unused]] uint64_t nanoseconds)
+    {
+        return result::ErrorExtensionNotSupported;
+    }
+
+    result Device::impl_importHostMemoryEXT(void* data, uint32_t size, Resource** resource)
+    {
+        const resource_desc desc = resource_desc::buffer(resource_usage_flag_bits::TransferSrc, memory_type::Upload, resource_state::Upload, size);
+
+        ID3D12Device3* device3 = nullptr;
+        auto r = static_cast<ID3D12Device*>(m_ptr)->QueryInterface(IID_PPV_ARGS(&device3));
+        if (FAILED(r))
+            return detail::mapHRESULT(r);
+
+        // the heap wraps the host memory without copying it, the buffer is placed at the offset of data in the heap
+        ID3D12Heap* dx12Heap = nullptr;
+        r = device3->OpenExistingHeapFromAddress(data, IID_PPV_ARGS(&dx12Heap));
+        device3->Release();
+        if (FAILED(r))
+            return result::ErrorInvalidUsage;
+
+        MEMORY_BASIC_INFORMATION memoryInfo;
+        VirtualQuery(data, &memoryInfo, sizeof(memoryInfo));
+        const uint64_t offset = static_cast<uint64_t>(static_cast<uint8_t*>(data) - static_cast<uint8_t*>(memoryInfo.AllocationBase));
+
+        const D3D12_RESOURCE_DESC dx12Desc = detail::mapResourceDesc(desc);
+        ID3D12Resource* dx12Resource = nullptr;
+        r = static_cast<ID3D12Device*>(m_ptr)->CreatePlacedResource(dx12Heap, offset, &dx12Desc, detail::mapResourceState(desc.initialState), nullptr, IID_PPV_ARGS(&dx12Resource));
+        if (FAILED(r))
+        {
+            dx12Heap->Release();
+            return detail::mapHRESULT(r);
+        }
+
+        auto* output = m_resources.allocate();
+        output->m_desc = desc;
+        output->m_hot->resource = dx12Resource;
+        output->m_hot->memory = dx12Heap;
+        output->m_imported = true;
+        *resource = output;
+        return result::Success;
+    }
+
+    result Device::impl_createExportableResourceEXT([[maybe_unused]] const resource_desc& desc, [[maybe_unused]] external_memory_handle_type_ext handleType, [[maybe_unused]] Resource** resource)
+    {
+        // DirectX 12 shares memory and fences through NT handles instead of file descriptors
+        return result::ErrorExtensionNotSupported;
+    }
+
+    result Device::impl_exportResourceMemoryFdEXT([[maybe_unused]] Resource* resource, [[maybe_unused]] int* fd)
+    {
+        return result::ErrorExtensionNotSupported;
+    }
+
+    result Device::impl_importResourceMemoryFdEXT([[maybe_unused]] const resource_desc& desc, [[maybe_unused]] external_memory_handle_type_ext handleType, [[maybe_unused]] int fd, [[maybe_unused]] Resource** resource)
+    {
+        return result::ErrorExtensionNotSupported;
+    }
+
+    result Device::impl_createExportableSemaphoreEXT([[maybe_unused]] Semaphore** semaphore)
+    {
+        return result::ErrorExtensionNotSupported;
+    }
+
+    result Device::impl_exportSemaphoreSyncFdEXT([[maybe_unused]] Semaphore* semaphore, [[maybe_unused]] int* fd)
+    {
+        return result::ErrorExtensionNotSupported;
+    }
+
+    result Device::impl_importSemaphoreSyncFdEXT([[maybe_unused]] Semaphore* semaphore, [[maybe_unused]] int fd)
+    {
+        return result::ErrorExtensionNotSupported;
     }
 }
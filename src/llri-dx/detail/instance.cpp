@@ -70,6 +70,8 @@ namespace llri
 
             auto* output = new Instance();
             output->m_desc = desc;
+            output->m_validationLevel = desc.validationLevel;
+            output->m_messageTarget = detail::instanceMessageTarget(desc);
             UINT factoryFlags = 0;
 
             for (size_t i = 0; i < desc.numExtensions; i++)
@@ -167,7 +169,7 @@ namespace llri
 #endif
         }
 
-        void impl_pollAPIMessages(messenger_type* messenger)
+        void impl_pollAPIMessages(const message_target& target, messenger_type* messenger)
         {
             if (messenger != nullptr)
             {
@@ -188,7 +190,7 @@ namespace llri
                         continue;
 
                     if (pMessage->pDescription != nullptr)
-                        detail::callUserCallback(detail::mapSeverity(pMessage->Severity), message_source::Implementation, pMessage->pDescription);
+                        detail::callUserCallback(target, detail::mapSeverity(pMessage->Severity), message_source::Implementation, pMessage->pDescription);
 
                     free(pMessage);
                 }
@@ -242,6 +244,8 @@ namespace llri
                 adapter->m_ptr = dxgiAdapter;
                 adapter->m_instance = this;
                 adapter->m_validationCallbackMessenger = m_validationCallbackMessenger;
+                adapter->m_validationLevel = m_validationLevel;
+                adapter->m_messageTarget = m_messageTarget;
 
                 // Attempt to query node count
                 ID3D12Device* device = nullptr;
@@ -274,6 +278,8 @@ namespace llri
         output->m_desc = desc;
         output->m_adapter = desc.adapter;
         output->m_validationCallbackMessenger = m_validationCallbackMessenger;
+        output->m_validationLevel = m_validationLevel;
+        output->m_messageTarget = m_messageTarget;
         output->m_ptr = dx12Device;
 
         if (m_shouldConstructValidationCallbackMessenger)
@@ -330,6 +336,9 @@ namespace llri
             queue->m_ptrs = queues;
             queue->m_fences = fences;
             queue->m_validationCallbackMessenger = output->m_validationCallbackMessenger;
+            queue->m_validationLevel = output->m_validationLevel;
+            queue->m_messageTarget = output->m_messageTarget;
+            queue->m_statistics = &output->m_statistics;
 
             switch(queueDesc.type)
             {
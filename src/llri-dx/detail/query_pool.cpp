@@ -0,0 +1,20 @@
+/**
+ * @file query_pool.cpp
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <llri/llri.hpp>
+#include <llri-dx/directx.hpp>
+
+namespace llri
+{
+    result QueryPool::impl_getResults(uint32_t first, uint32_t count, uint64_t* results)
+    {
+        // DX12 has no query availability, the readback buffer holds the results of the last resolve
+        const auto* data = static_cast<const uint64_t*>(m_readbackData);
+        const uint32_t stride = queryResultCount(m_desc.type);
+        std::copy_n(data + static_cast<size_t>(first) * stride, static_cast<size_t>(count) * stride, results);
+        return result::Success;
+    }
+}
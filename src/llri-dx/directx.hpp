@@ -304,5 +304,87 @@ namespace llri
 
             throw;
         }
+
+        constexpr D3D12_QUERY_HEAP_TYPE mapQueryHeapType(query_type type)
+        {
+            switch(type)
+            {
+                case query_type::Timestamp:
+                    return D3D12_QUERY_HEAP_TYPE_TIMESTAMP;
+                case query_type::Occlusion:
+                    return D3D12_QUERY_HEAP_TYPE_OCCLUSION;
+                case query_type::PipelineStatistics:
+                    return D3D12_QUERY_HEAP_TYPE_PIPELINE_STATISTICS;
+            }
+
+            throw;
+        }
+
+        constexpr D3D12_QUERY_TYPE mapQueryType(query_type type)
+        {
+            switch(type)
+            {
+                case query_type::Timestamp:
+                    return D3D12_QUERY_TYPE_TIMESTAMP;
+                case query_type::Occlusion:
+                    return D3D12_QUERY_TYPE_OCCLUSION;
+                case query_type::PipelineStatistics:
+                    return D3D12_QUERY_TYPE_PIPELINE_STATISTICS;
+            }
+
+            throw;
+        }
+
+        /**
+         * @brief Describes the buffer side of a texture_copy_desc as a placed footprint, which covers exactly the copied region.
+        */
+        inline D3D12_TEXTURE_COPY_LOCATION mapBufferCopyLocation(const texture_copy_desc& desc)
+        {
+            D3D12_TEXTURE_COPY_LOCATION location {};
+            location.pResource = static_cast<ID3D12Resource*>(desc.buffer->getNative());
+            location.Type = D3D12_TEXTURE_COPY_TYPE_PLACED_FOOTPRINT;
+            location.PlacedFootprint.Offset = desc.bufferOffset;
+            location.PlacedFootprint.Footprint.Format = mapTextureFormat(desc.texture->getDesc().textureFormat);
+            location.PlacedFootprint.Footprint.Width = desc.extent.width;
+            location.PlacedFootprint.Footprint.Height = desc.extent.height;
+            location.PlacedFootprint.Footprint.Depth = desc.extent.depth;
+            location.PlacedFootprint.Footprint.RowPitch = desc.bufferRowPitch;
+            return location;
+        }
+
+        /**
+         * @brief Describes the texture side of a texture_copy_desc as a subresource index.
+        */
+        inline D3D12_TEXTURE_COPY_LOCATION mapTextureCopyLocation(const texture_copy_desc& desc)
+        {
+            const resource_desc textureDesc = desc.texture->getDesc();
+
+            D3D12_TEXTURE_COPY_LOCATION location {};
+            location.pResource = static_cast<ID3D12Resource*>(desc.texture->getNative());
+            location.Type = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX;
+            location.SubresourceIndex = desc.mipLevel + desc.arrayLayer * textureDesc.mipLevels;
+            return location;
+        }
+
+        /**
+         * @brief Describes a resource_desc as a D3D12_RESOURCE_DESC, which is shared by committed and placed resources.
+        */
+        inline D3D12_RESOURCE_DESC mapResourceDesc(const resource_desc& desc)
+        {
+            const bool isTexture = desc.type != resource_type::Buffer;
+
+            D3D12_RESOURCE_DESC dx12Desc;
+            dx12Desc.Dimension = mapResourceType(desc.type);
+            dx12Desc.Alignment = 0;
+            dx12Desc.Width = static_cast<UINT64>(desc.width);
+            dx12Desc.Height = isTexture ? desc.height : 1;
+            dx12Desc.DepthOrArraySize = isTexture ? static_cast<UINT16>(desc.depthOrArrayLayers) : 1;
+            dx12Desc.MipLevels = isTexture ? static_cast<UINT16>(desc.mipLevels) : 1;
+            dx12Desc.Format = isTexture ? mapTextureFormat(desc.textureFormat) : DXGI_FORMAT_UNKNOWN;
+            dx12Desc.SampleDesc = isTexture ? DXGI_SAMPLE_DESC{ static_cast<UINT>(desc.sampleCount), D3D12_MULTISAMPLE_QUALITY_LEVELS_FLAG_NONE } : DXGI_SAMPLE_DESC{ 1, 0 };
+            dx12Desc.Layout = isTexture ? D3D12_TEXTURE_LAYOUT_UNKNOWN : D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
+            dx12Desc.Flags = mapResourceUsage(desc.usage);
+            return dx12Desc;
+        }
     }
 }
@@ -0,0 +1,117 @@
+/**
+ * @file adapter.cpp
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <llri/llri.hpp>
+#include <llri-null/utils.hpp>
+
+namespace llri
+{
+    adapter_info Adapter::impl_queryInfo() const
+    {
+        adapter_info info{};
+        info.vendorId = detail::nullVendorId;
+        info.adapterId = 0;
+        info.adapterName = detail::nullAdapterName;
+        info.adapterType = adapter_type::Virtual;
+        return info;
+    }
+
+    adapter_features Adapter::impl_queryFeatures() const
+    {
+        adapter_features features{};
+
+        // every feature is supported, because none of them do any work
+        features.pipelineStatisticsQuery = true;
+
+        return features;
+    }
+
+    adapter_limits Adapter::impl_queryLimits() const
+    {
+        adapter_limits output{};
+        output.timestampPeriod = 1.0f; // timestamps are written in nanoseconds
+        output.hostMemoryImportAlignment = 4096; // the page size that GPU implementations commonly require, so that applications behave the same on every implementation
+        return output;
+    }
+
+    bool Adapter::impl_queryExtensionSupport(adapter_extension ext) const
+    {
+        switch(ext)
+        {
+            case adapter_extension::SimulatedTiming:
+            case adapter_extension::HostMemoryImport:
+                return true;
+            case adapter_extension::ExternalMemoryFd:
+            case adapter_extension::ExternalSemaphoreFd:
+                // most resources have no memory, so there is nothing to share with other processes
+                return false;
+        }
+
+        return false;
+    }
+
+    result Adapter::impl_querySurfacePresentSupportEXT([[maybe_unused]] SurfaceEXT* surface, [[maybe_unused]] queue_type type, [[maybe_unused]] bool* support) const
+    {
+        return result::ErrorExtensionNotSupported;
+    }
+
+    result Adapter::impl_querySurfaceCapabilitiesEXT([[maybe_unused]] SurfaceEXT* surface, [[maybe_unused]] surface_capabilities_ext* capabilities) const
+    {
+        return result::ErrorExtensionNotSupported;
+    }
+
+    uint8_t Adapter::impl_queryQueueCount(queue_type type) const
+    {
+        return detail::nullQueueCount(type);
+    }
+
+    std::vector<queue_family_info> Adapter::impl_queryQueueFamilies() const
+    {
+        // every queue_type has its own simulated family
+        std::vector<queue_family_info> output;
+        for (uint8_t type = 0; type <= static_cast<uint8_t>(queue_type::MaxEnum); type++)
+        {
+            const auto queueType = static_cast<queue_type>(type);
+            if (detail::nullQueueCount(queueType) > 0)
+                output.push_back(queue_family_info { queueType, detail::nullQueueCount(queueType), true });
+        }
+
+        return output;
+    }
+
+    std::array<format_properties, static_cast<size_t>(format::MaxEnum) + 1> Adapter::impl_queryFormatProperties() const
+    {
+        std::array<format_properties, static_cast<size_t>(format::MaxEnum) + 1> result {};
+
+        constexpr uint8_t types = (1u << static_cast<uint8_t>(resource_type::Texture1D)) |
+            (1u << static_cast<uint8_t>(resource_type::Texture2D)) |
+            (1u << static_cast<uint8_t>(resource_type::Texture3D));
+
+        constexpr uint8_t sampleCounts = static_cast<uint8_t>(sample_count::Count1) | static_cast<uint8_t>(sample_count::Count2) |
+            static_cast<uint8_t>(sample_count::Count4) | static_cast<uint8_t>(sample_count::Count8) |
+            static_cast<uint8_t>(sample_count::Count16) | static_cast<uint8_t>(sample_count::Count32);
+
+        for (uint8_t f = 1; f <= static_cast<uint8_t>(format::MaxEnum); f++)
+        {
+            const auto form = static_cast<format>(f);
+
+            resource_usage_flags usageFlags = resource_usage_flag_bits::TransferSrc | resource_usage_flag_bits::TransferDst | resource_usage_flag_bits::Sampled;
+            if (has_depth_component(form))
+                usageFlags |= resource_usage_flag_bits::DepthStencilAttachment | resource_usage_flag_bits::DenyShaderResource;
+            else
+                usageFlags |= resource_usage_flag_bits::ShaderWrite | resource_usage_flag_bits::ColorAttachment;
+
+            result[f] = format_properties {
+                true,
+                types,
+                usageFlags,
+                sampleCounts
+            };
+        }
+
+        return result;
+    }
+}
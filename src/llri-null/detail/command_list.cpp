@@ -0,0 +1,105 @@
+/**
+ * @file command_list.cpp
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <llri/llri.hpp>
+#include <llri-null/utils.hpp>
+
+namespace llri
+{
+    namespace detail
+    {
+        void recordSimulatedCommands(void* deviceHandle, void* cmdList, uint32_t count, uint64_t size = 0)
+        {
+            // commands without an observable effect are only recorded for their simulated cost
+            if (!static_cast<null_device*>(deviceHandle)->simulatedTiming)
+                return;
+
+            static_cast<null_command_list*>(cmdList)->commands.push_back(null_command {
+                null_command_type::Simulated, nullptr, 0, count, size
+            });
+        }
+    }
+
+    result CommandList::impl_begin([[maybe_unused]] const command_list_begin_desc& desc)
+    {
+        static_cast<detail::null_command_list*>(m_ptr)->commands.clear();
+
+        m_state = command_list_state::Recording;
+        return result::Success;
+    }
+
+    result CommandList::impl_end()
+    {
+        m_state = command_list_state::Ready;
+        return result::Success;
+    }
+
+    result CommandList::impl_resourceBarrier(uint32_t numBarriers, [[maybe_unused]] const resource_barrier* barriers)
+    {
+        // barriers have no observable effect without GPU work
+        detail::recordSimulatedCommands(m_deviceHandle, m_ptr, numBarriers);
+        return result::Success;
+    }
+
+    result CommandList::impl_resetQueries(QueryPool* pool, uint32_t first, uint32_t count)
+    {
+        static_cast<detail::null_command_list*>(m_ptr)->commands.push_back(detail::null_command {
+            detail::null_command_type::ResetQueries, static_cast<detail::null_query_pool*>(pool->m_ptr), first, count
+        });
+        return result::Success;
+    }
+
+    result CommandList::impl_writeTimestamp(QueryPool* pool, uint32_t index)
+    {
+        static_cast<detail::null_command_list*>(m_ptr)->commands.push_back(detail::null_command {
+            detail::null_command_type::WriteTimestamp, static_cast<detail::null_query_pool*>(pool->m_ptr), index, 1
+        });
+        return result::Success;
+    }
+
+    result CommandList::impl_beginQuery([[maybe_unused]] QueryPool* pool, [[maybe_unused]] uint32_t index)
+    {
+        // the query only becomes available at endQuery()
+        detail::recordSimulatedCommands(m_deviceHandle, m_ptr, 1);
+        return result::Success;
+    }
+
+    result CommandList::impl_endQuery(QueryPool* pool, uint32_t index)
+    {
+        static_cast<detail::null_command_list*>(m_ptr)->commands.push_back(detail::null_command {
+            detail::null_command_type::EndQuery, static_cast<detail::null_query_pool*>(pool->m_ptr), index, 1
+        });
+        return result::Success;
+    }
+
+    result CommandList::impl_copyQueryResults(QueryPool* pool, [[maybe_unused]] uint32_t first, uint32_t count,
+        [[maybe_unused]] Resource* dst, [[maybe_unused]] uint64_t dstOffset)
+    {
+        // null resources have no memory to copy into
+        detail::recordSimulatedCommands(m_deviceHandle, m_ptr, 1, static_cast<uint64_t>(count) * queryResultCount(pool->m_desc.type) * sizeof(uint64_t));
+        return result::Success;
+    }
+
+    result CommandList::impl_copyBuffer([[maybe_unused]] Resource* src, [[maybe_unused]] uint64_t srcOffset,
+        [[maybe_unused]] Resource* dst, [[maybe_unused]] uint64_t dstOffset, uint64_t size)
+    {
+        // device memory doesn't exist in the null implementation, so copies have no observable effect
+        detail::recordSimulatedCommands(m_deviceHandle, m_ptr, 1, size);
+        return result::Success;
+    }
+
+    result CommandList::impl_copyBufferToTexture(const texture_copy_desc& desc)
+    {
+        detail::recordSimulatedCommands(m_deviceHandle, m_ptr, 1, detail::textureCopySize(desc));
+        return result::Success;
+    }
+
+    result CommandList::impl_copyTextureToBuffer(const texture_copy_desc& desc)
+    {
+        detail::recordSimulatedCommands(m_deviceHandle, m_ptr, 1, detail::textureCopySize(desc));
+        return result::Success;
+    }
+}
@@ -0,0 +1,253 @@
+/**
+ * @file device.cpp
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <llri/llri.hpp>
+#include <llri-null/utils.hpp>
+
+namespace llri
+{
+    result Device::impl_createCommandGroup(queue_type type, CommandGroup** cmdGroup)
+    {
+        auto* output = new CommandGroup();
+        output->m_device = this;
+        output->m_deviceFunctionTable = m_functionTable;
+        output->m_validationCallbackMessenger = m_validationCallbackMessenger;
+        output->m_validationLevel = m_validationLevel;
+        output->m_messageTarget = m_messageTarget;
+        output->m_statistics = &m_statistics;
+        output->m_type = type;
+
+        *cmdGroup = output;
+        return result::Success;
+    }
+
+    void Device::impl_destroyCommandGroup(CommandGroup* cmdGroup)
+    {
+        // the CommandList wrappers are destroyed along with the CommandGroup's pool
+        for (auto* cmdList : cmdGroup->m_cmdLists)
+            delete static_cast<detail::null_command_list*>(cmdList->m_ptr);
+
+        delete cmdGroup;
+    }
+
+    result Device::impl_createFence(fence_flags flags, Fence** fence)
+    {
+        auto* output = m_fences.allocate();
+        output->m_flags = flags;
+        output->m_signaled = (flags & fence_flag_bits::Signaled) == fence_flag_bits::Signaled;
+
+        *fence = output;
+        return result::Success;
+    }
+
+    void Device::impl_destroyFence(Fence* fence)
+    {
+        m_fences.free(fence);
+    }
+
+    result Device::impl_waitFences(uint32_t numFences, Fence** fences, uint64_t timeout)
+    {
+        // submits execute immediately, so every signaled fence has already been reached
+        // with simulated timing, the wait advances the simulated time to the moment that the last fence is signaled
+        auto* device = static_cast<detail::null_device*>(m_ptr);
+        if (device->simulatedTiming)
+        {
+            uint64_t target = 0;
+            for (size_t i = 0; i < numFences; i++)
+                target = std::max(target, fences[i]->m_counter);
+
+            const uint64_t now = device->time.load();
+            if (target > now && timeout != LLRI_TIMEOUT_MAX && (target - now + 999999) / 1000000 > timeout)
+            {
+                detail::advanceSimulatedTime(device->time, now + timeout * 1000000);
+                return result::Timeout;
+            }
+
+            detail::advanceSimulatedTime(device->time, target);
+        }
+
+        for (size_t i = 0; i < numFences; i++)
+            fences[i]->m_signaled = false;
+
+        return result::Success;
+    }
+
+    result Device::impl_createSemaphore(Semaphore** semaphore)
+    {
+        *semaphore = m_semaphores.allocate();
+        return result::Success;
+    }
+
+    void Device::impl_destroySemaphore(Semaphore* semaphore)
+    {
+        m_semaphores.free(semaphore);
+    }
+
+    result Device::impl_createQueryPool(const query_pool_desc& desc, QueryPool** pool)
+    {
+        auto* queries = new detail::null_query_pool();
+        queries->results.resize(static_cast<size_t>(desc.count) * queryResultCount(desc.type), 0);
+        queries->available.resize(desc.count, false);
+
+        auto* output = new QueryPool();
+        output->m_desc = desc;
+        output->m_ptr = queries;
+        output->m_validationCallbackMessenger = m_validationCallbackMessenger;
+        output->m_validationLevel = m_validationLevel;
+        output->m_messageTarget = m_messageTarget;
+
+        *pool = output;
+        return result::Success;
+    }
+
+    void Device::impl_destroyQueryPool(QueryPool* pool)
+    {
+        delete static_cast<detail::null_query_pool*>(pool->m_ptr);
+        delete pool;
+    }
+
+    result Device::impl_createResource(const resource_desc& desc, Resource** resource)
+    {
+        // no device memory is allocated, but the size is reported so that allocation statistics stay meaningful
+        auto* output = m_resources.allocate();
+        output->m_desc = desc;
+        output->m_allocationSize = detail::resourceSize(desc);
+
+        // buffers that can be mapped are backed by host memory, so that the host can write to and read from the mapped pointer
+        if (desc.type == resource_type::Buffer && desc.memoryType != memory_type::Local)
+            output->m_hot->memory = new uint8_t[desc.width] {};
+
+        *resource = output;
+        return result::Success;
+    }
+
+    void Device::impl_destroyResource(Resource* resource)
+    {
+        // placed resources point into the memory of their heap, and imported memory is owned by the application
+        if (!resource->m_heap && !resource->m_imported)
+            delete[] static_cast<uint8_t*>(resource->m_hot->memory);
+
+        m_resources.free(resource);
+    }
+
+    result Device::impl_createMemoryHeap(const memory_heap_desc& desc, MemoryHeap** heap)
+    {
+        auto* output = new MemoryHeap();
+        output->m_desc = desc;
+
+        // like buffers, heaps that can be mapped are backed by host memory
+        if (desc.memoryType != memory_type::Local)
+        {
+            output->m_ptr = new (std::nothrow) uint8_t[desc.size] {};
+            if (!output->m_ptr)
+            {
+                delete output;
+                return result::ErrorOutOfHostMemory;
+            }
+        }
+
+        *heap = output;
+        return result::Success;
+    }
+
+    void Device::impl_destroyMemoryHeap(MemoryHeap* heap)
+    {
+        delete[] static_cast<uint8_t*>(heap->m_ptr);
+        delete heap;
+    }
+
+    result Device::impl_queryResourceAllocationInfo(const resource_desc& desc, resource_allocation_info* info)
+    {
+        *info = resource_allocation_info { detail::resourceSize(desc), detail::nullResourceAlignment };
+        return result::Success;
+    }
+
+    result Device::impl_createPlacedResource(MemoryHeap* heap, uint64_t offset, const resource_desc& desc, Resource** resource)
+    {
+        auto* output = m_resources.allocate();
+        output->m_desc = desc;
+        output->m_heap = heap;
+        output->m_heapOffset = offset;
+
+        if (heap->m_ptr)
+            output->m_hot->memory = static_cast<uint8_t*>(heap->m_ptr) + offset;
+
+        *resource = output;
+        return result::Success;
+    }
+
+    result Device::impl_mapResource(Resource* resource, void** data)
+    {
+        *data = resource->m_hot->memory;
+        return result::Success;
+    }
+
+    void Device::impl_unmapResource([[maybe_unused]] Resource* resource)
+    {
+        // the host memory stays allocated until the Resource is destroyed
+    }
+
+    result Device::impl_setSimulatedTimingEXT(queue_type type, const simulated_timing_desc_ext& desc)
+    {
+        static_cast<detail::null_device*>(m_ptr)->timing[static_cast<size_t>(type)] = desc;
+        return result::Success;
+    }
+
+    result Device::impl_querySimulatedTimeEXT(uint64_t* time) const
+    {
+        *time = static_cast<detail::null_device*>(m_ptr)->time.load();
+        return result::Success;
+    }
+
+    result Device::impl_advanceSimulatedTimeEXT(uint64_t nanoseconds)
+    {
+        static_cast<detail::null_device*>(m_ptr)->time.fetch_add(nanoseconds);
+        return result::Success;
+    }
+
+    result Device::impl_importHostMemoryEXT(void* data, uint32_t size, Resource** resource)
+    {
+        // imported buffers are backed by the application's host memory, in the same way that Upload buffers are backed by host memory
+        auto* output = m_resources.allocate();
+        output->m_desc = resource_desc::buffer(resource_usage_flag_bits::TransferSrc, memory_type::Upload, resource_state::Upload, size);
+        output->m_hot->memory = data;
+        output->m_imported = true;
+
+        *resource = output;
+        return result::Success;
+    }
+
+    result Device::impl_createExportableResourceEXT([[maybe_unused]] const resource_desc& desc, [[maybe_unused]] external_memory_handle_type_ext handleType, [[maybe_unused]] Resource** resource)
+    {
+        // most resources have no memory, so there is nothing to share with other processes
+        return result::ErrorExtensionNotSupported;
+    }
+
+    result Device::impl_exportResourceMemoryFdEXT([[maybe_unused]] Resource* resource, [[maybe_unused]] int* fd)
+    {
+        return result::ErrorExtensionNotSupported;
+    }
+
+    result Device::impl_importResourceMemoryFdEXT([[maybe_unused]] const resource_desc& desc, [[maybe_unused]] external_memory_handle_type_ext handleType, [[maybe_unused]] int fd, [[maybe_unused]] Resource** resource)
+    {
+        return result::ErrorExtensionNotSupported;
+    }
+
+    result Device::impl_createExportableSemaphoreEXT([[maybe_unused]] Semaphore** semaphore)
+    {
+        return result::ErrorExtensionNotSupported;
+    }
+
+    result Device::impl_exportSemaphoreSyncFdEXT([[maybe_unused]] Semaphore* semaphore, [[maybe_unused]] int* fd)
+    {
+        return result::ErrorExtensionNotSupported;
+    }
+
+    result Device::impl_importSemaphoreSyncFdEXT([[maybe_unused]] Semaphore* semaphore, [[maybe_unused]] int fd)
+    {
+        return result::ErrorExtensionNotSupported;
+    }
+}
@@ -0,0 +1,27 @@
+/**
+ * @file query_pool.cpp
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <llri/llri.hpp>
+#include <llri-null/utils.hpp>
+#include <algorithm>
+
+namespace llri
+{
+    result QueryPool::impl_getResults(uint32_t first, uint32_t count, uint64_t* results)
+    {
+        const auto* queries = static_cast<detail::null_query_pool*>(m_ptr);
+
+        for (size_t i = first; i < static_cast<size_t>(first) + count; i++)
+        {
+            if (!queries->available[i])
+                return result::NotReady;
+        }
+
+        const size_t stride = queryResultCount(m_desc.type);
+        std::copy_n(queries->results.begin() + static_cast<ptrdiff_t>(first * stride), count * stride, results);
+        return result::Success;
+    }
+}
@@ -0,0 +1,105 @@
+/**
+ * @file queue.cpp
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <llri/llri.hpp>
+#include <llri-null/utils.hpp>
+#include <algorithm>
+
+namespace llri
+{
+    namespace detail
+    {
+        /**
+         * @brief Executes the recorded commands, starting at the given simulated time. Timestamps are written in simulated time if timing is not nullptr.
+         * @return The simulated time at which the commands finished.
+        */
+        uint64_t executeCommands(const null_command_list& cmdList, const simulated_timing_desc_ext* timing, uint64_t time)
+        {
+            for (const null_command& cmd : cmdList.commands)
+            {
+                const uint64_t cost = timing ? simulatedCost(cmd, *timing) : 0;
+                if (cmd.type == null_command_type::Simulated)
+                {
+                    time += cost;
+                    continue;
+                }
+
+                const size_t stride = cmd.pool->results.size() / cmd.pool->available.size();
+                const auto begin = cmd.pool->results.begin() + static_cast<ptrdiff_t>(cmd.first * stride);
+
+                switch (cmd.type)
+                {
+                    case null_command_type::ResetQueries:
+                    {
+                        std::fill_n(cmd.pool->available.begin() + cmd.first, cmd.count, false);
+                        break;
+                    }
+                    case null_command_type::WriteTimestamp:
+                    {
+                        *begin = timing ? time : nullTimestamp();
+                        cmd.pool->available[cmd.first] = true;
+                        break;
+                    }
+                    case null_command_type::EndQuery:
+                    {
+                        // nothing was drawn or dispatched, so all counters are zero
+                        std::fill_n(begin, stride, 0);
+                        cmd.pool->available[cmd.first] = true;
+                        break;
+                    }
+                    case null_command_type::Simulated:
+                        break;
+                }
+
+                time += cost;
+            }
+
+            return time;
+        }
+    }
+
+    result Queue::impl_submit(const submit_desc& desc)
+    {
+        auto* device = static_cast<detail::null_device*>(m_device->m_ptr);
+        auto* queue = static_cast<detail::null_queue*>(m_ptrs[0]);
+        const simulated_timing_desc_ext* timing = device->simulatedTiming ? &device->timing[static_cast<size_t>(m_desc.type)] : nullptr;
+
+        // the submission starts once the queue and the semaphores that it waits on are done
+        uint64_t time = 0;
+        if (timing)
+        {
+            time = std::max(device->time.load() + timing->submitLatency, queue->busyUntil);
+            for (size_t i = 0; i < desc.numWaitSemaphores; i++)
+                time = std::max(time, desc.waitSemaphores[i]->m_counter);
+        }
+
+        // commands are executed on the calling thread, so the submit is complete when this function returns
+        // with simulated timing, the results only become visible to Fences and Semaphores at their simulated time
+        for (size_t i = 0; i < desc.numCommandLists; i++)
+            time = detail::executeCommands(*static_cast<detail::null_command_list*>(desc.commandLists[i]->m_ptr), timing, time);
+
+        queue->busyUntil = time;
+        for (size_t i = 0; i < desc.numSignalSemaphores; i++)
+            desc.signalSemaphores[i]->m_counter = time;
+
+        if (desc.fence != nullptr)
+        {
+            desc.fence->m_counter = timing ? time + timing->fenceLatency : 0;
+            desc.fence->m_signaled = true;
+        }
+
+        return result::Success;
+    }
+
+    result Queue::impl_waitIdle()
+    {
+        auto* device = static_cast<detail::null_device*>(m_device->m_ptr);
+        if (device->simulatedTiming)
+            detail::advanceSimulatedTime(device->time, static_cast<detail::null_queue*>(m_ptrs[0])->busyUntil);
+
+        return result::Success;
+    }
+}
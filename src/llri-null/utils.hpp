@@ -0,0 +1,182 @@
+/**
+ * @file utils.hpp
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+#include <llri/llri.hpp>
+#include <algorithm>
+
+namespace llri
+{
+    namespace detail
+    {
+        /**
+         * @brief The name of the single Adapter that the null implementation exposes.
+        */
+        constexpr const char* nullAdapterName = "LLRI Null Adapter";
+
+        /**
+         * @brief The vendor ID that the null Adapter reports, which doesn't match any PCI vendor.
+        */
+        constexpr uint32_t nullVendorId = 0x4C4C5249; // "LLRI"
+
+        /**
+         * @brief Stands in for the native pointer of the null Adapter, because LLRI considers Adapters without one lost.
+        */
+        inline void* nullAdapterHandle()
+        {
+            static char handle;
+            return &handle;
+        }
+
+        /**
+         * @brief The number of queues that the null Adapter reports per queue_type.
+        */
+        constexpr uint8_t nullQueueCount(queue_type type)
+        {
+            switch (type)
+            {
+                case queue_type::Graphics:
+                    return 1;
+                case queue_type::Compute:
+                    return 4;
+                case queue_type::Transfer:
+                    return 2;
+            }
+
+            return 0;
+        }
+
+        /**
+         * @brief The number of bytes that a real implementation would roughly need for the resource, tightly packed and without alignment.
+        */
+        inline uint64_t resourceSize(const resource_desc& desc)
+        {
+            if (desc.type == resource_type::Buffer)
+                return desc.width;
+
+            const bool is3D = desc.type == resource_type::Texture3D;
+
+            uint64_t size = 0;
+            for (uint32_t mip = 0; mip < desc.mipLevels; mip++)
+            {
+                const uint64_t width = std::max(desc.width >> mip, 1u);
+                const uint64_t height = std::max(desc.height >> mip, 1u);
+                const uint64_t depth = is3D ? std::max(static_cast<uint32_t>(desc.depthOrArrayLayers) >> mip, 1u) : desc.depthOrArrayLayers;
+                size += width * height * depth;
+            }
+
+            return size * format_size(desc.textureFormat) * static_cast<uint64_t>(desc.sampleCount);
+        }
+
+        /**
+         * @brief The alignment that the null implementation reports for resources that are placed in a MemoryHeap.
+        */
+        constexpr uint64_t nullResourceAlignment = 256;
+
+        /**
+         * @brief The number of bytes of texel data that a texture copy transfers, excluding the padding between rows in the buffer.
+        */
+        inline uint64_t textureCopySize(const texture_copy_desc& desc)
+        {
+            return static_cast<uint64_t>(desc.extent.width) * desc.extent.height * desc.extent.depth * format_size(desc.texture->getDesc().textureFormat);
+        }
+
+        /**
+         * @brief The state of a QueryPool, which is written when the CommandLists that write to it are submitted.
+        */
+        struct null_query_pool
+        {
+            std::vector<uint64_t> results;
+            std::vector<bool> available;
+        };
+
+        enum struct null_command_type : uint8_t
+        {
+            ResetQueries,
+            WriteTimestamp,
+            EndQuery,
+            /**
+             * @brief count commands without an observable effect that copy size bytes in total. Only recorded if the Device simulates timing.
+            */
+            Simulated
+        };
+
+        /**
+         * @brief A recorded command that has an observable effect or a simulated cost, and thus needs to be emulated when the CommandList is submitted.
+        */
+        struct null_command
+        {
+            null_command_type type;
+            null_query_pool* pool;
+            uint32_t first;
+            uint32_t count;
+            uint64_t size = 0;
+        };
+
+        /**
+         * @brief The recorded commands of a CommandList.
+        */
+        struct null_command_list
+        {
+            std::vector<null_command> commands;
+        };
+
+        /**
+         * @brief The state of a Device, which only has an effect if the Device was created with adapter_extension::SimulatedTiming.
+        */
+        struct null_device
+        {
+            bool simulatedTiming = false;
+            /**
+             * @brief The simulated costs per queue_type.
+            */
+            std::array<simulated_timing_desc_ext, 3> timing {};
+            /**
+             * @brief The Device's simulated time in nanoseconds, which Fences, Semaphores and Queues compare their simulated times against.
+            */
+            std::atomic<uint64_t> time { 0 };
+        };
+
+        /**
+         * @brief The simulated timeline of a Queue.
+        */
+        struct null_queue
+        {
+            /**
+             * @brief The simulated time at which the Queue finishes its last submission.
+            */
+            uint64_t busyUntil = 0;
+        };
+
+        /**
+         * @brief Advances the simulated time to target, if target is later than the current simulated time.
+        */
+        inline void advanceSimulatedTime(std::atomic<uint64_t>& time, uint64_t target)
+        {
+            uint64_t current = time.load();
+            while (current < target && !time.compare_exchange_weak(current, target)) { }
+        }
+
+        /**
+         * @brief The simulated cost of executing the command.
+        */
+        inline uint64_t simulatedCost(const null_command& cmd, const simulated_timing_desc_ext& timing)
+        {
+            uint64_t cost = timing.commandCost * (cmd.type == null_command_type::Simulated ? cmd.count : 1);
+            if (cmd.size > 0 && timing.copyBandwidth > 0)
+                cost += static_cast<uint64_t>(std::ceil(static_cast<double>(cmd.size) * 1e9 / static_cast<double>(timing.copyBandwidth)));
+            return cost;
+        }
+
+        /**
+         * @brief Nanoseconds on a monotonic clock, used for timestamp queries. The null Adapter reports a timestamp period of 1.
+        */
+        inline uint64_t nullTimestamp()
+        {
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+        }
+    }
+}
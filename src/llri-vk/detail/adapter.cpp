@@ -53,18 +53,65 @@ namespace llri
         adapter_features features{};
 
         // Set all the information in a structured way here
+        features.pipelineStatisticsQuery = physicalFeatures.pipelineStatisticsQuery;
 
         return features;
     }
 
     adapter_limits Adapter::impl_queryLimits() const
     {
+        VkPhysicalDeviceProperties properties;
+        vkGetPhysicalDeviceProperties(static_cast<VkPhysicalDevice>(m_ptr), &properties);
+
         adapter_limits output{};
+        output.timestampPeriod = properties.limits.timestampPeriod;
+
+        if (detail::queryDeviceExtensionSupport(static_cast<VkPhysicalDevice>(m_ptr), "VK_EXT_external_memory_host"))
+        {
+            VkPhysicalDeviceExternalMemoryHostPropertiesEXT hostProperties {};
+            hostProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_MEMORY_HOST_PROPERTIES_EXT;
+
+            VkPhysicalDeviceProperties2 properties2 {};
+            properties2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+            properties2.pNext = &hostProperties;
+            vkGetPhysicalDeviceProperties2(static_cast<VkPhysicalDevice>(m_ptr), &properties2);
+
+            output.hostMemoryImportAlignment = hostProperties.minImportedHostPointerAlignment;
+        }
+
         return output;
     }
 
-    bool Adapter::impl_queryExtensionSupport([[maybe_unused]] adapter_extension ext) const
+    bool Adapter::impl_queryExtensionSupport(adapter_extension ext) const
     {
+        switch(ext)
+        {
+            case adapter_extension::SimulatedTiming:
+                // work is executed on a GPU, so its timing can't be simulated
+                return false;
+            case adapter_extension::HostMemoryImport:
+                return detail::queryDeviceExtensionSupport(static_cast<VkPhysicalDevice>(m_ptr), "VK_EXT_external_memory_host");
+            case adapter_extension::ExternalMemoryFd:
+                return detail::queryDeviceExtensionSupport(static_cast<VkPhysicalDevice>(m_ptr), "VK_KHR_external_memory_fd");
+            case adapter_extension::ExternalSemaphoreFd:
+            {
+                if (!detail::queryDeviceExtensionSupport(static_cast<VkPhysicalDevice>(m_ptr), "VK_KHR_external_semaphore_fd"))
+                    return false;
+
+                // the extension also covers opaque file descriptors, so sync file support is queried separately
+                VkPhysicalDeviceExternalSemaphoreInfo info {};
+                info.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_SEMAPHORE_INFO;
+                info.handleType = VK_EXTERNAL_SEMAPHORE_HANDLE_TYPE_SYNC_FD_BIT;
+
+                VkExternalSemaphoreProperties properties {};
+                properties.sType = VK_STRUCTURE_TYPE_EXTERNAL_SEMAPHORE_PROPERTIES;
+                vkGetPhysicalDeviceExternalSemaphoreProperties(static_cast<VkPhysicalDevice>(m_ptr), &info, &properties);
+
+                const VkExternalSemaphoreFeatureFlags required = VK_EXTERNAL_SEMAPHORE_FEATURE_EXPORTABLE_BIT | VK_EXTERNAL_SEMAPHORE_FEATURE_IMPORTABLE_BIT;
+                return (properties.externalSemaphoreFeatures & required) == required;
+            }
+        }
+
         return false;
     }
 
@@ -143,50 +190,58 @@ namespace llri
 
     uint8_t Adapter::impl_queryQueueCount(queue_type type) const
     {
+        const uint32_t family = detail::findQueueFamilies(static_cast<VkPhysicalDevice>(m_ptr))[type];
+        if (family == std::numeric_limits<uint32_t>::max())
+            return 0;
+
         // Get queue family info
         uint32_t propertyCount;
         vkGetPhysicalDeviceQueueFamilyProperties(static_cast<VkPhysicalDevice>(m_ptr), &propertyCount, nullptr);
         std::vector<VkQueueFamilyProperties> properties(propertyCount);
         vkGetPhysicalDeviceQueueFamilyProperties(static_cast<VkPhysicalDevice>(m_ptr), &propertyCount, properties.data());
 
-        for (auto p : properties)
+        return static_cast<uint8_t>(std::min<uint32_t>(properties[family].queueCount, std::numeric_limits<uint8_t>::max()));
+    }
+
+    std::vector<queue_family_info> Adapter::impl_queryQueueFamilies() const
+    {
+        auto families = detail::findQueueFamilies(static_cast<VkPhysicalDevice>(m_ptr));
+
+        uint32_t propertyCount;
+        vkGetPhysicalDeviceQueueFamilyProperties(static_cast<VkPhysicalDevice>(m_ptr), &propertyCount, nullptr);
+        std::vector<VkQueueFamilyProperties> properties(propertyCount);
+        vkGetPhysicalDeviceQueueFamilyProperties(static_cast<VkPhysicalDevice>(m_ptr), &propertyCount, properties.data());
+
+        std::vector<queue_family_info> output;
+        for (uint32_t i = 0; i < propertyCount; i++)
         {
-            switch(type)
-            {
-                case queue_type::Graphics:
-                {
-                    // Only the graphics queue has the graphics bit set
-                    // it usually also has compute & transfer set, because graphics queue tends to be general purpose
-                    if ((p.queueFlags & VK_QUEUE_GRAPHICS_BIT) == VK_QUEUE_GRAPHICS_BIT)
-                        return static_cast<uint8_t>(p.queueCount);
-                    break;
-                }
-                case queue_type::Compute:
-                {
-                    // Dedicated compute family has no graphics bit but does have a compute bit
-                    if ((p.queueFlags & VK_QUEUE_GRAPHICS_BIT) == 0 &&
-                        (p.queueFlags & VK_QUEUE_COMPUTE_BIT) == VK_QUEUE_COMPUTE_BIT)
-                        return static_cast<uint8_t>(p.queueCount);
-                    break;
-                }
-                case queue_type::Transfer:
-                {
-                    // Dedicated transfer family has no graphics bit, no compute bit, but does have a transfer bit
-                    if ((p.queueFlags & VK_QUEUE_GRAPHICS_BIT) == 0 &&
-                        (p.queueFlags & VK_QUEUE_COMPUTE_BIT) == 0 &&
-                        (p.queueFlags & VK_QUEUE_TRANSFER_BIT) == VK_QUEUE_TRANSFER_BIT)
-                        return static_cast<uint8_t>(p.queueCount);
-                    break;
-                }
-            }
+            queue_type type;
+            if (!detail::classifyQueueFamily(properties[i].queueFlags, &type))
+                continue;
+
+            output.push_back(queue_family_info {
+                type,
+                static_cast<uint8_t>(std::min<uint32_t>(properties[i].queueCount, std::numeric_limits<uint8_t>::max())),
+                families[type] == i
+            });
         }
-        
-        return 0;
+
+        return output;
     }
 
-    std::unordered_map<format, format_properties> Adapter::impl_queryFormatProperties() const
+    std::array<format_properties, static_cast<size_t>(format::MaxEnum) + 1> Adapter::impl_queryFormatProperties() const
     {
-        std::unordered_map<format, format_properties> result;
+        std::array<format_properties, static_cast<size_t>(format::MaxEnum) + 1> result {};
+
+        // sample counts are a device limit, not a per-format property
+        VkPhysicalDeviceProperties deviceProps;
+        vkGetPhysicalDeviceProperties(static_cast<VkPhysicalDevice>(m_ptr), &deviceProps);
+        const VkSampleCountFlags counts = deviceProps.limits.framebufferColorSampleCounts & deviceProps.limits.framebufferDepthSampleCounts;
+
+        // VkSampleCountFlagBits share their bit values with sample_count
+        constexpr VkSampleCountFlags countMask = VK_SAMPLE_COUNT_1_BIT | VK_SAMPLE_COUNT_2_BIT | VK_SAMPLE_COUNT_4_BIT |
+            VK_SAMPLE_COUNT_8_BIT | VK_SAMPLE_COUNT_16_BIT | VK_SAMPLE_COUNT_32_BIT;
+        const auto sampleCounts = static_cast<uint8_t>(counts & countMask);
 
         for (uint8_t f = 0; f <= static_cast<uint8_t>(format::MaxEnum); f++)
         {
@@ -219,43 +274,26 @@ namespace llri
             if ((formatProps.optimalTilingFeatures & VK_FORMAT_FEATURE_DEPTH_STENCIL_ATTACHMENT_BIT) == VK_FORMAT_FEATURE_DEPTH_STENCIL_ATTACHMENT_BIT)
                 usageFlags |= resource_usage_flag_bits::DepthStencilAttachment;
 
-            // get sample counts
-            VkPhysicalDeviceProperties deviceProps;
-            vkGetPhysicalDeviceProperties(static_cast<VkPhysicalDevice>(m_ptr), &deviceProps);
-            const VkSampleCountFlags counts = deviceProps.limits.framebufferColorSampleCounts & deviceProps.limits.framebufferDepthSampleCounts;
-            const std::unordered_map<sample_count, bool> sampleCounts {
-                { sample_count::Count1, counts & VK_SAMPLE_COUNT_1_BIT },
-                { sample_count::Count2, counts & VK_SAMPLE_COUNT_2_BIT },
-                { sample_count::Count4, counts & VK_SAMPLE_COUNT_4_BIT },
-                { sample_count::Count8, counts & VK_SAMPLE_COUNT_8_BIT },
-                { sample_count::Count16, counts & VK_SAMPLE_COUNT_16_BIT },
-                { sample_count::Count32, counts & VK_SAMPLE_COUNT_32_BIT }
-            };
-
             // get types
-            std::unordered_map<resource_type, bool> types {
-                { resource_type::Buffer, false },
-                { resource_type::Texture1D, true },
-                { resource_type::Texture2D, true },
-                { resource_type::Texture3D, true }
-            };
+            uint8_t types = (1u << static_cast<uint8_t>(resource_type::Texture1D)) |
+                (1u << static_cast<uint8_t>(resource_type::Texture2D)) |
+                (1u << static_cast<uint8_t>(resource_type::Texture3D));
             
 #ifdef __APPLE__
             // molten VK doesnt support non-2D depth textures
             if (form == format::D16UNorm || form == format::D24UNormS8UInt ||
                 form == format::D32Float || form == format::D32FloatS8X24UInt)
             {
-                types[resource_type::Texture1D] = false;
-                types[resource_type::Texture3D] = false;
+                types = 1u << static_cast<uint8_t>(resource_type::Texture2D);
             }
 #endif
 
-            result.insert({ form, format_properties {
+            result[f] = format_properties {
                 supported,
                 types,
                 usageFlags,
                 sampleCounts
-            } });
+            };
         }
 
         return result;
@@ -38,7 +38,7 @@ namespace llri
         if (r != VK_SUCCESS)
             return detail::mapVkResult(r);
 
-        auto* output = new CommandList();
+        auto* output = m_cmdLists.allocate();
         output->m_ptr = cmd;
         output->m_group = this;
 
@@ -49,8 +49,9 @@ namespace llri
         output->m_state = command_list_state::Empty;
 
         output->m_validationCallbackMessenger = m_validationCallbackMessenger;
-
-        m_cmdLists.emplace(output);
+        output->m_validationLevel = m_validationLevel;
+        output->m_messageTarget = m_messageTarget;
+        output->m_statistics = m_statistics;
 
         *cmdList = output;
         return result::Success;
@@ -73,7 +74,7 @@ namespace llri
 
         for (size_t i = 0; i < count; i++)
         {
-            auto* cmdList = new CommandList();
+            auto* cmdList = m_cmdLists.allocate();
             cmdList->m_ptr = cmdBuffers[i];
             cmdList->m_group = this;
 
@@ -84,8 +85,10 @@ namespace llri
             cmdList->m_state = command_list_state::Empty;
 
             cmdList->m_validationCallbackMessenger = m_validationCallbackMessenger;
+            cmdList->m_validationLevel = m_validationLevel;
+            cmdList->m_messageTarget = m_messageTarget;
+            cmdList->m_statistics = m_statistics;
 
-            m_cmdLists.emplace(cmdList);
             cmdLists->push_back(cmdList);
         }
 
@@ -99,11 +102,8 @@ namespace llri
         static_cast<VolkDeviceTable*>(m_deviceFunctionTable)
             ->vkFreeCommandBuffers(static_cast<VkDevice>(m_device->m_ptr), static_cast<VkCommandPool>(m_ptr), 1, &buffer);
 
-        // Remove from commandlist list
-        m_cmdLists.erase(cmdList);
-
         // Delete wrapper
-        delete cmdList;
+        m_cmdLists.free(cmdList);
         return result::Success;
     }
 
@@ -118,14 +118,9 @@ namespace llri
         static_cast<VolkDeviceTable*>(m_deviceFunctionTable)
             ->vkFreeCommandBuffers(static_cast<VkDevice>(m_device->m_ptr), static_cast<VkCommandPool>(m_ptr), static_cast<uint32_t>(buffers.size()), buffers.data());
 
+        // Delete wrappers
         for (size_t i = 0; i < numCommandLists; i++)
-        {
-            // Remove from commandlist list
-            m_cmdLists.erase(cmdLists[i]);
-
-            // Delete wrapper
-            delete cmdLists[i];
-        }
+            m_cmdLists.free(cmdLists[i]);
 
         return result::Success;
     }
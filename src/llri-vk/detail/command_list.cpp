@@ -43,6 +43,26 @@ namespace llri
         std::vector<VkMemoryBarrier> memoryBarriers(numBarriers);
         std::vector<VkBufferMemoryBarrier> bufferBarriers(numBarriers);
         std::vector<VkImageMemoryBarrier> imageBarriers(numBarriers);
+
+        // the queue families were cached when the Device was created
+        const auto& families = m_group->m_device->m_queueFamilies;
+        auto getOwnershipFamilies = [&](const resource_barrier_ownership& own, uint32_t* srcFamily, uint32_t* dstFamily)
+        {
+            *srcFamily = VK_QUEUE_FAMILY_IGNORED;
+            *dstFamily = VK_QUEUE_FAMILY_IGNORED;
+
+            // concurrent resources don't have an owner, and transfers within a family only need a memory dependency
+            if (own.resource->getDesc().sharingMode == resource_sharing_mode::Concurrent)
+                return;
+
+            const uint32_t src = families[static_cast<size_t>(own.srcQueue)];
+            const uint32_t dst = families[static_cast<size_t>(own.dstQueue)];
+            if (src == dst || src == std::numeric_limits<uint32_t>::max() || dst == std::numeric_limits<uint32_t>::max())
+                return;
+
+            *srcFamily = src;
+            *dstFamily = dst;
+        };
         
         for (size_t i = 0; i < numBarriers; i++)
         {
@@ -57,6 +77,53 @@ namespace llri
                 case resource_barrier_type::ReadWrite:
                     resource = barrier.rw.resource;
                     break;
+                case resource_barrier_type::Release:
+                case resource_barrier_type::Acquire:
+                    resource = barrier.own.resource;
+                    break;
+                case resource_barrier_type::Aliasing:
+                {
+                    // vulkan has no aliasing barrier, all prior memory accesses must complete before the memory is reused
+                    VkMemoryBarrier memoryBarrier {};
+                    memoryBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+                    memoryBarrier.pNext = nullptr;
+                    memoryBarrier.srcAccessMask = VK_ACCESS_MEMORY_WRITE_BIT;
+                    memoryBarrier.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+                    memoryBarriers[numMemBarriers++] = memoryBarrier;
+
+                    // the layout of an image becomes undefined when its memory is aliased, so it's reinitialized from UNDEFINED
+                    const auto afterDesc = barrier.alias.after->getDesc();
+                    if (afterDesc.type != resource_type::Buffer)
+                    {
+                        VkImageAspectFlags aspectFlags = {};
+                        if (has_color_component(afterDesc.textureFormat))
+                            aspectFlags |= VK_IMAGE_ASPECT_COLOR_BIT;
+                        if (has_depth_component(afterDesc.textureFormat))
+                            aspectFlags |= VK_IMAGE_ASPECT_DEPTH_BIT;
+                        if (has_stencil_component(afterDesc.textureFormat))
+                            aspectFlags |= VK_IMAGE_ASPECT_STENCIL_BIT;
+
+                        VkImageMemoryBarrier imgBarrier {};
+                        imgBarrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+                        imgBarrier.pNext = nullptr;
+                        imgBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+                        imgBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+                        imgBarrier.image = static_cast<VkImage>(barrier.alias.after->m_hot->resource);
+                        imgBarrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+                        imgBarrier.newLayout = detail::mapResourceState(barrier.alias.afterState);
+                        imgBarrier.srcAccessMask = VK_ACCESS_NONE_KHR;
+                        imgBarrier.dstAccessMask = detail::mapStateToAccess(barrier.alias.afterState);
+                        imgBarrier.subresourceRange = VkImageSubresourceRange {
+                            aspectFlags,
+                            0,
+                            afterDesc.mipLevels,
+                            0,
+                            afterDesc.type == resource_type::Texture3D ? 1u : afterDesc.depthOrArrayLayers
+                        };
+                        imageBarriers[numImgBarriers++] = imgBarrier;
+                    }
+                    continue;
+                }
             }
             
             auto resourceDesc = resource->getDesc();
@@ -81,12 +148,29 @@ namespace llri
                         bufferBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
                         break;
                     }
+                    case resource_barrier_type::Release:
+                    {
+                        // the destination access of a release is ignored, the acquire defines it
+                        bufferBarrier.srcAccessMask = detail::mapStateToAccess(barrier.own.state);
+                        bufferBarrier.dstAccessMask = VK_ACCESS_NONE_KHR;
+                        break;
+                    }
+                    case resource_barrier_type::Acquire:
+                    {
+                        bufferBarrier.srcAccessMask = VK_ACCESS_NONE_KHR;
+                        bufferBarrier.dstAccessMask = detail::mapStateToAccess(barrier.own.state);
+                        break;
+                    }
+                    case resource_barrier_type::Aliasing:
+                        break;
                 }
                 
                 bufferBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
                 bufferBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+                if (barrier.type == resource_barrier_type::Release || barrier.type == resource_barrier_type::Acquire)
+                    getOwnershipFamilies(barrier.own, &bufferBarrier.srcQueueFamilyIndex, &bufferBarrier.dstQueueFamilyIndex);
                 
-                bufferBarrier.buffer = static_cast<VkBuffer>(resource->m_resource);
+                bufferBarrier.buffer = static_cast<VkBuffer>(resource->m_hot->resource);
                 bufferBarrier.offset = 0;
                 bufferBarrier.size = resourceDesc.width;
                 
@@ -99,7 +183,7 @@ namespace llri
                 imgBarrier.pNext = nullptr;
                 imgBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
                 imgBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-                imgBarrier.image = static_cast<VkImage>(resource->m_resource);
+                imgBarrier.image = static_cast<VkImage>(resource->m_hot->resource);
                 
                 switch(barrier.type)
                 {
@@ -121,6 +205,29 @@ namespace llri
                         imgBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
                         break;
                     }
+                    case resource_barrier_type::Release:
+                    case resource_barrier_type::Acquire:
+                    {
+                        imgBarrier.oldLayout = detail::mapResourceState(barrier.own.state);
+                        imgBarrier.newLayout = detail::mapResourceState(barrier.own.state);
+
+                        // the destination access of a release is ignored, the acquire defines it
+                        if (barrier.type == resource_barrier_type::Release)
+                        {
+                            imgBarrier.srcAccessMask = detail::mapStateToAccess(barrier.own.state);
+                            imgBarrier.dstAccessMask = VK_ACCESS_NONE_KHR;
+                        }
+                        else
+                        {
+                            imgBarrier.srcAccessMask = VK_ACCESS_NONE_KHR;
+                            imgBarrier.dstAccessMask = detail::mapStateToAccess(barrier.own.state);
+                        }
+
+                        getOwnershipFamilies(barrier.own, &imgBarrier.srcQueueFamilyIndex, &imgBarrier.dstQueueFamilyIndex);
+                        break;
+                    }
+                    case resource_barrier_type::Aliasing:
+                        break;
                 }
                 
                 // use the texture format to detect the aspect flags
@@ -132,8 +239,8 @@ namespace llri
                 if (has_stencil_component(resourceDesc.textureFormat))
                     aspectFlags |= VK_IMAGE_ASPECT_STENCIL_BIT;
                 
-                // use all subresources for readwrite barriers and if specified in transition.
-                bool allSubresources = barrier.type == resource_barrier_type::ReadWrite ||
+                // use all subresources for readwrite and ownership barriers and if specified in transition.
+                bool allSubresources = barrier.type != resource_barrier_type::Transition ||
                     barrier.trans.subresourceRange == texture_subresource_range::all();
                 if (allSubresources)
                 {
@@ -191,4 +298,71 @@ namespace llri
         return result::Success;
     }
 
+
+    result CommandList::impl_resetQueries(QueryPool* pool, uint32_t first, uint32_t count)
+    {
+        static_cast<VolkDeviceTable*>(m_deviceFunctionTable)->
+            vkCmdResetQueryPool(static_cast<VkCommandBuffer>(m_ptr), static_cast<VkQueryPool>(pool->m_ptr), first, count);
+        return result::Success;
+    }
+
+    result CommandList::impl_writeTimestamp(QueryPool* pool, uint32_t index)
+    {
+        static_cast<VolkDeviceTable*>(m_deviceFunctionTable)->
+            vkCmdWriteTimestamp(static_cast<VkCommandBuffer>(m_ptr), VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, static_cast<VkQueryPool>(pool->m_ptr), index);
+        return result::Success;
+    }
+
+    result CommandList::impl_beginQuery(QueryPool* pool, uint32_t index)
+    {
+        static_cast<VolkDeviceTable*>(m_deviceFunctionTable)->
+            vkCmdBeginQuery(static_cast<VkCommandBuffer>(m_ptr), static_cast<VkQueryPool>(pool->m_ptr), index, 0);
+        return result::Success;
+    }
+
+    result CommandList::impl_endQuery(QueryPool* pool, uint32_t index)
+    {
+        static_cast<VolkDeviceTable*>(m_deviceFunctionTable)->
+            vkCmdEndQuery(static_cast<VkCommandBuffer>(m_ptr), static_cast<VkQueryPool>(pool->m_ptr), index);
+        return result::Success;
+    }
+
+    result CommandList::impl_copyQueryResults(QueryPool* pool, uint32_t first, uint32_t count, Resource* dst, uint64_t dstOffset)
+    {
+        const VkDeviceSize stride = queryResultCount(pool->m_desc.type) * sizeof(uint64_t);
+
+        // the wait happens on the GPU timeline, the copy executes once the queries are available
+        static_cast<VolkDeviceTable*>(m_deviceFunctionTable)->
+            vkCmdCopyQueryPoolResults(static_cast<VkCommandBuffer>(m_ptr), static_cast<VkQueryPool>(pool->m_ptr), first, count,
+                static_cast<VkBuffer>(dst->m_hot->resource), dstOffset, stride, VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT);
+        return result::Success;
+    }
+
+    result CommandList::impl_copyBuffer(Resource* src, uint64_t srcOffset, Resource* dst, uint64_t dstOffset, uint64_t size)
+    {
+        const VkBufferCopy region { srcOffset, dstOffset, size };
+        static_cast<VolkDeviceTable*>(m_deviceFunctionTable)->
+            vkCmdCopyBuffer(static_cast<VkCommandBuffer>(m_ptr), static_cast<VkBuffer>(src->m_hot->resource), static_cast<VkBuffer>(dst->m_hot->resource), 1, &region);
+        return result::Success;
+    }
+
+    result CommandList::impl_copyBufferToTexture(const texture_copy_desc& desc)
+    {
+        const VkBufferImageCopy region = detail::mapTextureCopy(desc);
+        // resources used by a Transfer Queue are in resource_state::General
+        const VkImageLayout layout = m_group->m_type == queue_type::Transfer ? VK_IMAGE_LAYOUT_GENERAL : VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        static_cast<VolkDeviceTable*>(m_deviceFunctionTable)->
+            vkCmdCopyBufferToImage(static_cast<VkCommandBuffer>(m_ptr), static_cast<VkBuffer>(desc.buffer->m_hot->resource),
+                static_cast<VkImage>(desc.texture->m_hot->resource), layout, 1, &region);
+        return result::Success;
+    }
+
+    result CommandList::impl_copyTextureToBuffer(const texture_copy_desc& desc)
+    {
+        const VkBufferImageCopy region = detail::mapTextureCopy(desc);
+        static_cast<VolkDeviceTable*>(m_deviceFunctionTable)->
+            vkCmdCopyImageToBuffer(static_cast<VkCommandBuffer>(m_ptr), static_cast<VkImage>(desc.texture->m_hot->resource),
+                m_group->m_type == queue_type::Transfer ? VK_IMAGE_LAYOUT_GENERAL : VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, static_cast<VkBuffer>(desc.buffer->m_hot->resource), 1, &region);
+        return result::Success;
+    }
 }
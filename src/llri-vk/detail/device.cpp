@@ -9,20 +9,305 @@
 
 namespace llri
 {
+    namespace detail
+    {
+        /**
+         * @brief Creates the VkImage or VkBuffer that desc describes without binding memory to it, and queries its memory requirements.
+         * next is chained to the create info, e.g. to create resources that external memory can be bound to.
+        */
+        VkResult createUnboundResource(VolkDeviceTable* table, VkDevice device, VkPhysicalDevice physicalDevice, const resource_desc& desc, void** resource, VkMemoryRequirements* requirements, const void* next = nullptr)
+        {
+            // concurrent resources are shared between all valid queue families, exclusive resources are transferred through ownership barriers
+            std::vector<uint32_t> familyIndices;
+            if (desc.sharingMode == resource_sharing_mode::Concurrent)
+            {
+                const auto& families = findQueueFamilies(physicalDevice);
+                for (const auto& [key, family] : families)
+                {
+                    if (family != std::numeric_limits<uint32_t>::max())
+                        familyIndices.push_back(family);
+                }
+            }
+
+            if (desc.type != resource_type::Buffer)
+            {
+                uint32_t depth = desc.type == resource_type::Texture3D ? desc.depthOrArrayLayers : 1;
+                uint32_t arrayLayers = desc.type == resource_type::Texture3D ? 1 : desc.depthOrArrayLayers;
+
+                VkImageCreateInfo imageCreate;
+                imageCreate.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+                imageCreate.pNext = next;
+                imageCreate.flags = 0;
+                imageCreate.imageType = mapTextureType(desc.type);
+                imageCreate.format = mapTextureFormat(desc.textureFormat);
+                imageCreate.extent = VkExtent3D{ desc.width, desc.height, depth };
+                imageCreate.mipLevels = desc.mipLevels;
+                imageCreate.arrayLayers = arrayLayers;
+                imageCreate.samples = (VkSampleCountFlagBits)desc.sampleCount;
+                imageCreate.tiling = VK_IMAGE_TILING_OPTIMAL;
+                imageCreate.usage = mapTextureUsage(desc.usage);
+                imageCreate.sharingMode = familyIndices.size() > 1 ? VK_SHARING_MODE_CONCURRENT : VK_SHARING_MODE_EXCLUSIVE;
+                imageCreate.queueFamilyIndexCount = static_cast<uint32_t>(familyIndices.size());
+                imageCreate.pQueueFamilyIndices = familyIndices.data();
+                imageCreate.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+                VkImage image = VK_NULL_HANDLE;
+                const auto r = table->vkCreateImage(device, &imageCreate, nullptr, &image);
+                if (r != VK_SUCCESS)
+                    return r;
+
+                table->vkGetImageMemoryRequirements(device, image, requirements);
+                *resource = image;
+            }
+            else
+            {
+                VkBufferCreateInfo bufferCreate;
+                bufferCreate.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+                bufferCreate.pNext = next;
+                bufferCreate.flags = 0;
+                bufferCreate.size = desc.width;
+                bufferCreate.usage = mapBufferUsage(desc.usage);
+                bufferCreate.sharingMode = familyIndices.size() > 1 ? VK_SHARING_MODE_CONCURRENT : VK_SHARING_MODE_EXCLUSIVE;
+                bufferCreate.queueFamilyIndexCount = static_cast<uint32_t>(familyIndices.size());
+                bufferCreate.pQueueFamilyIndices = familyIndices.data();
+
+                VkBuffer buffer = VK_NULL_HANDLE;
+                const auto r = table->vkCreateBuffer(device, &bufferCreate, nullptr, &buffer);
+                if (r != VK_SUCCESS)
+                    return r;
+
+                table->vkGetBufferMemoryRequirements(device, buffer, requirements);
+                *resource = buffer;
+            }
+
+            return VK_SUCCESS;
+        }
+
+        /**
+         * @brief Destroys a VkImage or VkBuffer that was created through createUnboundResource(), without freeing the memory that's bound to it.
+        */
+        void destroyUnboundResource(VolkDeviceTable* table, VkDevice device, resource_type type, void* resource)
+        {
+            if (type != resource_type::Buffer)
+                table->vkDestroyImage(device, static_cast<VkImage>(resource), nullptr);
+            else
+                table->vkDestroyBuffer(device, static_cast<VkBuffer>(resource), nullptr);
+        }
+
+        /**
+         * @brief Queries the memory types that every kind of resource that can be placed in a heap of memoryType supports, by intersecting the requirements of a representative buffer
+         * and, for memory_type::Local, of a color and a depth texture. Textures are only included if the adapter supports their format and usage.
+        */
+        uint32_t queryHeapMemoryTypeBits(VolkDeviceTable* table, VkDevice device, VkPhysicalDevice physicalDevice, const Adapter* adapter, memory_type memoryType)
+        {
+            std::vector<resource_desc> descs;
+            switch (memoryType)
+            {
+                case memory_type::Local:
+                    descs.push_back(resource_desc::buffer(resource_usage_flag_bits::TransferSrc | resource_usage_flag_bits::TransferDst | resource_usage_flag_bits::ShaderWrite, memoryType, resource_state::General, 256));
+                    break;
+                case memory_type::Upload:
+                    descs.push_back(resource_desc::buffer(resource_usage_flag_bits::TransferSrc, memoryType, resource_state::Upload, 256));
+                    break;
+                case memory_type::Read:
+                    descs.push_back(resource_desc::buffer(resource_usage_flag_bits::TransferDst, memoryType, resource_state::TransferDst, 256));
+                    break;
+            }
+
+            if (memoryType == memory_type::Local)
+            {
+                const std::pair<format, resource_usage_flags> textures[] = {
+                    { format::RGBA8UNorm, resource_usage_flag_bits::TransferDst | resource_usage_flag_bits::Sampled | resource_usage_flag_bits::ColorAttachment },
+                    { format::D32Float, resource_usage_flag_bits::Sampled | resource_usage_flag_bits::DepthStencilAttachment }
+                };
+
+                for (const auto& [textureFormat, usage] : textures)
+                {
+                    const format_properties& properties = adapter->queryFormatProperties(textureFormat);
+                    if (properties.supported && properties.supportsType(resource_type::Texture2D) && properties.usage.all(usage))
+                        descs.push_back(resource_desc { 0, 0, resource_type::Texture2D, usage, memoryType, resource_state::General, 16, 16, 1, 1, sample_count::Count1, textureFormat, resource_sharing_mode::Exclusive });
+                }
+            }
+
+            uint32_t memoryTypeBits = std::numeric_limits<uint32_t>::max();
+            for (const auto& desc : descs)
+            {
+                void* resource = nullptr;
+                VkMemoryRequirements reqs;
+                if (createUnboundResource(table, device, physicalDevice, desc, &resource, &reqs) != VK_SUCCESS)
+                    continue;
+
+                destroyUnboundResource(table, device, desc.type, resource);
+                memoryTypeBits &= reqs.memoryTypeBits;
+            }
+
+            return memoryTypeBits;
+        }
+
+        /**
+         * @brief Creates the VkImage or VkBuffer that desc describes with memory that can be exported as handleType, or with memory that's imported from importFd if it isn't -1.
+         * Textures use dedicated allocations, because some drivers only support exporting and importing images that way.
+        */
+        VkResult createExternalResource(VolkDeviceTable* table, VkDevice device, VkPhysicalDevice physicalDevice, const resource_desc& desc, VkExternalMemoryHandleTypeFlagBits handleType, int importFd, void** resource, VkDeviceMemory* memory, VkDeviceSize* size)
+        {
+            const bool isTexture = desc.type != resource_type::Buffer;
+
+            VkExternalMemoryImageCreateInfo imageInfo {};
+            imageInfo.sType = VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO;
+            imageInfo.handleTypes = handleType;
+
+            VkExternalMemoryBufferCreateInfo bufferInfo {};
+            bufferInfo.sType = VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_BUFFER_CREATE_INFO;
+            bufferInfo.handleTypes = handleType;
+
+            VkMemoryRequirements reqs;
+            auto r = createUnboundResource(table, device, physicalDevice, desc, resource, &reqs, isTexture ? static_cast<const void*>(&imageInfo) : &bufferInfo);
+            if (r != VK_SUCCESS)
+                return r;
+
+            // dma-bufs report the memory types that they can be imported into, opaque file descriptors use the same memory type as the exporting resource
+            uint32_t memoryTypeBits = reqs.memoryTypeBits;
+            if (importFd != -1 && handleType == VK_EXTERNAL_MEMORY_HANDLE_TYPE_DMA_BUF_BIT_EXT)
+            {
+                VkMemoryFdPropertiesKHR fdProperties {};
+                fdProperties.sType = VK_STRUCTURE_TYPE_MEMORY_FD_PROPERTIES_KHR;
+                r = table->vkGetMemoryFdPropertiesKHR(device, handleType, importFd, &fdProperties);
+                if (r != VK_SUCCESS)
+                {
+                    destroyUnboundResource(table, device, desc.type, *resource);
+                    return r;
+                }
+
+                memoryTypeBits &= fdProperties.memoryTypeBits;
+            }
+
+            const uint32_t memoryTypeIndex = findMemoryTypeIndex(physicalDevice, memoryTypeBits, mapMemoryType(desc.memoryType));
+            if (memoryTypeIndex == std::numeric_limits<uint32_t>::max())
+            {
+                destroyUnboundResource(table, device, desc.type, *resource);
+                return VK_ERROR_INVALID_EXTERNAL_HANDLE;
+            }
+
+            VkMemoryDedicatedAllocateInfo dedicatedInfo {};
+            dedicatedInfo.sType = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO;
+            dedicatedInfo.image = isTexture ? static_cast<VkImage>(*resource) : VK_NULL_HANDLE;
+
+            VkExportMemoryAllocateInfo exportInfo {};
+            exportInfo.sType = VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO;
+            exportInfo.pNext = isTexture ? &dedicatedInfo : nullptr;
+            exportInfo.handleTypes = handleType;
+
+            VkImportMemoryFdInfoKHR importInfo {};
+            importInfo.sType = VK_STRUCTURE_TYPE_IMPORT_MEMORY_FD_INFO_KHR;
+            importInfo.pNext = isTexture ? &dedicatedInfo : nullptr;
+            importInfo.handleType = handleType;
+            importInfo.fd = importFd;
+
+            VkMemoryAllocateInfo allocInfo;
+            allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+            allocInfo.pNext = importFd != -1 ? static_cast<const void*>(&importInfo) : &exportInfo;
+            allocInfo.allocationSize = reqs.size;
+            allocInfo.memoryTypeIndex = memoryTypeIndex;
+
+            // the implementation only takes ownership of importFd if the allocation succeeds
+            r = table->vkAllocateMemory(device, &allocInfo, nullptr, memory);
+            if (r != VK_SUCCESS)
+            {
+                destroyUnboundResource(table, device, desc.type, *resource);
+                return r;
+            }
+
+            if (isTexture)
+                r = table->vkBindImageMemory(device, static_cast<VkImage>(*resource), *memory, 0);
+            else
+                r = table->vkBindBufferMemory(device, static_cast<VkBuffer>(*resource), *memory, 0);
+
+            if (r != VK_SUCCESS)
+            {
+                destroyUnboundResource(table, device, desc.type, *resource);
+                table->vkFreeMemory(device, *memory, nullptr);
+                return r;
+            }
+
+            *size = reqs.size;
+            return VK_SUCCESS;
+        }
+
+        /**
+         * @brief Transitions a newly created image from the UNDEFINED layout to desc.initialState through the Device's internal work CommandList, and waits for the transition to complete.
+         * Because the transition executes on the work queue, the work queue's family becomes the owner of exclusive images, as documented in resource_sharing_mode::Exclusive.
+        */
+        void transitionToInitialState(VolkDeviceTable* table, VkDevice device, VkQueue queue, VkCommandPool workPool, VkCommandBuffer workCmd, VkFence workFence, VkImage image, const resource_desc& desc)
+        {
+            table->vkResetCommandPool(device, workPool, {});
+            
+            // Record commandbuffer to transition texture from undefined
+            VkCommandBufferBeginInfo beginInfo {};
+            beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+            beginInfo.pNext = nullptr;
+            beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+            beginInfo.pInheritanceInfo = nullptr;
+            table->vkBeginCommandBuffer(workCmd, &beginInfo);
+            
+            // use the texture format to detect the aspect flags
+            VkImageAspectFlags aspectFlags = {};
+            if (has_color_component(desc.textureFormat))
+                aspectFlags |= VK_IMAGE_ASPECT_COLOR_BIT;
+            if (has_depth_component(desc.textureFormat))
+                aspectFlags |= VK_IMAGE_ASPECT_DEPTH_BIT;
+            if (has_stencil_component(desc.textureFormat))
+                aspectFlags |= VK_IMAGE_ASPECT_STENCIL_BIT;
+            
+            VkImageMemoryBarrier imageMemoryBarrier {};
+            imageMemoryBarrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+            imageMemoryBarrier.pNext = nullptr;
+            imageMemoryBarrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+            imageMemoryBarrier.newLayout = mapResourceState(desc.initialState);
+            imageMemoryBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            imageMemoryBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            imageMemoryBarrier.srcAccessMask = VK_ACCESS_NONE_KHR;
+            imageMemoryBarrier.dstAccessMask = mapStateToAccess(desc.initialState);
+            imageMemoryBarrier.image = image;
+            imageMemoryBarrier.subresourceRange = VkImageSubresourceRange { aspectFlags, 0, desc.mipLevels, 0, desc.depthOrArrayLayers };
+            
+            table->vkCmdPipelineBarrier(workCmd,
+                VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, mapStateToPipelineStage(desc.initialState), {},
+                0, nullptr, 0, nullptr, 1, &imageMemoryBarrier);
+            
+            table->vkEndCommandBuffer(workCmd);
+            
+            VkSubmitInfo submit {};
+            submit.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+            submit.pNext = nullptr;
+            submit.commandBufferCount = 1;
+            submit.pCommandBuffers = &workCmd;
+            submit.signalSemaphoreCount = 0;
+            submit.pSignalSemaphores = nullptr;
+            submit.waitSemaphoreCount = 0;
+            submit.pWaitSemaphores = nullptr;
+            submit.pWaitDstStageMask = nullptr;
+            table->vkQueueSubmit(queue, 1, &submit, workFence);
+            
+            table->vkWaitForFences(device, 1, &workFence, VK_TRUE, std::numeric_limits<uint64_t>::max());
+            table->vkResetFences(device, 1, &workFence);
+        }
+    }
+
     result Device::impl_createCommandGroup(queue_type type, CommandGroup** cmdGroup)
     {
         auto* output = new CommandGroup();
         output->m_device = this;
         output->m_deviceFunctionTable = m_functionTable;
         output->m_validationCallbackMessenger = m_validationCallbackMessenger;
+        output->m_validationLevel = m_validationLevel;
+        output->m_messageTarget = m_messageTarget;
+        output->m_statistics = &m_statistics;
         output->m_type = type;
 
-        auto families = detail::findQueueFamilies(static_cast<VkPhysicalDevice>(m_adapter->m_ptr));
-
         VkCommandPoolCreateInfo info;
         info.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
         info.pNext = nullptr;
-        info.queueFamilyIndex = families[type];
+        info.queueFamilyIndex = m_queueFamilies[static_cast<size_t>(type)];
         info.flags = {};
 
         VkCommandPool pool;
@@ -72,7 +357,7 @@ namespace llri
         if (r != VK_SUCCESS)
             return detail::mapVkResult(r);
 
-        auto* output = new Fence();
+        auto* output = m_fences.allocate();
         output->m_flags = flags;
         output->m_ptr = vkFence;
         output->m_signaled = signaled;
@@ -89,7 +374,7 @@ namespace llri
                 vkDestroyFence(static_cast<VkDevice>(m_ptr), static_cast<VkFence>(fence->m_ptr), nullptr);
         }
 
-        delete fence;
+        m_fences.free(fence);
     }
 
     result Device::impl_waitFences(uint32_t numFences, Fence** fences, uint64_t timeout)
@@ -130,7 +415,7 @@ namespace llri
         if (r != VK_SUCCESS)
             return detail::mapVkResult(r);
 
-        auto* output = new Semaphore();
+        auto* output = m_semaphores.allocate();
         output->m_ptr = vkSemaphore;
 
         *semaphore = output;
@@ -145,84 +430,63 @@ namespace llri
                 vkDestroySemaphore(static_cast<VkDevice>(m_ptr), static_cast<VkSemaphore>(semaphore->m_ptr), nullptr);
         }
 
-        delete semaphore;
+        m_semaphores.free(semaphore);
     }
 
-    result Device::impl_createResource(const resource_desc& desc, Resource** resource)
+    result Device::impl_createQueryPool(const query_pool_desc& desc, QueryPool** pool)
     {
-        auto* table = static_cast<VolkDeviceTable*>(m_functionTable);
-        
-        const bool isTexture = desc.type != resource_type::Buffer;
+        VkQueryPoolCreateInfo info;
+        info.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+        info.pNext = nullptr;
+        info.flags = {};
+        info.queryType = detail::mapQueryType(desc.type);
+        info.queryCount = desc.count;
+        info.pipelineStatistics = desc.type == query_type::PipelineStatistics ? detail::pipelineStatisticsFlags : 0;
 
-        // get all valid queue families
-        const auto& families = detail::findQueueFamilies(static_cast<VkPhysicalDevice>(m_adapter->m_ptr));
-        std::vector<uint32_t> familyIndices;
-        for (const auto& [key, family] : families)
-        {
-            if (family != std::numeric_limits<uint32_t>::max())
-                familyIndices.push_back(family);
-        }
+        VkQueryPool vkPool;
+        const auto r = static_cast<VolkDeviceTable*>(m_functionTable)->
+            vkCreateQueryPool(static_cast<VkDevice>(m_ptr), &info, nullptr, &vkPool);
+        if (r != VK_SUCCESS)
+            return detail::mapVkResult(r);
 
-        // get memory flags
-        const auto memFlags = detail::mapMemoryType(desc.memoryType);
+        auto* output = new QueryPool();
+        output->m_desc = desc;
+        output->m_ptr = vkPool;
+        output->m_deviceHandle = m_ptr;
+        output->m_deviceFunctionTable = m_functionTable;
+        output->m_validationCallbackMessenger = m_validationCallbackMessenger;
+        output->m_validationLevel = m_validationLevel;
+        output->m_messageTarget = m_messageTarget;
 
-        uint64_t dataSize = 0;
-        uint32_t memoryTypeIndex = 0;
+        *pool = output;
+        return result::Success;
+    }
 
-        VkImage image = VK_NULL_HANDLE;
-        VkBuffer buffer = VK_NULL_HANDLE;
-        if (isTexture)
+    void Device::impl_destroyQueryPool(QueryPool* pool)
+    {
+        if (pool->m_ptr)
         {
-            uint32_t depth = desc.type == resource_type::Texture3D ? desc.depthOrArrayLayers : 1;
-            uint32_t arrayLayers = desc.type == resource_type::Texture3D ? 1 : desc.depthOrArrayLayers;
-
-            VkImageCreateInfo imageCreate;
-            imageCreate.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
-            imageCreate.pNext = nullptr;
-            imageCreate.flags = 0;
-            imageCreate.imageType = detail::mapTextureType(desc.type);
-            imageCreate.format = detail::mapTextureFormat(desc.textureFormat);
-            imageCreate.extent = VkExtent3D{ desc.width, desc.height, depth };
-            imageCreate.mipLevels = desc.mipLevels;
-            imageCreate.arrayLayers = arrayLayers;
-            imageCreate.samples = (VkSampleCountFlagBits)desc.sampleCount;
-            imageCreate.tiling = VK_IMAGE_TILING_OPTIMAL;
-            imageCreate.usage = detail::mapTextureUsage(desc.usage);
-            imageCreate.sharingMode = familyIndices.size() > 1 ? VK_SHARING_MODE_CONCURRENT : VK_SHARING_MODE_EXCLUSIVE;
-            imageCreate.queueFamilyIndexCount = static_cast<uint32_t>(familyIndices.size());
-            imageCreate.pQueueFamilyIndices = familyIndices.data();
-            imageCreate.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-
-            auto r = table->vkCreateImage(static_cast<VkDevice>(m_ptr), &imageCreate, nullptr, &image);
-            if (r != VK_SUCCESS)
-                return detail::mapVkResult(r);
-
-            VkMemoryRequirements reqs;
-            table->vkGetImageMemoryRequirements(static_cast<VkDevice>(m_ptr), image, &reqs);
-            dataSize = reqs.size;
-            memoryTypeIndex = detail::findMemoryTypeIndex(static_cast<VkPhysicalDevice>(m_adapter->m_ptr), reqs.memoryTypeBits, memFlags);
+            static_cast<VolkDeviceTable*>(m_functionTable)->
+                vkDestroyQueryPool(static_cast<VkDevice>(m_ptr), static_cast<VkQueryPool>(pool->m_ptr), nullptr);
         }
-        else
-        {
-            VkBufferCreateInfo bufferCreate;
-            bufferCreate.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
-            bufferCreate.pNext = nullptr;
-            bufferCreate.flags = 0;
-            bufferCreate.size = desc.width;
-            bufferCreate.usage = detail::mapBufferUsage(desc.usage);
-            bufferCreate.sharingMode = familyIndices.size() > 1 ? VK_SHARING_MODE_CONCURRENT : VK_SHARING_MODE_EXCLUSIVE;
-            bufferCreate.queueFamilyIndexCount = static_cast<uint32_t>(familyIndices.size());
-            bufferCreate.pQueueFamilyIndices = familyIndices.data();
-
-            auto r = table->vkCreateBuffer(static_cast<VkDevice>(m_ptr), &bufferCreate, nullptr, &buffer);
-            if (r != VK_SUCCESS)
-                return detail::mapVkResult(r);
 
-            VkMemoryRequirements reqs;
-            table->vkGetBufferMemoryRequirements(static_cast<VkDevice>(m_ptr), buffer, &reqs);
-            dataSize = reqs.size;
-            memoryTypeIndex = detail::findMemoryTypeIndex(static_cast<VkPhysicalDevice>(m_adapter->m_ptr), reqs.memoryTypeBits, memFlags);
-        }
+        delete pool;
+    }
+
+    result Device::impl_createResource(const resource_desc& desc, Resource** resource)
+    {
+        auto* table = static_cast<VolkDeviceTable*>(m_functionTable);
+        
+        const bool isTexture = desc.type != resource_type::Buffer;
+
+        void* nativeResource = nullptr;
+        VkMemoryRequirements reqs;
+        auto r = detail::createUnboundResource(table, static_cast<VkDevice>(m_ptr), static_cast<VkPhysicalDevice>(m_adapter->m_ptr), desc, &nativeResource, &reqs);
+        if (r != VK_SUCCESS)
+            return detail::mapVkResult(r);
+
+        const uint64_t dataSize = reqs.size;
+        const uint32_t memoryTypeIndex = detail::findMemoryTypeIndex(static_cast<VkPhysicalDevice>(m_adapter->m_ptr), reqs.memoryTypeBits, detail::mapMemoryType(desc.memoryType));
 
         VkMemoryAllocateFlagsInfoKHR flagsInfo;
         flagsInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO;
@@ -237,28 +501,21 @@ namespace llri
         allocInfo.memoryTypeIndex = memoryTypeIndex;
         
         VkDeviceMemory memory;
-        auto r = table->vkAllocateMemory(static_cast<VkDevice>(m_ptr), &allocInfo, nullptr, &memory);
+        r = table->vkAllocateMemory(static_cast<VkDevice>(m_ptr), &allocInfo, nullptr, &memory);
         if (r != VK_SUCCESS)
         {
-            if (isTexture)
-                table->vkDestroyImage(static_cast<VkDevice>(m_ptr), image, nullptr);
-            else
-                table->vkDestroyBuffer(static_cast<VkDevice>(m_ptr), buffer, nullptr);
+            detail::destroyUnboundResource(table, static_cast<VkDevice>(m_ptr), desc.type, nativeResource);
             return detail::mapVkResult(r);
         }
 
         if (isTexture)
-            r = table->vkBindImageMemory(static_cast<VkDevice>(m_ptr), image, memory, 0);
+            r = table->vkBindImageMemory(static_cast<VkDevice>(m_ptr), static_cast<VkImage>(nativeResource), memory, 0);
         else
-            r = table->vkBindBufferMemory(static_cast<VkDevice>(m_ptr), buffer, memory, 0);
+            r = table->vkBindBufferMemory(static_cast<VkDevice>(m_ptr), static_cast<VkBuffer>(nativeResource), memory, 0);
 
         if (r != VK_SUCCESS)
         {
-            if (isTexture)
-                table->vkDestroyImage(static_cast<VkDevice>(m_ptr), image, nullptr);
-            else
-                table->vkDestroyBuffer(static_cast<VkDevice>(m_ptr), buffer, nullptr);
-
+            detail::destroyUnboundResource(table, static_cast<VkDevice>(m_ptr), desc.type, nativeResource);
             table->vkFreeMemory(static_cast<VkDevice>(m_ptr), memory, nullptr);
 
             return detail::mapVkResult(r);
@@ -268,76 +525,390 @@ namespace llri
         // so we must transition them to desc.initialState manually.
         if (isTexture)
         {
-            table->vkResetCommandPool(static_cast<VkDevice>(m_ptr), static_cast<VkCommandPool>(m_workCmdGroup), {});
-            
-            // Record commandbuffer to transition texture from undefined
-            VkCommandBufferBeginInfo beginInfo {};
-            beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
-            beginInfo.pNext = nullptr;
-            beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
-            beginInfo.pInheritanceInfo = nullptr;
-            table->vkBeginCommandBuffer(static_cast<VkCommandBuffer>(m_workCmdList), &beginInfo);
-            
-            // use the texture format to detect the aspect flags
-            VkImageAspectFlags aspectFlags = {};
-            if (has_color_component(desc.textureFormat))
-                aspectFlags |= VK_IMAGE_ASPECT_COLOR_BIT;
-            if (has_depth_component(desc.textureFormat))
-                aspectFlags |= VK_IMAGE_ASPECT_DEPTH_BIT;
-            if (has_stencil_component(desc.textureFormat))
-                aspectFlags |= VK_IMAGE_ASPECT_STENCIL_BIT;
-            
-            VkImageMemoryBarrier imageMemoryBarrier {};
-            imageMemoryBarrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
-            imageMemoryBarrier.pNext = nullptr;
-            imageMemoryBarrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-            imageMemoryBarrier.newLayout = detail::mapResourceState(desc.initialState);
-            imageMemoryBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-            imageMemoryBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-            imageMemoryBarrier.srcAccessMask = VK_ACCESS_NONE_KHR;
-            imageMemoryBarrier.dstAccessMask = detail::mapStateToAccess(desc.initialState);
-            imageMemoryBarrier.image = image;
-            imageMemoryBarrier.subresourceRange = VkImageSubresourceRange { aspectFlags, 0, desc.mipLevels, 0, desc.depthOrArrayLayers };
-            
-            table->vkCmdPipelineBarrier(static_cast<VkCommandBuffer>(m_workCmdList),
-                VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, detail::mapStateToPipelineStage(desc.initialState), {},
-                0, nullptr, 0, nullptr, 1, &imageMemoryBarrier);
-            
-            table->vkEndCommandBuffer(static_cast<VkCommandBuffer>(m_workCmdList));
-            
-            VkSubmitInfo submit {};
-            submit.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-            submit.pNext = nullptr;
-            submit.commandBufferCount = 1;
-            submit.pCommandBuffers = reinterpret_cast<VkCommandBuffer*>(&m_workCmdList);
-            submit.signalSemaphoreCount = 0;
-            submit.pSignalSemaphores = nullptr;
-            submit.waitSemaphoreCount = 0;
-            submit.pWaitSemaphores = nullptr;
-            submit.pWaitDstStageMask = nullptr;
-            table->vkQueueSubmit(static_cast<VkQueue>(getQueue(m_workQueueType, 0)->m_ptrs[0]), 1, &submit, static_cast<VkFence>(m_workFence));
-            
-            table->vkWaitForFences(static_cast<VkDevice>(m_ptr), 1, reinterpret_cast<VkFence*>(&m_workFence), VK_TRUE, std::numeric_limits<uint64_t>::max());
-            table->vkResetFences(static_cast<VkDevice>(m_ptr), 1, reinterpret_cast<VkFence*>(&m_workFence));
+            detail::transitionToInitialState(table, static_cast<VkDevice>(m_ptr), static_cast<VkQueue>(getQueue(m_workQueueType, 0)->m_ptrs[0]),
+                static_cast<VkCommandPool>(m_workCmdGroup), static_cast<VkCommandBuffer>(m_workCmdList), static_cast<VkFence>(m_workFence),
+                static_cast<VkImage>(nativeResource), desc);
         }
 
-        auto* output = new Resource();
+        auto* output = m_resources.allocate();
         output->m_desc = desc;
-        output->m_resource = isTexture ? static_cast<Resource::native_resource*>(image) : static_cast<Resource::native_resource*>(buffer);
-        output->m_memory = memory;
+        output->m_hot->resource = nativeResource;
+        output->m_hot->memory = memory;
+        output->m_allocationSize = dataSize;
         *resource = output;
         return result::Success;
     }
 
     void Device::impl_destroyResource(Resource* resource)
     {
-        const bool isTexture = resource->m_desc.type != resource_type::Buffer;
+        detail::destroyUnboundResource(static_cast<VolkDeviceTable*>(m_functionTable), static_cast<VkDevice>(m_ptr), resource->m_desc.type, resource->m_hot->resource);
+        
+        // placed resources share the memory of their heap, which is freed by destroyMemoryHeap()
+        if (!resource->m_heap)
+            static_cast<VolkDeviceTable*>(m_functionTable)->vkFreeMemory(static_cast<VkDevice>(m_ptr), static_cast<VkDeviceMemory>(resource->m_hot->memory), nullptr);
+
+        m_resources.free(resource);
+    }
+
+    result Device::impl_createMemoryHeap(const memory_heap_desc& desc, MemoryHeap** heap)
+    {
+        auto* table = static_cast<VolkDeviceTable*>(m_functionTable);
+
+        // the heap isn't created for a specific resource, so it uses a memory type that buffers and textures both support
+        const uint32_t memoryTypeBits = detail::queryHeapMemoryTypeBits(table, static_cast<VkDevice>(m_ptr), static_cast<VkPhysicalDevice>(m_adapter->m_ptr), m_adapter, desc.memoryType);
+        uint32_t memoryTypeIndex = detail::findMemoryTypeIndex(static_cast<VkPhysicalDevice>(m_adapter->m_ptr), memoryTypeBits, detail::mapMemoryType(desc.memoryType));
+
+        // if no memory type supports all of them, any memory type with the right properties is used and createPlacedResource() rejects the resources that don't support it
+        if (memoryTypeIndex == std::numeric_limits<uint32_t>::max())
+            memoryTypeIndex = detail::findMemoryTypeIndex(static_cast<VkPhysicalDevice>(m_adapter->m_ptr), std::numeric_limits<uint32_t>::max(), detail::mapMemoryType(desc.memoryType));
+        if (memoryTypeIndex == std::numeric_limits<uint32_t>::max())
+            return result::ErrorOutOfDeviceMemory;
+
+        VkMemoryAllocateFlagsInfoKHR flagsInfo;
+        flagsInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO;
+        flagsInfo.pNext = nullptr;
+        flagsInfo.deviceMask = desc.visibleNodeMask;
+        flagsInfo.flags = VK_MEMORY_ALLOCATE_DEVICE_MASK_BIT;
+
+        VkMemoryAllocateInfo allocInfo;
+        allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+        allocInfo.pNext = m_adapter->queryNodeCount() > 1 ? &flagsInfo : nullptr;
+        allocInfo.allocationSize = desc.size;
+        allocInfo.memoryTypeIndex = memoryTypeIndex;
+
+        VkDeviceMemory memory;
+        auto r = table->vkAllocateMemory(static_cast<VkDevice>(m_ptr), &allocInfo, nullptr, &memory);
+        if (r != VK_SUCCESS)
+            return detail::mapVkResult(r);
+
+        // memory can only be mapped once, so host visible heaps stay mapped and mapResource() returns an offset into the mapping
+        void* mapped = nullptr;
+        if (desc.memoryType != memory_type::Local)
+        {
+            r = table->vkMapMemory(static_cast<VkDevice>(m_ptr), memory, 0, VK_WHOLE_SIZE, {}, &mapped);
+            if (r != VK_SUCCESS)
+            {
+                table->vkFreeMemory(static_cast<VkDevice>(m_ptr), memory, nullptr);
+                return detail::mapVkResult(r);
+            }
+        }
+
+        auto* output = new MemoryHeap();
+        output->m_desc = desc;
+        output->m_ptr = memory;
+        output->m_memoryTypeIndex = memoryTypeIndex;
+        output->m_mapped = mapped;
+
+        *heap = output;
+        return result::Success;
+    }
+
+    void Device::impl_destroyMemoryHeap(MemoryHeap* heap)
+    {
+        // freeing memory implicitly unmaps it
+        static_cast<VolkDeviceTable*>(m_functionTable)->vkFreeMemory(static_cast<VkDevice>(m_ptr), static_cast<VkDeviceMemory>(heap->m_ptr), nullptr);
+        delete heap;
+    }
+
+    result Device::impl_queryResourceAllocationInfo(const resource_desc& desc, resource_allocation_info* info)
+    {
+        auto* table = static_cast<VolkDeviceTable*>(m_functionTable);
+
+        // the requirements can only be queried on an existing image or buffer, no memory is bound to it
+        void* nativeResource = nullptr;
+        VkMemoryRequirements reqs;
+        const auto r = detail::createUnboundResource(table, static_cast<VkDevice>(m_ptr), static_cast<VkPhysicalDevice>(m_adapter->m_ptr), desc, &nativeResource, &reqs);
+        if (r != VK_SUCCESS)
+            return detail::mapVkResult(r);
+
+        detail::destroyUnboundResource(table, static_cast<VkDevice>(m_ptr), desc.type, nativeResource);
+
+        *info = resource_allocation_info { reqs.size, reqs.alignment };
+        return result::Success;
+    }
+
+    result Device::impl_createPlacedResource(MemoryHeap* heap, uint64_t offset, const resource_desc& desc, Resource** resource)
+    {
+        auto* table = static_cast<VolkDeviceTable*>(m_functionTable);
+
+        const bool isTexture = desc.type != resource_type::Buffer;
+
+        void* nativeResource = nullptr;
+        VkMemoryRequirements reqs;
+        auto r = detail::createUnboundResource(table, static_cast<VkDevice>(m_ptr), static_cast<VkPhysicalDevice>(m_adapter->m_ptr), desc, &nativeResource, &reqs);
+        if (r != VK_SUCCESS)
+            return detail::mapVkResult(r);
+
+        // the heap's memory type is picked without knowing which resources will be placed in it, so not every resource is guaranteed to support it
+        if ((reqs.memoryTypeBits & (1u << heap->m_memoryTypeIndex)) == 0)
+        {
+            detail::destroyUnboundResource(table, static_cast<VkDevice>(m_ptr), desc.type, nativeResource);
+            return result::ErrorInvalidUsage;
+        }
 
         if (isTexture)
-            static_cast<VolkDeviceTable*>(m_functionTable)->vkDestroyImage(static_cast<VkDevice>(m_ptr), static_cast<VkImage>(resource->m_resource), nullptr);
+            r = table->vkBindImageMemory(static_cast<VkDevice>(m_ptr), static_cast<VkImage>(nativeResource), static_cast<VkDeviceMemory>(heap->m_ptr), offset);
         else
-            static_cast<VolkDeviceTable*>(m_functionTable)->vkDestroyBuffer(static_cast<VkDevice>(m_ptr), static_cast<VkBuffer>(resource->m_resource), nullptr);
-        
-        static_cast<VolkDeviceTable*>(m_functionTable)->vkFreeMemory(static_cast<VkDevice>(m_ptr), static_cast<VkDeviceMemory>(resource->m_memory), nullptr);
+            r = table->vkBindBufferMemory(static_cast<VkDevice>(m_ptr), static_cast<VkBuffer>(nativeResource), static_cast<VkDeviceMemory>(heap->m_ptr), offset);
+
+        if (r != VK_SUCCESS)
+        {
+            detail::destroyUnboundResource(table, static_cast<VkDevice>(m_ptr), desc.type, nativeResource);
+            return detail::mapVkResult(r);
+        }
+
+        // placed textures aren't transitioned to their initial state, because the aliasing barrier that initializes them before their first use reinitializes them from UNDEFINED
+        auto* output = m_resources.allocate();
+        output->m_desc = desc;
+        output->m_hot->resource = nativeResource;
+        output->m_hot->memory = heap->m_ptr;
+        output->m_heap = heap;
+        output->m_heapOffset = offset;
+        *resource = output;
+        return result::Success;
+    }
+
+    result Device::impl_mapResource(Resource* resource, void** data)
+    {
+        if (resource->m_heap)
+        {
+            *data = static_cast<uint8_t*>(resource->m_heap->m_mapped) + resource->m_heapOffset;
+            return result::Success;
+        }
+
+        // the whole allocation is mapped, which starts at the buffer because buffers are bound at offset 0
+        const auto r = static_cast<VolkDeviceTable*>(m_functionTable)->
+            vkMapMemory(static_cast<VkDevice>(m_ptr), static_cast<VkDeviceMemory>(resource->m_hot->memory), 0, VK_WHOLE_SIZE, {}, data);
+        if (r != VK_SUCCESS)
+            return detail::mapVkResult(r);
+
+        return result::Success;
+    }
+
+    void Device::impl_unmapResource(Resource* resource)
+    {
+        // placed resources share the mapping of their heap, which stays mapped until the heap is destroyed
+        if (resource->m_heap)
+            return;
+
+        static_cast<VolkDeviceTable*>(m_functionTable)->vkUnmapMemory(static_cast<VkDevice>(m_ptr), static_cast<VkDeviceMemory>(resource->m_hot->memory));
+    }
+
+    result Device::impl_setSimulatedTimingEXT([[maybe_unused]] queue_type type, [[maybe_unused]] const simulated_timing_desc_ext& desc)
+    {
+        // Vulkan executes work on a GPU, so its timing can't be simulated
+        return result::ErrorExtensionNotSupported;
+    }
+
+    result Device::impl_querySimulatedTimeEXT([[maybe_unused]] uint64_t* time) const
+    {
+        return result::ErrorExtensionNotSupported;
+    }
+
+    result Device::impl_advanceSimulatedTimeEXT([[maybe_unused]] uint64_t nanoseconds)
+    {
+        return result::ErrorExtensionNotSupported;
+    }
+
+    result Device::impl_importHostMemoryEXT(void* data, uint32_t size, Resource** resource)
+    {
+        auto* table = static_cast<VolkDeviceTable*>(m_functionTable);
+        const resource_desc desc = resource_desc::buffer(resource_usage_flag_bits::TransferSrc, memory_type::Upload, resource_state::Upload, size);
+
+        // the memory types that the pointer can be imported into depend on how the host memory was allocated
+        VkMemoryHostPointerPropertiesEXT pointerProperties {};
+        pointerProperties.sType = VK_STRUCTURE_TYPE_MEMORY_HOST_POINTER_PROPERTIES_EXT;
+        auto r = table->vkGetMemoryHostPointerPropertiesEXT(static_cast<VkDevice>(m_ptr), VK_EXTERNAL_MEMORY_HANDLE_TYPE_HOST_ALLOCATION_BIT_EXT, data, &pointerProperties);
+        if (r == VK_ERROR_INVALID_EXTERNAL_HANDLE)
+            return result::ErrorInvalidUsage;
+        if (r != VK_SUCCESS)
+            return detail::mapVkResult(r);
+
+        VkExternalMemoryBufferCreateInfo externalInfo {};
+        externalInfo.sType = VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_BUFFER_CREATE_INFO;
+        externalInfo.handleTypes = VK_EXTERNAL_MEMORY_HANDLE_TYPE_HOST_ALLOCATION_BIT_EXT;
+
+        void* nativeResource = nullptr;
+        VkMemoryRequirements reqs;
+        r = detail::createUnboundResource(table, static_cast<VkDevice>(m_ptr), static_cast<VkPhysicalDevice>(m_adapter->m_ptr), desc, &nativeResource, &reqs, &externalInfo);
+        if (r != VK_SUCCESS)
+            return detail::mapVkResult(r);
+
+        // the buffer is bound at offset 0 and can't be larger than the imported memory
+        const uint32_t memoryTypeIndex = detail::findMemoryTypeIndex(static_cast<VkPhysicalDevice>(m_adapter->m_ptr), reqs.memoryTypeBits & pointerProperties.memoryTypeBits, detail::mapMemoryType(desc.memoryType));
+        if (memoryTypeIndex == std::numeric_limits<uint32_t>::max() || reqs.size > size)
+        {
+            detail::destroyUnboundResource(table, static_cast<VkDevice>(m_ptr), desc.type, nativeResource);
+            return result::ErrorInvalidUsage;
+        }
+
+        VkImportMemoryHostPointerInfoEXT importInfo {};
+        importInfo.sType = VK_STRUCTURE_TYPE_IMPORT_MEMORY_HOST_POINTER_INFO_EXT;
+        importInfo.handleType = VK_EXTERNAL_MEMORY_HANDLE_TYPE_HOST_ALLOCATION_BIT_EXT;
+        importInfo.pHostPointer = data;
+
+        VkMemoryAllocateInfo allocInfo;
+        allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+        allocInfo.pNext = &importInfo;
+        allocInfo.allocationSize = size;
+        allocInfo.memoryTypeIndex = memoryTypeIndex;
+
+        VkDeviceMemory memory;
+        r = table->vkAllocateMemory(static_cast<VkDevice>(m_ptr), &allocInfo, nullptr, &memory);
+        if (r != VK_SUCCESS)
+        {
+            detail::destroyUnboundResource(table, static_cast<VkDevice>(m_ptr), desc.type, nativeResource);
+            return detail::mapVkResult(r);
+        }
+
+        r = table->vkBindBufferMemory(static_cast<VkDevice>(m_ptr), static_cast<VkBuffer>(nativeResource), memory, 0);
+        if (r != VK_SUCCESS)
+        {
+            detail::destroyUnboundResource(table, static_cast<VkDevice>(m_ptr), desc.type, nativeResource);
+            table->vkFreeMemory(static_cast<VkDevice>(m_ptr), memory, nullptr);
+            return detail::mapVkResult(r);
+        }
+
+        // freeing imported memory doesn't free the host memory, so destroyResource() frees it like any other allocation
+        auto* output = m_resources.allocate();
+        output->m_desc = desc;
+        output->m_hot->resource = nativeResource;
+        output->m_hot->memory = memory;
+        output->m_imported = true;
+        *resource = output;
+        return result::Success;
+    }
+
+    result Device::impl_createExportableResourceEXT(const resource_desc& desc, external_memory_handle_type_ext handleType, Resource** resource)
+    {
+        auto* table = static_cast<VolkDeviceTable*>(m_functionTable);
+
+        if (handleType == external_memory_handle_type_ext::DmaBuf && !detail::queryDeviceExtensionSupport(static_cast<VkPhysicalDevice>(m_adapter->m_ptr), "VK_EXT_external_memory_dma_buf"))
+            return result::ErrorExtensionNotSupported;
+
+        void* nativeResource = nullptr;
+        VkDeviceMemory memory;
+        VkDeviceSize size;
+        const auto r = detail::createExternalResource(table, static_cast<VkDevice>(m_ptr), static_cast<VkPhysicalDevice>(m_adapter->m_ptr), desc, detail::mapExternalMemoryHandleType(handleType), -1, &nativeResource, &memory, &size);
+        if (r != VK_SUCCESS)
+            return detail::mapVkResult(r);
+
+        if (desc.type != resource_type::Buffer)
+        {
+            detail::transitionToInitialState(table, static_cast<VkDevice>(m_ptr), static_cast<VkQueue>(getQueue(m_workQueueType, 0)->m_ptrs[0]),
+                static_cast<VkCommandPool>(m_workCmdGroup), static_cast<VkCommandBuffer>(m_workCmdList), static_cast<VkFence>(m_workFence),
+                static_cast<VkImage>(nativeResource), desc);
+        }
+
+        auto* output = m_resources.allocate();
+        output->m_desc = desc;
+        output->m_hot->resource = nativeResource;
+        output->m_hot->memory = memory;
+        output->m_allocationSize = size;
+        *resource = output;
+        return result::Success;
+    }
+
+    result Device::impl_exportResourceMemoryFdEXT(Resource* resource, int* fd)
+    {
+        VkMemoryGetFdInfoKHR info {};
+        info.sType = VK_STRUCTURE_TYPE_MEMORY_GET_FD_INFO_KHR;
+        info.memory = static_cast<VkDeviceMemory>(resource->m_hot->memory);
+        info.handleType = detail::mapExternalMemoryHandleType(resource->m_externalHandleType);
+
+        const auto r = static_cast<VolkDeviceTable*>(m_functionTable)->vkGetMemoryFdKHR(static_cast<VkDevice>(m_ptr), &info, fd);
+        if (r != VK_SUCCESS)
+            return detail::mapVkResult(r);
+
+        return result::Success;
+    }
+
+    result Device::impl_importResourceMemoryFdEXT(const resource_desc& desc, external_memory_handle_type_ext handleType, int fd, Resource** resource)
+    {
+        auto* table = static_cast<VolkDeviceTable*>(m_functionTable);
+
+        if (handleType == external_memory_handle_type_ext::DmaBuf && !detail::queryDeviceExtensionSupport(static_cast<VkPhysicalDevice>(m_adapter->m_ptr), "VK_EXT_external_memory_dma_buf"))
+            return result::ErrorExtensionNotSupported;
+
+        void* nativeResource = nullptr;
+        VkDeviceMemory memory;
+        VkDeviceSize size;
+        const auto r = detail::createExternalResource(table, static_cast<VkDevice>(m_ptr), static_cast<VkPhysicalDevice>(m_adapter->m_ptr), desc, detail::mapExternalMemoryHandleType(handleType), fd, &nativeResource, &memory, &size);
+        if (r == VK_ERROR_INVALID_EXTERNAL_HANDLE)
+            return result::ErrorInvalidUsage;
+        if (r != VK_SUCCESS)
+            return detail::mapVkResult(r);
+
+        if (desc.type != resource_type::Buffer)
+        {
+            detail::transitionToInitialState(table, static_cast<VkDevice>(m_ptr), static_cast<VkQueue>(getQueue(m_workQueueType, 0)->m_ptrs[0]),
+                static_cast<VkCommandPool>(m_workCmdGroup), static_cast<VkCommandBuffer>(m_workCmdList), static_cast<VkFence>(m_workFence),
+                static_cast<VkImage>(nativeResource), desc);
+        }
+
+        // the imported memory is freed like any other allocation, the exporting resource keeps its own reference to it
+        auto* output = m_resources.allocate();
+        output->m_desc = desc;
+        output->m_hot->resource = nativeResource;
+        output->m_hot->memory = memory;
+        *resource = output;
+        return result::Success;
+    }
+
+    result Device::impl_createExportableSemaphoreEXT(Semaphore** semaphore)
+    {
+        VkExportSemaphoreCreateInfo exportInfo {};
+        exportInfo.sType = VK_STRUCTURE_TYPE_EXPORT_SEMAPHORE_CREATE_INFO;
+        exportInfo.handleTypes = VK_EXTERNAL_SEMAPHORE_HANDLE_TYPE_SYNC_FD_BIT;
+
+        VkSemaphoreCreateInfo info;
+        info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+        info.pNext = &exportInfo;
+        info.flags = {};
+
+        VkSemaphore vkSemaphore;
+        const VkResult r = static_cast<VolkDeviceTable*>(m_functionTable)->
+            vkCreateSemaphore(static_cast<VkDevice>(m_ptr), &info, nullptr, &vkSemaphore);
+        if (r != VK_SUCCESS)
+            return detail::mapVkResult(r);
+
+        auto* output = m_semaphores.allocate();
+        output->m_ptr = vkSemaphore;
+
+        *semaphore = output;
+        return result::Success;
+    }
+
+    result Device::impl_exportSemaphoreSyncFdEXT(Semaphore* semaphore, int* fd)
+    {
+        VkSemaphoreGetFdInfoKHR info {};
+        info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_GET_FD_INFO_KHR;
+        info.semaphore = static_cast<VkSemaphore>(semaphore->m_ptr);
+        info.handleType = VK_EXTERNAL_SEMAPHORE_HANDLE_TYPE_SYNC_FD_BIT;
+
+        const auto r = static_cast<VolkDeviceTable*>(m_functionTable)->vkGetSemaphoreFdKHR(static_cast<VkDevice>(m_ptr), &info, fd);
+        if (r != VK_SUCCESS)
+            return detail::mapVkResult(r);
+
+        return result::Success;
+    }
+
+    result Device::impl_importSemaphoreSyncFdEXT(Semaphore* semaphore, int fd)
+    {
+        // sync file descriptors can only be imported temporarily, the next wait restores the Semaphore's own payload
+        VkImportSemaphoreFdInfoKHR info {};
+        info.sType = VK_STRUCTURE_TYPE_IMPORT_SEMAPHORE_FD_INFO_KHR;
+        info.semaphore = static_cast<VkSemaphore>(semaphore->m_ptr);
+        info.flags = VK_SEMAPHORE_IMPORT_TEMPORARY_BIT;
+        info.handleType = VK_EXTERNAL_SEMAPHORE_HANDLE_TYPE_SYNC_FD_BIT;
+        info.fd = fd;
+
+        const auto r = static_cast<VolkDeviceTable*>(m_functionTable)->vkImportSemaphoreFdKHR(static_cast<VkDevice>(m_ptr), &info);
+        if (r == VK_ERROR_INVALID_EXTERNAL_HANDLE)
+            return result::ErrorInvalidUsage;
+        if (r != VK_SUCCESS)
+            return detail::mapVkResult(r);
+
+        return result::Success;
     }
 }
@@ -53,9 +53,9 @@ namespace llri
         VkBool32 debugCallback(VkDebugUtilsMessageSeverityFlagBitsEXT severity,
                                [[maybe_unused]] VkDebugUtilsMessageTypeFlagsEXT type,
                                const VkDebugUtilsMessengerCallbackDataEXT* callbackData,
-                               [[maybe_unused]] void* userData)
+                               void* userData)
         {
-            detail::callUserCallback(mapSeverity(severity), message_source::Implementation, callbackData->pMessage);
+            detail::callUserCallback(*static_cast<const message_target*>(userData), mapSeverity(severity), message_source::Implementation, callbackData->pMessage);
             return VK_FALSE;
         }
     }
@@ -68,6 +68,8 @@ namespace llri
 
             auto* output = new Instance();
             output->m_desc = desc;
+            output->m_validationLevel = desc.validationLevel;
+            output->m_messageTarget = detail::instanceMessageTarget(desc);
             const auto& availableExtensions = detail::queryAvailableExtensions();
 
             std::vector<const char*> layers;
@@ -186,7 +188,7 @@ namespace llri
                         VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT |
                         VK_DEBUG_UTILS_MESSAGE_TYPE_PERFORMANCE_BIT_EXT;
 
-                    const VkDebugUtilsMessengerCreateInfoEXT debugUtilsCi{ VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT, nullptr, {}, severity, types, &detail::debugCallback, nullptr };
+                    const VkDebugUtilsMessengerCreateInfoEXT debugUtilsCi{ VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT, nullptr, {}, severity, types, &detail::debugCallback, &output->m_messageTarget };
 
                     VkDebugUtilsMessengerEXT messenger;
                     vkCreateDebugUtilsMessengerEXT(vulkanInstance, &debugUtilsCi, nullptr, &messenger);
@@ -225,7 +227,7 @@ namespace llri
             delete instance;
         }
 
-        void impl_pollAPIMessages([[maybe_unused]] messenger_type* messenger)
+        void impl_pollAPIMessages([[maybe_unused]] const message_target& target, [[maybe_unused]] messenger_type* messenger)
         {
             // Empty because vulkan uses a callback system
         }
@@ -274,6 +276,8 @@ namespace llri
                     Adapter* adapter = new Adapter();
                     adapter->m_ptr = group.physicalDevices[0];
                     adapter->m_instance = this;
+                    adapter->m_validationLevel = m_validationLevel;
+                    adapter->m_messageTarget = m_messageTarget;
                     adapter->m_nodeCount = static_cast<uint8_t>(group.physicalDeviceCount);
 
                     m_cachedAdapters[group.physicalDevices[0]] = adapter;
@@ -307,6 +311,8 @@ namespace llri
                     Adapter* adapter = new Adapter();
                     adapter->m_ptr = physicalDevice;
                     adapter->m_instance = this;
+                    adapter->m_validationLevel = m_validationLevel;
+                    adapter->m_messageTarget = m_messageTarget;
 
                     m_cachedAdapters[physicalDevice] = adapter;
                     adapters->push_back(adapter);
@@ -323,9 +329,13 @@ namespace llri
         output->m_desc = desc;
         output->m_adapter = desc.adapter;
         output->m_validationCallbackMessenger = m_validationCallbackMessenger;
+        output->m_validationLevel = m_validationLevel;
+        output->m_messageTarget = m_messageTarget;
 
         // Queue creation
         auto families = detail::findQueueFamilies(static_cast<VkPhysicalDevice>(desc.adapter->m_ptr));
+        for (const auto& [type, family] : families)
+            output->m_queueFamilies[static_cast<size_t>(type)] = family;
 
         std::vector<float> graphicsPriorities;
         std::vector<float> computePriorities;
@@ -382,6 +392,35 @@ namespace llri
 
         if (desc.adapter->m_nodeCount > 1)
             extensions.push_back("VK_KHR_device_group");
+
+        for (size_t i = 0; i < desc.numExtensions; i++)
+        {
+            auto& extension = desc.extensions[i];
+            switch (extension)
+            {
+                case adapter_extension::SimulatedTiming:
+                    break;
+                case adapter_extension::HostMemoryImport:
+                {
+                    extensions.push_back("VK_EXT_external_memory_host");
+                    break;
+                }
+                case adapter_extension::ExternalMemoryFd:
+                {
+                    extensions.push_back("VK_KHR_external_memory_fd");
+
+                    // dma-bufs are optional, external_memory_handle_type_ext::DmaBuf returns ErrorExtensionNotSupported without them
+                    if (detail::queryDeviceExtensionSupport(static_cast<VkPhysicalDevice>(desc.adapter->m_ptr), "VK_EXT_external_memory_dma_buf"))
+                        extensions.push_back("VK_EXT_external_memory_dma_buf");
+                    break;
+                }
+                case adapter_extension::ExternalSemaphoreFd:
+                {
+                    extensions.push_back("VK_KHR_external_semaphore_fd");
+                    break;
+                }
+            }
+        }
         
 #ifdef __APPLE__
         // required for MoltenVK
@@ -390,6 +429,7 @@ namespace llri
 
         // Features
         VkPhysicalDeviceFeatures features{};
+        features.pipelineStatisticsQuery = desc.features.pipelineStatisticsQuery;
 
         // Create device
         VkDeviceCreateInfo ci{
@@ -435,6 +475,9 @@ namespace llri
             queue->m_device = output;
             queue->m_ptrs = std::vector<Queue::native_queue*>(desc.adapter->m_nodeCount, vkQueue);
             queue->m_validationCallbackMessenger = output->m_validationCallbackMessenger;
+            queue->m_validationLevel = output->m_validationLevel;
+            queue->m_messageTarget = output->m_messageTarget;
+            queue->m_statistics = &output->m_statistics;
 
             switch(queueDesc.type)
             {
@@ -0,0 +1,24 @@
+/**
+ * @file query_pool.cpp
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <llri/llri.hpp>
+#include <llri-vk/utils.hpp>
+#include <graphics/vulkan/volk.h>
+
+namespace llri
+{
+    result QueryPool::impl_getResults(uint32_t first, uint32_t count, uint64_t* results)
+    {
+        const VkDeviceSize stride = queryResultCount(m_desc.type) * sizeof(uint64_t);
+
+        // no VK_QUERY_RESULT_WAIT_BIT, unavailable queries result in VK_NOT_READY instead of a stall
+        const auto r = static_cast<VolkDeviceTable*>(m_deviceFunctionTable)->
+            vkGetQueryPoolResults(static_cast<VkDevice>(m_deviceHandle), static_cast<VkQueryPool>(m_ptr), first, count,
+                count * stride, results, stride, VK_QUERY_RESULT_64_BIT);
+
+        return detail::mapVkResult(r);
+    }
+}
@@ -63,6 +63,22 @@ namespace llri
             return availableExtensions;
         }
 
+        bool queryDeviceExtensionSupport(VkPhysicalDevice physicalDevice, const char* name)
+        {
+            uint32_t extensionCount;
+            vkEnumerateDeviceExtensionProperties(physicalDevice, nullptr, &extensionCount, nullptr);
+            std::vector<VkExtensionProperties> extensions(extensionCount);
+            vkEnumerateDeviceExtensionProperties(physicalDevice, nullptr, &extensionCount, extensions.data());
+
+            for (const auto& extension : extensions)
+            {
+                if (std::strcmp(extension.extensionName, name) == 0)
+                    return true;
+            }
+
+            return false;
+        }
+
         /**
          * @brief Helper function that converts vk::Result to llri::result
         */
@@ -146,6 +162,27 @@ namespace llri
             return static_cast<uint32_t>(-1);
         }
     
+        bool classifyQueueFamily(VkQueueFlags flags, queue_type* type)
+        {
+            // Only the graphics family has the graphics bit set
+            // it usually also has compute & transfer set, because graphics queue tends to be general purpose
+            if ((flags & VK_QUEUE_GRAPHICS_BIT) == VK_QUEUE_GRAPHICS_BIT)
+                *type = queue_type::Graphics;
+
+            // Dedicated compute family has no graphics bit but does have a compute bit
+            else if ((flags & VK_QUEUE_COMPUTE_BIT) == VK_QUEUE_COMPUTE_BIT)
+                *type = queue_type::Compute;
+
+            // Dedicated transfer family has no graphics bit, no compute bit, but does have a transfer bit
+            else if ((flags & VK_QUEUE_TRANSFER_BIT) == VK_QUEUE_TRANSFER_BIT)
+                *type = queue_type::Transfer;
+
+            else
+                return false;
+
+            return true;
+        }
+
         std::unordered_map<queue_type, uint32_t> findQueueFamilies(VkPhysicalDevice physicalDevice)
         {
             std::unordered_map<queue_type, uint32_t> output
@@ -163,22 +200,14 @@ namespace llri
 
             for (uint32_t i = 0; i < propertyCount; i++)
             {
-                auto& p = properties[i];
-
-                // Only the graphics queue has the graphics bit set
-                // it usually also has compute & transfer set, because graphics queue tends to be general purpose
-                if ((p.queueFlags & VK_QUEUE_GRAPHICS_BIT) == VK_QUEUE_GRAPHICS_BIT)
-                    output[queue_type::Graphics] = i;
-
-                // Dedicated compute family has no graphics bit but does have a compute bit
-                else if ((p.queueFlags & VK_QUEUE_GRAPHICS_BIT) == 0 && (p.queueFlags & VK_QUEUE_COMPUTE_BIT) == VK_QUEUE_COMPUTE_BIT)
-                    output[queue_type::Compute] = i;
-
-                // Dedicated transfer family has no graphics bit, no compute bit, but does have a transfer bit
-                else if ((p.queueFlags & VK_QUEUE_GRAPHICS_BIT) == 0 &&
-                    (p.queueFlags & VK_QUEUE_COMPUTE_BIT) == 0 &&
-                    (p.queueFlags & VK_QUEUE_TRANSFER_BIT) == VK_QUEUE_TRANSFER_BIT)
-                    output[queue_type::Transfer] = i;
+                queue_type type;
+                if (!classifyQueueFamily(properties[i].queueFlags, &type))
+                    continue;
+
+                // prefer the family with the most queues so that more work can run in parallel
+                uint32_t& selected = output[type];
+                if (selected == std::numeric_limits<uint32_t>::max() || properties[i].queueCount > properties[selected].queueCount)
+                    selected = i;
             }
 
             return output;
@@ -56,6 +56,10 @@ namespace llri
          * @brief Helper function that maps extensions to their names
         */
         const extension_map& queryAvailableExtensions();
+        /**
+         * @brief Queries if the physical device supports a device extension
+        */
+        bool queryDeviceExtensionSupport(VkPhysicalDevice physicalDevice, const char* name);
 
         result mapVkResult(VkResult result);
 
@@ -74,6 +78,37 @@ namespace llri
             return {};
         }
 
+        constexpr VkQueryType mapQueryType(query_type type)
+        {
+            switch (type)
+            {
+                case query_type::Timestamp:
+                    return VK_QUERY_TYPE_TIMESTAMP;
+                case query_type::Occlusion:
+                    return VK_QUERY_TYPE_OCCLUSION;
+                case query_type::PipelineStatistics:
+                    return VK_QUERY_TYPE_PIPELINE_STATISTICS;
+                default:
+                    break;
+            }
+
+            return {};
+        }
+
+        // the counters in the order of llri::pipeline_statistics, Vulkan writes enabled counters in order of their bits
+        constexpr VkQueryPipelineStatisticFlags pipelineStatisticsFlags =
+            VK_QUERY_PIPELINE_STATISTIC_INPUT_ASSEMBLY_VERTICES_BIT |
+            VK_QUERY_PIPELINE_STATISTIC_INPUT_ASSEMBLY_PRIMITIVES_BIT |
+            VK_QUERY_PIPELINE_STATISTIC_VERTEX_SHADER_INVOCATIONS_BIT |
+            VK_QUERY_PIPELINE_STATISTIC_GEOMETRY_SHADER_INVOCATIONS_BIT |
+            VK_QUERY_PIPELINE_STATISTIC_GEOMETRY_SHADER_PRIMITIVES_BIT |
+            VK_QUERY_PIPELINE_STATISTIC_CLIPPING_INVOCATIONS_BIT |
+            VK_QUERY_PIPELINE_STATISTIC_CLIPPING_PRIMITIVES_BIT |
+            VK_QUERY_PIPELINE_STATISTIC_FRAGMENT_SHADER_INVOCATIONS_BIT |
+            VK_QUERY_PIPELINE_STATISTIC_TESSELLATION_CONTROL_SHADER_PATCHES_BIT |
+            VK_QUERY_PIPELINE_STATISTIC_TESSELLATION_EVALUATION_SHADER_INVOCATIONS_BIT |
+            VK_QUERY_PIPELINE_STATISTIC_COMPUTE_SHADER_INVOCATIONS_BIT;
+
         constexpr VkImageType mapTextureType(resource_type type)
         {
             switch (type)
@@ -385,6 +420,24 @@ namespace llri
             return map[static_cast<size_t>(state)];
         }
 
+        /**
+         * @brief Maps a texture_copy_desc to a VkBufferImageCopy. Vulkan describes the buffer's row pitch in texels and the region's offset in the buffer per subresource.
+        */
+        inline VkBufferImageCopy mapTextureCopy(const texture_copy_desc& desc)
+        {
+            const uint32_t texelSize = format_size(desc.texture->getDesc().textureFormat);
+            const bool is3D = desc.texture->getDesc().type == resource_type::Texture3D;
+
+            VkBufferImageCopy region;
+            region.bufferOffset = desc.bufferOffset;
+            region.bufferRowLength = desc.bufferRowPitch / texelSize;
+            region.bufferImageHeight = desc.extent.height;
+            region.imageSubresource = VkImageSubresourceLayers { VK_IMAGE_ASPECT_COLOR_BIT, desc.mipLevel, is3D ? 0 : desc.arrayLayer, 1 };
+            region.imageOffset = VkOffset3D { desc.textureOffset.x, desc.textureOffset.y, desc.textureOffset.z };
+            region.imageExtent = VkExtent3D { desc.extent.width, desc.extent.height, desc.extent.depth };
+            return region;
+        }
+
         constexpr VkImageUsageFlags mapTextureUsage(resource_usage_flags usage)
         {
             VkImageUsageFlags output = 0;
@@ -438,6 +491,19 @@ namespace llri
             return output;
         }
 
+        constexpr VkExternalMemoryHandleTypeFlagBits mapExternalMemoryHandleType(external_memory_handle_type_ext type)
+        {
+            switch (type)
+            {
+                case external_memory_handle_type_ext::OpaqueFd:
+                    return VK_EXTERNAL_MEMORY_HANDLE_TYPE_OPAQUE_FD_BIT;
+                case external_memory_handle_type_ext::DmaBuf:
+                    return VK_EXTERNAL_MEMORY_HANDLE_TYPE_DMA_BUF_BIT_EXT;
+            }
+
+            return VK_EXTERNAL_MEMORY_HANDLE_TYPE_OPAQUE_FD_BIT;
+        }
+
         constexpr VkMemoryPropertyFlags mapMemoryType(memory_type type)
         {
             VkMemoryPropertyFlags memFlags = 0;
@@ -527,7 +593,14 @@ namespace llri
         }
     
         /**
-         * @brief Finds LLRI standard queue families (Graphics, Compute, Transfer)
+         * @brief Classifies a queue family by the most capable queue_type that it supports.
+         * @return False if the family supports neither graphics, compute, nor transfer operations.
+        */
+        bool classifyQueueFamily(VkQueueFlags flags, queue_type* type);
+
+        /**
+         * @brief Finds LLRI standard queue families (Graphics, Compute, Transfer).
+         * If multiple families classify as the same queue_type, the family with the most queues is selected.
         */
         std::unordered_map<queue_type, uint32_t> findQueueFamilies(VkPhysicalDevice physicalDevice);
     }
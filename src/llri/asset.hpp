@@ -0,0 +1,34 @@
+/**
+ * @file asset.hpp
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+#include <llri/llri.hpp>
+
+#include <condition_variable>
+#include <deque>
+#include <thread>
+
+#if defined(_WIN32)
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+/**
+ * The asset streamer is an optional layer on top of LLRI and is thus not included by llri.hpp.
+ * It doesn't depend on a compression library, the decompression function is provided by the application.
+ */
+#include <llri/detail/asset_streamer.hpp>
+#include <llri/detail/asset_streamer.inl>
@@ -86,7 +86,10 @@ namespace llri
     */
     struct adapter_features
     {
-        // reserved for future adapter features.
+        /**
+         * @brief QueryPools **can** be created with query_type::PipelineStatistics.
+        */
+        bool pipelineStatisticsQuery;
     };
 
     /**
@@ -94,7 +97,41 @@ namespace llri
     */
     struct adapter_limits
     {
-        // reserved for future adapter limits.
+        /**
+         * @brief The number of nanoseconds it takes for a timestamp written by CommandList::writeTimestamp() to be incremented by 1.
+         * The difference between two timestamps multiplied by timestampPeriod is the elapsed GPU time in nanoseconds.
+         *
+         * A value of 0 means that the Adapter doesn't support timestamp queries.
+        */
+        float timestampPeriod;
+
+        /**
+         * @brief The alignment in bytes that the address and size of host memory **must** have to be imported through Device::importHostMemoryEXT().
+         *
+         * A value of 0 means that the Adapter doesn't support adapter_extension::HostMemoryImport.
+        */
+        uint64_t hostMemoryImportAlignment;
+    };
+
+    /**
+     * @brief Describes a family of hardware queues that the Adapter exposes.
+    */
+    struct queue_family_info
+    {
+        /**
+         * @brief The most capable queue_type that the family supports. Graphics families also support compute and transfer operations, and compute families also support transfer operations.
+         *
+         * Compute and Transfer families are thus separate from the families of more capable types. Work on them commonly runs on separate hardware engines, so it can overlap with work on other families.
+        */
+        queue_type type;
+        /**
+         * @brief The number of hardware queues in the family.
+        */
+        uint8_t queueCount;
+        /**
+         * @brief If LLRI creates its Queues of type from this family. Adapter::queryQueueCount(type) returns the queueCount of the selected family.
+        */
+        bool selected;
     };
 
     /**
@@ -107,18 +144,29 @@ namespace llri
         */
         bool supported;
         /**
-         * @brief If the format is supported for each resource_type.
-         * @note resource_type::Buffer is present in this map for completeness but is always set to false.
+         * @brief A bitmask of the resource_types that the format supports, bit (1 << resource_type) is set if the format can be used with that type.
+         * @note resource_type::Buffer is present in this mask for completeness but is never set.
         */
-        std::unordered_map<resource_type, bool> types;
+        uint8_t types;
         /**
          * @brief The resource usage flag bits that are supported when this format is used.
         */
         resource_usage_flags usage;
         /**
-         * @brief If the format supports multi-sampling for each sample_count value.
+         * @brief A bitmask of the sample_count values that the format supports for multi-sampling. sample_count values are powers of two, so each value maps to its own bit.
+        */
+        uint8_t sampleCounts;
+
+        /**
+         * @brief Returns true if the format can be used with the given resource_type.
         */
-        std::unordered_map<sample_count, bool> sampleCounts;
+        [[nodiscard]] constexpr bool supportsType(resource_type type) const noexcept;
+
+        /**
+         * @brief Returns true if the format supports multi-sampling with the given sample_count.
+         * Values that are not a member of sample_count always return false.
+        */
+        [[nodiscard]] constexpr bool supportsSampleCount(sample_count count) const noexcept;
     };
 
     /**
@@ -140,6 +188,8 @@ namespace llri
          *
          * DirectX12: IDXGIAdapter*
          * Vulkan: VkPhysicalDevice
+         * Null: an opaque handle that must not be dereferenced
+         * CPU: an opaque handle that must not be dereferenced
          */
         [[nodiscard]] native_adapter* getNative() const;
         
@@ -201,18 +251,27 @@ namespace llri
         */
         [[nodiscard]] uint8_t queryQueueCount(queue_type type) const;
 
+        /**
+         * @brief Query all queue families that the Adapter exposes.
+         *
+         * Applications **may** use this to decide how many Queues of each type to request in device_desc, for example to spread uploads over multiple dedicated transfer queues through queue_pool.
+         * Implementations without the concept of queue families (DirectX12) report a single family for each queue_type.
+        */
+        [[nodiscard]] std::vector<queue_family_info> queryQueueFamilies() const;
+
         /**
          * @brief Query the properties of all formats.
-         * The resulting unordered_map contains a format_properties structure for every format in llri::format.
+         * The resulting array contains a format_properties structure for every format in llri::format, indexed by the format's value.
          *
          * The result of queryFormatProperties is cached internally and a reference is returned. Thus calling the function multiple times does not come with an extra cost and calling queryFormatProperties(format) doesn't either.
         */
-        [[nodiscard]] const std::unordered_map<format, format_properties>& queryFormatProperties() const;
+        [[nodiscard]] const std::array<format_properties, static_cast<size_t>(format::MaxEnum) + 1>& queryFormatProperties() const;
 
         /**
          * @brief Query the properties of a single format.
+         * @note Valid usage: f **must** be less or equal to format::MaxEnum, otherwise std::out_of_range is thrown.
          */
-        [[nodiscard]] format_properties queryFormatProperties(format f) const;
+        [[nodiscard]] const format_properties& queryFormatProperties(format f) const;
 
         /**
          * @brief Query the number of nodes (physical adapters) that this adapter represents. If there are no linked physical adapters, this returns 1.
@@ -230,9 +289,12 @@ namespace llri
         Instance* m_instance = nullptr;
 
         void* m_validationCallbackMessenger = nullptr;
+        validation_level m_validationLevel = validation_level::Full;
+        detail::message_target m_messageTarget;
 
         // cached value of queryFormatProperties()
-        mutable std::unordered_map<format, format_properties> m_cachedFormatProperties {};
+        mutable std::array<format_properties, static_cast<size_t>(format::MaxEnum) + 1> m_cachedFormatProperties {};
+        mutable bool m_formatPropertiesCached = false;
 
         [[nodiscard]] adapter_info impl_queryInfo() const;
         [[nodiscard]] adapter_features impl_queryFeatures() const;
@@ -240,7 +302,8 @@ namespace llri
         [[nodiscard]] bool impl_queryExtensionSupport(adapter_extension ext) const;
 
         [[nodiscard]] uint8_t impl_queryQueueCount(queue_type type) const;
-        [[nodiscard]] std::unordered_map<format, format_properties> impl_queryFormatProperties() const;
+        [[nodiscard]] std::vector<queue_family_info> impl_queryQueueFamilies() const;
+        [[nodiscard]] std::array<format_properties, static_cast<size_t>(format::MaxEnum) + 1> impl_queryFormatProperties() const;
         
         result impl_querySurfacePresentSupportEXT(SurfaceEXT* surface, queue_type type, bool* support) const;
         result impl_querySurfaceCapabilitiesEXT(SurfaceEXT* surface, surface_capabilities_ext* capabilities) const;
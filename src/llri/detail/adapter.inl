@@ -26,6 +26,37 @@ namespace llri
         return "Invalid adapter_type value";
     }
 
+    constexpr bool format_properties::supportsType(resource_type type) const noexcept
+    {
+        if (type > resource_type::MaxEnum)
+            return false;
+
+        const uint8_t bit = 1u << static_cast<uint8_t>(type);
+        return (types & bit) == bit;
+    }
+
+    constexpr bool format_properties::supportsSampleCount(sample_count count) const noexcept
+    {
+        const auto bit = static_cast<uint8_t>(count);
+        if (bit == 0 || !detail::hasSingleBit(bit))
+            return false;
+
+        return (sampleCounts & bit) == bit;
+    }
+
+    namespace detail
+    {
+        /**
+         * @brief Returns true if the format properties support the type, sample count and usage of the texture described by desc.
+         * @note desc.type **must** be less or equal to resource_type::MaxEnum, and desc.sampleCount **must** be a member of sample_count.
+        */
+        constexpr bool supportsTexture(const format_properties& properties, const resource_desc& desc) noexcept
+        {
+            const auto sampleCount = static_cast<uint8_t>(desc.sampleCount);
+            return properties.supported & ((properties.types & resourceTypeBit(desc.type)) != 0) & ((properties.sampleCounts & sampleCount) == sampleCount) & properties.usage.all(desc.usage);
+        }
+    }
+
     inline Adapter::native_adapter* Adapter::getNative() const
     {
         return m_ptr;
@@ -53,53 +84,83 @@ namespace llri
 
     inline result Adapter::querySurfacePresentSupportEXT(SurfaceEXT* surface, queue_type type, bool* support) const
     {
-        LLRI_DETAIL_VALIDATION_REQUIRE(detail::contains(m_instance->m_enabledExtensions, instance_extension::SurfaceWin32) ||
-                                       detail::contains(m_instance->m_enabledExtensions, instance_extension::SurfaceCocoa) ||
-                                       detail::contains(m_instance->m_enabledExtensions, instance_extension::SurfaceXlib) ||
-                                       detail::contains(m_instance->m_enabledExtensions, instance_extension::SurfaceXcb), result::ErrorExtensionNotEnabled)
+        LLRI_DETAIL_VALIDATION_FULL(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(detail::contains(m_instance->m_enabledExtensions, instance_extension::SurfaceWin32) ||
+                                           detail::contains(m_instance->m_enabledExtensions, instance_extension::SurfaceCocoa) ||
+                                           detail::contains(m_instance->m_enabledExtensions, instance_extension::SurfaceXlib) ||
+                                           detail::contains(m_instance->m_enabledExtensions, instance_extension::SurfaceXcb), result::ErrorExtensionNotEnabled)
+        }
 
-        LLRI_DETAIL_VALIDATION_REQUIRE(support != nullptr, result::ErrorInvalidUsage)
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(support != nullptr, result::ErrorInvalidUsage)
+        }
         *support = false;
-        LLRI_DETAIL_VALIDATION_REQUIRE(surface != nullptr, result::ErrorInvalidUsage)
-        LLRI_DETAIL_VALIDATION_REQUIRE(type <= queue_type::MaxEnum, result::ErrorInvalidUsage)
-        
+
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(surface != nullptr, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(type <= queue_type::MaxEnum, result::ErrorInvalidUsage)
+        }
+
         LLRI_DETAIL_CALL_IMPL(impl_querySurfacePresentSupportEXT(surface, type, support), m_validationCallbackMessenger)
     }
 
     inline result Adapter::querySurfaceCapabilitiesEXT(SurfaceEXT* surface, surface_capabilities_ext* capabilities) const
     {
-        LLRI_DETAIL_VALIDATION_REQUIRE(detail::contains(m_instance->m_enabledExtensions, instance_extension::SurfaceWin32) ||
-                                       detail::contains(m_instance->m_enabledExtensions, instance_extension::SurfaceCocoa) ||
-                                       detail::contains(m_instance->m_enabledExtensions, instance_extension::SurfaceXlib) ||
-                                       detail::contains(m_instance->m_enabledExtensions, instance_extension::SurfaceXcb), result::ErrorExtensionNotEnabled)
+        LLRI_DETAIL_VALIDATION_FULL(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(detail::contains(m_instance->m_enabledExtensions, instance_extension::SurfaceWin32) ||
+                                           detail::contains(m_instance->m_enabledExtensions, instance_extension::SurfaceCocoa) ||
+                                           detail::contains(m_instance->m_enabledExtensions, instance_extension::SurfaceXlib) ||
+                                           detail::contains(m_instance->m_enabledExtensions, instance_extension::SurfaceXcb), result::ErrorExtensionNotEnabled)
+        }
         
-        LLRI_DETAIL_VALIDATION_REQUIRE(capabilities != nullptr, result::ErrorInvalidUsage)
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(capabilities != nullptr, result::ErrorInvalidUsage)
+        }
         *capabilities = {};
-        LLRI_DETAIL_VALIDATION_REQUIRE(surface != nullptr, result::ErrorInvalidUsage)
+
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(surface != nullptr, result::ErrorInvalidUsage)
+        }
 
         LLRI_DETAIL_CALL_IMPL(impl_querySurfaceCapabilitiesEXT(surface, capabilities), m_validationCallbackMessenger)
     }
 
     inline uint8_t Adapter::queryQueueCount(queue_type type) const
     {
-        LLRI_DETAIL_VALIDATION_REQUIRE(type <= queue_type::MaxEnum, 0)
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(type <= queue_type::MaxEnum, 0)
+        }
+
         LLRI_DETAIL_CALL_IMPL(impl_queryQueueCount(type), m_validationCallbackMessenger)
     }
 
-    inline const std::unordered_map<format, format_properties>& Adapter::queryFormatProperties() const
+    inline std::vector<queue_family_info> Adapter::queryQueueFamilies() const
+    {
+        LLRI_DETAIL_CALL_IMPL(impl_queryQueueFamilies(), m_validationCallbackMessenger)
+    }
+
+    inline const std::array<format_properties, static_cast<size_t>(format::MaxEnum) + 1>& Adapter::queryFormatProperties() const
     {
-        if (m_cachedFormatProperties.empty())
+        if (!m_formatPropertiesCached)
         {
             m_cachedFormatProperties = impl_queryFormatProperties();
+            m_formatPropertiesCached = true;
             LLRI_DETAIL_POLL_API_MESSAGES(m_validationCallbackMessenger)
         }
 
         return m_cachedFormatProperties;
     }
 
-    inline format_properties Adapter::queryFormatProperties(format f) const
+    inline const format_properties& Adapter::queryFormatProperties(format f) const
     {
-        return queryFormatProperties().at(f);
+        return queryFormatProperties().at(static_cast<size_t>(f));
     }
 
     inline uint8_t Adapter::queryNodeCount() const
@@ -86,8 +86,45 @@ namespace llri
         void* userData
         );
 
+    /**
+     * @brief Describes when messages are sent to the message callback.
+    */
+    enum struct message_delivery : uint8_t
+    {
+        /**
+         * @brief Messages are sent to the callback immediately, on the thread that raised them. This includes implementation threads, e.g. a driver's validation layer calling back from within an API call.
+        */
+        Immediate,
+        /**
+         * @brief Messages are pushed into a lock-free queue and are only sent to the callback when llri::pollMessages() is called.
+         * Raising a message never allocates or blocks, and messages that are raised again while an identical message is still pending are de-duplicated, which rate-limits repeated messages to one per llri::pollMessages() call.
+         * Pending messages are stored in fixed-size entries, so messages longer than 511 characters are truncated.
+        */
+        Deferred,
+        /**
+         * @brief The highest value in this enum.
+        */
+        MaxEnum = Deferred
+    };
+
+    /**
+     * @brief Converts a message_delivery to a string.
+     * @return The enum value as a string, or "Invalid message_delivery value" if the value was not recognized as an enum member.
+    */
+    inline std::string to_string(message_delivery delivery);
+
     namespace detail
     {
+        /**
+         * @brief The callback and user data that messages raised by an object are sent to.
+         * Every object stores its own copy, inherited from the Instance that created it, so that routing a message never touches shared state.
+        */
+        struct message_target
+        {
+            message_callback* callback = nullptr;
+            void* userData = nullptr;
+        };
+
         /**
          * @brief Global message callback, not part of the public API - should not be accessed directly but instead be set through llri::setMessageCallback().
         */
@@ -96,12 +133,6 @@ namespace llri
          * @brief Global user data, not part of the public API - should not be accessed directly but instead be set through llri::setMessageCallback().
         */
         inline void* m_userData;
-
-        // convenience callback functions
-        inline void callUserCallback(message_severity severity, message_source source, const std::string& message) { if (m_messageCallback) m_messageCallback(severity, source, message.c_str(), m_userData); }
-        inline void apiError(const std::string& func, result r, const std::string& message) { callUserCallback(message_severity::Error, message_source::API, func + " returned " + to_string(r) + " because " + message); }
-        inline void apiError(const std::string& func, void* dummy, const std::string& message) { callUserCallback(message_severity::Error, message_source::API, func + " returned " + std::to_string(reinterpret_cast<uint64_t>(dummy)) + " because " + message); }
-        inline void apiWarning(const std::string& func, const std::string& message) { callUserCallback(message_severity::Warning, message_source::API, "in " + func + ": " + message); }
     }
 
     /**
@@ -109,7 +140,10 @@ namespace llri
      *
      * The callback contains contextual information about the message, like for example its severity.
      *
+     * The callback set here is the default for Instances: an Instance created with instance_desc::messageCallback set to nullptr copies the callback and user data that are set at the time of llri::createInstance(). Changing the callback afterwards does not affect existing Instances.
+     *
      * @note Implementation messages only occur if instance_extension::DriverValidation and/or GPUValidation are enabled. If no message callback is set, some implementations might still output messages (Vulkan tends to print to stdout, whereas DirectX tends to print to the "Output" window in Visual Studio).
+     * @note This function is not thread-safe and **must not** be called while llri::createInstance() or llri::pollMessages() are executing on other threads.
      *
      * @param callback The callback, the function passed must conform to the message_callback definition. You **may** set this value to nullptr, in which case no messages are sent.
      * @param userData Optional user data pointer. Not used by LLRI but it's passed around and sent along the callback.
@@ -119,4 +153,26 @@ namespace llri
         detail::m_messageCallback = callback;
         detail::m_userData = userData;
     }
+
+    /**
+     * @brief Sets when messages are sent to the message callback. The default is message_delivery::Immediate.
+     *
+     * @note Messages that are still pending when switching from message_delivery::Deferred to message_delivery::Immediate are sent on the next llri::pollMessages() call.
+     *
+     * @param delivery The delivery mode. If the value is more than message_delivery::MaxEnum, the call is ignored.
+    */
+    inline void setMessageDelivery(message_delivery delivery);
+
+    /**
+     * @brief Sends all pending deferred messages to the message callback of the object that raised them, on the calling thread.
+     *
+     * Messages that were de-duplicated while pending are sent once with their repeat count appended. If messages were dropped because the queue was full, a single warning that reports the number of dropped messages is sent to every callback that messages were dropped for.
+     *
+     * This function is intended to be called once per frame, or continuously from a dedicated logging thread.
+     *
+     * @note llri::pollMessages() **must not** be called from multiple threads simultaneously.
+     *
+     * @return The number of messages that were sent to a message callback.
+    */
+    inline size_t pollMessages();
 }
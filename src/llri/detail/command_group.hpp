@@ -37,6 +37,8 @@ namespace llri
          *
          * DirectX12: ID3D12CommandAllocator*
          * Vulkan: VkCommandPool
+         * Null: nullptr
+         * CPU: nullptr
          */
         [[nodiscard]] native_command_group* getNative() const;
         
@@ -114,6 +116,14 @@ namespace llri
         */
         result free(uint8_t numCommandLists, CommandList** cmdLists);
 
+        /**
+         * @brief Get the CommandList that a handle refers to.
+         *
+         * @param h A handle obtained through CommandList::getHandle().
+         * @return The CommandList, or nullptr if the CommandList was freed or if it wasn't allocated through this CommandGroup.
+        */
+        [[nodiscard]] CommandList* resolve(handle<CommandList> h) const;
+
     private:
         // Force private constructor/deconstructor so that only create/destroy can manage lifetime
         CommandGroup() = default;
@@ -126,9 +136,12 @@ namespace llri
         void* m_deviceFunctionTable = nullptr;
 
         void* m_validationCallbackMessenger = nullptr;
+        validation_level m_validationLevel = validation_level::Full;
+        detail::message_target m_messageTarget;
+        detail::device_statistics_recorder* m_statistics = nullptr;
 
         queue_type m_type;
-        std::unordered_set<CommandList*> m_cmdLists;
+        detail::object_pool<CommandList> m_cmdLists;
 
 #ifndef LLRI_DISABLE_VALIDATION
         CommandList* m_currentlyRecording = nullptr;
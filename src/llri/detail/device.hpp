@@ -22,9 +22,19 @@ namespace llri
 
     class Semaphore;
 
+    struct query_pool_desc;
+    class QueryPool;
+
     class Resource;
     struct resource_desc;
 
+    struct memory_heap_desc;
+    struct resource_allocation_info;
+    class MemoryHeap;
+
+    struct simulated_timing_desc_ext;
+    enum struct external_memory_handle_type_ext : uint8_t;
+
     /**
      * @brief Device description to be used in Instance::createDevice().
     */
@@ -83,6 +93,7 @@ namespace llri
     {
         friend Instance;
         friend class CommandGroup;
+        friend class CommandList;
         friend class Queue;
   
     public:
@@ -98,6 +109,8 @@ namespace llri
          *
          * DirectX12: ID3D12Device*
          * Vulkan: VkDevice
+         * Null: an internal object that holds the simulated timing state
+         * CPU: an internal object that holds the thread pool that executes transfer commands
          */
         [[nodiscard]] native_device* getNative() const;
         
@@ -218,6 +231,27 @@ namespace llri
         */
         void destroySemaphore(Semaphore* semaphore);
 
+        /**
+         * @brief Create a QueryPool, which holds queries that can be written by CommandLists and read back on the CPU.
+         * @param desc The description of the QueryPool.
+         * @param pool A pointer to the resulting QueryPool variable.
+         *
+         * @note Valid usage (ErrorInvalidUsage): pool **must** be a valid non-null pointer to a QueryPool* variable.
+         * @note Valid usage (ErrorInvalidUsage): desc.type **must** be less than or equal to query_type::MaxEnum.
+         * @note Valid usage (ErrorInvalidUsage): desc.count **must** be more than 0.
+         * @note Valid usage (ErrorFeatureNotSupported): If desc.type is query_type::PipelineStatistics, the Device **must** have been created with adapter_features::pipelineStatisticsQuery enabled.
+         *
+         * @return Success upon correct execution of the operation.
+         * @return Implementation defined result values: ErrorOutOfHostMemory, ErrorOutOfDeviceMemory.
+        */
+        result createQueryPool(const query_pool_desc& desc, QueryPool** pool);
+
+        /**
+         * @brief Destroy the given QueryPool object.
+         * @param pool A pointer to a valid QueryPool, or nullptr.
+        */
+        void destroyQueryPool(QueryPool* pool);
+
         /**
          * @brief Create a resource (a buffer or texture) and allocate the memory for it.
          * @param desc The description of the resource.
@@ -236,6 +270,308 @@ namespace llri
          * @param resource A pointer to a valid Resource, or nullptr.
         */
         void destroyResource(Resource* resource);
+
+        /**
+         * @brief Create a MemoryHeap, a single block of memory in which resources can be placed through createPlacedResource().
+         * @param desc The description of the MemoryHeap.
+         * @param heap A pointer to the resulting MemoryHeap variable.
+         *
+         * @note Valid usage (ErrorInvalidUsage): heap **must** be a valid non-null pointer to a MemoryHeap* variable.
+         * @note Valid usage: the conditions described in memory_heap_desc **must** be met.
+         *
+         * @return Success upon correct execution of the operation.
+         * @return memory_heap_desc defined result values: ErrorInvalidUsage, ErrorInvalidNodeMask.
+         * @return Implementation defined result values: ErrorOutOfHostMemory, ErrorOutOfDeviceMemory.
+        */
+        result createMemoryHeap(const memory_heap_desc& desc, MemoryHeap** heap);
+
+        /**
+         * @brief Destroy the given MemoryHeap and free its memory.
+         * @param heap A pointer to a valid MemoryHeap, or nullptr.
+         *
+         * @note All resources that were placed in the heap **must** be destroyed before the heap is destroyed.
+        */
+        void destroyMemoryHeap(MemoryHeap* heap);
+
+        /**
+         * @brief Query the size and alignment that a resource would occupy if it were placed in a MemoryHeap with createPlacedResource().
+         * @param desc The description of the resource.
+         * @param info A pointer to the resulting resource_allocation_info variable.
+         *
+         * @note Valid usage (ErrorInvalidUsage): info **must** be a valid non-null pointer to a resource_allocation_info variable.
+         *
+         * @return Success upon correct execution of the operation.
+         * @return resource_desc defined result values: ErrorInvalidUsage, ErrorInvalidNodeMask.
+         * @return Implementation defined result values: ErrorOutOfHostMemory, ErrorOutOfDeviceMemory.
+        */
+        result queryResourceAllocationInfo(const resource_desc& desc, resource_allocation_info* info);
+
+        /**
+         * @brief Create a resource (a buffer or texture) at an offset in an existing MemoryHeap. The resource doesn't allocate memory of its own, so resources whose lifetimes don't overlap can be placed in the same memory.
+         *
+         * Placed resources are destroyed through destroyResource(), which doesn't free the heap's memory.
+         * Switching between resources that overlap in the heap requires a resource_barrier::aliasing() barrier.
+         * Placed textures **must** also be initialized with a resource_barrier::aliasing() barrier before their first use, even if no other resource overlaps with them.
+         *
+         * Vulkan: Placed textures aren't transitioned to desc.initialState upon creation, the aliasing barrier initializes them in that state instead.
+         *
+         * @param heap The MemoryHeap to place the resource in.
+         * @param offset The offset in bytes in the heap at which the resource is placed.
+         * @param desc The description of the resource.
+         * @param resource A pointer to the resulting resource variable.
+         *
+         * @note Valid usage (ErrorInvalidUsage): heap **must** be a valid non-null pointer to a MemoryHeap.
+         * @note Valid usage (ErrorInvalidUsage): resource **must** be a valid non-null pointer to a Resource* variable.
+         * @note Valid usage (ErrorInvalidUsage): desc.memoryType **must** be the same as the heap's memory_heap_desc::memoryType.
+         * @note Valid usage (ErrorInvalidNodeMask): desc.createNodeMask **must** be the same as the heap's memory_heap_desc::createNodeMask, and desc.visibleNodeMask **must not** have bits set that aren't set in the heap's memory_heap_desc::visibleNodeMask.
+         * @note Valid usage (ErrorInvalidUsage): offset **must** be a multiple of queryResourceAllocationInfo(desc).alignment, and offset + queryResourceAllocationInfo(desc).size **must not** be more than the heap's memory_heap_desc::size.
+         *
+         * @return Success upon correct execution of the operation.
+         * @return resource_desc defined result values: ErrorInvalidUsage, ErrorInvalidNodeMask.
+         * @return Implementation defined result values: ErrorOutOfHostMemory, ErrorOutOfDeviceMemory.
+        */
+        result createPlacedResource(MemoryHeap* heap, uint64_t offset, const resource_desc& desc, Resource** resource);
+
+        /**
+         * @brief Map the memory of a buffer into host address space, so that the host can write to memory_type::Upload buffers and read from memory_type::Read buffers.
+         * The buffer stays mapped until unmapResource() is called, and the pointer remains valid for that duration, even while the device accesses the buffer.
+         *
+         * @param resource The buffer to map.
+         * @param data A pointer to the resulting pointer variable, which points to the start of the buffer.
+         *
+         * @note Valid usage (ErrorInvalidUsage): resource **must** be a valid non-null pointer to a Resource.
+         * @note Valid usage (ErrorInvalidUsage): data **must** be a valid non-null pointer to a void* variable.
+         * @note Valid usage (ErrorInvalidUsage): resource **must** be a resource_type::Buffer created with memory_type::Upload or memory_type::Read.
+         * @note Valid usage (ErrorInvalidState): resource **must not** already be mapped.
+         * @note The host **must** synchronize its access with the device, e.g. by waiting on a Fence before reading back the results of a copy into a memory_type::Read buffer.
+         *
+         * @return Success upon correct execution of the operation.
+         * @return Implementation defined result values: ErrorOutOfHostMemory, ErrorOutOfDeviceMemory.
+        */
+        result mapResource(Resource* resource, void** data);
+
+        /**
+         * @brief Unmap a buffer that was mapped with mapResource(). Pointers obtained through mapResource() are no longer valid after this call.
+         * @param resource A pointer to a mapped Resource, or nullptr. Resources that aren't mapped are ignored.
+        */
+        void unmapResource(Resource* resource);
+
+        /**
+         * @brief Query a snapshot of the Device's call counts, implementation timings, barriers and allocations, counted since the Device was created or since the last resetStatistics().
+         * Calls made through the Device's Queues, CommandGroups and CommandLists are included.
+         *
+         * @note This function is thread-safe. Statistics are recorded per thread and summed when queried, so calls that are in flight on other threads **may** not be included yet.
+        */
+        [[nodiscard]] device_statistics queryStatistics() const;
+
+        /**
+         * @brief Reset the Device's statistics, after which queryStatistics() only includes calls made after the reset.
+         *
+         * @note This function is thread-safe.
+        */
+        void resetStatistics();
+
+        /**
+         * @brief Query the objects that were created through the Device and not yet destroyed, including CommandLists allocated through its CommandGroups.
+         *
+         * @note The counts are only tracked if the Device's Instance was created with instance_desc::trackObjectLifetimes enabled, otherwise all counts are 0.
+         * @note This function is thread-safe, but objects that are created or destroyed on other threads at the same time **may** not be included yet.
+        */
+        [[nodiscard]] live_objects queryLiveObjects() const;
+
+        /**
+         * @brief Get the Resource that a handle refers to.
+         *
+         * @param h A handle obtained through Resource::getHandle().
+         * @return The Resource, or nullptr if the Resource was destroyed or if it wasn't created through this Device.
+         *
+         * @note This function is thread-safe.
+        */
+        [[nodiscard]] Resource* resolve(handle<Resource> h) const;
+
+        /**
+         * @brief Get the Fence that a handle refers to.
+         *
+         * @param h A handle obtained through Fence::getHandle().
+         * @return The Fence, or nullptr if the Fence was destroyed or if it wasn't created through this Device.
+         *
+         * @note This function is thread-safe.
+        */
+        [[nodiscard]] Fence* resolve(handle<Fence> h) const;
+
+        /**
+         * @brief Get the Semaphore that a handle refers to.
+         *
+         * @param h A handle obtained through Semaphore::getHandle().
+         * @return The Semaphore, or nullptr if the Semaphore was destroyed or if it wasn't created through this Device.
+         *
+         * @note This function is thread-safe.
+        */
+        [[nodiscard]] Semaphore* resolve(handle<Semaphore> h) const;
+
+        /**
+         * @brief Set the simulated costs of the work that is submitted to Queues of the given queue_type. The costs apply to submissions made after this call.
+         *
+         * @param type The type of Queue that the costs apply to.
+         * @param desc The simulated costs.
+         *
+         * @note Valid usage (ErrorExtensionNotEnabled): The Device **must** have been created with adapter_extension::SimulatedTiming enabled.
+         * @note Valid usage (ErrorInvalidUsage): type **must** be less than or equal to queue_type::MaxEnum.
+         * @note This function **must** not be called while Queues of the given type are being submitted to on other threads.
+         *
+         * @return Success upon correct execution of the operation.
+        */
+        result setSimulatedTimingEXT(queue_type type, const simulated_timing_desc_ext& desc);
+
+        /**
+         * @brief Query the Device's simulated time in nanoseconds. The simulated time starts at 0 and only advances through advanceSimulatedTimeEXT(), and through waitFences() and Queue::waitIdle() waiting for work to finish.
+         *
+         * @param time A pointer to the resulting time variable.
+         *
+         * @note Valid usage (ErrorExtensionNotEnabled): The Device **must** have been created with adapter_extension::SimulatedTiming enabled.
+         * @note Valid usage (ErrorInvalidUsage): time **must** be a valid non-null pointer to a uint64_t variable.
+         *
+         * @return Success upon correct execution of the operation.
+        */
+        result querySimulatedTimeEXT(uint64_t* time) const;
+
+        /**
+         * @brief Advance the Device's simulated time, e.g. to model the CPU time that an application spends on a frame.
+         *
+         * @param nanoseconds The number of nanoseconds to advance the simulated time by.
+         *
+         * @note Valid usage (ErrorExtensionNotEnabled): The Device **must** have been created with adapter_extension::SimulatedTiming enabled.
+         *
+         * @return Success upon correct execution of the operation.
+        */
+        result advanceSimulatedTimeEXT(uint64_t nanoseconds);
+
+        /**
+         * @brief Wrap host memory that the application owns in a buffer, so that the device can copy from it without the data first being copied into memory that LLRI allocated.
+         * The buffer is created with resource_usage_flag_bits::TransferSrc in memory_type::Upload and resource_state::Upload, and it **may** be mapped through mapResource() like other Upload buffers.
+         *
+         * The host memory isn't freed when the buffer is destroyed, and it **must** stay valid until the buffer is destroyed. The host **must not** write to the memory while the device reads from it.
+         *
+         * @param data A pointer to the host memory, for example a memory-mapped file.
+         * @param size The size of the host memory in bytes.
+         * @param resource A pointer to the resulting resource variable.
+         *
+         * @note Valid usage (ErrorExtensionNotEnabled): The Device **must** have been created with adapter_extension::HostMemoryImport enabled.
+         * @note Valid usage (ErrorInvalidUsage): data **must** be a valid non-null pointer, and size **must** be more than 0.
+         * @note Valid usage (ErrorInvalidUsage): resource **must** be a valid non-null pointer to a Resource* variable.
+         * @note Valid usage (ErrorInvalidUsage): data and size **must** be multiples of adapter_limits::hostMemoryImportAlignment.
+         *
+         * @return Success upon correct execution of the operation.
+         * @return ErrorInvalidUsage implementations may return this if the host memory can't be imported, e.g. because the driver doesn't support importing memory-mapped files.
+         * @return Implementation defined result values: ErrorOutOfHostMemory, ErrorOutOfDeviceMemory.
+        */
+        result importHostMemoryEXT(void* data, uint32_t size, Resource** resource);
+
+        /**
+         * @brief Create a resource (a buffer or texture) like createResource(), with memory that **may** be exported through exportResourceMemoryFdEXT().
+         *
+         * @param desc The description of the resource.
+         * @param handleType The type of file descriptor that the memory is exported as.
+         * @param resource A pointer to the resulting resource variable.
+         *
+         * @note Valid usage (ErrorExtensionNotEnabled): The Device **must** have been created with adapter_extension::ExternalMemoryFd enabled.
+         * @note Valid usage (ErrorInvalidUsage): handleType **must** be less than or equal to external_memory_handle_type_ext::MaxEnum.
+         * @note Valid usage (ErrorInvalidUsage): resource **must** be a valid non-null pointer to a Resource* variable.
+         * @note Valid usage (ErrorInvalidUsage): if handleType is external_memory_handle_type_ext::DmaBuf, desc.type **must** be resource_type::Buffer.
+         *
+         * @return Success upon correct execution of the operation.
+         * @return resource_desc defined result values: ErrorInvalidUsage, ErrorInvalidNodeMask.
+         * @return ErrorExtensionNotSupported if the implementation doesn't support exporting memory as handleType.
+         * @return Implementation defined result values: ErrorOutOfHostMemory, ErrorOutOfDeviceMemory.
+        */
+        result createExportableResourceEXT(const resource_desc& desc, external_memory_handle_type_ext handleType, Resource** resource);
+
+        /**
+         * @brief Export the memory of a resource as a file descriptor, which **may** be passed to another process (e.g. over a UNIX domain socket) and imported there through importResourceMemoryFdEXT().
+         * The memory stays valid until both the resource and all Resources that imported it are destroyed.
+         *
+         * @param resource The resource whose memory is exported.
+         * @param fd A pointer to the resulting file descriptor variable. The caller owns the file descriptor, and **must** close it unless it's passed to importResourceMemoryFdEXT().
+         *
+         * @note Valid usage (ErrorExtensionNotEnabled): The Device **must** have been created with adapter_extension::ExternalMemoryFd enabled.
+         * @note Valid usage (ErrorInvalidUsage): resource **must** be a valid non-null pointer to a Resource that was created through createExportableResourceEXT().
+         * @note Valid usage (ErrorInvalidUsage): fd **must** be a valid non-null pointer to an int variable.
+         *
+         * @return Success upon correct execution of the operation.
+         * @return Implementation defined result values: ErrorOutOfHostMemory.
+        */
+        result exportResourceMemoryFdEXT(Resource* resource, int* fd);
+
+        /**
+         * @brief Create a resource (a buffer or texture) that uses memory which was exported through exportResourceMemoryFdEXT(), by this or another Device or process.
+         * The resource is in desc.initialState, and its contents are what the exporting resource wrote to the memory.
+         *
+         * @param desc The description of the resource, which **must** be the same as the desc of the exported resource.
+         * @param handleType The type of file descriptor, which **must** be the same as the handleType that the resource was exported as.
+         * @param fd The file descriptor. Upon success, ownership of the file descriptor is transferred to the implementation, and the application **must not** use or close it anymore.
+         * @param resource A pointer to the resulting resource variable.
+         *
+         * @note Valid usage (ErrorExtensionNotEnabled): The Device **must** have been created with adapter_extension::ExternalMemoryFd enabled.
+         * @note Valid usage (ErrorInvalidUsage): handleType **must** be less than or equal to external_memory_handle_type_ext::MaxEnum.
+         * @note Valid usage (ErrorInvalidUsage): fd **must** be a valid file descriptor (0 or more).
+         * @note Valid usage (ErrorInvalidUsage): resource **must** be a valid non-null pointer to a Resource* variable.
+         * @note Valid usage (ErrorInvalidUsage): if handleType is external_memory_handle_type_ext::DmaBuf, desc.type **must** be resource_type::Buffer.
+         * @note Opaque file descriptors **must** have been exported by the same implementation on the same Adapter.
+         *
+         * @return Success upon correct execution of the operation.
+         * @return resource_desc defined result values: ErrorInvalidUsage, ErrorInvalidNodeMask.
+         * @return ErrorInvalidUsage implementations may return this if the file descriptor doesn't refer to memory that can back the resource.
+         * @return ErrorExtensionNotSupported if the implementation doesn't support importing memory as handleType.
+         * @return Implementation defined result values: ErrorOutOfHostMemory, ErrorOutOfDeviceMemory.
+        */
+        result importResourceMemoryFdEXT(const resource_desc& desc, external_memory_handle_type_ext handleType, int fd, Resource** resource);
+
+        /**
+         * @brief Create a Semaphore like createSemaphore(), which **may** be exported through exportSemaphoreSyncFdEXT().
+         *
+         * @param semaphore A pointer to the resulting semaphore variable.
+         *
+         * @note Valid usage (ErrorExtensionNotEnabled): The Device **must** have been created with adapter_extension::ExternalSemaphoreFd enabled.
+         * @note Valid usage (ErrorInvalidUsage): semaphore **must** be a valid non-null pointer to a Semaphore* variable.
+         *
+         * @return Success upon correct execution of the operation.
+         * @return Implementation defined result values: ErrorOutOfHostMemory, ErrorOutOfDeviceMemory.
+        */
+        result createExportableSemaphoreEXT(Semaphore** semaphore);
+
+        /**
+         * @brief Export the signal of a Semaphore as a sync file descriptor, which becomes readable once the Semaphore is signaled and **may** be passed to another process.
+         * Exporting consumes the signal like a submission that waits on the Semaphore would, so the Semaphore **may** be signaled again afterwards.
+         *
+         * @param semaphore The Semaphore to export. A submission that signals the Semaphore **must** have been submitted before this call.
+         * @param fd A pointer to the resulting file descriptor variable. The caller owns the file descriptor, and **must** close it unless it's passed to importSemaphoreSyncFdEXT(). A value of -1 means that the Semaphore was already signaled.
+         *
+         * @note Valid usage (ErrorExtensionNotEnabled): The Device **must** have been created with adapter_extension::ExternalSemaphoreFd enabled.
+         * @note Valid usage (ErrorInvalidUsage): semaphore **must** be a valid non-null pointer to a Semaphore that was created through createExportableSemaphoreEXT().
+         * @note Valid usage (ErrorInvalidUsage): fd **must** be a valid non-null pointer to an int variable.
+         *
+         * @return Success upon correct execution of the operation.
+         * @return Implementation defined result values: ErrorOutOfHostMemory.
+        */
+        result exportSemaphoreSyncFdEXT(Semaphore* semaphore, int* fd);
+
+        /**
+         * @brief Import a sync file descriptor into a Semaphore, after which the next submission that waits on the Semaphore waits for the file descriptor to become readable instead.
+         * The import only applies to that submission, after which the Semaphore behaves like it did before the import.
+         *
+         * @param semaphore The Semaphore to import the file descriptor into. Any Semaphore created through this Device **may** be used, it doesn't have to be exportable.
+         * @param fd The sync file descriptor, or -1 if the Semaphore should be treated as signaled. Upon success, ownership of the file descriptor is transferred to the implementation.
+         *
+         * @note Valid usage (ErrorExtensionNotEnabled): The Device **must** have been created with adapter_extension::ExternalSemaphoreFd enabled.
+         * @note Valid usage (ErrorInvalidUsage): semaphore **must** be a valid non-null pointer to a Semaphore.
+         * @note Valid usage (ErrorInvalidUsage): fd **must** be -1 or more.
+         * @note The Semaphore **must not** be signaled, or waited on by a submission that hasn't started executing yet.
+         *
+         * @return Success upon correct execution of the operation.
+         * @return ErrorInvalidUsage implementations may return this if fd isn't a sync file descriptor.
+         * @return Implementation defined result values: ErrorOutOfHostMemory.
+        */
+        result importSemaphoreSyncFdEXT(Semaphore* semaphore, int fd);
     private:
         // Force private constructor/deconstructor so that only create/destroy can manage lifetime
         Device() = default;
@@ -246,12 +582,32 @@ namespace llri
         void* m_functionTable = nullptr;
 
         void* m_validationCallbackMessenger = nullptr;
+        validation_level m_validationLevel = validation_level::Full;
+        detail::message_target m_messageTarget;
+        detail::device_statistics_recorder m_statistics;
+        detail::lifetime_tracker m_lifetime;
+
+        // objects are allocated from per-type pools so that they're stored contiguously and can be referred to by generational handles
+        detail::object_pool<Resource, detail::resource_hot_fields> m_resources;
+        detail::object_pool<Fence> m_fences;
+        detail::object_pool<Semaphore> m_semaphores;
 
         std::vector<Queue*> m_graphicsQueues;
         std::vector<Queue*> m_computeQueues;
         std::vector<Queue*> m_transferQueues;
 
         device_desc m_desc;
+
+#ifdef LLRI_DETAIL_ENABLE_VALIDATION
+        std::unordered_set<adapter_extension> m_enabledExtensions;
+        uint64_t m_hostMemoryImportAlignment = 0;
+
+        // shared by all functions that take a resource_desc
+        result validateResourceDesc(const resource_desc& desc);
+        // runs the individual checks of a desc that failed one of validateResourceDesc()'s combined checks, to report the requirement that it doesn't meet
+        result reportInvalidResourceDesc(const resource_desc& desc);
+        result validateNodeMasks(uint32_t createNodeMask, uint32_t visibleNodeMask);
+#endif
         
         // used for internal commands/work (e.g. transitioning internal states)
         void* m_workCmdGroup = nullptr;
@@ -259,6 +615,9 @@ namespace llri
         void* m_workFence = nullptr;
         queue_type m_workQueueType;
 
+        // the queue family of every queue_type, cached at creation by implementations that group queues into families, so that barriers don't query them again
+        std::array<uint32_t, static_cast<size_t>(queue_type::MaxEnum) + 1> m_queueFamilies {};
+
         result impl_createCommandGroup(queue_type type, CommandGroup** cmdGroup);
         void impl_destroyCommandGroup(CommandGroup* cmdGroup);
 
@@ -269,7 +628,29 @@ namespace llri
         result impl_createSemaphore(Semaphore** semaphore);
         void impl_destroySemaphore(Semaphore* semaphore);
 
+        result impl_createQueryPool(const query_pool_desc& desc, QueryPool** pool);
+        void impl_destroyQueryPool(QueryPool* pool);
+
         result impl_createResource(const resource_desc& desc, Resource** resource);
         void impl_destroyResource(Resource* resource);
+        result impl_createMemoryHeap(const memory_heap_desc& desc, MemoryHeap** heap);
+        void impl_destroyMemoryHeap(MemoryHeap* heap);
+        result impl_queryResourceAllocationInfo(const resource_desc& desc, resource_allocation_info* info);
+        result impl_createPlacedResource(MemoryHeap* heap, uint64_t offset, const resource_desc& desc, Resource** resource);
+        result impl_mapResource(Resource* resource, void** data);
+        void impl_unmapResource(Resource* resource);
+
+        result impl_setSimulatedTimingEXT(queue_type type, const simulated_timing_desc_ext& desc);
+        result impl_querySimulatedTimeEXT(uint64_t* time) const;
+        result impl_advanceSimulatedTimeEXT(uint64_t nanoseconds);
+
+        result impl_importHostMemoryEXT(void* data, uint32_t size, Resource** resource);
+
+        result impl_createExportableResourceEXT(const resource_desc& desc, external_memory_handle_type_ext handleType, Resource** resource);
+        result impl_exportResourceMemoryFdEXT(Resource* resource, int* fd);
+        result impl_importResourceMemoryFdEXT(const resource_desc& desc, external_memory_handle_type_ext handleType, int fd, Resource** resource);
+        result impl_createExportableSemaphoreEXT(Semaphore** semaphore);
+        result impl_exportSemaphoreSyncFdEXT(Semaphore* semaphore, int* fd);
+        result impl_importSemaphoreSyncFdEXT(Semaphore* semaphore, int fd);
     };
 }
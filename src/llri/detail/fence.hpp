@@ -52,6 +52,7 @@ namespace llri
     {
         friend class Device;
         friend class Queue;
+        template<typename, typename> friend class detail::object_pool;
 
     public:
         using native_fence = void;
@@ -66,13 +67,21 @@ namespace llri
          *
          * DirectX12: ID3D12Fence*
          * Vulkan: VkFence
+         * Null: nullptr
+         * CPU: an internal object that is signaled when the submission completes
          */
         [[nodiscard]] native_fence* getNative() const;
+
+        /**
+         * @brief Get the Fence's generational handle, which can be resolved through Device::resolve() and is safe to hold on to after the Fence is destroyed.
+        */
+        [[nodiscard]] handle<Fence> getHandle() const;
     private:
         // Force private constructor/deconstructor so that only create/destroy can manage lifetime
         Fence() = default;
         ~Fence() = default;
 
+        handle<Fence> m_handle;
         fence_flags m_flags;
 
         native_fence* m_ptr = nullptr;
@@ -46,4 +46,9 @@ namespace llri
     {
         return m_ptr;
     }
+
+    inline handle<Fence> Fence::getHandle() const
+    {
+        return m_handle;
+    }
 }
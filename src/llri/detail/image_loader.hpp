@@ -0,0 +1,216 @@
+/**
+ * @file image_loader.hpp
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+#include <llri/image.hpp> // unnecessary but helps intellisense
+
+namespace llri
+{
+    class Device;
+    class Resource;
+    class streaming_uploader;
+
+    /**
+     * @brief Describes how an image_loader decodes and uploads images.
+    */
+    struct image_loader_desc
+    {
+        /**
+         * @brief The uploader that the decoded images are written into and uploaded through.
+         *
+         * @note Valid usage (ErrorInvalidUsage): uploader **must** be a valid non-null pointer to a streaming_uploader that was created for the same Device, and it **must** outlive the image_loader.
+        */
+        streaming_uploader* uploader;
+
+        /**
+         * @brief The number of worker threads that decode images and write them into the uploader's staging memory, or 0 to create one worker per hardware thread.
+        */
+        uint32_t numWorkers;
+
+        /**
+         * @brief If true, textures are created with as many mip levels as Device::createResource() allows for their width, each of which is box filtered from the level before it. Otherwise textures only have a single mip level.
+        */
+        bool generateMips;
+
+        /**
+         * @brief If true, textures are created with format::RGBA8sRGB, otherwise they're created with format::RGBA8UNorm.
+        */
+        bool srgb;
+
+        /**
+         * @brief The state that textures are created in, which is also the state that they're in on the uploader's destination Queue once they've been uploaded.
+         *
+         * @note Valid usage (ErrorInvalidUsage): state **must** be a valid enum value.
+        */
+        resource_state state;
+
+        /**
+         * @brief The device node that textures are created on. Passing 0 is the equivalent of passing 1.
+        */
+        uint32_t nodeMask;
+    };
+
+    /**
+     * @brief Identifies an image that was requested through image_loader::load().
+    */
+    struct image_request
+    {
+        uint32_t index = std::numeric_limits<uint32_t>::max();
+    };
+
+    /**
+     * @brief The progress of an image that was requested through image_loader::load().
+    */
+    enum struct image_status : uint8_t
+    {
+        /**
+         * @brief The image is being read, decoded or uploaded.
+        */
+        Loading,
+        /**
+         * @brief All of the image's mip levels have been uploaded, and its texture **may** be used on the uploader's destination Queue.
+        */
+        Complete,
+        /**
+         * @brief The image couldn't be read or decoded, its texture couldn't be created, or one of its mip levels is larger than the uploader's staging buffer.
+        */
+        Failed,
+        /**
+         * @brief The highest value in this enum.
+        */
+        MaxEnum = Failed
+    };
+
+    /**
+     * @brief Converts an image_status to a string.
+     * @return The enum value as a string, or "Invalid image_status value" if the value was not recognized as an enum member.
+    */
+    inline std::string to_string(image_status status);
+
+    /**
+     * @brief Utility that loads image files into Texture2D resources in the background.
+     *
+     * Files are read on a dedicated I/O thread and decoded by stb_image on a pool of worker threads, into 4 channel images. update() creates the texture of each decoded image
+     * and reserves staging memory for all of its mip levels in the streaming_uploader at once, after which the workers write the mip levels into the mapped staging memory directly,
+     * so the decoded pixels are never copied into an intermediate buffer. The next streaming_uploader::flush() uploads the mip levels together with the other uploads that were committed in time.
+     *
+     * Mip levels are box filtered in place in stb_image's allocation, each from the level before it, and are written into the staging memory as they're filtered.
+     * Nothing is read back from the staging memory, but the mip levels of an image are thus written in order, by one worker at a time.
+     *
+     * The textures are owned by the loader and remain valid until destroy().
+     *
+     * @note load() is thread-safe. The other functions **must** be called from the thread that calls streaming_uploader::flush().
+    */
+    class image_loader
+    {
+    public:
+        image_loader() = default;
+        image_loader(const image_loader&) = delete;
+        image_loader& operator=(const image_loader&) = delete;
+        ~image_loader() { destroy(); }
+
+        /**
+         * @brief Start the loader's I/O and worker threads.
+         *
+         * @note Valid usage (ErrorInvalidUsage): device **must** be a valid non-null pointer to a Device.
+         *
+         * @return Success upon correct execution of the operation.
+         * @return image_loader_desc defined result values: ErrorInvalidUsage.
+        */
+        result create(Device* device, const image_loader_desc& desc);
+
+        /**
+         * @brief Stop the loader's threads, wait for the uploads of its textures to complete and destroy the textures. Images that haven't been decoded yet are discarded.
+         * Calling destroy() on a loader that wasn't created has no effect.
+         *
+         * @note destroy() flushes the uploader if it still holds uploads of the loader's textures.
+        */
+        void destroy();
+
+        /**
+         * @brief Request an image file to be loaded. The file is read and decoded in the background.
+         *
+         * @param path The path of the image file, in any format that stb_image supports.
+         * @param request The request that can be used to query the image's status and texture.
+         *
+         * @return Success upon correct execution of the operation.
+         * @return ErrorInvalidUsage if the loader wasn't created, if path is empty or if request is nullptr.
+        */
+        result load(const std::string& path, image_request* request);
+
+        /**
+         * @brief Create the textures of decoded images and reserve staging memory for their mip levels, in the order in which the images were requested.
+         * If the uploader's staging buffer is full, the remaining images are reserved in a later update().
+         *
+         * update() is intended to be called once per frame, before streaming_uploader::flush().
+         *
+         * @return Success upon correct execution of the operation.
+         * @return ErrorInvalidUsage if the loader wasn't created.
+        */
+        result update();
+
+        /**
+         * @brief Query the progress of an image.
+         * @return The image's status, or image_status::Failed if request wasn't returned by load().
+        */
+        [[nodiscard]] image_status queryStatus(const image_request& request);
+
+        /**
+         * @brief Get the texture of an image.
+         * @return The image's Texture2D with format::RGBA8UNorm or format::RGBA8sRGB, or nullptr if queryStatus() doesn't return image_status::Complete.
+        */
+        [[nodiscard]] Resource* getTexture(const image_request& request);
+
+    private:
+        struct image
+        {
+            std::string path;
+            std::unique_ptr<stbi_uc[]> file;
+            size_t fileSize;
+            // the last mip level that was written, tightly packed
+            stbi_uc* pixels;
+            uint32_t width;
+            uint32_t height;
+            Resource* texture;
+            uint32_t mipLevels;
+            uint32_t reservedMips;
+            uint32_t pendingWrites;
+            bool writing;
+            streaming_request lastRequest;
+            image_status status;
+        };
+
+        struct write_job
+        {
+            uint32_t image;
+            uint32_t mipLevel;
+            streaming_texture_reservation reservation;
+        };
+
+        void read();
+        void work();
+        void decode(uint32_t index);
+        void write(const write_job& job);
+        static void filterMipLevel(stbi_uc* pixels, uint32_t srcWidth, uint32_t srcHeight, uint8_t* dst, uint32_t rowPitch);
+        void release(image& img);
+
+        Device* m_device = nullptr;
+        image_loader_desc m_desc {};
+
+        std::thread m_reader;
+        std::vector<std::thread> m_workers;
+        bool m_stop = false;
+
+        std::mutex m_mutex;
+        std::condition_variable m_readAvailable;
+        std::condition_variable m_workAvailable;
+        std::vector<image> m_images;
+        std::deque<uint32_t> m_readJobs;
+        std::deque<uint32_t> m_decodeJobs;
+        std::deque<uint32_t> m_decoded;
+        std::deque<write_job> m_writeJobs;
+    };
+}
@@ -0,0 +1,422 @@
+/**
+ * @file image_loader.inl
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+#include <llri/image.hpp> // unnecessary but helps intellisense
+
+namespace llri
+{
+    inline std::string to_string(image_status status)
+    {
+        switch(status)
+        {
+            case image_status::Loading:
+                return "Loading";
+            case image_status::Complete:
+                return "Complete";
+            case image_status::Failed:
+                return "Failed";
+        }
+
+        return "Invalid image_status value";
+    }
+
+    inline result image_loader::create(Device* device, const image_loader_desc& desc)
+    {
+        if (device == nullptr || desc.uploader == nullptr || desc.state > resource_state::MaxEnum)
+            return result::ErrorInvalidUsage;
+
+        destroy();
+
+        m_device = device;
+        m_desc = desc;
+        m_stop = false;
+
+        uint32_t numWorkers = desc.numWorkers;
+        if (numWorkers == 0)
+            numWorkers = std::max(std::thread::hardware_concurrency(), 1u);
+
+        m_reader = std::thread(&image_loader::read, this);
+        for (uint32_t i = 0; i < numWorkers; i++)
+            m_workers.emplace_back(&image_loader::work, this);
+
+        return result::Success;
+    }
+
+    inline void image_loader::destroy()
+    {
+        if (m_device == nullptr)
+            return;
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_readAvailable.notify_all();
+        m_workAvailable.notify_all();
+
+        // workers finish the write jobs that are left, so that every reservation in the uploader is committed before they exit
+        m_reader.join();
+        for (auto& worker : m_workers)
+            worker.join();
+
+        // submit the uploads of the loader's textures, so that they can be destroyed safely
+        uint64_t queued = m_desc.uploader->queryQueuedBytes();
+        while (queued > 0 && m_desc.uploader->flush() == result::Success)
+        {
+            const uint64_t remaining = m_desc.uploader->queryQueuedBytes();
+            if (remaining == queued)
+                break;
+            queued = remaining;
+        }
+        static_cast<void>(m_desc.uploader->waitIdle());
+
+        for (auto& img : m_images)
+        {
+            release(img);
+            if (img.texture != nullptr)
+                m_device->destroyResource(img.texture);
+        }
+
+        m_workers.clear();
+        m_images.clear();
+        m_readJobs.clear();
+        m_decodeJobs.clear();
+        m_decoded.clear();
+        m_writeJobs.clear();
+        m_device = nullptr;
+    }
+
+    inline result image_loader::load(const std::string& path, image_request* request)
+    {
+        if (path.empty() || request == nullptr)
+            return result::ErrorInvalidUsage;
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_device == nullptr)
+                return result::ErrorInvalidUsage;
+
+            request->index = static_cast<uint32_t>(m_images.size());
+            m_images.push_back(image { path, nullptr, 0, nullptr, 0, 0, nullptr, 0, 0, 0, false, streaming_request {}, image_status::Loading });
+            m_readJobs.push_back(request->index);
+        }
+
+        m_readAvailable.notify_one();
+        return result::Success;
+    }
+
+    inline result image_loader::update()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (m_device == nullptr)
+            return result::ErrorInvalidUsage;
+
+        const format textureFormat = m_desc.srgb ? format::RGBA8sRGB : format::RGBA8UNorm;
+        bool scheduled = false;
+
+        while (!m_decoded.empty())
+        {
+            const uint32_t index = m_decoded.front();
+            image& img = m_images[index];
+
+            if (img.texture == nullptr)
+            {
+                resource_desc desc {};
+                desc.createNodeMask = m_desc.nodeMask;
+                desc.visibleNodeMask = m_desc.nodeMask;
+                desc.type = resource_type::Texture2D;
+                desc.usage = resource_usage_flag_bits::TransferDst | resource_usage_flag_bits::Sampled;
+                desc.memoryType = memory_type::Local;
+                desc.initialState = m_desc.state;
+                desc.width = img.width;
+                desc.height = img.height;
+                desc.depthOrArrayLayers = 1;
+                desc.mipLevels = static_cast<uint16_t>(img.mipLevels);
+                desc.sampleCount = sample_count::Count1;
+                desc.textureFormat = textureFormat;
+                desc.sharingMode = resource_sharing_mode::Exclusive;
+
+                if (m_device->createResource(desc, &img.texture) != result::Success)
+                {
+                    img.texture = nullptr;
+                    img.status = image_status::Failed;
+                }
+            }
+
+            // all mip levels are reserved back to back, so that they're flushed in the same batch
+            while (img.status == image_status::Loading && img.reservedMips < img.mipLevels)
+            {
+                const uint32_t mipLevel = img.reservedMips;
+                const extent_3d extent { std::max(img.width >> mipLevel, 1u), std::max(img.height >> mipLevel, 1u), 1 };
+
+                streaming_texture_reservation reservation;
+                const result r = m_desc.uploader->reserve(streaming_texture_upload { img.texture, mipLevel, 0, offset_3d { 0, 0, 0 }, extent, nullptr, 0, m_desc.state }, &reservation);
+                if (r == result::NotReady)
+                {
+                    // the staging buffer is full, the remaining mip levels are reserved after the next flush
+                    lock.unlock();
+                    if (scheduled)
+                        m_workAvailable.notify_all();
+                    return result::Success;
+                }
+
+                if (r != result::Success)
+                {
+                    img.status = image_status::Failed;
+                    break;
+                }
+
+                img.reservedMips++;
+                img.pendingWrites++;
+                img.lastRequest = reservation.request;
+                m_writeJobs.push_back(write_job { index, mipLevel, reservation });
+                scheduled = true;
+            }
+
+            if (img.status == image_status::Failed && img.pendingWrites == 0)
+                release(img);
+
+            m_decoded.pop_front();
+        }
+
+        lock.unlock();
+        if (scheduled)
+            m_workAvailable.notify_all();
+        return result::Success;
+    }
+
+    inline image_status image_loader::queryStatus(const image_request& request)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (request.index >= m_images.size())
+            return image_status::Failed;
+
+        image& img = m_images[request.index];
+        if (img.status != image_status::Loading || img.texture == nullptr || img.reservedMips < img.mipLevels || img.pendingWrites > 0)
+            return img.status;
+
+        // uploads complete in order, so the last mip level completes last
+        if (m_desc.uploader->isComplete(img.lastRequest))
+            img.status = image_status::Complete;
+        return img.status;
+    }
+
+    inline Resource* image_loader::getTexture(const image_request& request)
+    {
+        if (queryStatus(request) != image_status::Complete)
+            return nullptr;
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_images[request.index].texture;
+    }
+
+    inline void image_loader::read()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        while (true)
+        {
+            m_readAvailable.wait(lock, [this] { return m_stop || !m_readJobs.empty(); });
+            if (m_stop)
+                return;
+
+            const uint32_t index = m_readJobs.front();
+            m_readJobs.pop_front();
+            const std::string path = m_images[index].path;
+
+            lock.unlock();
+
+            std::unique_ptr<stbi_uc[]> file;
+            size_t fileSize = 0;
+            std::ifstream stream(path, std::ios::binary | std::ios::ate);
+            if (stream)
+            {
+                fileSize = static_cast<size_t>(stream.tellg());
+                file.reset(new stbi_uc[fileSize]);
+                stream.seekg(0);
+                if (!stream.read(reinterpret_cast<char*>(file.get()), static_cast<std::streamsize>(fileSize)))
+                    fileSize = 0;
+            }
+
+            lock.lock();
+
+            if (fileSize == 0)
+            {
+                m_images[index].status = image_status::Failed;
+                continue;
+            }
+
+            m_images[index].file = std::move(file);
+            m_images[index].fileSize = fileSize;
+            m_decodeJobs.push_back(index);
+            m_workAvailable.notify_one();
+        }
+    }
+
+    inline void image_loader::work()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        while (true)
+        {
+            // the mip levels of an image are written in order, by one worker at a time, because each level is filtered in place from the level before it
+            auto next = m_writeJobs.end();
+            m_workAvailable.wait(lock, [this, &next]
+            {
+                next = std::find_if(m_writeJobs.begin(), m_writeJobs.end(), [this](const write_job& job) { return !m_images[job.image].writing; });
+                return m_stop || next != m_writeJobs.end() || !m_decodeJobs.empty();
+            });
+
+            // writes go first because the uploader can't submit anything that was reserved after them until they're committed
+            if (next != m_writeJobs.end())
+            {
+                const write_job job = *next;
+                m_writeJobs.erase(next);
+                m_images[job.image].writing = true;
+
+                lock.unlock();
+                write(job);
+                lock.lock();
+
+                image& img = m_images[job.image];
+                img.writing = false;
+                img.pendingWrites--;
+                if (img.pendingWrites == 0 && (img.reservedMips == img.mipLevels || img.status == image_status::Failed))
+                    release(img);
+                continue;
+            }
+
+            // the remaining write jobs belong to images that other workers are writing, which write them before they exit
+            if (m_stop)
+                return;
+
+            const uint32_t index = m_decodeJobs.front();
+            m_decodeJobs.pop_front();
+
+            lock.unlock();
+            decode(index);
+            lock.lock();
+        }
+    }
+
+    inline void image_loader::decode(uint32_t index)
+    {
+        std::unique_ptr<stbi_uc[]> file;
+        size_t fileSize;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            file = std::move(m_images[index].file);
+            fileSize = m_images[index].fileSize;
+        }
+
+        // stb_image decodes into its own allocation, which the workers write mip 0 from and then filter the other mip levels in
+        int width = 0, height = 0, channels = 0;
+        stbi_uc* pixels = stbi_load_from_memory(file.get(), static_cast<int>(fileSize), &width, &height, &channels, 4);
+        file.reset();
+
+        // Device::createResource() requires width >> mipLevels to be more than 0
+        uint32_t mipLevels = 1;
+        if (pixels != nullptr && m_desc.generateMips)
+        {
+            while ((static_cast<uint32_t>(width) >> (mipLevels + 1)) > 0)
+                mipLevels++;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        image& img = m_images[index];
+
+        if (pixels == nullptr)
+        {
+            img.status = image_status::Failed;
+            return;
+        }
+
+        img.pixels = pixels;
+        img.width = static_cast<uint32_t>(width);
+        img.height = static_cast<uint32_t>(height);
+        img.mipLevels = mipLevels;
+
+        m_decoded.push_back(index);
+    }
+
+    inline void image_loader::filterMipLevel(stbi_uc* pixels, uint32_t srcWidth, uint32_t srcHeight, uint8_t* dst, uint32_t rowPitch)
+    {
+        constexpr uint32_t texelSize = 4;
+
+        const uint32_t dstWidth = std::max(srcWidth >> 1, 1u);
+        const uint32_t dstHeight = std::max(srcHeight >> 1, 1u);
+
+        // the level is filtered in place in row order, which is safe because every texel only reads source texels at or after its own position
+        for (uint32_t y = 0; y < dstHeight; y++)
+        {
+            const uint32_t y0 = y * 2;
+            const uint32_t y1 = std::min(y0 + 2, srcHeight);
+
+            for (uint32_t x = 0; x < dstWidth; x++)
+            {
+                const uint32_t x0 = x * 2;
+                const uint32_t x1 = std::min(x0 + 2, srcWidth);
+
+                std::array<uint32_t, texelSize> sum {};
+                for (uint32_t sy = y0; sy < y1; sy++)
+                {
+                    const stbi_uc* texel = pixels + (sy * static_cast<size_t>(srcWidth) + x0) * texelSize;
+                    for (uint32_t sx = x0; sx < x1; sx++, texel += texelSize)
+                    {
+                        for (uint32_t c = 0; c < texelSize; c++)
+                            sum[c] += texel[c];
+                    }
+                }
+
+                const uint32_t count = (x1 - x0) * (y1 - y0);
+                stbi_uc* out = pixels + (y * static_cast<size_t>(dstWidth) + x) * texelSize;
+                for (uint32_t c = 0; c < texelSize; c++)
+                    out[c] = static_cast<stbi_uc>((sum[c] + count / 2) / count);
+
+                // the staging memory is only written to, because reading from write-combined memory is slow
+                std::memcpy(dst + y * static_cast<size_t>(rowPitch) + x * texelSize, out, texelSize);
+            }
+        }
+    }
+
+    inline void image_loader::write(const write_job& job)
+    {
+        constexpr uint32_t texelSize = 4;
+
+        stbi_uc* pixels;
+        uint32_t width, height;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            const image& img = m_images[job.image];
+            pixels = img.pixels;
+            width = img.width;
+            height = img.height;
+        }
+
+        uint8_t* dst = job.reservation.data;
+        if (job.mipLevel == 0)
+        {
+            for (uint32_t y = 0; y < height; y++)
+                std::memcpy(dst + y * static_cast<size_t>(job.reservation.rowPitch), pixels + y * static_cast<size_t>(width) * texelSize, width * texelSize);
+        }
+        else
+        {
+            // pixels holds the previous mip level, which the previous write job of this image filtered
+            filterMipLevel(pixels, std::max(width >> (job.mipLevel - 1), 1u), std::max(height >> (job.mipLevel - 1), 1u), dst, job.reservation.rowPitch);
+        }
+
+        m_desc.uploader->commit(job.reservation.request);
+    }
+
+    inline void image_loader::release(image& img)
+    {
+        if (img.pixels != nullptr)
+            stbi_image_free(img.pixels);
+        img.pixels = nullptr;
+        img.file.reset();
+    }
+}
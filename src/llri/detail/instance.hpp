@@ -23,6 +23,38 @@ namespace llri
     struct surface_xcb_desc_ext;
     class SurfaceEXT;
 
+    /**
+     * @brief The amount of API validation that an Instance, and all objects created through it, perform at runtime.
+     *
+     * @note If LLRI_DISABLE_VALIDATION is defined, validation is compiled out entirely and the validation level has no effect.
+    */
+    enum struct validation_level : uint8_t
+    {
+        /**
+         * @brief No API validation is performed. Invalid usage of the API results in undefined behaviour.
+        */
+        Disabled,
+        /**
+         * @brief Only inexpensive checks are performed: pointer parameters are checked for nullptr and enum parameters are checked for valid values.
+         * These checks are a handful of branches per call and are suitable for production builds.
+        */
+        Basic,
+        /**
+         * @brief All valid usage documented in the API is validated, including object states, limits, format support and array contents.
+        */
+        Full,
+        /**
+         * @brief The highest value in this enum.
+        */
+        MaxEnum = Full
+    };
+
+    /**
+     * @brief Converts a validation_level to a string.
+     * @return The enum value as a string, or "Invalid validation_level value" if the value was not recognized as an enum member.
+    */
+    inline std::string to_string(validation_level level);
+
     /**
      * @brief Instance description to be used in llri::createInstance().
     */
@@ -50,6 +82,30 @@ namespace llri
          * @note Valid usage: Can be nullptr or a valid null-terminated string.
         */
         const char* applicationName;
+        /**
+         * @brief The amount of runtime API validation performed by the Instance and all objects created through it. Defaults to validation_level::Full.
+         *
+         * @note Valid usage (ErrorInvalidUsage): validationLevel **must** be less or equal to validation_level::MaxEnum.
+        */
+        validation_level validationLevel = validation_level::Full;
+        /**
+         * @brief The callback that messages raised by the Instance and all objects created through it are sent to.
+         * If messageCallback is nullptr, the callback and user data set through llri::setMessageCallback() at the time of llri::createInstance() are used instead.
+         *
+         * Storing the callback per Instance allows multiple Instances in one process to route their messages to separate loggers without any synchronization.
+        */
+        message_callback* messageCallback = nullptr;
+        /**
+         * @brief Optional user data pointer that is passed to messageCallback. Ignored if messageCallback is nullptr.
+        */
+        void* messageUserData = nullptr;
+        /**
+         * @brief Count the Devices created through the Instance, and the objects created through those Devices. Defaults to false.
+         *
+         * Objects that are still live when their Device or the Instance is destroyed are reported to the message callback as a message_severity::Warning, and the counts can be queried at any time through Instance::queryLiveObjects() and Device::queryLiveObjects().
+         * Tracking costs an atomic add per create and destroy call, which makes it suitable for catching leaks and memory growth in long-running applications.
+        */
+        bool trackObjectLifetimes = false;
     };
 
     namespace detail
@@ -61,9 +117,15 @@ namespace llri
         /**
          * @brief Polls API messages, only called if LLRI_DISABLE_IMPLEMENTATION_MESSAGE_POLLING is not defined.
          * Used internally only
+         * @param target The callback that polled messages are sent to.
          * @param messenger This value may differ depending on the function that is calling it, the most relevant messenger will be picked.
         */
-        void impl_pollAPIMessages(messenger_type* messenger);
+        void impl_pollAPIMessages(const message_target& target, messenger_type* messenger);
+
+        /**
+         * @brief Returns the message_target that an Instance created with desc sends its messages to.
+        */
+        inline message_target instanceMessageTarget(const instance_desc& desc);
     }
 
     /**
@@ -119,6 +181,8 @@ namespace llri
          *
          * DirectX12: IDXGIFactory*
          * Vulkan: VkInstance
+         * Null: nullptr
+         * CPU: nullptr
          */
         [[nodiscard]] native_instance* getNative() const;
 
@@ -156,7 +220,7 @@ namespace llri
 
         /**
          * @brief Destroy the device object.
-         * All resources created through the device **must** be destroyed prior to calling this function.
+         * All resources created through the device **must** be destroyed prior to calling this function. If instance_desc::trackObjectLifetimes is enabled, objects that weren't destroyed are reported to the message callback.
          *
          * @param device The device object to be destroyed.
          *
@@ -226,6 +290,15 @@ namespace llri
         */
         void destroySurfaceEXT(SurfaceEXT* surface);
 
+        /**
+         * @brief Query the number of Devices that were created through the Instance and not yet destroyed, along with all live objects that were created through them.
+         * Objects of Devices that were destroyed while they still had live objects remain counted, because they were never destroyed.
+         *
+         * @note The counts are only tracked if the Instance was created with instance_desc::trackObjectLifetimes enabled, otherwise all counts are 0.
+         * @note This function is thread-safe, but objects that are created or destroyed on other threads at the same time **may** not be included yet.
+        */
+        [[nodiscard]] live_objects queryLiveObjects() const;
+
     private:
         // Force private constructor/deconstructor so that only create/destroy can manage lifetime
         Instance() = default;
@@ -237,6 +310,9 @@ namespace llri
 
         bool m_shouldConstructValidationCallbackMessenger;
         detail::messenger_type* m_validationCallbackMessenger = nullptr; // Allows API to store their callback messenger if needed
+        validation_level m_validationLevel = validation_level::Full;
+        detail::message_target m_messageTarget;
+        detail::lifetime_tracker m_lifetime;
 
         std::unordered_map<void*, Adapter*> m_cachedAdapters;
 
@@ -9,6 +9,21 @@
 
 namespace llri
 {
+    inline std::string to_string(validation_level level)
+    {
+        switch (level)
+        {
+            case validation_level::Disabled:
+                return "Disabled";
+            case validation_level::Basic:
+                return "Basic";
+            case validation_level::Full:
+                return "Full";
+        }
+
+        return "Invalid validation_level value";
+    }
+
     inline std::string to_string(instance_extension ext)
     {
         switch (ext)
@@ -30,6 +45,17 @@ namespace llri
         return "Invalid instance_extension value";
     }
 
+    namespace detail
+    {
+        inline message_target instanceMessageTarget(const instance_desc& desc)
+        {
+            if (desc.messageCallback)
+                return { desc.messageCallback, desc.messageUserData };
+
+            return { m_messageCallback, m_userData };
+        }
+    }
+
     [[nodiscard]] inline bool queryInstanceExtensionSupport(instance_extension ext)
     {
         return detail::queryInstanceExtensionSupport(ext);
@@ -37,18 +63,30 @@ namespace llri
 
     inline result createInstance(const instance_desc& desc, Instance** instance)
     {
-        LLRI_DETAIL_VALIDATION_REQUIRE(instance != nullptr, result::ErrorInvalidUsage)
-        *instance = nullptr;
+        // the Instance doesn't exist yet, so validation messages are sent to the target that it would be created with
+        [[maybe_unused]] const detail::message_target target = detail::instanceMessageTarget(desc);
 
-        LLRI_DETAIL_VALIDATION_REQUIRE(desc.numExtensions <= static_cast<uint32_t>(instance_extension::MaxEnum) + 1, result::ErrorExceededLimit)
-        
-        LLRI_DETAIL_VALIDATION_REQUIRE(desc.numExtensions == 0 || (desc.numExtensions > 0 && desc.extensions != nullptr), result::ErrorInvalidUsage)
+        LLRI_DETAIL_VALIDATION_BASIC(desc.validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE_TARGET(target, instance != nullptr, result::ErrorInvalidUsage)
+        }
+        *instance = nullptr;
 
 #ifdef LLRI_DETAIL_ENABLE_VALIDATION
-        for (size_t i = 0; i < desc.numExtensions; i++)
+        LLRI_DETAIL_VALIDATION_BASIC(desc.validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE_TARGET(target, desc.validationLevel <= validation_level::MaxEnum, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE_TARGET(target, desc.numExtensions <= static_cast<uint32_t>(instance_extension::MaxEnum) + 1, result::ErrorExceededLimit)
+            LLRI_DETAIL_VALIDATION_REQUIRE_TARGET(target, desc.numExtensions == 0 || (desc.numExtensions > 0 && desc.extensions != nullptr), result::ErrorInvalidUsage)
+
+            for (size_t i = 0; i < desc.numExtensions; i++)
+                LLRI_DETAIL_VALIDATION_REQUIRE_ITER_TARGET(target, desc.extensions[i] <= instance_extension::MaxEnum, i, result::ErrorExtensionNotSupported)
+        }
+
+        LLRI_DETAIL_VALIDATION_FULL(desc.validationLevel)
         {
-            LLRI_DETAIL_VALIDATION_REQUIRE_ITER(desc.extensions[i] <= instance_extension::MaxEnum, i, result::ErrorExtensionNotSupported)
-            LLRI_DETAIL_VALIDATION_REQUIRE_ITER(queryInstanceExtensionSupport(desc.extensions[i]), i, result::ErrorExtensionNotSupported)
+            for (size_t i = 0; i < desc.numExtensions; i++)
+                LLRI_DETAIL_VALIDATION_REQUIRE_ITER_TARGET(target, queryInstanceExtensionSupport(desc.extensions[i]), i, result::ErrorExtensionNotSupported)
         }
 #endif
 
@@ -65,7 +103,7 @@ namespace llri
         // handle message polling
 #ifndef LLRI_DISABLE_IMPLEMENTATION_MESSAGE_POLLING
         if (*instance)
-            detail::impl_pollAPIMessages((*instance)->m_validationCallbackMessenger);
+            detail::impl_pollAPIMessages((*instance)->m_messageTarget, (*instance)->m_validationCallbackMessenger);
 #endif
 
         // handle validation data
@@ -74,6 +112,9 @@ namespace llri
             (*instance)->m_enabledExtensions = { desc.extensions, desc.extensions + desc.numExtensions };
 #endif
 
+        if (*instance && desc.trackObjectLifetimes)
+            (*instance)->m_lifetime.enable(nullptr);
+
         // finally return
         return r;
     }
@@ -83,6 +124,9 @@ namespace llri
         if (!instance)
             return;
 
+        if (instance->m_lifetime.enabled())
+            detail::reportLiveObjects(instance->m_messageTarget, "Instance", instance->m_lifetime.snapshot());
+
         detail::impl_destroyInstance(instance);
         // Can't do any polling after the instance is destroyed
     }
@@ -99,7 +143,10 @@ namespace llri
 
     inline result Instance::enumerateAdapters(std::vector<Adapter*>* adapters)
     {
-        LLRI_DETAIL_VALIDATION_REQUIRE(adapters != nullptr, result::ErrorInvalidUsage)
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(adapters != nullptr, result::ErrorInvalidUsage)
+        }
 
         adapters->clear();
 
@@ -112,55 +159,90 @@ namespace llri
 
     inline result Instance::createDevice(const device_desc& desc, Device** device)
     {
-        LLRI_DETAIL_VALIDATION_REQUIRE(device != nullptr, result::ErrorInvalidUsage)
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(device != nullptr, result::ErrorInvalidUsage)
+        }
 
         *device = nullptr;
 
 #ifdef LLRI_DETAIL_ENABLE_VALIDATION
-        LLRI_DETAIL_VALIDATION_REQUIRE(desc.adapter != nullptr, result::ErrorInvalidUsage)
-        LLRI_DETAIL_VALIDATION_REQUIRE(desc.numExtensions <= static_cast<uint32_t>(adapter_extension::MaxEnum) + 1, result::ErrorInvalidUsage);
-        LLRI_DETAIL_VALIDATION_REQUIRE(desc.numExtensions == 0 || (desc.numExtensions > 0 && desc.extensions != nullptr), result::ErrorInvalidUsage)
-
-        for (size_t i = 0; i < desc.numExtensions; i++)
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
         {
-            LLRI_DETAIL_VALIDATION_REQUIRE_ITER(desc.extensions[i] <= adapter_extension::MaxEnum, i, result::ErrorExtensionNotSupported)
-            LLRI_DETAIL_VALIDATION_REQUIRE_ITER(desc.adapter->queryExtensionSupport(desc.extensions[i]), i, result::ErrorExtensionNotSupported)
-        }
+            LLRI_DETAIL_VALIDATION_REQUIRE(desc.adapter != nullptr, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(desc.numExtensions <= static_cast<uint32_t>(adapter_extension::MaxEnum) + 1, result::ErrorInvalidUsage);
+            LLRI_DETAIL_VALIDATION_REQUIRE(desc.numExtensions == 0 || (desc.numExtensions > 0 && desc.extensions != nullptr), result::ErrorInvalidUsage)
 
-        LLRI_DETAIL_VALIDATION_REQUIRE(desc.adapter->m_ptr != nullptr, result::ErrorDeviceLost)
+            for (size_t i = 0; i < desc.numExtensions; i++)
+                LLRI_DETAIL_VALIDATION_REQUIRE_ITER(desc.extensions[i] <= adapter_extension::MaxEnum, i, result::ErrorExtensionNotSupported)
 
-        LLRI_DETAIL_VALIDATION_REQUIRE(desc.numQueues != 0, result::ErrorInvalidUsage);
-        LLRI_DETAIL_VALIDATION_REQUIRE(desc.queues != nullptr, result::ErrorInvalidUsage);
+            LLRI_DETAIL_VALIDATION_REQUIRE(desc.numQueues != 0, result::ErrorInvalidUsage);
+            LLRI_DETAIL_VALIDATION_REQUIRE(desc.queues != nullptr, result::ErrorInvalidUsage);
 
-        // Get max queues
-        std::unordered_map<queue_type, uint8_t> maxQueueCounts {
-            { queue_type::Graphics, desc.adapter->queryQueueCount(queue_type::Graphics) },
-            { queue_type::Compute, desc.adapter->queryQueueCount(queue_type::Compute) },
-            { queue_type::Transfer, desc.adapter->queryQueueCount(queue_type::Transfer) }
-        };
-        
-        // Validate all queue descs and their relation to max queue counts
-        std::unordered_map<queue_type, size_t> queueCounts {
-            { queue_type::Graphics, 0 },
-            { queue_type::Compute, 0 },
-            { queue_type::Transfer, 0 }
-        };
+            for (size_t i = 0; i < desc.numQueues; i++)
+            {
+                LLRI_DETAIL_VALIDATION_REQUIRE_ITER(desc.queues[i].type <= queue_type::MaxEnum, i, result::ErrorInvalidUsage)
+                LLRI_DETAIL_VALIDATION_REQUIRE_ITER(desc.queues[i].priority <= queue_priority::MaxEnum, i, result::ErrorInvalidUsage)
+            }
+        }
 
-        for (size_t i = 0; i < desc.numQueues; i++)
+        LLRI_DETAIL_VALIDATION_FULL(m_validationLevel)
         {
-            auto& queue = desc.queues[i];
+            for (size_t i = 0; i < desc.numExtensions; i++)
+                LLRI_DETAIL_VALIDATION_REQUIRE_ITER(desc.adapter->queryExtensionSupport(desc.extensions[i]), i, result::ErrorExtensionNotSupported)
+
+            LLRI_DETAIL_VALIDATION_REQUIRE(desc.adapter->m_ptr != nullptr, result::ErrorDeviceLost)
+
+            const adapter_features supportedFeatures = desc.adapter->queryFeatures();
+            LLRI_DETAIL_VALIDATION_REQUIRE_IF(desc.features.pipelineStatisticsQuery, supportedFeatures.pipelineStatisticsQuery, result::ErrorFeatureNotSupported)
+
+            // Get max queues
+            std::unordered_map<queue_type, uint8_t> maxQueueCounts {
+                { queue_type::Graphics, desc.adapter->queryQueueCount(queue_type::Graphics) },
+                { queue_type::Compute, desc.adapter->queryQueueCount(queue_type::Compute) },
+                { queue_type::Transfer, desc.adapter->queryQueueCount(queue_type::Transfer) }
+            };
+        
+            // Validate all queue descs and their relation to max queue counts
+            std::unordered_map<queue_type, size_t> queueCounts {
+                { queue_type::Graphics, 0 },
+                { queue_type::Compute, 0 },
+                { queue_type::Transfer, 0 }
+            };
+
+            for (size_t i = 0; i < desc.numQueues; i++)
+            {
+                auto& queue = desc.queues[i];
+
+                queueCounts[queue.type]++; // count the number of queues of this given type to notexceed the max
+                LLRI_DETAIL_VALIDATION_REQUIRE_MESSAGE(queueCounts[queue.type] <= maxQueueCounts[queue.type], "queue_desc " + std::to_string(i) + " is the " + std::to_string(queueCounts[queue.type]) + "th " +
+                        to_string(queue.type) + " queue, even though the maximum number of queues of this type is " + std::to_string(maxQueueCounts[queue.type]) + ".", result::ErrorInvalidUsage)
+            }
+        }
+#endif
 
-            LLRI_DETAIL_VALIDATION_REQUIRE_ITER(desc.queues[i].type <= queue_type::MaxEnum, i, result::ErrorInvalidUsage)
+        LLRI_DETAIL_TRACE_SCOPE()
+        const result r = impl_createDevice(desc, device);
 
-            queueCounts[queue.type]++; // count the number of queues of this given type to notexceed the max
-            LLRI_DETAIL_VALIDATION_REQUIRE_MESSAGE(queueCounts[queue.type] <= maxQueueCounts[queue.type], "queue_desc " + std::to_string(i) + " is the " + std::to_string(queueCounts[queue.type]) + "th " +
-                    to_string(queue.type) + " queue, even though the maximum number of queues of this type is " + std::to_string(maxQueueCounts[queue.type]) + ".", result::ErrorInvalidUsage)
+#ifdef LLRI_DETAIL_ENABLE_VALIDATION
+        if (*device)
+        {
+            (*device)->m_enabledExtensions = { desc.extensions, desc.extensions + desc.numExtensions };
 
-            LLRI_DETAIL_VALIDATION_REQUIRE_ITER(queue.priority <= queue_priority::MaxEnum, i, result::ErrorInvalidUsage)
+            // the limits are queried once here, because querying them can be expensive on some implementations
+            if ((*device)->m_enabledExtensions.find(adapter_extension::HostMemoryImport) != (*device)->m_enabledExtensions.end())
+                (*device)->m_hostMemoryImportAlignment = desc.adapter->queryLimits().hostMemoryImportAlignment;
         }
 #endif
 
-        LLRI_DETAIL_CALL_IMPL(impl_createDevice(desc, device), (*device)->m_validationCallbackMessenger)
+        if (*device && m_lifetime.enabled())
+        {
+            (*device)->m_lifetime.enable(&m_lifetime);
+            m_lifetime.track(detail::tracked_object::Device);
+        }
+
+        LLRI_DETAIL_POLL_API_MESSAGES((*device)->m_validationCallbackMessenger)
+        return r;
     }
 
     inline void Instance::destroyDevice(Device* device)
@@ -168,6 +250,12 @@ namespace llri
         if (!device)
             return;
 
+        if (device->m_lifetime.enabled())
+        {
+            detail::reportLiveObjects(m_messageTarget, "Device", device->m_lifetime.snapshot());
+            m_lifetime.untrack(detail::tracked_object::Device);
+        }
+
         impl_destroyDevice(device);
 
         LLRI_DETAIL_POLL_API_MESSAGES(m_validationCallbackMessenger)
@@ -175,47 +263,87 @@ namespace llri
 
     inline result Instance::createSurfaceEXT(const surface_win32_desc_ext& desc, SurfaceEXT** surface)
     {
-        LLRI_DETAIL_VALIDATION_REQUIRE(surface != nullptr, result::ErrorInvalidUsage)
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(surface != nullptr, result::ErrorInvalidUsage)
+        }
         *surface = nullptr;
-        LLRI_DETAIL_VALIDATION_REQUIRE(m_enabledExtensions.find(instance_extension::SurfaceWin32) != m_enabledExtensions.end(), result::ErrorExtensionNotEnabled)
 
-        LLRI_DETAIL_VALIDATION_REQUIRE(desc.hinstance != nullptr, result::ErrorInvalidUsage)
-        LLRI_DETAIL_VALIDATION_REQUIRE(desc.hwnd != nullptr, result::ErrorInvalidUsage)
+        LLRI_DETAIL_VALIDATION_FULL(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(m_enabledExtensions.find(instance_extension::SurfaceWin32) != m_enabledExtensions.end(), result::ErrorExtensionNotEnabled)
+        }
+
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(desc.hinstance != nullptr, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(desc.hwnd != nullptr, result::ErrorInvalidUsage)
+        }
 
         LLRI_DETAIL_CALL_IMPL(impl_createSurfaceEXT(desc, surface), m_validationCallbackMessenger)
     }
     
     inline result Instance::createSurfaceEXT(const surface_cocoa_desc_ext& desc, SurfaceEXT** surface)
     {
-        LLRI_DETAIL_VALIDATION_REQUIRE(surface != nullptr, result::ErrorInvalidUsage)
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(surface != nullptr, result::ErrorInvalidUsage)
+        }
         *surface = nullptr;
-        LLRI_DETAIL_VALIDATION_REQUIRE(m_enabledExtensions.find(instance_extension::SurfaceCocoa) != m_enabledExtensions.end(), result::ErrorExtensionNotEnabled)
 
-        LLRI_DETAIL_VALIDATION_REQUIRE(desc.nsWindow != nullptr, result::ErrorInvalidUsage)
-        
+        LLRI_DETAIL_VALIDATION_FULL(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(m_enabledExtensions.find(instance_extension::SurfaceCocoa) != m_enabledExtensions.end(), result::ErrorExtensionNotEnabled)
+        }
+
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(desc.nsWindow != nullptr, result::ErrorInvalidUsage)
+        }
+
         LLRI_DETAIL_CALL_IMPL(impl_createSurfaceEXT(desc, surface), m_validationCallbackMessenger)
     }
 
     inline result Instance::createSurfaceEXT(const surface_xlib_desc_ext& desc, SurfaceEXT** surface)
     {
-        LLRI_DETAIL_VALIDATION_REQUIRE(surface != nullptr, result::ErrorInvalidUsage)
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(surface != nullptr, result::ErrorInvalidUsage)
+        }
         *surface = nullptr;
-        LLRI_DETAIL_VALIDATION_REQUIRE(m_enabledExtensions.find(instance_extension::SurfaceXlib) != m_enabledExtensions.end(), result::ErrorExtensionNotEnabled)
 
-        LLRI_DETAIL_VALIDATION_REQUIRE(desc.display != nullptr, result::ErrorInvalidUsage)
-        LLRI_DETAIL_VALIDATION_REQUIRE(desc.window != 0, result::ErrorInvalidUsage)
+        LLRI_DETAIL_VALIDATION_FULL(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(m_enabledExtensions.find(instance_extension::SurfaceXlib) != m_enabledExtensions.end(), result::ErrorExtensionNotEnabled)
+        }
+
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(desc.display != nullptr, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(desc.window != 0, result::ErrorInvalidUsage)
+        }
 
         LLRI_DETAIL_CALL_IMPL(impl_createSurfaceEXT(desc, surface), m_validationCallbackMessenger)
     }
 
     inline result Instance::createSurfaceEXT(const surface_xcb_desc_ext& desc, SurfaceEXT** surface)
     {
-        LLRI_DETAIL_VALIDATION_REQUIRE(surface != nullptr, result::ErrorInvalidUsage)
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(surface != nullptr, result::ErrorInvalidUsage)
+        }
         *surface = nullptr;
-        LLRI_DETAIL_VALIDATION_REQUIRE(m_enabledExtensions.find(instance_extension::SurfaceXcb) != m_enabledExtensions.end(), result::ErrorExtensionNotEnabled)
 
-        LLRI_DETAIL_VALIDATION_REQUIRE(desc.connection != nullptr, result::ErrorInvalidUsage)
-        LLRI_DETAIL_VALIDATION_REQUIRE(desc.window != 0, result::ErrorInvalidUsage)
+        LLRI_DETAIL_VALIDATION_FULL(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(m_enabledExtensions.find(instance_extension::SurfaceXcb) != m_enabledExtensions.end(), result::ErrorExtensionNotEnabled)
+        }
+
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(desc.connection != nullptr, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(desc.window != 0, result::ErrorInvalidUsage)
+        }
 
         LLRI_DETAIL_CALL_IMPL(impl_createSurfaceEXT(desc, surface), m_validationCallbackMessenger)
     }
@@ -228,4 +356,9 @@ namespace llri
         impl_destroySurfaceEXT(surface);
         LLRI_DETAIL_POLL_API_MESSAGES(m_validationCallbackMessenger)
     }
+
+    inline live_objects Instance::queryLiveObjects() const
+    {
+        return m_lifetime.snapshot();
+    }
 }
@@ -0,0 +1,310 @@
+/**
+ * @file job_scheduler.inl
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+#include <llri/llri.hpp> // unnecessary but helps intellisense
+
+namespace llri
+{
+    inline result job_scheduler::create(Device* device, uint32_t nodeMask)
+    {
+        if (device == nullptr)
+            return result::ErrorInvalidUsage;
+
+        destroy();
+
+        m_device = device;
+        m_nodeMask = nodeMask;
+
+        for (uint8_t type = 0; type <= static_cast<uint8_t>(queue_type::MaxEnum); type++)
+        {
+            const auto queueType = static_cast<queue_type>(type);
+            for (uint8_t index = 0; index < device->queryQueueCount(queueType); index++)
+                m_queues.push_back(queue_slot { device->getQueue(queueType, index), queueType, index });
+        }
+
+        return result::Success;
+    }
+
+    inline void job_scheduler::destroy()
+    {
+        if (m_device == nullptr)
+            return;
+
+        static_cast<void>(wait());
+
+        for (auto* semaphore : m_freeSemaphores)
+            m_device->destroySemaphore(semaphore);
+        for (auto* semaphore : m_usedSemaphores)
+            m_device->destroySemaphore(semaphore);
+        for (auto* fence : m_freeFences)
+            m_device->destroyFence(fence);
+        for (auto* fence : m_pendingFences)
+            m_device->destroyFence(fence);
+
+        m_freeSemaphores.clear();
+        m_usedSemaphores.clear();
+        m_freeFences.clear();
+        m_pendingFences.clear();
+        m_queues.clear();
+        m_jobs.clear();
+        m_device = nullptr;
+    }
+
+    inline result job_scheduler::schedule(const job_desc& desc, job* output)
+    {
+        if (m_device == nullptr || output == nullptr)
+            return result::ErrorInvalidUsage;
+
+        if (desc.numCommandLists == 0 || desc.commandLists == nullptr)
+            return result::ErrorInvalidUsage;
+
+        if (desc.numDependencies > 0 && desc.dependencies == nullptr)
+            return result::ErrorInvalidUsage;
+
+        for (uint32_t i = 0; i < desc.numCommandLists; i++)
+        {
+            if (desc.commandLists[i] == nullptr || desc.commandLists[i]->getGroup()->getType() != desc.commandLists[0]->getGroup()->getType())
+                return result::ErrorInvalidUsage;
+        }
+
+        const queue_type type = desc.commandLists[0]->getGroup()->getType();
+        if (std::none_of(m_queues.begin(), m_queues.end(), [type](const queue_slot& slot) { return slot.type == type; }))
+            return result::ErrorInvalidUsage;
+
+        scheduled_job scheduled { { desc.commandLists, desc.commandLists + desc.numCommandLists }, {}, type };
+        for (uint32_t i = 0; i < desc.numDependencies; i++)
+        {
+            if (desc.dependencies[i].index >= m_jobs.size())
+                return result::ErrorInvalidUsage;
+
+            scheduled.dependencies.push_back(desc.dependencies[i].index);
+        }
+
+        std::sort(scheduled.dependencies.begin(), scheduled.dependencies.end());
+        scheduled.dependencies.erase(std::unique(scheduled.dependencies.begin(), scheduled.dependencies.end()), scheduled.dependencies.end());
+
+        m_jobs.push_back(std::move(scheduled));
+        *output = job { static_cast<uint32_t>(m_jobs.size() - 1) };
+        return result::Success;
+    }
+
+    inline result job_scheduler::flush(std::vector<job_submission>* submissions)
+    {
+        if (m_device == nullptr)
+            return result::ErrorInvalidUsage;
+
+        const std::vector<scheduled_job> jobs = std::move(m_jobs);
+        m_jobs.clear();
+
+        if (submissions != nullptr)
+            submissions->clear();
+
+        if (jobs.empty())
+            return result::Success;
+
+        constexpr uint32_t noIndex = std::numeric_limits<uint32_t>::max();
+        const size_t numJobs = jobs.size();
+        const size_t numQueues = m_queues.size();
+
+        // Every job keeps a clock with, for each queue, the position of the last job on that queue that is known to complete before the job.
+        // A dependency only requires a Semaphore if it isn't covered by the clock of the job's queue or by the clock of another dependency that requires a Semaphore.
+        std::vector<uint32_t> jobQueues(numJobs, noIndex);
+        std::vector<uint32_t> jobPositions(numJobs, 0);
+        std::vector<std::vector<uint32_t>> clocks(numJobs);
+        std::vector<std::vector<uint32_t>> queueClocks(numQueues, std::vector<uint32_t>(numQueues, 0));
+        std::vector<uint32_t> queueLoads(numQueues, 0);
+        std::vector<std::vector<uint32_t>> waits(numJobs);
+
+        for (uint32_t j = 0; j < numJobs; j++)
+        {
+            const scheduled_job& current = jobs[j];
+
+            // prefer the queue of the latest dependency of the same type, which needs no Semaphore, then the queue with the fewest jobs
+            uint32_t slot = noIndex;
+            for (auto dependency : current.dependencies)
+            {
+                if (m_queues[jobQueues[dependency]].type == current.type)
+                    slot = jobQueues[dependency];
+            }
+
+            if (slot == noIndex)
+            {
+                for (uint32_t q = 0; q < numQueues; q++)
+                {
+                    if (m_queues[q].type == current.type && (slot == noIndex || queueLoads[q] < queueLoads[slot]))
+                        slot = q;
+                }
+            }
+
+            jobQueues[j] = slot;
+            jobPositions[j] = ++queueLoads[slot];
+
+            std::vector<uint32_t>& clock = clocks[j];
+            clock = queueClocks[slot];
+
+            std::vector<uint32_t> candidates;
+            for (auto dependency : current.dependencies)
+            {
+                if (jobQueues[dependency] != slot && jobPositions[dependency] > clock[jobQueues[dependency]])
+                    candidates.push_back(dependency);
+            }
+
+            for (auto candidate : candidates)
+            {
+                const bool covered = std::any_of(candidates.begin(), candidates.end(), [&](uint32_t other)
+                {
+                    return other != candidate && clocks[other][jobQueues[candidate]] >= jobPositions[candidate];
+                });
+
+                if (!covered)
+                    waits[j].push_back(candidate);
+            }
+
+            for (auto dependency : current.dependencies)
+            {
+                for (size_t q = 0; q < numQueues; q++)
+                    clock[q] = std::max(clock[q], clocks[dependency][q]);
+            }
+
+            clock[slot] = jobPositions[j];
+            queueClocks[slot] = clock;
+        }
+
+        std::vector<std::vector<Semaphore*>> waitSemaphores(numJobs);
+        std::vector<std::vector<Semaphore*>> signalSemaphores(numJobs);
+        for (uint32_t j = 0; j < numJobs; j++)
+        {
+            for (auto signaler : waits[j])
+            {
+                Semaphore* semaphore;
+                const result r = acquireSemaphore(&semaphore);
+                if (r != result::Success)
+                    return r;
+
+                signalSemaphores[signaler].push_back(semaphore);
+                waitSemaphores[j].push_back(semaphore);
+            }
+        }
+
+        if (submissions != nullptr)
+        {
+            submissions->reserve(numJobs);
+            for (uint32_t j = 0; j < numJobs; j++)
+            {
+                const queue_slot& slot = m_queues[jobQueues[j]];
+                submissions->push_back(job_submission { slot.type, slot.index, static_cast<uint32_t>(waitSemaphores[j].size()), static_cast<uint32_t>(signalSemaphores[j].size()) });
+            }
+        }
+
+        // consecutive jobs on a queue share a submit, unless the later job waits or the earlier job signals
+        struct queue_submit
+        {
+            uint32_t slot;
+            std::vector<CommandList*> commandLists;
+            std::vector<Semaphore*> waitSemaphores;
+            std::vector<Semaphore*> signalSemaphores;
+            Fence* fence;
+        };
+        std::vector<queue_submit> submits;
+        std::vector<uint32_t> openSubmits(numQueues, noIndex);
+
+        for (uint32_t j = 0; j < numJobs; j++)
+        {
+            uint32_t& open = openSubmits[jobQueues[j]];
+            if (open == noIndex || !waitSemaphores[j].empty() || !submits[open].signalSemaphores.empty())
+            {
+                submits.push_back(queue_submit { jobQueues[j], {}, waitSemaphores[j], {}, nullptr });
+                open = static_cast<uint32_t>(submits.size() - 1);
+            }
+
+            queue_submit& submit = submits[open];
+            submit.commandLists.insert(submit.commandLists.end(), jobs[j].commandLists.begin(), jobs[j].commandLists.end());
+            submit.signalSemaphores.insert(submit.signalSemaphores.end(), signalSemaphores[j].begin(), signalSemaphores[j].end());
+        }
+
+        for (uint32_t i = 0; i < submits.size(); i++)
+        {
+            queue_submit& submit = submits[i];
+
+            // the last submit on each queue signals a Fence for wait()
+            if (openSubmits[submit.slot] == i)
+            {
+                const result r = acquireFence(&submit.fence);
+                if (r != result::Success)
+                    return r;
+            }
+
+            const submit_desc desc {
+                m_nodeMask,
+                static_cast<uint32_t>(submit.commandLists.size()), submit.commandLists.data(),
+                static_cast<uint32_t>(submit.waitSemaphores.size()), submit.waitSemaphores.data(),
+                static_cast<uint32_t>(submit.signalSemaphores.size()), submit.signalSemaphores.data(),
+                submit.fence
+            };
+
+            const result r = m_queues[submit.slot].queue->submit(desc);
+            if (submit.fence != nullptr)
+            {
+                // a Fence that was never submitted would never be signaled, so it goes straight back to the pool
+                if (r == result::Success)
+                    m_pendingFences.push_back(submit.fence);
+                else
+                    m_freeFences.push_back(submit.fence);
+            }
+
+            if (r != result::Success)
+                return r;
+        }
+
+        return result::Success;
+    }
+
+    inline result job_scheduler::wait()
+    {
+        if (m_pendingFences.empty())
+            return result::Success;
+
+        const result r = m_device->waitFences(static_cast<uint32_t>(m_pendingFences.size()), m_pendingFences.data(), LLRI_TIMEOUT_MAX);
+        if (r != result::Success)
+            return r;
+
+        m_freeFences.insert(m_freeFences.end(), m_pendingFences.begin(), m_pendingFences.end());
+        m_pendingFences.clear();
+
+        m_freeSemaphores.insert(m_freeSemaphores.end(), m_usedSemaphores.begin(), m_usedSemaphores.end());
+        m_usedSemaphores.clear();
+        return result::Success;
+    }
+
+    inline result job_scheduler::acquireSemaphore(Semaphore** semaphore)
+    {
+        if (m_freeSemaphores.empty())
+        {
+            const result r = m_device->createSemaphore(semaphore);
+            if (r != result::Success)
+                return r;
+        }
+        else
+        {
+            *semaphore = m_freeSemaphores.back();
+            m_freeSemaphores.pop_back();
+        }
+
+        m_usedSemaphores.push_back(*semaphore);
+        return result::Success;
+    }
+
+    inline result job_scheduler::acquireFence(Fence** fence)
+    {
+        if (m_freeFences.empty())
+            return m_device->createFence(fence_flag_bits::None, fence);
+
+        *fence = m_freeFences.back();
+        m_freeFences.pop_back();
+        return result::Success;
+    }
+}
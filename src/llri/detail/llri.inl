@@ -9,63 +9,71 @@
 
 namespace llri
 {
-    inline std::string to_string(result r)
+    namespace detail
     {
-        switch (r)
+        constexpr const char* resultName(result r)
         {
-            case result::Success:
-                return "Success";
-            case result::Timeout:
-                return "Timeout";
-            case result::ErrorUnknown:
-                return "ErrorUnknown";
-            case result::ErrorInvalidUsage:
-                return "ErrorInvalidUsage";
-            case result::ErrorFeatureNotSupported:
-                return "ErrorFeatureNotSupported";
-            case result::ErrorExtensionNotSupported:
-                return "ErrorExtensionNotSupported";
-            case result::ErrorExtensionNotEnabled:
-                return "ErrorExtensionNotEnabled";
-            case result::ErrorDeviceHung:
-                return "ErrorDeviceHung";
-            case result::ErrorDeviceLost:
-                return "ErrorDeviceLost";
-            case result::ErrorDeviceRemoved:
-                return "ErrorDeviceRemoved";
-            case result::ErrorDriverFailure:
-                return "ErrorDriverFailure";
-            case result::NotReady:
-                return "NotReady";
-            case result::ErrorOutOfHostMemory:
-                return "ErrorOutOfHostMemory";
-            case result::ErrorOutOfDeviceMemory:
-                return "ErrorOutOfDeviceMemory";
-            case result::ErrorInitializationFailed:
-                return "ErrorInitializationFailed";
-            case result::ErrorIncompatibleDriver:
-                return "ErrorIncompatibleDriver";
-            case result::ErrorInvalidState:
-                return "ErrorInvalidState";
-            case result::ErrorExceededLimit:
-                return "ErrorExceededLimit";
-            case result::ErrorInvalidNodeMask:
-                return "ErrorInvalidNodeMask";
-            case result::ErrorIncompatibleNodeMask:
-                return "ErrorIncompatibleNodeMask";
-            case result::ErrorOccupied:
-                return "ErrorOccupied";
-            case result::ErrorNotSignaled:
-                return "ErrorNotSignaled";
-            case result::ErrorAlreadySignaled:
-                return "ErrorAlreadySignaled";
-            case result::ErrorInvalidFormat:
-                return "ErrorInvalidFormat";
-            case result::ErrorSurfaceLostEXT:
-                return "ErrorSurfaceLostEXT";
+            switch (r)
+            {
+                case result::Success:
+                    return "Success";
+                case result::Timeout:
+                    return "Timeout";
+                case result::ErrorUnknown:
+                    return "ErrorUnknown";
+                case result::ErrorInvalidUsage:
+                    return "ErrorInvalidUsage";
+                case result::ErrorFeatureNotSupported:
+                    return "ErrorFeatureNotSupported";
+                case result::ErrorExtensionNotSupported:
+                    return "ErrorExtensionNotSupported";
+                case result::ErrorExtensionNotEnabled:
+                    return "ErrorExtensionNotEnabled";
+                case result::ErrorDeviceHung:
+                    return "ErrorDeviceHung";
+                case result::ErrorDeviceLost:
+                    return "ErrorDeviceLost";
+                case result::ErrorDeviceRemoved:
+                    return "ErrorDeviceRemoved";
+                case result::ErrorDriverFailure:
+                    return "ErrorDriverFailure";
+                case result::NotReady:
+                    return "NotReady";
+                case result::ErrorOutOfHostMemory:
+                    return "ErrorOutOfHostMemory";
+                case result::ErrorOutOfDeviceMemory:
+                    return "ErrorOutOfDeviceMemory";
+                case result::ErrorInitializationFailed:
+                    return "ErrorInitializationFailed";
+                case result::ErrorIncompatibleDriver:
+                    return "ErrorIncompatibleDriver";
+                case result::ErrorInvalidState:
+                    return "ErrorInvalidState";
+                case result::ErrorExceededLimit:
+                    return "ErrorExceededLimit";
+                case result::ErrorInvalidNodeMask:
+                    return "ErrorInvalidNodeMask";
+                case result::ErrorIncompatibleNodeMask:
+                    return "ErrorIncompatibleNodeMask";
+                case result::ErrorOccupied:
+                    return "ErrorOccupied";
+                case result::ErrorNotSignaled:
+                    return "ErrorNotSignaled";
+                case result::ErrorAlreadySignaled:
+                    return "ErrorAlreadySignaled";
+                case result::ErrorInvalidFormat:
+                    return "ErrorInvalidFormat";
+                case result::ErrorSurfaceLostEXT:
+                    return "ErrorSurfaceLostEXT";
+            }
+
+            return "Invalid result value";
         }
+    }
 
-        return "Invalid result value";
+    inline std::string to_string(result r)
+    {
+        return detail::resultName(r);
     }
 
     inline std::string to_string(implementation impl)
@@ -76,6 +84,10 @@ namespace llri
                 return "Vulkan";
             case implementation::DirectX12:
                 return "DirectX12";
+            case implementation::Null:
+                return "Null";
+            case implementation::CPU:
+                return "CPU";
         }
 
         return "Invalid implementation value";
@@ -83,6 +95,7 @@ namespace llri
 }
 
 #include <llri/detail/callback.inl>
+#include <llri/detail/trace.inl>
 
 #include <llri/detail/instance.inl>
 #include <llri/detail/adapter.inl>
@@ -91,10 +104,16 @@ namespace llri
 #include <llri/detail/device.inl>
 
 #include <llri/detail/resource.inl>
+#include <llri/detail/memory_heap.inl>
 
 #include <llri/detail/command_group.inl>
 #include <llri/detail/command_list.inl>
 
 #include <llri/detail/fence.inl>
+#include <llri/detail/query_pool.inl>
+#include <llri/detail/job_scheduler.inl>
+#include <llri/detail/streaming_uploader.inl>
+#include <llri/detail/statistics.inl>
+#include <llri/detail/lifetime.inl>
 
 #include <llri/detail/swapchain_ext.inl>
@@ -42,4 +42,40 @@ namespace llri
     {
         return "{ " + std::to_string(offset.x) + ", " + std::to_string(offset.y) + " }";
     }
+
+    /**
+     * @brief A three-dimensional extent described by a width, height and depth.
+    */
+    struct extent_3d
+    {
+        uint32_t width;
+        uint32_t height;
+        uint32_t depth;
+    };
+
+    /**
+     * @brief Converts an extent_3d to a string using the format: "{ width, height, depth }"
+    */
+    inline std::string to_string(extent_3d extent)
+    {
+        return "{ " + std::to_string(extent.width) + ", " + std::to_string(extent.height) + ", " + std::to_string(extent.depth) + " }";
+    }
+
+    /**
+     * @brief A three-dimensional offset described by an x, y and z coordinate.
+    */
+    struct offset_3d
+    {
+        int32_t x;
+        int32_t y;
+        int32_t z;
+    };
+
+    /**
+     * @brief Converts an offset_3d to a string using the format: "{ x, y, z }"
+    */
+    inline std::string to_string(offset_3d offset)
+    {
+        return "{ " + std::to_string(offset.x) + ", " + std::to_string(offset.y) + ", " + std::to_string(offset.z) + " }";
+    }
 }
@@ -0,0 +1,378 @@
+/**
+ * @file message_queue.hpp
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+#include <llri/llri.hpp> // unnecessary but helps intellisense
+
+namespace llri
+{
+    namespace detail
+    {
+        /**
+         * @brief The maximum length of a single deferred message, including the null terminator. Longer deferred messages are truncated, messages that are delivered immediately are not.
+        */
+        constexpr size_t maxMessageLength = 512;
+
+        /**
+         * @brief The number of messages that can be pending in the message queue before new messages are dropped.
+        */
+        constexpr size_t messageQueueCapacity = 256;
+
+        /**
+         * @brief The number of message targets whose dropped messages are counted separately between two polls. Messages for further targets are dropped without being reported.
+        */
+        constexpr size_t maxDroppedMessageTargets = 16;
+
+        /**
+         * @brief The maximum number of characters of a formatted integer, including the sign.
+        */
+        constexpr size_t maxIntegerLength = 20;
+
+        /**
+         * @brief Formats value into the end of buffer and returns the characters that were written, without allocating.
+        */
+        template<typename T, std::enable_if_t<std::is_integral_v<T>, int> = 0>
+        std::string_view formatInteger(T value, char (&buffer)[maxIntegerLength]) noexcept
+        {
+            bool negative = false;
+            auto unsignedValue = static_cast<uint64_t>(value);
+            if constexpr (std::is_signed_v<T>)
+            {
+                if (value < 0)
+                {
+                    // negated as unsigned, because negating the lowest value of T overflows
+                    negative = true;
+                    using unsigned_type = std::make_unsigned_t<T>;
+                    unsignedValue = static_cast<unsigned_type>(0u - static_cast<unsigned_type>(value));
+                }
+            }
+
+            size_t begin = maxIntegerLength;
+            do
+            {
+                buffer[--begin] = static_cast<char>('0' + unsignedValue % 10);
+                unsignedValue /= 10;
+            } while (unsignedValue != 0);
+
+            if (negative)
+                buffer[--begin] = '-';
+
+            return std::string_view(buffer + begin, maxIntegerLength - begin);
+        }
+
+        /**
+         * @brief A fixed-size message, formatted in place so that raising a message never allocates.
+        */
+        struct message_entry
+        {
+            message_target target;
+            message_severity severity;
+            message_source source;
+            uint64_t hash = 0;
+            size_t length = 0;
+            char text[maxMessageLength];
+
+            void append(std::string_view str) noexcept
+            {
+                const size_t count = std::min(str.size(), maxMessageLength - 1 - length);
+                std::copy_n(str.data(), count, text + length);
+                length += count;
+                text[length] = '\0';
+            }
+
+            template<typename T, std::enable_if_t<std::is_integral_v<T>, int> = 0>
+            void append(T value) noexcept
+            {
+                char buffer[maxIntegerLength];
+                append(formatInteger(value, buffer));
+            }
+
+            /**
+             * @brief Calculates the FNV-1a hash of the target, severity, source and text, used to recognize repeated messages.
+            */
+            void calculateHash() noexcept
+            {
+                uint64_t h = 0xcbf29ce484222325;
+                constexpr uint64_t prime = 0x00000100000001b3;
+
+                h = (h ^ reinterpret_cast<uintptr_t>(target.callback)) * prime;
+                h = (h ^ reinterpret_cast<uintptr_t>(target.userData)) * prime;
+                h = (h ^ static_cast<uint8_t>(severity)) * prime;
+                h = (h ^ static_cast<uint8_t>(source)) * prime;
+                for (size_t i = 0; i < length; i++)
+                    h = (h ^ static_cast<uint8_t>(text[i])) * prime;
+
+                hash = h | 1; // zero marks an empty de-duplication slot
+            }
+        };
+
+        /**
+         * @brief Bounded multi-producer, single-consumer lock-free ring buffer of message_entry.
+         *
+         * Every cell carries a sequence number which tells producers and the consumer whether the cell is free to write or ready to read, so neither side ever blocks.
+         * Messages that are already pending are de-duplicated: pushing a message that is identical to a pending one only increments that message's repeat count.
+         *
+         * A de-duplication slot holds the hash of the pending message that owns it and that message's repeat count in a single atomic word,
+         * so a repeat is either counted for the pending message or, once the slot was released, pushed as a new message.
+        */
+        class message_queue
+        {
+        public:
+            message_queue() noexcept
+            {
+                for (size_t i = 0; i < messageQueueCapacity; i++)
+                    m_cells[i].sequence.store(i, std::memory_order_relaxed);
+            }
+
+            /**
+             * @brief Pushes entry into the queue, or counts it as a repeat if an identical message is still pending.
+             * Thread-safe, may be called from any number of threads.
+             * @return false if the queue was full and the message was dropped.
+            */
+            bool push(const message_entry& entry) noexcept
+            {
+                dedup_slot& slot = m_dedupSlots[entry.hash % m_dedupSlots.size()];
+                const uint64_t tag = dedupTag(entry.hash);
+
+                bool ownsSlot = false;
+                uint64_t state = slot.state.load(std::memory_order_acquire);
+                while (true)
+                {
+                    if (state == 0)
+                    {
+                        // claiming the slot resets its repeat count along with it
+                        ownsSlot = slot.state.compare_exchange_weak(state, tag, std::memory_order_acq_rel);
+                        if (ownsSlot)
+                            break;
+                    }
+                    else if ((state & ~repeatMask) == tag)
+                    {
+                        // saturate instead of carrying into the tag
+                        const uint64_t next = (state & repeatMask) == repeatMask ? state : state + 1;
+                        if (slot.state.compare_exchange_weak(state, next, std::memory_order_acq_rel))
+                            return true;
+                    }
+                    else
+                    {
+                        // the slot is owned by a different message, so this one isn't de-duplicated
+                        break;
+                    }
+                }
+
+                size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+                while (true)
+                {
+                    cell& c = m_cells[pos % messageQueueCapacity];
+                    const size_t sequence = c.sequence.load(std::memory_order_acquire);
+                    const auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+
+                    if (diff == 0)
+                    {
+                        if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                        {
+                            c.entry = entry;
+                            c.ownsDedupSlot = ownsSlot;
+                            c.sequence.store(pos + 1, std::memory_order_release);
+                            return true;
+                        }
+                    }
+                    else if (diff < 0)
+                    {
+                        // full, release the de-duplication slot so that the message can be raised again later
+                        // the repeats that were counted for this message in the meantime are dropped along with it
+                        uint32_t dropped = 1;
+                        if (ownsSlot)
+                            dropped += static_cast<uint32_t>(slot.state.exchange(0, std::memory_order_acq_rel) & repeatMask);
+                        drop(entry.target, dropped);
+                        return false;
+                    }
+                    else
+                    {
+                        pos = m_enqueuePos.load(std::memory_order_relaxed);
+                    }
+                }
+            }
+
+            /**
+             * @brief Pops the oldest pending message.
+             * @note Not thread-safe, only one thread may pop messages at a time.
+             * @param entry The popped message.
+             * @param repeats The number of identical messages that were raised while entry was pending.
+             * @return false if the queue was empty.
+            */
+            bool pop(message_entry& entry, uint32_t& repeats) noexcept
+            {
+                const size_t pos = m_dequeuePos.load(std::memory_order_relaxed);
+                cell& c = m_cells[pos % messageQueueCapacity];
+                if (c.sequence.load(std::memory_order_acquire) != pos + 1)
+                    return false;
+
+                entry = c.entry;
+                const bool ownsSlot = c.ownsDedupSlot;
+                c.sequence.store(pos + messageQueueCapacity, std::memory_order_release);
+                m_dequeuePos.store(pos + 1, std::memory_order_relaxed);
+
+                // the slot is released and its count taken in one exchange, later repeats claim the slot for a new message
+                repeats = 0;
+                if (ownsSlot)
+                {
+                    dedup_slot& slot = m_dedupSlots[entry.hash % m_dedupSlots.size()];
+                    repeats = static_cast<uint32_t>(slot.state.exchange(0, std::memory_order_acq_rel) & repeatMask);
+                }
+
+                return true;
+            }
+
+            /**
+             * @brief Calls report(target, count) for every target that messages were dropped for because the queue was full, and resets the counters.
+             * @note Not thread-safe with other calls to takeDropped(), like pop().
+            */
+            template<typename Func>
+            void takeDropped(Func&& report)
+            {
+                std::array<dropped_messages, maxDroppedMessageTargets> dropped;
+                size_t count;
+                {
+                    std::lock_guard<std::mutex> lock(m_droppedMutex);
+                    dropped = m_dropped;
+                    count = m_numDroppedTargets;
+                    m_numDroppedTargets = 0;
+                }
+
+                // reported outside of the lock, so that the callbacks may raise messages themselves
+                for (size_t i = 0; i < count; i++)
+                    report(dropped[i].target, dropped[i].count);
+            }
+
+        private:
+            struct cell
+            {
+                std::atomic<size_t> sequence;
+                message_entry entry;
+                bool ownsDedupSlot;
+            };
+
+            /**
+             * @brief The low bits of a de-duplication slot's state hold the repeat count, the high bits the tag of the message that owns the slot. Zero marks an empty slot.
+            */
+            struct dedup_slot
+            {
+                std::atomic<uint64_t> state { 0 };
+            };
+
+            static constexpr uint64_t repeatMask = (1ull << 24) - 1;
+
+            static constexpr uint64_t dedupTag(uint64_t hash) noexcept
+            {
+                return (hash & ~repeatMask) | (repeatMask + 1);
+            }
+
+            struct dropped_messages
+            {
+                message_target target;
+                uint32_t count;
+            };
+
+            /**
+             * @brief Counts messages that were dropped for target. The queue is full when this is called, so taking a lock here doesn't slow down the common case.
+            */
+            void drop(const message_target& target, uint32_t count) noexcept
+            {
+                std::lock_guard<std::mutex> lock(m_droppedMutex);
+                for (size_t i = 0; i < m_numDroppedTargets; i++)
+                {
+                    if (m_dropped[i].target.callback == target.callback && m_dropped[i].target.userData == target.userData)
+                    {
+                        m_dropped[i].count += count;
+                        return;
+                    }
+                }
+
+                if (m_numDroppedTargets < m_dropped.size())
+                    m_dropped[m_numDroppedTargets++] = dropped_messages { target, count };
+            }
+
+            std::array<cell, messageQueueCapacity> m_cells;
+            std::array<dedup_slot, 64> m_dedupSlots;
+
+            // producers and the consumer write to separate cache lines
+            alignas(64) std::atomic<size_t> m_enqueuePos { 0 };
+            alignas(64) std::atomic<size_t> m_dequeuePos { 0 };
+
+            std::mutex m_droppedMutex;
+            std::array<dropped_messages, maxDroppedMessageTargets> m_dropped {};
+            size_t m_numDroppedTargets = 0;
+        };
+
+        /**
+         * @brief Global message delivery mode, not part of the public API - should not be accessed directly but instead be set through llri::setMessageDelivery().
+        */
+        inline std::atomic<message_delivery> m_messageDelivery { message_delivery::Immediate };
+        /**
+         * @brief Global queue of pending messages, used if the delivery mode is message_delivery::Deferred.
+        */
+        inline message_queue m_messageQueue;
+
+        inline void appendMessagePart(std::string& text, std::string_view part) { text.append(part); }
+        template<typename T, std::enable_if_t<std::is_integral_v<T>, int> = 0>
+        void appendMessagePart(std::string& text, T value)
+        {
+            char buffer[maxIntegerLength];
+            text.append(formatInteger(value, buffer));
+        }
+
+        inline const char* messageText(const char* text) { return text; }
+        inline const char* messageText(const std::string& text) { return text.c_str(); }
+
+        /**
+         * @brief True if T is already a null-terminated string that can be passed to a message callback as is.
+        */
+        template<typename T>
+        constexpr bool isMessageText = std::is_convertible_v<const T&, const char*> || std::is_same_v<T, std::string>;
+
+        template<typename... Parts>
+        void raiseMessage(const message_target& target, message_severity severity, message_source source, const Parts&... parts)
+        {
+            if (!target.callback)
+                return;
+
+            if (m_messageDelivery.load(std::memory_order_relaxed) == message_delivery::Deferred)
+            {
+                message_entry entry;
+                entry.target = target;
+                entry.severity = severity;
+                entry.source = source;
+                entry.text[0] = '\0';
+                (entry.append(parts), ...);
+
+                entry.calculateHash();
+                m_messageQueue.push(entry);
+                return;
+            }
+
+            // only pending messages are limited to maxMessageLength, immediate messages are passed on in full
+            if constexpr (sizeof...(Parts) == 1 && (isMessageText<Parts> && ...))
+            {
+                target.callback(severity, source, messageText(parts...), target.userData);
+            }
+            else
+            {
+                std::string text;
+                (appendMessagePart(text, parts), ...);
+                target.callback(severity, source, text.c_str(), target.userData);
+            }
+        }
+
+        // convenience callback functions
+        template<typename Message>
+        void callUserCallback(const message_target& target, message_severity severity, message_source source, const Message& message) { raiseMessage(target, severity, source, message); }
+        template<typename... Parts>
+        void apiError(const message_target& target, const char* func, result r, const Parts&... parts) { raiseMessage(target, message_severity::Error, message_source::API, func, " returned ", resultName(r), " because ", parts...); }
+        template<typename... Parts>
+        void apiError(const message_target& target, const char* func, void* dummy, const Parts&... parts) { raiseMessage(target, message_severity::Error, message_source::API, func, " returned ", static_cast<uint64_t>(reinterpret_cast<uintptr_t>(dummy)), " because ", parts...); }
+        inline void apiWarning(const message_target& target, const char* func, std::string_view message) { raiseMessage(target, message_severity::Warning, message_source::API, "in ", func, ": ", message); }
+    }
+}
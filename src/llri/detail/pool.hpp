@@ -0,0 +1,316 @@
+/**
+ * @file pool.hpp
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+#include <llri/llri.hpp> // unnecessary but helps intellisense
+
+namespace llri
+{
+    /**
+     * @brief A generational handle to an object of type T, which stays safe to use after the object is destroyed.
+     *
+     * Handles are an index into the pool that owns the object and the generation of the slot at the time the object was created.
+     * When the object is destroyed, the generation of its slot changes, so resolving a handle to a destroyed object returns nullptr instead of a dangling pointer, even if the slot has been reused by a new object.
+     * Handles are obtained through getHandle() on Resource, Fence, Semaphore and CommandList, and are resolved through Device::resolve() and CommandGroup::resolve().
+    */
+    template<typename T>
+    struct handle
+    {
+        /**
+         * @brief The index of the object's slot in its pool.
+        */
+        uint32_t index = std::numeric_limits<uint32_t>::max();
+        /**
+         * @brief The generation of the slot when the object was created. Live objects always have an odd generation, so a default-constructed handle never resolves.
+        */
+        uint32_t generation = 0;
+
+        [[nodiscard]] constexpr bool operator==(const handle& other) const noexcept { return index == other.index && generation == other.generation; }
+        [[nodiscard]] constexpr bool operator!=(const handle& other) const noexcept { return !(*this == other); }
+    };
+
+    namespace detail
+    {
+        /**
+         * @brief The default hot-field type of an object_pool, for objects whose fields are all stored in the object itself.
+        */
+        struct no_hot_fields {};
+
+        /**
+         * @brief Owns objects of type T in segments of contiguous slots, so that objects that are created together are stored together and creating an object never needs a separate heap allocation once a segment is available.
+         *
+         * Every segment stores its slots as separate arrays: the generation of every slot, the Hot fields of every slot and the objects themselves.
+         * Fields that command recording reads for every object it touches are kept in Hot, so that walking many objects walks a dense array of small entries. T points to its Hot entry, which keeps the pointer based API a thin layer on top of the arrays.
+         * A slot is live if its generation is odd. Destroying an object increments its slot's generation and pushes the slot onto a free list, which is reused by the next allocation.
+         * Object addresses are stable until the object is freed, because segments are never moved. Every segment is twice the size of the one before it.
+         *
+         * allocate(), free() and resolve() are thread-safe and lock-free, except for the allocation that adds a new segment. Iteration doesn't race with them, but objects that are freed during iteration **must not** be used, so iterating requires external synchronization like the object that owns the pool.
+         *
+         * T **must** have a member "handle<T> m_handle", which the pool sets when the object is allocated. If Hot isn't no_hot_fields, T **must** also have a member "Hot* m_hot", which the pool points to the object's value-initialized Hot entry.
+        */
+        template<typename T, typename Hot = no_hot_fields>
+        class object_pool
+        {
+        public:
+            /**
+             * @brief The number of slots in the first segment.
+            */
+            static constexpr uint32_t chunkSize = 64;
+
+            object_pool() = default;
+            object_pool(const object_pool&) = delete;
+            object_pool& operator=(const object_pool&) = delete;
+
+            ~object_pool()
+            {
+                for (uint32_t index = 0; index < m_capacity.load(std::memory_order_acquire); index++)
+                {
+                    if (isLive(index))
+                        slot(index)->~T();
+                }
+
+                for (auto& s : m_segments)
+                    delete s.load(std::memory_order_relaxed);
+            }
+
+            /**
+             * @brief Constructs a new object in a free slot.
+            */
+            T* allocate()
+            {
+                const uint32_t index = pop();
+                segment* s = segmentOf(index);
+                const uint32_t offset = index - segmentBase(segmentIndex(index));
+
+                // only the thread that popped the slot writes its generation
+                const uint32_t generation = s->generations[offset].load(std::memory_order_relaxed) + 1;
+
+                T* object = new (s->storage[offset].bytes) T();
+                object->m_handle = handle<T> { index, generation };
+                if constexpr (!std::is_same_v<Hot, no_hot_fields>)
+                {
+                    s->hot[offset] = Hot {};
+                    object->m_hot = &s->hot[offset];
+                }
+
+                s->generations[offset].store(generation, std::memory_order_release);
+                m_size.fetch_add(1, std::memory_order_relaxed);
+                return object;
+            }
+
+            /**
+             * @brief Destroys an object that was allocated through this pool, which invalidates all of its handles.
+            */
+            void free(T* object)
+            {
+                const uint32_t index = object->m_handle.index;
+                segment* s = segmentOf(index);
+                const uint32_t offset = index - segmentBase(segmentIndex(index));
+
+                // the generation changes first, so that handles stop resolving before the object is destroyed
+                s->generations[offset].fetch_add(1, std::memory_order_acq_rel);
+                object->~T();
+
+                push(index, index);
+                m_size.fetch_sub(1, std::memory_order_relaxed);
+            }
+
+            /**
+             * @brief Returns the object that h refers to, or nullptr if the object was destroyed or if h wasn't created by this pool.
+            */
+            [[nodiscard]] T* resolve(handle<T> h) const noexcept
+            {
+                if (h.index >= m_capacity.load(std::memory_order_acquire))
+                    return nullptr;
+
+                const uint32_t generation = generationOf(h.index);
+                if (generation != h.generation || (generation & 1u) == 0)
+                    return nullptr;
+
+                return slot(h.index);
+            }
+
+            /**
+             * @brief Returns true if object is a live object of this pool. object is compared against the pool's segments and is never dereferenced, so any pointer value is valid.
+            */
+            [[nodiscard]] bool contains(const T* object) const noexcept
+            {
+                const uint32_t capacity = m_capacity.load(std::memory_order_acquire);
+                const auto address = reinterpret_cast<uintptr_t>(object);
+
+                for (uint32_t s = 0; s < m_segments.size() && segmentBase(s) < capacity; s++)
+                {
+                    const auto begin = reinterpret_cast<uintptr_t>(m_segments[s].load(std::memory_order_relaxed)->storage.get());
+                    if (address < begin || address >= begin + sizeof(slot_storage) * segmentSize(s))
+                        continue;
+
+                    if ((address - begin) % sizeof(slot_storage) != 0)
+                        return false;
+
+                    return isLive(segmentBase(s) + static_cast<uint32_t>((address - begin) / sizeof(slot_storage)));
+                }
+
+                return false;
+            }
+
+            /**
+             * @brief The number of live objects.
+            */
+            [[nodiscard]] size_t size() const noexcept { return m_size.load(std::memory_order_relaxed); }
+            [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+            /**
+             * @brief Iterates over the live objects in the order of their slots, which walks the segments front to back.
+            */
+            class iterator
+            {
+            public:
+                iterator(const object_pool* pool, uint32_t index, uint32_t capacity) : m_pool(pool), m_index(index), m_capacity(capacity) { skip(); }
+
+                T* operator*() const { return m_pool->slot(m_index); }
+                iterator& operator++() { m_index++; skip(); return *this; }
+                bool operator==(const iterator& other) const { return m_index == other.m_index; }
+                bool operator!=(const iterator& other) const { return m_index != other.m_index; }
+
+            private:
+                void skip()
+                {
+                    while (m_index < m_capacity && !m_pool->isLive(m_index))
+                        m_index++;
+                }
+
+                const object_pool* m_pool;
+                uint32_t m_index;
+                uint32_t m_capacity;
+            };
+
+            [[nodiscard]] iterator begin() const { const uint32_t capacity = m_capacity.load(std::memory_order_acquire); return iterator(this, 0, capacity); }
+            [[nodiscard]] iterator end() const { const uint32_t capacity = m_capacity.load(std::memory_order_acquire); return iterator(this, capacity, capacity); }
+
+        private:
+            struct slot_storage
+            {
+                alignas(T) unsigned char bytes[sizeof(T)];
+            };
+
+            struct segment
+            {
+                explicit segment(uint32_t size) :
+                    generations(new std::atomic<uint32_t>[size]()),
+                    nextFree(new std::atomic<uint32_t>[size]()),
+                    hot(new Hot[size]()),
+                    storage(new slot_storage[size])
+                { }
+
+                std::unique_ptr<std::atomic<uint32_t>[]> generations;
+                // the index + 1 of the next slot on the free list, 0 ends the list
+                std::unique_ptr<std::atomic<uint32_t>[]> nextFree;
+                std::unique_ptr<Hot[]> hot;
+                std::unique_ptr<slot_storage[]> storage;
+            };
+
+            // segment s holds chunkSize << s slots, so 26 segments hold more slots than a 32 bit index can address
+            static constexpr uint32_t maxSegments = 26;
+
+            [[nodiscard]] static constexpr uint32_t segmentSize(uint32_t s) noexcept { return chunkSize << s; }
+            [[nodiscard]] static constexpr uint32_t segmentBase(uint32_t s) noexcept { return chunkSize * ((1u << s) - 1); }
+            [[nodiscard]] static constexpr uint32_t segmentIndex(uint32_t index) noexcept
+            {
+                uint32_t s = 0;
+                for (uint64_t v = (index / chunkSize + 1ull) >> 1; v != 0; v >>= 1)
+                    s++;
+                return s;
+            }
+
+            [[nodiscard]] segment* segmentOf(uint32_t index) const noexcept { return m_segments[segmentIndex(index)].load(std::memory_order_relaxed); }
+
+            [[nodiscard]] uint32_t generationOf(uint32_t index) const noexcept
+            {
+                return segmentOf(index)->generations[index - segmentBase(segmentIndex(index))].load(std::memory_order_acquire);
+            }
+
+            [[nodiscard]] bool isLive(uint32_t index) const noexcept { return (generationOf(index) & 1u) != 0; }
+
+            [[nodiscard]] T* slot(uint32_t index) const noexcept
+            {
+                return reinterpret_cast<T*>(segmentOf(index)->storage[index - segmentBase(segmentIndex(index))].bytes);
+            }
+
+            [[nodiscard]] std::atomic<uint32_t>& nextFreeOf(uint32_t index) const noexcept
+            {
+                return segmentOf(index)->nextFree[index - segmentBase(segmentIndex(index))];
+            }
+
+            /**
+             * @brief Pushes the slots first to last, which are already linked to each other, onto the free list.
+             * The head of the free list holds a tag in its high bits that changes with every push and pop, so a pop never succeeds on a head that was popped and pushed again in the meantime.
+            */
+            void push(uint32_t first, uint32_t last) noexcept
+            {
+                uint64_t head = m_freeHead.load(std::memory_order_relaxed);
+                uint64_t next;
+                do
+                {
+                    nextFreeOf(last).store(static_cast<uint32_t>(head), std::memory_order_relaxed);
+                    next = (((head >> 32) + 1) << 32) | (first + 1ull);
+                } while (!m_freeHead.compare_exchange_weak(head, next, std::memory_order_release, std::memory_order_relaxed));
+            }
+
+            [[nodiscard]] uint32_t pop()
+            {
+                uint64_t head = m_freeHead.load(std::memory_order_acquire);
+                while (true)
+                {
+                    const auto top = static_cast<uint32_t>(head);
+                    if (top == 0)
+                    {
+                        grow();
+                        head = m_freeHead.load(std::memory_order_acquire);
+                        continue;
+                    }
+
+                    const uint32_t next = nextFreeOf(top - 1).load(std::memory_order_relaxed);
+                    if (m_freeHead.compare_exchange_weak(head, (((head >> 32) + 1) << 32) | next, std::memory_order_acquire, std::memory_order_acquire))
+                        return top - 1;
+                }
+            }
+
+            /**
+             * @brief Adds a segment and pushes its slots onto the free list. Only this rare path takes a lock, so that two threads that find the free list empty don't both add a segment.
+            */
+            void grow()
+            {
+                std::lock_guard lock(m_growMutex);
+
+                // another thread may have grown the pool or freed an object while this thread waited
+                if (static_cast<uint32_t>(m_freeHead.load(std::memory_order_acquire)) != 0)
+                    return;
+
+                const uint32_t capacity = m_capacity.load(std::memory_order_relaxed);
+                const uint32_t s = segmentIndex(capacity);
+                if (s >= maxSegments)
+                    throw std::bad_alloc();
+
+                const uint32_t size = segmentSize(s);
+                auto* added = new segment(size);
+
+                // linked in order so that slots are handed out in order of their address
+                for (uint32_t i = 0; i + 1 < size; i++)
+                    added->nextFree[i].store(capacity + i + 2, std::memory_order_relaxed);
+
+                m_segments[s].store(added, std::memory_order_relaxed);
+                m_capacity.store(capacity + size, std::memory_order_release);
+                push(capacity, capacity + size - 1);
+            }
+
+            std::array<std::atomic<segment*>, maxSegments> m_segments {};
+            std::atomic<uint32_t> m_capacity { 0 };
+            std::atomic<uint64_t> m_freeHead { 0 };
+            std::atomic<size_t> m_size { 0 };
+            std::mutex m_growMutex;
+        };
+    }
+}
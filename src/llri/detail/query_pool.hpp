@@ -0,0 +1,215 @@
+/**
+ * @file query_pool.hpp
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+#include <llri/llri.hpp> // unnecessary but helps intellisense
+
+namespace llri
+{
+    class Device;
+
+    /**
+     * @brief Describes the kind of queries that a QueryPool holds.
+    */
+    enum struct query_type : uint8_t
+    {
+        /**
+         * @brief Each query holds a 64 bit GPU timestamp, written by CommandList::writeTimestamp().
+         * Timestamps are measured in ticks, which can be converted to nanoseconds by multiplying them with adapter_limits::timestampPeriod.
+        */
+        Timestamp,
+        /**
+         * @brief Each query counts the number of samples that passed the depth and stencil tests between CommandList::beginQuery() and CommandList::endQuery().
+         * Implementations **may** return any non-zero value if one or more samples passed, so the result **should** only be relied upon to be exact when it's zero.
+        */
+        Occlusion,
+        /**
+         * @brief Each query holds a pipeline_statistics structure, counting the work done by the pipeline between CommandList::beginQuery() and CommandList::endQuery().
+         *
+         * @note QueryPools of this type **can** only be created if the Device was created with adapter_features::pipelineStatisticsQuery enabled.
+        */
+        PipelineStatistics,
+        /**
+         * @brief The highest value in this enum.
+        */
+        MaxEnum = PipelineStatistics
+    };
+
+    /**
+     * @brief Converts a query_type to a string.
+     * @return The enum value as a string, or "Invalid query_type value" if the value was not recognized as an enum member.
+    */
+    inline std::string to_string(query_type type);
+
+    /**
+     * @brief The result of a single query_type::PipelineStatistics query.
+     * QueryPool::getResults() and CommandList::copyQueryResults() write the counters in the order in which they're declared.
+    */
+    struct pipeline_statistics
+    {
+        uint64_t inputAssemblyVertices;
+        uint64_t inputAssemblyPrimitives;
+        uint64_t vertexShaderInvocations;
+        uint64_t geometryShaderInvocations;
+        uint64_t geometryShaderPrimitives;
+        uint64_t clippingInvocations;
+        uint64_t clippingPrimitives;
+        uint64_t fragmentShaderInvocations;
+        uint64_t tessellationControlShaderPatches;
+        uint64_t tessellationEvaluationShaderInvocations;
+        uint64_t computeShaderInvocations;
+    };
+
+    /**
+     * @brief The number of uint64_t values that a single query of the given type produces.
+     * @return 1 for query_type::Timestamp and query_type::Occlusion, the number of counters in pipeline_statistics for query_type::PipelineStatistics, or 0 if type isn't a valid enum value.
+    */
+    constexpr uint32_t queryResultCount(query_type type) noexcept;
+
+    /**
+     * @brief Describes how a QueryPool should be created.
+    */
+    struct query_pool_desc
+    {
+        /**
+         * @brief The type of queries in the pool.
+         *
+         * @note Valid usage (ErrorInvalidUsage): type **must** be less than or equal to query_type::MaxEnum.
+        */
+        query_type type;
+
+        /**
+         * @brief The number of queries in the pool.
+         *
+         * @note Valid usage (ErrorInvalidUsage): count **must** be more than 0.
+        */
+        uint32_t count;
+    };
+
+    /**
+     * @brief QueryPool holds a fixed number of queries which are written by CommandLists and whose results can be read back on the CPU.
+    */
+    class QueryPool
+    {
+        friend class Device;
+        friend class CommandList;
+
+    public:
+        using native_query_pool = void;
+
+        /**
+         * @brief Get the desc that the QueryPool was created with.
+        */
+        [[nodiscard]] query_pool_desc getDesc() const;
+
+        /**
+         * @brief Gets the native QueryPool pointer, which depending on the llri::getImplementation() is a pointer to the following:
+         *
+         * DirectX12: ID3D12QueryHeap*
+         * Vulkan: VkQueryPool
+         * Null: an internal object that holds the query results
+         * CPU: an internal object that holds the query results
+         */
+        [[nodiscard]] native_query_pool* getNative() const;
+
+        /**
+         * @brief Copy the results of a range of queries into results, without waiting for the queries to complete.
+         *
+         * @param first The index of the first query in the range.
+         * @param count The number of queries in the range.
+         * @param results A pointer to an array of at least count * queryResultCount(desc.type) uint64_t values, which receives the results.
+         *
+         * @note Valid usage (ErrorInvalidUsage): results **must** be a valid non-null pointer to an array of at least count * queryResultCount(desc.type) values.
+         * @note Valid usage (ErrorInvalidUsage): count **must** be more than 0.
+         * @note Valid usage (ErrorInvalidUsage): first + count **must** be less than or equal to query_pool_desc::count.
+         *
+         * @note DirectX12 has no way to check if a query has completed, so implementations **may** return Success for queries that are still in flight. The results of a range of queries **should** thus only be read after the CommandList that wrote them is known to have completed, for example by waiting on the Fence of its submission or by using query_pool_ring.
+         *
+         * @return Success upon correct execution of the operation, if all queries in the range have completed.
+         * @return NotReady if one or more of the queries in the range have not completed yet. The contents of results are undefined in this case.
+         * @return Implementation defined result values: ErrorDeviceLost.
+        */
+        result getResults(uint32_t first, uint32_t count, uint64_t* results);
+
+    private:
+        // Force private constructor/deconstructor so that only create/destroy can manage lifetime
+        QueryPool() = default;
+        ~QueryPool() = default;
+
+        native_query_pool* m_ptr = nullptr;
+        query_pool_desc m_desc;
+
+        void* m_deviceHandle = nullptr;
+        void* m_deviceFunctionTable = nullptr;
+
+        // used by implementations that resolve query results into a separate buffer
+        void* m_readback = nullptr;
+        void* m_readbackData = nullptr;
+
+        void* m_validationCallbackMessenger = nullptr;
+        validation_level m_validationLevel = validation_level::Full;
+        detail::message_target m_messageTarget;
+
+        result impl_getResults(uint32_t first, uint32_t count, uint64_t* results);
+    };
+
+    /**
+     * @brief Utility that cycles through one QueryPool per frame in flight so that query results can be read back without stalling the CPU or the GPU.
+     *
+     * Every frame, queries are recorded into current(). Once the frame that used oldest() has completed (which in a typical frame loop is guaranteed by waiting on that frame's Fence before recording into it again),
+     * the results can be read through oldest()->getResults() before the ring is advanced and oldest() is reused.
+    */
+    class query_pool_ring
+    {
+    public:
+        query_pool_ring() = default;
+        query_pool_ring(const query_pool_ring&) = delete;
+        query_pool_ring& operator=(const query_pool_ring&) = delete;
+        ~query_pool_ring() { destroy(); }
+
+        /**
+         * @brief Create numFrames QueryPools on device, each created with desc.
+         *
+         * @note Valid usage (ErrorInvalidUsage): device **must** be a valid non-null pointer to a Device.
+         * @note Valid usage (ErrorInvalidUsage): numFrames **must** be more than 0.
+         *
+         * @return Success upon correct execution of the operation.
+         * @return All possible result values from Device::createQueryPool().
+        */
+        result create(Device* device, const query_pool_desc& desc, uint32_t numFrames);
+
+        /**
+         * @brief Destroy all QueryPools in the ring. Safe to call on a ring that was never created.
+        */
+        void destroy();
+
+        /**
+         * @brief The QueryPool that queries for the current frame **should** be recorded into, or nullptr if the ring wasn't created.
+        */
+        [[nodiscard]] QueryPool* current() const { return m_pools.empty() ? nullptr : m_pools[m_frame % m_pools.size()]; }
+
+        /**
+         * @brief The QueryPool that was used the longest ago, which becomes current() after the next call to advance().
+         * @return The pool, or nullptr if the ring hasn't cycled through every pool yet and oldest() thus doesn't hold any results.
+        */
+        [[nodiscard]] QueryPool* oldest() const;
+
+        /**
+         * @brief Move on to the next frame.
+        */
+        void advance() { m_frame++; }
+
+        /**
+         * @brief The number of times that advance() has been called since creation.
+        */
+        [[nodiscard]] uint64_t frame() const { return m_frame; }
+
+    private:
+        Device* m_device = nullptr;
+        std::vector<QueryPool*> m_pools;
+        uint64_t m_frame = 0;
+    };
+}
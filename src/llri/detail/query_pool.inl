@@ -0,0 +1,102 @@
+/**
+ * @file query_pool.inl
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+#include <llri/llri.hpp> // unnecessary but helps intellisense
+
+namespace llri
+{
+    inline std::string to_string(query_type type)
+    {
+        switch (type)
+        {
+            case query_type::Timestamp:
+                return "Timestamp";
+            case query_type::Occlusion:
+                return "Occlusion";
+            case query_type::PipelineStatistics:
+                return "PipelineStatistics";
+        }
+
+        return "Invalid query_type value";
+    }
+
+    constexpr uint32_t queryResultCount(query_type type) noexcept
+    {
+        switch (type)
+        {
+            case query_type::Timestamp:
+            case query_type::Occlusion:
+                return 1;
+            case query_type::PipelineStatistics:
+                return sizeof(pipeline_statistics) / sizeof(uint64_t);
+        }
+
+        return 0;
+    }
+
+    inline query_pool_desc QueryPool::getDesc() const
+    {
+        return m_desc;
+    }
+
+    inline QueryPool::native_query_pool* QueryPool::getNative() const
+    {
+        return m_ptr;
+    }
+
+    inline result QueryPool::getResults(uint32_t first, uint32_t count, uint64_t* results)
+    {
+        LLRI_DETAIL_VALIDATION_BASIC(m_validationLevel)
+        {
+            LLRI_DETAIL_VALIDATION_REQUIRE(results != nullptr, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(count > 0, result::ErrorInvalidUsage)
+            LLRI_DETAIL_VALIDATION_REQUIRE(static_cast<uint64_t>(first) + count <= m_desc.count, result::ErrorInvalidUsage)
+        }
+
+        LLRI_DETAIL_CALL_IMPL(impl_getResults(first, count, results), m_validationCallbackMessenger)
+    }
+
+    inline result query_pool_ring::create(Device* device, const query_pool_desc& desc, uint32_t numFrames)
+    {
+        if (device == nullptr || numFrames == 0)
+            return result::ErrorInvalidUsage;
+
+        destroy();
+
+        m_device = device;
+        m_pools.resize(numFrames, nullptr);
+        for (auto& pool : m_pools)
+        {
+            const result r = device->createQueryPool(desc, &pool);
+            if (r != result::Success)
+            {
+                destroy();
+                return r;
+            }
+        }
+
+        return result::Success;
+    }
+
+    inline void query_pool_ring::destroy()
+    {
+        for (QueryPool* pool : m_pools)
+            m_device->destroyQueryPool(pool);
+
+        m_pools.clear();
+        m_device = nullptr;
+        m_frame = 0;
+    }
+
+    inline QueryPool* query_pool_ring::oldest() const
+    {
+        if (m_pools.empty() || m_frame + 1 < m_pools.size())
+            return nullptr;
+
+        return m_pools[(m_frame + 1) % m_pools.size()];
+    }
+}
@@ -183,6 +183,8 @@ namespace llri
          *
          * DirectX12: ID3D12CommandQueue*
          * Vulkan: VkQueue
+         * Null: an internal object that holds the Queue's simulated timeline
+         * CPU: an internal object that executes the Queue's submissions on a worker thread
          *
          * @param index The index of the device node to get the queue of. The function returns nullptr if the index exceeds the number of nodes in the device.
          */
@@ -218,8 +220,154 @@ namespace llri
         Device* m_device = nullptr;
 
         void* m_validationCallbackMessenger = nullptr;
+        validation_level m_validationLevel = validation_level::Full;
+        detail::message_target m_messageTarget;
+        detail::device_statistics_recorder* m_statistics = nullptr;
 
         result impl_submit(const submit_desc& desc);
         result impl_waitIdle();
     };
+
+    /**
+     * @brief Determines how a queue_pool selects the Queue for each submission.
+    */
+    enum struct queue_pool_policy : uint8_t
+    {
+        /**
+         * @brief Submissions cycle through the Queues in order.
+        */
+        RoundRobin,
+        /**
+         * @brief Each submission goes to the Queue with the fewest CommandLists that haven't completed yet. Ties are resolved in favour of the Queue with the lowest index.
+        */
+        LeastLoaded,
+        /**
+         * @brief The highest value in this enum.
+        */
+        MaxEnum = LeastLoaded
+    };
+
+    /**
+     * @brief Converts a queue_pool_policy to a string.
+     * @return The enum value as a string, or "Invalid queue_pool_policy value" if the value was not recognized as an enum member.
+    */
+    inline std::string to_string(queue_pool_policy policy);
+
+    /**
+     * @brief Identifies a submission that was made through queue_pool::submit().
+    */
+    struct queue_pool_ticket
+    {
+        /**
+         * @brief The index of the Queue that the submission was made to, as used in Device::getQueue().
+        */
+        uint8_t queueIndex = std::numeric_limits<uint8_t>::max();
+        /**
+         * @brief The number of submissions that were made to the Queue through the pool up to and including this submission.
+        */
+        uint64_t value = 0;
+    };
+
+    /**
+     * @brief Utility that spreads submissions over all of a Device's Queues of a single queue_type, for example to keep multiple transfer queues busy in parallel.
+     *
+     * The pool signals one of its own Fences with every submission, which it uses to track which submissions have completed.
+     *
+     * @note queue_pool is not thread-safe.
+    */
+    class queue_pool
+    {
+    public:
+        queue_pool() = default;
+        queue_pool(const queue_pool&) = delete;
+        queue_pool& operator=(const queue_pool&) = delete;
+        ~queue_pool() { destroy(); }
+
+        /**
+         * @brief Prepare the pool for submitting to all Queues of type on device.
+         *
+         * @note Valid usage (ErrorInvalidUsage): device **must** be a valid non-null pointer to a Device.
+         * @note Valid usage (ErrorInvalidUsage): type **must not** be more than queue_type::MaxEnum, and device **must** have at least one Queue of type.
+         * @note Valid usage (ErrorInvalidUsage): policy **must not** be more than queue_pool_policy::MaxEnum.
+         *
+         * @return Success upon correct execution of the operation.
+        */
+        result create(Device* device, queue_type type, queue_pool_policy policy);
+
+        /**
+         * @brief Wait for all submissions to complete and destroy the pool's Fences. Calling destroy() on a pool that wasn't created has no effect.
+        */
+        void destroy();
+
+        /**
+         * @brief Submit to the Queue that the pool's queue_pool_policy selects.
+         *
+         * @param desc Describes the submission, refer to Queue::submit() for its usage.
+         * @param ticket If not nullptr, receives a ticket that identifies the submission in isComplete() and wait().
+         *
+         * @note Valid usage (ErrorInvalidUsage): desc.fence **must** be nullptr, because the pool signals its own Fence. Completion is queried through isComplete() and wait() instead.
+         *
+         * @return Success upon correct execution of the operation.
+         * @return Device::createFence() and Queue::submit() defined result values.
+        */
+        result submit(const submit_desc& desc, queue_pool_ticket* ticket = nullptr);
+
+        /**
+         * @brief Check, without blocking, if the submission that ticket identifies has completed.
+         *
+         * @return True if the submission has completed, or if ticket doesn't identify a submission of this pool.
+        */
+        [[nodiscard]] bool isComplete(const queue_pool_ticket& ticket);
+
+        /**
+         * @brief Block the CPU thread until the submission that ticket identifies, and all earlier submissions to the same Queue, have completed.
+         *
+         * @return Success upon correct execution of the operation.
+         * @return Device::waitFences() defined result values.
+        */
+        result wait(const queue_pool_ticket& ticket);
+
+        /**
+         * @brief Block the CPU thread until all submissions made through the pool have completed.
+         *
+         * @return Success upon correct execution of the operation.
+         * @return Device::waitFences() defined result values.
+        */
+        result waitIdle();
+
+        /**
+         * @brief The number of Queues that the pool submits to, or 0 if the pool wasn't created.
+        */
+        [[nodiscard]] uint8_t queryQueueCount() const { return static_cast<uint8_t>(m_queues.size()); }
+
+        /**
+         * @brief The number of CommandLists that were submitted to the Queue at index and haven't completed yet.
+        */
+        [[nodiscard]] uint32_t queryLoad(uint8_t index);
+
+    private:
+        struct in_flight
+        {
+            Fence* fence;
+            uint64_t value;
+            uint32_t numCommandLists;
+        };
+
+        struct pooled_queue
+        {
+            Queue* queue;
+            uint64_t submitted;
+            uint64_t completed;
+            uint32_t load;
+            std::vector<in_flight> pending;
+        };
+
+        result poll(pooled_queue& queue, uint64_t waitValue);
+
+        Device* m_device = nullptr;
+        queue_pool_policy m_policy = queue_pool_policy::RoundRobin;
+        std::vector<pooled_queue> m_queues;
+        size_t m_next = 0;
+        std::vector<Fence*> m_freeFences;
+    };
 }
@@ -0,0 +1,324 @@
+/**
+ * @file render_graph.hpp
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+#include <llri/graph.hpp> // unnecessary but helps intellisense
+
+namespace llri
+{
+    class render_graph;
+
+    /**
+     * @brief Identifies a resource that was declared in a render_graph through render_graph::importResource() or render_graph::createTransient().
+     *
+     * Handles are only valid in the render_graph that returned them, until render_graph::reset() is called.
+    */
+    struct render_graph_resource
+    {
+        uint32_t index = std::numeric_limits<uint32_t>::max();
+
+        [[nodiscard]] bool valid() const { return index != std::numeric_limits<uint32_t>::max(); }
+
+        bool operator==(const render_graph_resource& other) const { return index == other.index; }
+        bool operator!=(const render_graph_resource& other) const { return index != other.index; }
+    };
+
+    /**
+     * @brief Describes how a render_graph uses its Device.
+    */
+    struct render_graph_desc
+    {
+        /**
+         * @brief The device node that the graph's CommandLists, transient resources and submits use. Passing 0 is the equivalent of passing 1.
+         *
+         * @note Valid usage (ErrorInvalidNodeMask): Exactly one bit **must** be set, and that bit **must** be less than 1 << Adapter::queryNodeCount().
+        */
+        uint32_t nodeMask;
+
+        /**
+         * @brief If true, passes added with queue_type::Compute are executed on the Device's first Compute queue, if the Device has one.
+         * Otherwise, they're executed on the Graphics queue.
+        */
+        bool asyncCompute;
+        /**
+         * @brief If true, passes added with queue_type::Transfer are executed on the Device's first Transfer queue, if the Device has one.
+         * Otherwise, they're executed on the Graphics queue.
+         *
+         * Resources **must** be in resource_state::General to be used on a Transfer queue, so every resource that such a pass reads or writes is transitioned to resource_state::General instead of the state the pass declared.
+        */
+        bool asyncTransfer;
+    };
+
+    /**
+     * @brief Describes a batch of passes that a compiled render_graph records into a single CommandList and submits to a single Queue.
+    */
+    struct render_graph_batch
+    {
+        /**
+         * @brief The type of Queue that the batch is submitted to.
+        */
+        queue_type queue;
+        /**
+         * @brief The passes in the batch, in the order in which they're recorded. Passes are identified by the order in which they were added, starting at 0.
+        */
+        std::vector<uint32_t> passes;
+        /**
+         * @brief The number of resource barriers that the batch records.
+        */
+        uint32_t numBarriers;
+        /**
+         * @brief The number of Semaphores that the batch waits on before it executes.
+        */
+        uint32_t numWaitSemaphores;
+        /**
+         * @brief The number of Semaphores that the batch signals after it executes.
+        */
+        uint32_t numSignalSemaphores;
+    };
+
+    /**
+     * @brief Declares the resources that a pass reads and writes. Returned by render_graph::addPass().
+    */
+    class render_graph_pass
+    {
+        friend class render_graph;
+
+    public:
+        /**
+         * @brief Declare that the pass reads from resource in state.
+         *
+         * @note Valid usage (ErrorInvalidUsage): resource **must** be a valid handle that was returned by the same render_graph.
+         * @note Valid usage (ErrorInvalidUsage): state **must not** be more than resource_state::MaxEnum.
+         * @note Valid usage (ErrorInvalidState): the resource **must** meet the requirements of state, as described in resource_state.
+         * @note Valid usage (ErrorInvalidUsage): if the pass uses the resource more than once, it **must** use it in the same state.
+         *
+         * Usage errors are returned by render_graph::compile().
+        */
+        render_graph_pass& read(render_graph_resource resource, resource_state state);
+
+        /**
+         * @brief Declare that the pass writes to resource in state.
+         *
+         * Valid usage is the same as that of read().
+        */
+        render_graph_pass& write(render_graph_resource resource, resource_state state);
+
+    private:
+        render_graph_pass(render_graph* graph, uint32_t index) : m_graph(graph), m_index(index) { }
+
+        render_graph_pass& access(render_graph_resource resource, resource_state state, bool write);
+
+        render_graph* m_graph;
+        uint32_t m_index;
+    };
+
+    /**
+     * @brief A render_graph executes a set of declared passes and derives everything that is needed to execute them correctly from the resources that the passes read and write:
+     *
+     * - Passes are ordered topologically. Independent passes that run on the same queue are grouped together to reduce the number of submits.
+     * - Resource barriers are derived from the states that the passes declare, and recorded in a single CommandList::resourceBarrier() call before each pass.
+     * - Transient resources are placed in a single MemoryHeap, and transient resources whose lifetimes don't overlap share their memory.
+     * - Compute and transfer passes **may** run on separate queues (see render_graph_desc), synchronized through Semaphores. The ownership of resource_sharing_mode::Exclusive resources is transferred between the queues with resource_barrier::release() and resource_barrier::acquire().
+     *
+     * The graph is declared again every frame, after reset(). compile() compares the declared passes and resources with those of the previous compilation and only recompiles if their shape changed.
+     * The shape consists of the passes' queue types, the resources they use and the states they use them in, the transient resources' descs, and the states and sharing modes of the imported resources. The imported Resource pointers and the pass functions are not part of the shape, so they can change every frame.
+     *
+     * The graph executes one frame at a time: execute() waits until the previous execution has completed before it records the next one.
+     *
+     * @note render_graph is not thread-safe.
+    */
+    class render_graph
+    {
+        friend class render_graph_pass;
+
+    public:
+        render_graph() = default;
+        render_graph(const render_graph&) = delete;
+        render_graph& operator=(const render_graph&) = delete;
+        ~render_graph() { destroy(); }
+
+        /**
+         * @brief Create the graph's Device objects.
+         *
+         * @note Valid usage (ErrorInvalidUsage): device **must** be a valid non-null pointer to a Device.
+         * @note Valid usage (ErrorFeatureNotSupported): device **must** have been created with at least one queue_type::Graphics Queue.
+         *
+         * @return Success upon correct execution of the operation.
+         * @return Device::createFence() defined result values.
+        */
+        result create(Device* device, const render_graph_desc& desc);
+
+        /**
+         * @brief Wait for the graph's last execution to complete and destroy all of the objects that the graph created. Calling destroy() on a graph that wasn't created has no effect.
+        */
+        void destroy();
+
+        /**
+         * @brief Remove all declared passes and resources, so that the graph can be declared again for the next frame. The compiled graph is kept until compile() finds that the graph's shape changed.
+        */
+        void reset();
+
+        /**
+         * @brief Declare a Resource that the graph doesn't own.
+         *
+         * @param resource The resource. If resource is nullptr, the returned handle is invalid.
+         * @param state The state that resource is in when execute() is called. The graph returns resource to this state at the end of each execution.
+         *
+         * @note Valid usage: If resource was created with resource_sharing_mode::Exclusive, it **must** be owned by queue_type::Graphics when execute() is called. The graph transfers its ownership to the queues of the passes that use it, and back to queue_type::Graphics at the end of the execution.
+        */
+        render_graph_resource importResource(Resource* resource, resource_state state);
+
+        /**
+         * @brief Declare a resource that is owned by the graph and only lives for the duration of an execution. Its contents are undefined at the start of each execution.
+         *
+         * The resource is created in the graph's MemoryHeap upon compilation, with the node masks of render_graph_desc::nodeMask and resource_sharing_mode::Exclusive. Its initialState is chosen by the graph.
+         *
+         * @note Valid usage (ErrorInvalidUsage): desc.memoryType **must** be memory_type::Local.
+         * @note Valid usage: desc **must** meet the valid usage of Device::createPlacedResource(), whose errors are returned by compile().
+        */
+        render_graph_resource createTransient(const resource_desc& desc);
+
+        /**
+         * @brief Add a pass to the graph. The pass's reads and writes are declared through the returned render_graph_pass.
+         *
+         * @param name The name of the pass, which is only used for debugging purposes.
+         * @param type The type of queue that the pass's commands require.
+         * @param record The function that records the pass's commands. It's called during execute(), with the pass's CommandList. Resource barriers **should not** be recorded for the resources that the pass declared.
+         *
+         * @note Valid usage (ErrorInvalidUsage): type **must not** be more than queue_type::MaxEnum.
+        */
+        render_graph_pass addPass(std::string name, queue_type type, std::function<void(CommandList*)> record);
+
+        /**
+         * @brief Compile the graph if its shape changed since the last compilation. If the shape changed, compile() waits for the previous execution to complete, and destroys and recreates the graph's transient resources.
+         *
+         * execute() calls compile() itself, but the graph **can** be compiled ahead of time, for example to create the transient resources before their first use.
+         *
+         * @return Success upon correct execution of the operation.
+         * @return ErrorInvalidUsage or ErrorInvalidState if the declared passes or resources don't meet their valid usage.
+         * @return Device::createMemoryHeap(), Device::createPlacedResource(), Device::createSemaphore(), Device::createCommandGroup() and CommandGroup::allocate() defined result values.
+        */
+        result compile();
+
+        /**
+         * @brief Compile the graph, wait for the previous execution to complete, record every pass and submit the batches to their queues.
+         *
+         * @return Success upon correct execution of the operation.
+         * @return compile() defined result values.
+         * @return CommandList and Queue::submit() defined result values.
+        */
+        result execute();
+
+        /**
+         * @brief Block the CPU thread until the graph's last execution has completed. Returns immediately if the graph isn't executing.
+         *
+         * @return Success upon correct execution of the operation.
+         * @return Device::waitFence() defined result values.
+        */
+        result wait();
+
+        /**
+         * @brief Get the Resource that a handle refers to. Transient resources are only available after compile(), so this function is typically called from within a pass's record function.
+         * @return The Resource, or nullptr if the handle is invalid or if the transient resource hasn't been created.
+        */
+        [[nodiscard]] Resource* getResource(render_graph_resource resource) const;
+
+        /**
+         * @brief Query the batches of the compiled graph, in the order in which they're submitted.
+        */
+        [[nodiscard]] std::vector<render_graph_batch> queryBatches() const;
+
+        /**
+         * @brief Query the size in bytes of the MemoryHeap in which the transient resources are placed.
+        */
+        [[nodiscard]] uint64_t queryTransientMemorySize() const { return m_heapSize; }
+
+        /**
+         * @brief Query how often the graph was compiled, which **can** be used to verify that the graph's shape is stable between frames.
+        */
+        [[nodiscard]] uint32_t queryCompileCount() const { return m_compileCount; }
+
+    private:
+        struct resource_access
+        {
+            uint32_t resource;
+            resource_state state;
+            bool write;
+        };
+
+        struct pass
+        {
+            std::string name;
+            queue_type type;
+            std::function<void(CommandList*)> record;
+            std::vector<resource_access> accesses;
+        };
+
+        struct declared_resource
+        {
+            Resource* imported;
+            resource_state state;
+            resource_desc desc;
+        };
+
+        struct barrier
+        {
+            resource_barrier_type type;
+            uint32_t resource;
+            uint32_t before;
+            resource_state oldState;
+            resource_state newState;
+            queue_type srcQueue = queue_type::Graphics;
+            queue_type dstQueue = queue_type::Graphics;
+        };
+
+        struct batch
+        {
+            queue_type queue;
+            std::vector<uint32_t> passes;
+            // barriers[i] is recorded before passes[i], release is recorded after the last pass
+            std::vector<std::vector<barrier>> barriers;
+            std::vector<barrier> release;
+            std::vector<Semaphore*> waitSemaphores;
+            std::vector<Semaphore*> signalSemaphores;
+            CommandList* commandList;
+        };
+
+        static constexpr uint32_t noIndex = std::numeric_limits<uint32_t>::max();
+
+        result validate() const;
+        [[nodiscard]] bool matchesCompiledShape() const;
+        [[nodiscard]] queue_type queueFor(queue_type type) const;
+        [[nodiscard]] resource_state effectiveState(const pass& p, const resource_access& access) const;
+        [[nodiscard]] const resource_desc& describeResource(uint32_t resource) const;
+        void releaseCompiled();
+
+        Device* m_device = nullptr;
+        render_graph_desc m_desc {};
+        std::array<Queue*, static_cast<size_t>(queue_type::MaxEnum) + 1> m_queues {};
+        Fence* m_fence = nullptr;
+        bool m_inFlight = false;
+
+        // declarations of the current frame
+        std::vector<pass> m_passes;
+        std::vector<declared_resource> m_resources;
+
+        // the shape that the graph was compiled for
+        bool m_compiled = false;
+        std::vector<pass> m_compiledPasses;
+        std::vector<declared_resource> m_compiledResources;
+        uint32_t m_compileCount = 0;
+
+        // objects created by compile()
+        MemoryHeap* m_heap = nullptr;
+        uint64_t m_heapSize = 0;
+        std::vector<Resource*> m_transients;
+        std::vector<batch> m_batches;
+        std::vector<Semaphore*> m_semaphores;
+        std::array<CommandGroup*, static_cast<size_t>(queue_type::MaxEnum) + 1> m_commandGroups {};
+        std::vector<resource_barrier> m_scratchBarriers;
+    };
+}
@@ -9,6 +9,8 @@
 
 namespace llri
 {
+    enum struct external_memory_handle_type_ext : uint8_t;
+
     /**
      * @brief Describes a range of subresources of a texture.
      */
@@ -77,7 +79,7 @@ namespace llri
         /**
          * @brief All types of device access are allowed in this state, but it is not as optimal as more explicit states.
          *
-         * A resource **must** be in this state if it wishes to be used by a Transfer Queue.
+         * A resource **must** be in this state if it wishes to be used by a Transfer Queue. The exception are resources in memory_type::Upload, which stay in resource_state::Upload and **may** be copied from on a Transfer Queue in that state.
         */
         General,
         /**
@@ -318,6 +320,12 @@ namespace llri
         return f >= format::FirstStencilFormat && f <= format::LastDepthStencilFormat;
     }
 
+    /**
+     * @brief The size of a single texel of the format in bytes. This is the size that a texel takes up in a buffer when a texture is copied to or from it.
+     * @return The texel size in bytes, or 0 for format::Undefined and values that are not recognized as an enum member.
+    */
+    inline uint32_t format_size(format f);
+
     /**
      * @brief Converts a format to a string.
      * @return The enum value as a string, or "Invalid format value" if the value was not recognized as an enum member.
@@ -447,6 +455,41 @@ namespace llri
     */
     std::string to_string(memory_type type);
 
+    /**
+     * @brief Determines whether a resource can be accessed by Queues of different queue_types without transferring its ownership.
+    */
+    enum struct resource_sharing_mode : uint8_t
+    {
+        /**
+         * @brief The resource is owned by a single queue_type at a time. Using it on a Queue of another type requires a resource_barrier::release() on the owning type, followed by a resource_barrier::acquire() on the new type.
+         *
+         * Exclusive resources allow implementations to use optimizations such as compression that concurrent resources may not support.
+         *
+         * A newly created resource is owned by the first queue_type that its Device was created with Queues of, in the order Graphics, Compute, Transfer, because that's where implementations set up its initial state.
+         * Resources that are first used by another queue_type **should** be released from that initial owner. Otherwise their contents are undefined on the new type.
+         *
+         * Vulkan: Textures are transitioned to their initialState on a Queue of the initial owner.
+         * DirectX: Queues don't own resources, so ownership transfers have no effect beyond the Semaphore that orders them.
+        */
+        Exclusive,
+        /**
+         * @brief The resource can be accessed by Queues of all types without ownership transfers, although accesses **must** still be synchronized through Semaphores.
+         *
+         * Concurrent access **may** disable implementation optimizations and thus **should** only be used for resources that switch queue_types frequently.
+        */
+        Concurrent,
+        /**
+         * @brief The highest value in this enum.
+        */
+        MaxEnum = Concurrent
+    };
+
+    /**
+     * @brief Converts a resource_sharing_mode to a string.
+     * @return The enum value as a string, or "Invalid resource_sharing_mode value" if the value was not recognized as an enum member.
+    */
+    std::string to_string(resource_sharing_mode mode);
+
     /**
      * @brief Resource description to be used in Device::createResource().
     */
@@ -557,16 +600,38 @@ namespace llri
         */
         format textureFormat;
 
+        /**
+         * @brief Whether Queues of different queue_types can access the resource without ownership transfers.
+         *
+         * @note Valid usage (ErrorInvalidUsage): sharingMode **must** be a valid resource_sharing_mode enum value.
+        */
+        resource_sharing_mode sharingMode;
+
         /**
          * @brief Convenience function for creating a buffer resource_desc.
         */
-        static constexpr resource_desc buffer(resource_usage_flags usage, memory_type memoryType, resource_state initialState, uint32_t sizeInBytes, uint32_t createNodeMask = 0, uint32_t visibleNodeMask = 0) noexcept;
+        static constexpr resource_desc buffer(resource_usage_flags usage, memory_type memoryType, resource_state initialState, uint32_t sizeInBytes, uint32_t createNodeMask = 0, uint32_t visibleNodeMask = 0, resource_sharing_mode sharingMode = resource_sharing_mode::Exclusive) noexcept;
     };
 
+    class MemoryHeap;
+
+    namespace detail
+    {
+        /**
+         * @brief The fields of a Resource that barriers and copies read for every Resource they record, stored contiguously per Device in the Resource pool instead of in the Resource itself.
+        */
+        struct resource_hot_fields
+        {
+            void* resource;
+            void* memory;
+        };
+    }
+
     class Resource
     {
         friend class Device;
         friend class CommandList;
+        template<typename, typename> friend class detail::object_pool;
 
     public:
         using native_resource = void;
@@ -582,6 +647,8 @@ namespace llri
          *
          * DirectX12: ID3D12Resource*
          * Vulkan: VkImage OR VkBuffer depending on getDesc()::type
+         * Null: nullptr
+         * CPU: nullptr
          */
         [[nodiscard]] native_resource* getNative() const;
         
@@ -590,16 +657,322 @@ namespace llri
          *
          * DirectX12: nullptr
          * Vulkan: VkDeviceMemory
+         * Null: the host memory of memory_type::Upload and memory_type::Read buffers, nullptr otherwise
+         * CPU: the host memory that holds the Resource's data
+         *
+         * For resources that were placed in a MemoryHeap, Vulkan returns the heap's VkDeviceMemory, and Null and CPU return a pointer to the Resource's offset in the heap's host memory.
+         * For resources that were created through Device::importHostMemoryEXT(), DirectX12 returns the ID3D12Heap* that wraps the host memory, Vulkan returns the imported VkDeviceMemory, and Null and CPU return the imported host memory.
          */
         [[nodiscard]] native_memory* getNativeMemory() const;
+
+        /**
+         * @brief Get the Resource's generational handle, which can be resolved through Device::resolve() and is safe to hold on to after the Resource is destroyed.
+        */
+        [[nodiscard]] handle<Resource> getHandle() const;
+
+        /**
+         * @brief Get the MemoryHeap that the Resource was placed in.
+         * @return The MemoryHeap that was passed to Device::createPlacedResource(), or nullptr if the Resource was created through Device::createResource() and thus owns its memory.
+        */
+        [[nodiscard]] MemoryHeap* getHeap() const;
+
+        /**
+         * @brief Get the offset in bytes at which the Resource was placed in its MemoryHeap, or 0 if getHeap() returns nullptr.
+        */
+        [[nodiscard]] uint64_t getHeapOffset() const;
     private:
         // Force private constructor/deconstructor so that only create/destroy can manage lifetime
         Resource() = default;
         ~Resource() = default;
 
+        handle<Resource> m_handle;
+        // the native resource and memory, in the Device's array of hot fields
+        detail::resource_hot_fields* m_hot = nullptr;
         resource_desc m_desc;
         
-        native_memory* m_memory = nullptr;
-        native_resource* m_resource = nullptr;
+        uint64_t m_allocationSize = 0;
+        void* m_mapped = nullptr;
+
+        MemoryHeap* m_heap = nullptr;
+        uint64_t m_heapOffset = 0;
+
+        // imported memory is owned by the application, so it isn't freed when the Resource is destroyed
+        bool m_imported = false;
+
+        // set for resources created through Device::createExportableResourceEXT()
+        bool m_exportable = false;
+        external_memory_handle_type_ext m_externalHandleType {};
     };
+
+    namespace detail
+    {
+        /**
+         * @brief Returns the bit that represents the resource_type in a resource_type bitmask.
+        */
+        constexpr uint8_t resourceTypeBit(resource_type type) noexcept
+        {
+            return static_cast<uint8_t>(1u << static_cast<uint8_t>(type));
+        }
+
+        /**
+         * @brief Returns the size in texels of a mip level of a texture. The depth of textures that aren't resource_type::Texture3D is 1, because their depthOrArrayLayers describes array layers.
+         * @note mipLevel **must** be less than desc.mipLevels.
+        */
+        inline extent_3d mipExtent(const resource_desc& desc, uint32_t mipLevel) noexcept
+        {
+            return extent_3d {
+                std::max(desc.width >> mipLevel, 1u),
+                std::max(desc.height >> mipLevel, 1u),
+                desc.type == resource_type::Texture3D ? std::max(static_cast<uint32_t>(desc.depthOrArrayLayers) >> mipLevel, 1u) : 1u
+            };
+        }
+
+        /**
+         * @brief Returns the bit that represents the memory_type in a memory_type bitmask.
+        */
+        constexpr uint8_t memoryTypeBit(memory_type type) noexcept
+        {
+            return static_cast<uint8_t>(1u << static_cast<uint8_t>(type));
+        }
+
+        /**
+         * @brief The conditions that a resource_state places on a Resource that is created in, or transitioned to, that state.
+        */
+        struct resource_state_requirements
+        {
+            /**
+             * @brief A resource_type bitmask of the types that may be in this state.
+            */
+            uint8_t types;
+            /**
+             * @brief A memory_type bitmask of the memory types that may be in this state.
+            */
+            uint8_t memoryTypes;
+            /**
+             * @brief The usage flags that the resource **must** have been created with.
+            */
+            resource_usage_flags requiredUsage;
+            /**
+             * @brief The usage flags that textures **must** have been created with, in addition to requiredUsage.
+            */
+            resource_usage_flags requiredTextureUsage;
+            /**
+             * @brief The usage flags that the resource **must not** have been created with.
+            */
+            resource_usage_flags forbiddenUsage;
+        };
+
+        constexpr uint8_t allBufferTypes = resourceTypeBit(resource_type::Buffer);
+        constexpr uint8_t allTextureTypes = resourceTypeBit(resource_type::Texture1D) | resourceTypeBit(resource_type::Texture2D) | resourceTypeBit(resource_type::Texture3D);
+        constexpr uint8_t allMemoryTypes = memoryTypeBit(memory_type::Local) | memoryTypeBit(memory_type::Upload) | memoryTypeBit(memory_type::Read);
+
+        /**
+         * @brief The requirements of each resource_state, indexed by resource_state. These reflect the valid usage notes on resource_state.
+        */
+        constexpr std::array<resource_state_requirements, static_cast<size_t>(resource_state::MaxEnum) + 1> resourceStateRequirements {{
+            /* General */                        { allBufferTypes | allTextureTypes, allMemoryTypes, resource_usage_flag_bits::None, resource_usage_flag_bits::None, resource_usage_flag_bits::None },
+            /* Upload */                         { allBufferTypes | allTextureTypes, memoryTypeBit(memory_type::Upload), resource_usage_flag_bits::None, resource_usage_flag_bits::None, resource_usage_flag_bits::ShaderWrite },
+            /* ColorAttachment */                { allTextureTypes, allMemoryTypes, resource_usage_flag_bits::ColorAttachment, resource_usage_flag_bits::None, resource_usage_flag_bits::None },
+            /* DepthStencilAttachment */         { allTextureTypes, allMemoryTypes, resource_usage_flag_bits::DepthStencilAttachment, resource_usage_flag_bits::None, resource_usage_flag_bits::None },
+            /* DepthStencilAttachmentReadOnly */ { allTextureTypes, allMemoryTypes, resource_usage_flag_bits::DepthStencilAttachment, resource_usage_flag_bits::None, resource_usage_flag_bits::None },
+            /* ShaderReadOnly */                 { allBufferTypes | allTextureTypes, allMemoryTypes, resource_usage_flag_bits::None, resource_usage_flag_bits::Sampled, resource_usage_flag_bits::None },
+            /* ShaderReadWrite */                { allBufferTypes | allTextureTypes, allMemoryTypes, resource_usage_flag_bits::ShaderWrite, resource_usage_flag_bits::None, resource_usage_flag_bits::None },
+            /* TransferSrc */                    { allBufferTypes | allTextureTypes, allMemoryTypes, resource_usage_flag_bits::TransferSrc, resource_usage_flag_bits::None, resource_usage_flag_bits::None },
+            /* TransferDst */                    { allBufferTypes | allTextureTypes, allMemoryTypes, resource_usage_flag_bits::TransferDst, resource_usage_flag_bits::None, resource_usage_flag_bits::None },
+            /* VertexBuffer */                   { allBufferTypes, allMemoryTypes, resource_usage_flag_bits::None, resource_usage_flag_bits::None, resource_usage_flag_bits::None },
+            /* IndexBuffer */                    { allBufferTypes, allMemoryTypes, resource_usage_flag_bits::None, resource_usage_flag_bits::None, resource_usage_flag_bits::None },
+            /* ConstantBuffer */                 { allBufferTypes, allMemoryTypes, resource_usage_flag_bits::None, resource_usage_flag_bits::None, resource_usage_flag_bits::None }
+        }};
+
+        /**
+         * @brief Returns true if the resource described by desc meets all of the requirements of state.
+         * @note state **must** be less or equal to resource_state::MaxEnum.
+        */
+        constexpr bool meetsStateRequirements(const resource_desc& desc, resource_state state) noexcept
+        {
+            const resource_state_requirements& requirements = resourceStateRequirements[static_cast<size_t>(state)];
+            const bool isTexture = desc.type != resource_type::Buffer;
+
+            return (requirements.types & resourceTypeBit(desc.type)) != 0 &&
+                (requirements.memoryTypes & memoryTypeBit(desc.memoryType)) != 0 &&
+                desc.usage.all(requirements.requiredUsage) &&
+                (!isTexture || desc.usage.all(requirements.requiredTextureUsage)) &&
+                desc.usage.none(requirements.forbiddenUsage);
+        }
+
+        /**
+         * @brief Returns the bit that represents the resource_state in a resource_state bitmask.
+        */
+        constexpr uint16_t resourceStateBit(resource_state state) noexcept
+        {
+            return static_cast<uint16_t>(1u << static_cast<uint8_t>(state));
+        }
+
+        /**
+         * @brief The largest width, height and depthOrArrayLayers that a resource_desc may have.
+        */
+        constexpr uint32_t maxResourceDimension = 16348;
+
+        /**
+         * @brief The conditions that a resource_type places on the other members of a resource_desc. Members that the type doesn't use (e.g. the height of buffers) accept every value.
+        */
+        struct resource_type_requirements
+        {
+            /**
+             * @brief The usage flags that resources of this type may be created with.
+            */
+            resource_usage_flags validUsage;
+            /**
+             * @brief A memory_type bitmask of the memory types that resources of this type may be created in.
+            */
+            uint8_t memoryTypes;
+            /**
+             * @brief A sample_count bitmask of the sample counts that resources of this type may be created with.
+            */
+            uint8_t sampleCounts;
+            uint32_t minHeight;
+            uint32_t maxHeight;
+            uint16_t minDepthOrArrayLayers;
+            uint16_t maxDepthOrArrayLayers;
+            uint16_t minMipLevels;
+        };
+
+        /**
+         * @brief The requirements of each resource_type, indexed by resource_type. These reflect the valid usage notes on resource_desc.
+        */
+        constexpr std::array<resource_type_requirements, static_cast<size_t>(resource_type::MaxEnum) + 1> resourceTypeRequirements {{
+            /* Buffer */    { resource_usage_flag_bits::TransferSrc | resource_usage_flag_bits::TransferDst | resource_usage_flag_bits::ShaderWrite, allMemoryTypes, static_cast<uint8_t>(sample_count::Count1), 0, UINT32_MAX, 0, UINT16_MAX, 0 },
+            /* Texture1D */ { resource_usage_flag_bits::All, memoryTypeBit(memory_type::Local), static_cast<uint8_t>(sample_count::Count1), 1, 1, 1, maxResourceDimension, 1 },
+            /* Texture2D */ { resource_usage_flag_bits::All, memoryTypeBit(memory_type::Local), static_cast<uint8_t>((static_cast<uint8_t>(sample_count::MaxEnum) << 1) - 1), 1, maxResourceDimension, 1, maxResourceDimension, 1 },
+            /* Texture3D */ { resource_usage_flag_bits::All, memoryTypeBit(memory_type::Local), static_cast<uint8_t>(sample_count::Count1), 1, 2048, 1, maxResourceDimension, 1 }
+        }};
+
+        /**
+         * @brief The conditions that a memory_type places on the usage and initial state of a resource_desc.
+        */
+        struct memory_type_requirements
+        {
+            /**
+             * @brief The usage flags that resources in this memory type **must not** have been created with.
+            */
+            resource_usage_flags forbiddenUsage;
+            /**
+             * @brief A resource_state bitmask of the states that resources in this memory type may be created in.
+            */
+            uint16_t initialStates;
+        };
+
+        constexpr resource_usage_flags hostVisibleForbiddenUsage = resource_usage_flag_bits::ShaderWrite | resource_usage_flag_bits::ColorAttachment | resource_usage_flag_bits::DepthStencilAttachment | resource_usage_flag_bits::DenyShaderResource;
+
+        /**
+         * @brief The requirements of each memory_type, indexed by memory_type. These reflect the valid usage notes on memory_type.
+        */
+        constexpr std::array<memory_type_requirements, static_cast<size_t>(memory_type::MaxEnum) + 1> memoryTypeRequirements {{
+            /* Local */  { resource_usage_flag_bits::None, UINT16_MAX },
+            /* Upload */ { hostVisibleForbiddenUsage, resourceStateBit(resource_state::Upload) },
+            /* Read */   { hostVisibleForbiddenUsage, resourceStateBit(resource_state::TransferDst) }
+        }};
+
+        /**
+         * @brief The only usage flags that a resource with resource_usage_flag_bits::DenyShaderResource may have.
+        */
+        constexpr resource_usage_flags denyShaderResourceValidUsage = resource_usage_flag_bits::DenyShaderResource | resource_usage_flag_bits::DepthStencilAttachment |
+            resource_usage_flag_bits::TransferSrc | resource_usage_flag_bits::TransferDst;
+
+        /**
+         * @brief The usage flags that a resource_desc may and must have for a combination of resource_type, memory_type and resource_state.
+         * Combinations that are invalid regardless of usage allow no usage flags and require all of them, which no resource_desc can meet.
+        */
+        struct resource_usage_requirements
+        {
+            resource_usage_flags allowedUsage;
+            resource_usage_flags requiredUsage;
+        };
+
+        constexpr size_t resourceUsageRequirementsIndex(resource_type type, memory_type memoryType, resource_state state) noexcept
+        {
+            return (static_cast<size_t>(type) * (static_cast<size_t>(memory_type::MaxEnum) + 1) + static_cast<size_t>(memoryType)) * (static_cast<size_t>(resource_state::MaxEnum) + 1) + static_cast<size_t>(state);
+        }
+
+        constexpr size_t resourceUsageRequirementsCount = resourceUsageRequirementsIndex(resource_type::MaxEnum, memory_type::MaxEnum, resource_state::MaxEnum) + 1;
+
+        /**
+         * @brief Merges resourceTypeRequirements, memoryTypeRequirements and resourceStateRequirements into a single table of usage requirements.
+        */
+        constexpr std::array<resource_usage_requirements, resourceUsageRequirementsCount> mergeResourceUsageRequirements() noexcept
+        {
+            std::array<resource_usage_requirements, resourceUsageRequirementsCount> output {};
+            for (uint8_t t = 0; t <= static_cast<uint8_t>(resource_type::MaxEnum); t++)
+            {
+                for (uint8_t m = 0; m <= static_cast<uint8_t>(memory_type::MaxEnum); m++)
+                {
+                    for (uint8_t s = 0; s <= static_cast<uint8_t>(resource_state::MaxEnum); s++)
+                    {
+                        const auto type = static_cast<resource_type>(t);
+                        const auto memoryType = static_cast<memory_type>(m);
+                        const auto state = static_cast<resource_state>(s);
+
+                        const resource_type_requirements& typeRequirements = resourceTypeRequirements[t];
+                        const memory_type_requirements& memoryRequirements = memoryTypeRequirements[m];
+                        const resource_state_requirements& stateRequirements = resourceStateRequirements[s];
+
+                        resource_usage_requirements& requirements = output[resourceUsageRequirementsIndex(type, memoryType, state)];
+                        if ((typeRequirements.memoryTypes & memoryTypeBit(memoryType)) == 0 || (memoryRequirements.initialStates & resourceStateBit(state)) == 0 ||
+                            (stateRequirements.types & resourceTypeBit(type)) == 0 || (stateRequirements.memoryTypes & memoryTypeBit(memoryType)) == 0)
+                        {
+                            requirements = { resource_usage_flag_bits::None, resource_usage_flag_bits::All };
+                            continue;
+                        }
+
+                        requirements.allowedUsage = typeRequirements.validUsage.value & ~memoryRequirements.forbiddenUsage.value & ~stateRequirements.forbiddenUsage.value;
+                        requirements.requiredUsage = stateRequirements.requiredUsage.value | (type != resource_type::Buffer ? stateRequirements.requiredTextureUsage.value : resource_usage_flag_bits::None);
+                    }
+                }
+            }
+            return output;
+        }
+
+        /**
+         * @brief The usage requirements of every combination of resource_type, memory_type and resource_state, indexed by resourceUsageRequirementsIndex().
+        */
+        constexpr std::array<resource_usage_requirements, resourceUsageRequirementsCount> resourceUsageRequirements = mergeResourceUsageRequirements();
+
+        /**
+         * @brief Returns true if desc meets the requirements of its type, memory type and initial state, and the rules that apply to its dimensions and usage.
+         * The type, memory type and initial state are checked with a single lookup in resourceUsageRequirements, so that valid descs are accepted in a few instructions.
+         * Node masks and format support depend on the Adapter and aren't checked.
+         * @note desc.type, desc.memoryType and desc.initialState **must** be less or equal to their MaxEnum.
+        */
+        constexpr bool meetsResourceRequirements(const resource_desc& desc) noexcept
+        {
+            const resource_usage_requirements& usage = resourceUsageRequirements[resourceUsageRequirementsIndex(desc.type, desc.memoryType, desc.initialState)];
+            const resource_type_requirements& type = resourceTypeRequirements[static_cast<size_t>(desc.type)];
+            const auto sampleCount = static_cast<uint8_t>(desc.sampleCount);
+
+            if (!usage.allowedUsage.all(desc.usage) || !desc.usage.all(usage.requiredUsage))
+                return false;
+
+            if (desc.usage.contains(resource_usage_flag_bits::DenyShaderResource) &&
+                (!denyShaderResourceValidUsage.all(desc.usage) || !desc.usage.contains(resource_usage_flag_bits::DepthStencilAttachment)))
+                return false;
+
+            // unsigned wrap around turns each range check into a single comparison
+            if (desc.width - 1u >= maxResourceDimension ||
+                desc.height - type.minHeight > type.maxHeight - type.minHeight ||
+                static_cast<uint32_t>(desc.depthOrArrayLayers - type.minDepthOrArrayLayers) > static_cast<uint32_t>(type.maxDepthOrArrayLayers - type.minDepthOrArrayLayers) ||
+                desc.mipLevels < type.minMipLevels ||
+                sampleCount == 0 || !hasSingleBit(sampleCount) || (type.sampleCounts & sampleCount) != sampleCount)
+                return false;
+
+            if (desc.type == resource_type::Buffer)
+                return true;
+
+            // mip levels and multi-sampling only apply to textures
+            if (desc.sampleCount != sample_count::Count1)
+                return desc.mipLevels == 1 && desc.usage.none(resource_usage_flag_bits::ShaderWrite) &&
+                    desc.usage.any(resource_usage_flag_bits::ColorAttachment | resource_usage_flag_bits::DepthStencilAttachment) && desc.textureFormat != format::Undefined;
+
+            return (desc.mipLevels == 1 || (desc.mipLevels < 32 && (desc.width >> desc.mipLevels) != 0)) && desc.textureFormat != format::Undefined;
+        }
+    }
 }
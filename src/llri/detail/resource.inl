@@ -166,6 +166,71 @@ namespace llri
         return "Invalid format value";
     }
 
+    inline uint32_t format_size(format f)
+    {
+        switch (f)
+        {
+            case format::Undefined:
+                return 0;
+            case format::R8UNorm:
+            case format::R8Norm:
+            case format::R8UInt:
+            case format::R8Int:
+                return 1;
+            case format::RG8UNorm:
+            case format::RG8Norm:
+            case format::RG8UInt:
+            case format::RG8Int:
+            case format::R16UNorm:
+            case format::R16Norm:
+            case format::R16UInt:
+            case format::R16Int:
+            case format::R16Float:
+            case format::D16UNorm:
+                return 2;
+            case format::RGBA8UNorm:
+            case format::RGBA8Norm:
+            case format::RGBA8UInt:
+            case format::RGBA8Int:
+            case format::RGBA8sRGB:
+            case format::BGRA8UNorm:
+            case format::BGRA8sRGB:
+            case format::RGB10A2UNorm:
+            case format::RGB10A2UInt:
+            case format::RG16UNorm:
+            case format::RG16Norm:
+            case format::RG16UInt:
+            case format::RG16Int:
+            case format::RG16Float:
+            case format::R32UInt:
+            case format::R32Int:
+            case format::R32Float:
+            case format::D32Float:
+            case format::D24UNormS8UInt:
+                return 4;
+            case format::RGBA16UNorm:
+            case format::RGBA16Norm:
+            case format::RGBA16UInt:
+            case format::RGBA16Int:
+            case format::RGBA16Float:
+            case format::RG32UInt:
+            case format::RG32Int:
+            case format::RG32Float:
+            case format::D32FloatS8X24UInt:
+                return 8;
+            case format::RGB32UInt:
+            case format::RGB32Int:
+            case format::RGB32Float:
+                return 12;
+            case format::RGBA32UInt:
+            case format::RGBA32Int:
+            case format::RGBA32Float:
+                return 16;
+        }
+
+        return 0;
+    }
+
     inline std::string to_string(sample_count count)
     {
         switch(count)
@@ -262,6 +327,19 @@ namespace llri
         return "Invalid memory_type value";
     }
 
+    inline std::string to_string(resource_sharing_mode mode)
+    {
+        switch(mode)
+        {
+            case resource_sharing_mode::Exclusive:
+                return "Exclusive";
+            case resource_sharing_mode::Concurrent:
+                return "Concurrent";
+        }
+
+        return "Invalid resource_sharing_mode value";
+    }
+
     inline resource_desc Resource::getDesc() const
     {
         return m_desc;
@@ -269,15 +347,30 @@ namespace llri
 
     inline Resource::native_resource* Resource::getNative() const
     {
-        return m_resource;
+        return m_hot->resource;
     }
 
     inline Resource::native_memory* Resource::getNativeMemory() const
     {
-        return m_memory;
+        return m_hot->memory;
+    }
+
+    inline handle<Resource> Resource::getHandle() const
+    {
+        return m_handle;
+    }
+
+    inline MemoryHeap* Resource::getHeap() const
+    {
+        return m_heap;
+    }
+
+    inline uint64_t Resource::getHeapOffset() const
+    {
+        return m_heapOffset;
     }
 
-    constexpr resource_desc resource_desc::buffer(resource_usage_flags usage, memory_type memoryType, resource_state initialState, uint32_t sizeInBytes, uint32_t createNodeMask, uint32_t visibleNodeMask) noexcept
+    constexpr resource_desc resource_desc::buffer(resource_usage_flags usage, memory_type memoryType, resource_state initialState, uint32_t sizeInBytes, uint32_t createNodeMask, uint32_t visibleNodeMask, resource_sharing_mode sharingMode) noexcept
     {
         return {
             createNodeMask, visibleNodeMask,
@@ -285,7 +378,8 @@ namespace llri
             usage, memoryType, initialState,
             sizeInBytes, // width = size
             1, 1, 1, // texture sizes defaulted to 1
-            sample_count::Count1, format::Undefined // these parameters are ignored but we set them to reasonable defaults
+            sample_count::Count1, format::Undefined, // these parameters are ignored but we set them to reasonable defaults
+            sharingMode
         };
     }
 }
@@ -17,6 +17,7 @@ namespace llri
     {
         friend class Device;
         friend class Queue;
+        template<typename, typename> friend class detail::object_pool;
 
     public:
         using native_semaphore = void;
@@ -26,18 +27,32 @@ namespace llri
          *
          * DirectX12: ID3D12Fence*
          * Vulkan: VkSemaphore
+         * Null: nullptr
+         * CPU: an internal object that is signaled when the submission completes
          */
         [[nodiscard]] native_semaphore* getNative() const
         {
             return m_ptr;
         }
+
+        /**
+         * @brief Get the Semaphore's generational handle, which can be resolved through Device::resolve() and is safe to hold on to after the Semaphore is destroyed.
+        */
+        [[nodiscard]] handle<Semaphore> getHandle() const
+        {
+            return m_handle;
+        }
         
     private:
         // Force private constructor/deconstructor so that only create/destroy can manage lifetime
         Semaphore() = default;
         ~Semaphore() = default;
 
+        handle<Semaphore> m_handle;
         native_semaphore* m_ptr = nullptr;
         uint64_t m_counter = 0;
+
+        // set for semaphores created through Device::createExportableSemaphoreEXT()
+        bool m_exportable = false;
     };
 }
@@ -0,0 +1,104 @@
+/**
+ * @file trace.inl
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+#include <llri/llri.hpp> // unnecessary but helps intellisense
+
+namespace llri
+{
+    inline void setTraceEnabled(bool enabled)
+    {
+        detail::m_traceEnabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    inline bool isTraceEnabled()
+    {
+        return detail::m_traceEnabled.load(std::memory_order_relaxed);
+    }
+
+    inline void traceGPUSpan(queue_type queueType, uint8_t queueIndex, std::string_view name, uint64_t beginTimestamp, uint64_t endTimestamp, float timestampPeriod)
+    {
+        const auto begin = static_cast<uint64_t>(static_cast<double>(beginTimestamp) * timestampPeriod);
+        const auto end = static_cast<uint64_t>(static_cast<double>(std::max(beginTimestamp, endTimestamp)) * timestampPeriod);
+
+        std::lock_guard lock(detail::m_traceMutex);
+        detail::m_traceGPUSpans.push_back(detail::trace_gpu_span { queueType, queueIndex, std::string(name), begin, end });
+    }
+
+    inline void clearTrace()
+    {
+        std::lock_guard lock(detail::m_traceMutex);
+        for (auto& buffer : detail::m_traceBuffers)
+        {
+            std::lock_guard bufferLock(buffer->mutex);
+            buffer->spans.clear();
+        }
+
+        detail::m_traceGPUSpans.clear();
+    }
+
+    inline void writeTrace(std::ostream& stream)
+    {
+        constexpr uint32_t cpuPid = 1;
+        constexpr uint32_t gpuPid = 2;
+
+        std::lock_guard lock(detail::m_traceMutex);
+
+        const auto flags = stream.flags();
+        stream << std::fixed;
+        stream << R"({"displayTimeUnit":"ns","traceEvents":[)";
+
+        bool first = true;
+        detail::writeTraceMetadata(stream, first, "process_name", cpuPid, 0, "LLRI CPU");
+        detail::writeTraceMetadata(stream, first, "process_name", gpuPid, 0, "LLRI GPU");
+
+        // the earliest return from Queue::submit() anchors the GPU track to the CPU timeline
+        uint64_t firstSubmit = std::numeric_limits<uint64_t>::max();
+
+        for (auto& buffer : detail::m_traceBuffers)
+        {
+            std::lock_guard bufferLock(buffer->mutex);
+            if (buffer->spans.empty())
+                continue;
+
+            detail::writeTraceMetadata(stream, first, "thread_name", cpuPid, buffer->threadId, "Thread " + std::to_string(buffer->threadId));
+
+            for (const auto& span : buffer->spans)
+            {
+                detail::writeTraceEvent(stream, first, span.name, cpuPid, buffer->threadId, span.begin, span.end);
+
+                if (std::string_view(span.name) == "submit")
+                    firstSubmit = std::min(firstSubmit, span.end);
+            }
+        }
+
+        if (!detail::m_traceGPUSpans.empty())
+        {
+            uint64_t firstGPU = std::numeric_limits<uint64_t>::max();
+            for (const auto& span : detail::m_traceGPUSpans)
+                firstGPU = std::min(firstGPU, span.begin);
+
+            const uint64_t anchor = firstSubmit != std::numeric_limits<uint64_t>::max() ? firstSubmit : 0;
+
+            // all queues share the anchor, so that spans keep their relative position across tracks
+            std::vector<uint32_t> namedTracks;
+            for (const auto& span : detail::m_traceGPUSpans)
+            {
+                const uint32_t track = detail::traceGPUTrack(span.queueType, span.queueIndex);
+                if (!detail::contains(namedTracks, track))
+                {
+                    detail::writeTraceMetadata(stream, first, "thread_name", gpuPid, track, to_string(span.queueType) + " queue " + std::to_string(span.queueIndex));
+                    namedTracks.push_back(track);
+                }
+
+                detail::writeTraceEvent(stream, first, span.name, gpuPid, track, span.begin - firstGPU + anchor, span.end - firstGPU + anchor);
+            }
+        }
+
+        stream << "\n]}\n";
+        stream.flags(flags);
+    }
+}
@@ -19,11 +19,23 @@ namespace llri
             return (mask & (mask - 1)) == 0;
         }
 
+        /**
+         * @brief Returns true if a pair of node masks is valid for an Adapter with nodeCount nodes. A mask of 0 is treated as 1.
+        */
+        constexpr bool meetsNodeMaskRequirements(uint32_t createNodeMask, uint32_t visibleNodeMask, uint8_t nodeCount) noexcept
+        {
+            createNodeMask = createNodeMask == 0 ? 1 : createNodeMask;
+            visibleNodeMask = visibleNodeMask == 0 ? 1 : visibleNodeMask;
+
+            const uint32_t limit = 1u << nodeCount;
+            return hasSingleBit(createNodeMask) & (createNodeMask < limit) & (visibleNodeMask < limit) & ((visibleNodeMask & createNodeMask) == createNodeMask);
+        }
+
         /**
          * @brief Returns true if the container contains the value
         */
         template <typename C, typename T>
-        constexpr bool contains(C container, T value)
+        constexpr bool contains(const C& container, const T& value)
         {
             return std::find(container.begin(), container.end(), value) != container.end();
         }
@@ -32,33 +44,58 @@ namespace llri
 
 #ifdef LLRI_DISABLE_VALIDATION
 #define LLRI_DETAIL_VALIDATION_REQUIRE(param, ret)
+#define LLRI_DETAIL_VALIDATION_REQUIRE_TARGET(target, param, ret)
 #define LLRI_DETAIL_VALIDATION_REQUIRE_ITER(param, i, ret)
+#define LLRI_DETAIL_VALIDATION_REQUIRE_ITER_TARGET(target, param, i, ret)
 #define LLRI_DETAIL_VALIDATION_REQUIRE_IF(condition, param, ret)
-#define LLRI_DETAIL_VALIDATION_REQUIRE_MESSAGE(param, message)
+#define LLRI_DETAIL_VALIDATION_REQUIRE_MESSAGE(param, message, ret)
+
+#define LLRI_DETAIL_VALIDATION_BASIC(level) if constexpr (false)
+#define LLRI_DETAIL_VALIDATION_FULL(level) if constexpr (false)
 
 #else
 #define LLRI_DETAIL_ENABLE_VALIDATION
 
-#define LLRI_DETAIL_VALIDATION_REQUIRE(param, ret) { \
+/**
+ * @brief Guards a block of validation that only runs if level is validation_level::Basic or higher.
+*/
+#define LLRI_DETAIL_VALIDATION_BASIC(level) if ((level) >= validation_level::Basic)
+
+/**
+ * @brief Guards a block of validation that only runs if level is validation_level::Full.
+*/
+#define LLRI_DETAIL_VALIDATION_FULL(level) if ((level) >= validation_level::Full)
+
+/**
+ * @brief Like LLRI_DETAIL_VALIDATION_REQUIRE, but sends the error to target instead of to the calling object's m_messageTarget. Used by functions that aren't members of an object.
+*/
+#define LLRI_DETAIL_VALIDATION_REQUIRE_TARGET(target, param, ret) { \
         /* make sure the expression is executed only once */ \
         bool requireParamResult = param; \
         if (!requireParamResult) \
         { \
-            detail::apiError(__func__, ret, "param " + std::string(#param) + " was false."); \
+            detail::apiError(target, __func__, ret, "param ", #param, " was false."); \
             return ret; \
         } \
     }
 
-#define LLRI_DETAIL_VALIDATION_REQUIRE_ITER(param, i, ret) { \
+#define LLRI_DETAIL_VALIDATION_REQUIRE(param, ret) LLRI_DETAIL_VALIDATION_REQUIRE_TARGET(m_messageTarget, param, ret)
+
+/**
+ * @brief Like LLRI_DETAIL_VALIDATION_REQUIRE_ITER, but sends the error to target instead of to the calling object's m_messageTarget.
+*/
+#define LLRI_DETAIL_VALIDATION_REQUIRE_ITER_TARGET(target, param, i, ret) { \
         /* make sure the expression is executed only once */ \
         bool requireParamResult = param; \
         if (!requireParamResult) \
         { \
-            detail::apiError(__func__, ret, "param " + std::string(#param) + " (where i == " + std::to_string(i) + ") was false."); \
+            detail::apiError(target, __func__, ret, "param ", #param, " (where i == ", i, ") was false."); \
             return ret; \
         } \
     }
 
+#define LLRI_DETAIL_VALIDATION_REQUIRE_ITER(param, i, ret) LLRI_DETAIL_VALIDATION_REQUIRE_ITER_TARGET(m_messageTarget, param, i, ret)
+
 #define LLRI_DETAIL_VALIDATION_REQUIRE_IF(condition, param, ret) { \
         if (condition) \
         { \
@@ -66,7 +103,7 @@ namespace llri
             bool requireParamResult = param; \
             if (!requireParamResult) \
             { \
-                detail::apiError(__func__, ret, std::string(#condition) + " was true and param " + std::string(#param) + " was false."); \
+                detail::apiError(m_messageTarget, __func__, ret, #condition, " was true and param ", #param, " was false."); \
                 return ret; \
             } \
         } \
@@ -77,7 +114,7 @@ namespace llri
         bool requireParamResult = param; \
         if (!requireParamResult) \
         { \
-            detail::callUserCallback(message_severity::Error, message_source::API, message); \
+            detail::callUserCallback(m_messageTarget, message_severity::Error, message_source::API, message); \
             return ret; \
         } \
     }
@@ -85,12 +122,28 @@ namespace llri
 #endif
 
 #ifdef LLRI_DISABLE_IMPLEMENTATION_MESSAGE_POLLING
-#define LLRI_DETAIL_CALL_IMPL(func, messenger) return func;
+#define LLRI_DETAIL_CALL_IMPL(func, messenger) \
+    LLRI_DETAIL_TRACE_SCOPE() \
+    return func;
+#define LLRI_DETAIL_CALL_IMPL_STATISTICS(func, messenger, statistics, call) \
+    LLRI_DETAIL_TRACE_SCOPE() \
+    const auto callBegin = detail::statisticsNow(); \
+    const auto r = func; \
+    (statistics).recordCall(call, callBegin); \
+    return r;
 #define LLRI_DETAIL_POLL_API_MESSAGES(messenger)
 #else
 #define LLRI_DETAIL_CALL_IMPL(func, messenger) \
+    LLRI_DETAIL_TRACE_SCOPE() \
+    const auto r = func; \
+    detail::impl_pollAPIMessages(m_messageTarget, messenger); \
+    return r;
+#define LLRI_DETAIL_CALL_IMPL_STATISTICS(func, messenger, statistics, call) \
+    LLRI_DETAIL_TRACE_SCOPE() \
+    const auto callBegin = detail::statisticsNow(); \
     const auto r = func; \
-    detail::impl_pollAPIMessages(messenger); \
+    (statistics).recordCall(call, callBegin); \
+    detail::impl_pollAPIMessages(m_messageTarget, messenger); \
     return r;
-#define LLRI_DETAIL_POLL_API_MESSAGES(messenger) detail::impl_pollAPIMessages(messenger);
+#define LLRI_DETAIL_POLL_API_MESSAGES(messenger) detail::impl_pollAPIMessages(m_messageTarget, messenger);
 #endif
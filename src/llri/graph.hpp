@@ -0,0 +1,15 @@
+/**
+ * @file graph.hpp
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+#include <llri/llri.hpp>
+
+/**
+ * The render graph is an optional layer on top of LLRI and is thus not included by llri.hpp.
+ * It only uses the public LLRI API, so it works with every implementation.
+ */
+#include <llri/detail/render_graph.hpp>
+#include <llri/detail/render_graph.inl>
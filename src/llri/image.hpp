@@ -0,0 +1,22 @@
+/**
+ * @file image.hpp
+ * Copyright (c) 2021 Leon Brands, Rythe Interactive
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+#include <llri/llri.hpp>
+
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <thread>
+
+/**
+ * The image loader is an optional layer on top of LLRI and is thus not included by llri.hpp.
+ * It decodes images with stb_image, so stb_image.h must be in the include path, and exactly one translation unit must define STB_IMAGE_IMPLEMENTATION before including this file.
+ */
+#include <stb_image.h>
+
+#include <llri/detail/image_loader.hpp>
+#include <llri/detail/image_loader.inl>
@@ -7,14 +7,22 @@
 #pragma once
 #include <cstdint>
 #include <cmath>
+#include <cstring>
 #include <climits>
 #include <limits>
 
 #include <string>
+#include <string_view>
 #include <array>
+#include <algorithm>
 #include <vector>
 #include <iostream> // including iostream fixes std::string issues on osx
 #include <functional>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <chrono>
 
 #include <unordered_set>
 #include <unordered_map>
@@ -40,6 +48,13 @@
   * @note Disabling implementation message polling is not guaranteed to prevent implementations from sending messages through other means. Drivers often have their own way of forwarding messages and it's very possible that messages end up in stdout or visual studio's output window.
   */
 #define LLRI_DISABLE_IMPLEMENTATION_MESSAGE_POLLING
+
+ /**
+  * @def LLRI_ENABLE_TRACING
+  * @brief Defining LLRI_ENABLE_TRACING compiles a trace span into every LLRI call that calls into the implementation.
+  * Spans are only recorded while llri::setTraceEnabled(true) is in effect, and can be exported as Chrome trace event JSON through llri::writeTrace().
+  */
+#define LLRI_ENABLE_TRACING
 #endif
 
 /**
@@ -78,7 +93,7 @@ namespace llri
         */
         Timeout,
         /**
-         * @brief A fence has not yet completed.
+         * @brief A fence or query has not yet completed.
         */
         NotReady,
         /**
@@ -186,6 +201,14 @@ namespace llri
     */
     inline std::string to_string(result r);
 
+    namespace detail
+    {
+        /**
+         * @brief Returns the name of a result value as a string literal, or "Invalid result value" if the value was not recognized as an enum member. Unlike to_string(), this never allocates.
+        */
+        constexpr const char* resultName(result r);
+    }
+
     /**
     * @brief Names the implementation.
     */
@@ -199,10 +222,20 @@ namespace llri
         * @brief Microsoft's DirectX 12 API.
         */
         DirectX12,
+        /**
+        * @brief An implementation that doesn't call into any graphics API. Objects follow LLRI's object model and state machines, but no GPU work is executed.
+        * Useful for measuring the overhead of LLRI itself, and for running applications on machines without a graphics driver.
+        */
+        Null,
+        /**
+        * @brief A reference implementation that doesn't call into any graphics API. Resources live in host memory, and Queues execute transfer commands on worker threads.
+        * Useful for testing the results of transfer work on machines without a graphics driver.
+        */
+        CPU,
         /**
          * @brief The highest value in this enum.
         */
-        MaxEnum = DirectX12
+        MaxEnum = CPU
     };
 
     /**
@@ -222,19 +255,27 @@ namespace llri
 #include <llri/detail/validation.hpp>
 #include <llri/detail/flags.hpp>
 #include <llri/detail/math.hpp>
+#include <llri/detail/pool.hpp>
 
 #include <llri/detail/callback.hpp>
+#include <llri/detail/message_queue.hpp>
+#include <llri/detail/trace.hpp>
+
+// resource.hpp defines the format enums, which adapter.hpp uses to size its format_properties table, and memory_type, which lifetime.hpp uses to count bytes
+#include <llri/detail/resource.hpp>
+#include <llri/detail/memory_heap.hpp>
+#include <llri/detail/lifetime.hpp>
 
 #include <llri/detail/instance.hpp>
 #include <llri/detail/instance_extensions.hpp>
 
 #include <llri/detail/adapter.hpp>
 #include <llri/detail/adapter_extensions.hpp>
+#include <llri/detail/statistics.hpp>
 
 #include <llri/detail/queue.hpp>
 #include <llri/detail/device.hpp>
 
-#include <llri/detail/resource.hpp>
 #include <llri/detail/resource_barrier.hpp>
 
 #include <llri/detail/command_group.hpp>
@@ -242,8 +283,13 @@ namespace llri
 
 #include <llri/detail/fence.hpp>
 #include <llri/detail/semaphore.hpp>
+#include <llri/detail/query_pool.hpp>
+#include <llri/detail/job_scheduler.hpp>
+#include <llri/detail/streaming_uploader.hpp>
 
 #include <llri/detail/surface_ext.hpp>
 #include <llri/detail/swapchain_ext.hpp>
+#include <llri/detail/simulated_timing_ext.hpp>
+#include <llri/detail/external_fd_ext.hpp>
 
 #include <llri/detail/llri.inl>